@@ -0,0 +1,766 @@
+//
+//  Mat-Benchmarks.cpp
+//  ORCAMath Benchmarks
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include "ORCAMath/ORCAMath.h"
+
+using namespace ORCA;
+
+/* Sizes 3 and 4..1024 in powers of two. Cubic operations stop earlier to keep a run short */
+
+static void _matSizes(benchmark::internal::Benchmark* bench) {
+    bench->Arg(3)->RangeMultiplier(2)->Range(4, 1024);
+}
+
+static void _cubicSizes(benchmark::internal::Benchmark* bench) {
+    bench->Arg(3)->RangeMultiplier(2)->Range(4, 256);
+}
+
+/**
+ * Rewrites one element with its own value, which discards sticky compute results
+ * so every iteration of det(), inv() and rref() does the full computation
+ */
+
+template <class T>
+static void _invalidate(Mat<T>& m) {
+    m.set(0, 0, m.at(0, 0));
+}
+
+/* Construction */
+
+static void BM_MatConstruct(benchmark::State& state) {
+    const index_t n = state.range(0);
+    for (auto _ : state) {
+        Mat<double> m(n, n);
+        benchmark::DoNotOptimize(m.data());
+    }
+    state.SetComplexityN(n);
+}
+BENCHMARK(BM_MatConstruct)->Apply(_matSizes);
+
+static void BM_MatConstructZeros(benchmark::State& state) {
+    const index_t n = state.range(0);
+    for (auto _ : state) {
+        Mat<double> m(n, n, fill::zeros);
+        benchmark::DoNotOptimize(m.data());
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * static_cast<int64_t>(sizeof(double)));
+}
+BENCHMARK(BM_MatConstructZeros)->Apply(_matSizes);
+
+static void BM_MatConstructRand(benchmark::State& state) {
+    const index_t n = state.range(0);
+    for (auto _ : state) {
+        Mat<double> m(n, n, fill::rand);
+        benchmark::DoNotOptimize(m.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_MatConstructRand)->Apply(_matSizes);
+
+static void BM_MatConstructRandSeeded(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Rng generator(42);
+    for (auto _ : state) {
+        Mat<double> m(n, n, fill::rand, generator);
+        benchmark::DoNotOptimize(m.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_MatConstructRandSeeded)->Apply(_matSizes);
+
+static void BM_MatConstructRandn(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Rng generator(42);
+    for (auto _ : state) {
+        Mat<double> m(n, n, fill::randn, generator);
+        benchmark::DoNotOptimize(m.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_MatConstructRandn)->Apply(_matSizes);
+
+static void BM_MatCopy(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Mat<double> source(n, n, fill::rand);
+    for (auto _ : state) {
+        Mat<double> m(source);
+        benchmark::DoNotOptimize(m.data());
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * static_cast<int64_t>(sizeof(double)));
+}
+BENCHMARK(BM_MatCopy)->Apply(_matSizes);
+
+/* Cast constructors */
+
+static void BM_MatCastFloatToDouble(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Mat<float> source(n, n, fill::rand);
+    for (auto _ : state) {
+        Mat<double> m(source);
+        benchmark::DoNotOptimize(m.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_MatCastFloatToDouble)->Apply(_matSizes);
+
+static void BM_MatCastIntToDouble(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Mat<int> source(n, n);
+    index_t i, j;
+    for (i = 0; i < n; ++i) {
+        for (j = 0; j < n; ++j) {
+            source.set(i, j, static_cast<int>(i - j));
+        }
+    }
+    for (auto _ : state) {
+        Mat<double> m(source);
+        benchmark::DoNotOptimize(m.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_MatCastIntToDouble)->Apply(_matSizes);
+
+static void BM_MatCastTranspose(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Mat<float> source(n, n, fill::rand);
+    for (auto _ : state) {
+        Mat<double> m(source.t());
+        benchmark::DoNotOptimize(m.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_MatCastTranspose)->Apply(_matSizes);
+
+static void BM_MatTransposeInPlace(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Mat<double> a(n, n, fill::rand);
+    for (auto _ : state) {
+        a.transposeInPlace();
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetBytesProcessed(state.iterations() * n * n * sizeof(double));
+}
+BENCHMARK(BM_MatTransposeInPlace)->Apply(_matSizes);
+
+/* Products */
+
+template <class T>
+static void BM_MatMultiply(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Mat<T> a(n, n, fill::rand);
+    Mat<T> b(n, n, fill::rand);
+    for (auto _ : state) {
+        Mat<T> c = a * b;
+        benchmark::DoNotOptimize(c.data());
+        benchmark::ClobberMemory();
+    }
+    state.counters["FLOPS"] = benchmark::Counter(2.0 * n * n * n, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK_TEMPLATE(BM_MatMultiply, float)->Apply(_matSizes);
+BENCHMARK_TEMPLATE(BM_MatMultiply, double)->Apply(_matSizes);
+BENCHMARK_TEMPLATE(BM_MatMultiply, Real<double>)->Apply(_cubicSizes);
+
+static void BM_MatMultiplyComplex(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Mat<Complex<double>> a(n, n);
+    Mat<Complex<double>> b(n, n);
+    index_t i, j;
+    for (i = 0; i < n; ++i) {
+        for (j = 0; j < n; ++j) {
+            a.set(i, j, Complex<double>((i + j) % 7, (i * j) % 5));
+            b.set(i, j, Complex<double>((i * 3 + j) % 11, (i + 2 * j) % 3));
+        }
+    }
+    for (auto _ : state) {
+        Mat<Complex<double>> c = a * b;
+        benchmark::DoNotOptimize(c.data());
+        benchmark::ClobberMemory();
+    }
+    state.counters["FLOPS"] = benchmark::Counter(8.0 * n * n * n, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_MatMultiplyComplex)->Apply(_cubicSizes);
+
+static void BM_MatMultiplyTransposed(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Mat<double> a(n, n, fill::rand);
+    Mat<double> b(n, n, fill::rand);
+    for (auto _ : state) {
+        Mat<double> c = a.t() * b;
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.counters["FLOPS"] = benchmark::Counter(2.0 * n * n * n, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_MatMultiplyTransposed)->Apply(_cubicSizes);
+
+static void BM_MatMultiplyRightTransposed(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Mat<double> a(n, n, fill::rand);
+    Mat<double> b(n, n, fill::rand);
+    for (auto _ : state) {
+        Mat<double> c = a * b.t();
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.counters["FLOPS"] = benchmark::Counter(2.0 * n * n * n, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_MatMultiplyRightTransposed)->Apply(_cubicSizes);
+
+static void BM_MatVecMultiply(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Mat<double> a(n, n, fill::rand);
+    ColVec<double> x(static_cast<int>(n));
+    index_t i;
+    for (i = 0; i < n; ++i) {
+        x.set(i, 1.0 / (i + 1));
+    }
+    for (auto _ : state) {
+        Mat<double> y = a * x;
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.counters["FLOPS"] = benchmark::Counter(2.0 * n * n, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_MatVecMultiply)->Apply(_matSizes);
+
+static void BM_Gemv(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Mat<double> a(n, n, fill::rand);
+    ColVec<double> x(static_cast<int>(n));
+    ColVec<double> y(static_cast<int>(n));
+    index_t i;
+    for (i = 0; i < n; ++i) {
+        x.set(i, 1.0 / (i + 1));
+    }
+    for (auto _ : state) {
+        gemv(y, a, x);
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.counters["FLOPS"] = benchmark::Counter(2.0 * n * n, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_Gemv)->Apply(_matSizes);
+
+static void BM_MatMultiplyInto(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Mat<double> a(n, n, fill::rand);
+    Mat<double> b(n, n, fill::rand);
+    Mat<double> c(n, n);
+    for (auto _ : state) {
+        multiply(c, a, b);
+        benchmark::DoNotOptimize(c.data());
+        benchmark::ClobberMemory();
+    }
+    state.counters["FLOPS"] = benchmark::Counter(2.0 * n * n * n, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_MatMultiplyInto)->Apply(_cubicSizes);
+
+/* Element-wise arithmetic */
+
+static void BM_MatAdd(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Mat<double> a(n, n, fill::rand);
+    Mat<double> b(n, n, fill::rand);
+    for (auto _ : state) {
+        Mat<double> c = a + b * 2.0 - a;
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_MatAdd)->Apply(_matSizes);
+
+static void BM_MatAddInPlace(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Mat<double> a(n, n, fill::rand);
+    Mat<double> b(n, n, fill::rand);
+    for (auto _ : state) {
+        a += b;
+        a -= b;
+        benchmark::DoNotOptimize(a.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_MatAddInPlace)->Apply(_matSizes);
+
+/* Determinant, inverse and row reduction */
+
+static void BM_MatDet(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Mat<double> a(n, n, fill::rand);
+    for (auto _ : state) {
+        _invalidate(a);
+        benchmark::DoNotOptimize(a.det());
+    }
+    state.SetComplexityN(n);
+}
+BENCHMARK(BM_MatDet)->Apply(_cubicSizes)->Complexity(benchmark::oNCubed);
+
+static void BM_MatDetCached(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Mat<double> a(n, n, fill::rand);
+    benchmark::DoNotOptimize(a.det());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a.det());
+    }
+}
+BENCHMARK(BM_MatDetCached)->Arg(3)->Arg(256);
+
+static void BM_MatInv(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Mat<double> a(n, n, fill::rand);
+    for (auto _ : state) {
+        _invalidate(a);
+        Mat<double> inverse = a.inv();
+        benchmark::DoNotOptimize(inverse.data());
+    }
+    state.SetComplexityN(n);
+}
+BENCHMARK(BM_MatInv)->Apply(_cubicSizes)->Complexity(benchmark::oNCubed);
+
+static void BM_MatRref(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Mat<double> a(n, n, fill::rand);
+    for (auto _ : state) {
+        Mat<double> reduced = a.rref();
+        benchmark::DoNotOptimize(reduced.data());
+    }
+    state.SetComplexityN(n);
+}
+BENCHMARK(BM_MatRref)->Apply(_cubicSizes)->Complexity(benchmark::oNCubed);
+
+/* Factorizations of one symmetric positive-definite matrix. Cholesky and LDLt need about
+ * half the flops of LU */
+
+static void _factorSizes(benchmark::internal::Benchmark* bench) {
+    bench->Arg(64)->Arg(256)->Arg(1000)->Unit(benchmark::kMillisecond);
+}
+
+static Mat<double> _spd(index_t n) {
+    Mat<double> a(n, n, fill::rand);
+    Mat<double> spd = a * a.t();
+    index_t i;
+    for (i = 0; i < n; ++i) {
+        spd.set(i, i, spd.at(i, i) + n);
+    }
+    return spd;
+}
+
+static void BM_FactorLU(benchmark::State& state) {
+    const Mat<double> a = _spd(state.range(0));
+    for (auto _ : state) {
+        LU<double> factors(a);
+        benchmark::DoNotOptimize(factors.L().data());
+    }
+}
+BENCHMARK(BM_FactorLU)->Apply(_factorSizes);
+
+static void BM_FactorChol(benchmark::State& state) {
+    const Mat<double> a = _spd(state.range(0));
+    for (auto _ : state) {
+        Chol<double> factors(a);
+        benchmark::DoNotOptimize(factors.L().data());
+    }
+}
+BENCHMARK(BM_FactorChol)->Apply(_factorSizes);
+
+static void BM_FactorLDLT(benchmark::State& state) {
+    const Mat<double> a = _spd(state.range(0));
+    for (auto _ : state) {
+        LDLT<double> factors(a);
+        benchmark::DoNotOptimize(factors.L().data());
+    }
+}
+BENCHMARK(BM_FactorLDLT)->Apply(_factorSizes);
+
+static void BM_MatLUSolve(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Mat<double> a(n, n, fill::rand);
+    ColVec<double> b(static_cast<int>(n));
+    index_t i;
+    for (i = 0; i < n; ++i) {
+        b.set(i, 1);
+    }
+    LU<double> factors = a.lu();
+    for (auto _ : state) {
+        ColVec<double> x = factors.solve(b);
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.SetComplexityN(n);
+}
+BENCHMARK(BM_MatLUSolve)->Apply(_cubicSizes)->Complexity(benchmark::oNSquared);
+
+/* Vector products */
+
+static void BM_VecDot(benchmark::State& state) {
+    const index_t n = state.range(0);
+    ColVec<double> u(static_cast<int>(n));
+    ColVec<double> v(static_cast<int>(n));
+    index_t i;
+    for (i = 0; i < n; ++i) {
+        u.set(i, i);
+        v.set(i, 1.0 / (i + 1));
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dot(u, v));
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_VecDot)->Apply(_matSizes);
+
+/* Sparse products, five entries per row */
+
+static std::vector<Triplet<double>> _banded(index_t n) {
+    std::vector<Triplet<double>> entries;
+    index_t i, offset;
+    for (i = 0; i < n; ++i) {
+        for (offset = -2; offset <= 2; ++offset) {
+            entries.push_back({i, (i + offset + n) % n, 1.0 / (offset + 3)});
+        }
+    }
+    return entries;
+}
+
+static void BM_SparseMatVec(benchmark::State& state) {
+    const index_t n = state.range(0);
+    SparseMat<double> a(n, n, _banded(n));
+    ColVec<double> x(static_cast<int>(n));
+    index_t i;
+    for (i = 0; i < n; ++i) {
+        x.set(i, 1.0 / (i + 1));
+    }
+    for (auto _ : state) {
+        ColVec<double> y = a * x;
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.nonZeros());
+}
+BENCHMARK(BM_SparseMatVec)->Apply(_matSizes);
+
+static void BM_SparseTransposedMatVec(benchmark::State& state) {
+    const index_t n = state.range(0);
+    SparseMat<double> a(n, n, _banded(n));
+    ColVec<double> x(static_cast<int>(n));
+    index_t i;
+    for (i = 0; i < n; ++i) {
+        x.set(i, 1.0 / (i + 1));
+    }
+    for (auto _ : state) {
+        ColVec<double> y = a.t() * x;
+        benchmark::DoNotOptimize(y.data());
+    }
+    state.SetItemsProcessed(state.iterations() * a.nonZeros());
+}
+BENCHMARK(BM_SparseTransposedMatVec)->Apply(_matSizes);
+
+/* Structured products and solves */
+
+static void BM_DiagMultiply(benchmark::State& state) {
+    const index_t n = state.range(0);
+    DiagMat<double> d(n);
+    Mat<double> b(n, n, fill::ones);
+    index_t i;
+    for (i = 0; i < n; ++i) {
+        d.set(i, 1.0 + i);
+    }
+    for (auto _ : state) {
+        Mat<double> c = d * b;
+        benchmark::DoNotOptimize(c.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n * n);
+}
+BENCHMARK(BM_DiagMultiply)->Apply(_matSizes);
+
+static void BM_TriSolve(benchmark::State& state) {
+    const index_t n = state.range(0);
+    TriMat<double> l(n, triangle::lower);
+    ColVec<double> rhs(static_cast<int>(n));
+    index_t i, j;
+    for (i = 0; i < n; ++i) {
+        for (j = 0; j <= i; ++j) {
+            l.set(i, j, (i == j) ? 2.0 : 1.0 / (i + j + 1));
+        }
+        rhs.set(i, 1.0);
+    }
+    for (auto _ : state) {
+        ColVec<double> solution = l.solve(rhs);
+        benchmark::DoNotOptimize(solution.data());
+    }
+    state.SetComplexityN(n);
+}
+BENCHMARK(BM_TriSolve)->Apply(_matSizes)->Complexity(benchmark::oNSquared);
+
+/* Small temporaries from the heap and from an arena */
+
+static void BM_SmallTemporaries(benchmark::State& state) {
+    Mat<double> a(3, 3, fill::ones);
+    for (auto _ : state) {
+        Mat<double> c = a + a;
+        benchmark::DoNotOptimize(c.data());
+    }
+}
+BENCHMARK(BM_SmallTemporaries);
+
+static void BM_SmallTemporariesArena(benchmark::State& state) {
+    Arena workspace(1 << 12);
+    Mat<double> a(3, 3, fill::ones);
+    for (auto _ : state) {
+        arena::Scope scope(workspace);
+        Mat<double> c = a + a;
+        benchmark::DoNotOptimize(c.data());
+    }
+}
+BENCHMARK(BM_SmallTemporariesArena);
+
+/* Block assembly */
+
+static void BM_BlockAssembly(benchmark::State& state) {
+    Mat<double> inertia(6, 6, fill::zeros);
+    Mat<double> rotational(3, 3, fill::ones);
+    Mat<double> skew(3, 3, fill::ones);
+    for (auto _ : state) {
+        inertia.block(0, 2, 0, 2) = rotational;
+        inertia.block(0, 2, 0, 2) += skew * skew;
+        inertia.block(0, 2, 3, 5) = skew;
+        inertia.block(3, 5, 0, 2) = skew.t();
+        inertia.block(3, 5, 3, 5) = rotational;
+        benchmark::DoNotOptimize(inertia.data());
+    }
+}
+BENCHMARK(BM_BlockAssembly);
+
+/* Many independent small problems, one Mat at a time and as a batch */
+
+static const index_t _problems = 4096;
+
+static void _batchSizes(benchmark::internal::Benchmark* bench) {
+    bench->Arg(3)->Arg(6)->Arg(12);
+}
+
+static MatBatch<double> _randomBatch(index_t n) {
+    MatBatch<double> batch(_problems, n, n);
+    Rng rng(1);
+    index_t i, j;
+    for (i = 0; i < n; ++i) {
+        for (j = 0; j < n; ++j) {
+            rng.uniform(batch.data(i, j), _problems, 0.0, 1.0);
+        }
+    }
+    return batch;
+}
+
+static void BM_MatLoopInv(benchmark::State& state) {
+    const index_t n = state.range(0);
+    std::vector<Mat<double>> a;
+    index_t k;
+    for (k = 0; k < _problems; ++k) {
+        a.push_back(Mat<double>(n, n, fill::rand));
+    }
+    for (auto _ : state) {
+        for (Mat<double>& problem : a) {
+            _invalidate(problem);
+            Mat<double> inverse = problem.inv();
+            benchmark::DoNotOptimize(inverse.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * _problems);
+}
+BENCHMARK(BM_MatLoopInv)->Apply(_batchSizes);
+
+static void BM_MatBatchInv(benchmark::State& state) {
+    const index_t n = state.range(0);
+    const MatBatch<double> a = _randomBatch(n);
+    for (auto _ : state) {
+        MatBatch<double> inverse = inv(a);
+        benchmark::DoNotOptimize(inverse.data());
+    }
+    state.SetItemsProcessed(state.iterations() * _problems);
+}
+BENCHMARK(BM_MatBatchInv)->Apply(_batchSizes);
+
+static void BM_MatLoopDet(benchmark::State& state) {
+    const index_t n = state.range(0);
+    std::vector<Mat<double>> a;
+    index_t k;
+    for (k = 0; k < _problems; ++k) {
+        a.push_back(Mat<double>(n, n, fill::rand));
+    }
+    for (auto _ : state) {
+        for (Mat<double>& problem : a) {
+            _invalidate(problem);
+            benchmark::DoNotOptimize(problem.det());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * _problems);
+}
+BENCHMARK(BM_MatLoopDet)->Apply(_batchSizes);
+
+static void BM_MatBatchDet(benchmark::State& state) {
+    const index_t n = state.range(0);
+    const MatBatch<double> a = _randomBatch(n);
+    for (auto _ : state) {
+        ColVec<double> determinants = det(a);
+        benchmark::DoNotOptimize(determinants.data());
+    }
+    state.SetItemsProcessed(state.iterations() * _problems);
+}
+BENCHMARK(BM_MatBatchDet)->Apply(_batchSizes);
+
+static void BM_MatLoopSolve(benchmark::State& state) {
+    const index_t n = state.range(0);
+    std::vector<Mat<double>> a;
+    index_t k;
+    for (k = 0; k < _problems; ++k) {
+        a.push_back(Mat<double>(n, n, fill::rand));
+    }
+    const Mat<double> b(n, 1, fill::ones);
+    for (auto _ : state) {
+        for (Mat<double>& problem : a) {
+            _invalidate(problem);
+            Mat<double> x = problem.lu().solve(b);
+            benchmark::DoNotOptimize(x.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * _problems);
+}
+BENCHMARK(BM_MatLoopSolve)->Apply(_batchSizes);
+
+static void BM_MatBatchSolve(benchmark::State& state) {
+    const index_t n = state.range(0);
+    const MatBatch<double> a = _randomBatch(n);
+    const MatBatch<double> b(_problems, Mat<double>(n, 1, fill::ones));
+    for (auto _ : state) {
+        MatBatch<double> x = solve(a, b);
+        benchmark::DoNotOptimize(x.data());
+    }
+    state.SetItemsProcessed(state.iterations() * _problems);
+}
+BENCHMARK(BM_MatBatchSolve)->Apply(_batchSizes);
+
+/* Loading a saved n x n table. Text is parsed element by element with full precision,
+ * binary files are read in one call, mapped files are opened and summed in place */
+
+static void _ioSizes(benchmark::internal::Benchmark* bench) {
+    bench->Arg(64)->Arg(512)->Arg(2048);
+}
+
+static const std::string _ioPath = "orca-benchmark-table";
+
+static void BM_LoadText(benchmark::State& state) {
+    const index_t n = state.range(0);
+    const std::string path = _ioPath + ".txt";
+    {
+        std::ofstream out(path);
+        out.precision(17);
+        out << Mat<double>(n, n, fill::rand);
+    }
+    for (auto _ : state) {
+        std::ifstream in(path);
+        Mat<double> table(n, n);
+        double* data = table.data();
+        index_t i;
+        for (i = 0; i < n * n; ++i) {
+            in >> data[i];
+        }
+        benchmark::DoNotOptimize(table.data());
+    }
+    std::remove(path.c_str());
+    state.SetBytesProcessed(state.iterations() * n * n * static_cast<int64_t>(sizeof(double)));
+}
+BENCHMARK(BM_LoadText)->Apply(_ioSizes)->Unit(benchmark::kMicrosecond);
+
+static void BM_LoadBinary(benchmark::State& state) {
+    const index_t n = state.range(0);
+    const std::string path = _ioPath + ".orm";
+    save(path, Mat<double>(n, n, fill::rand));
+    for (auto _ : state) {
+        Mat<double> table = load<double>(path);
+        benchmark::DoNotOptimize(table.data());
+    }
+    std::remove(path.c_str());
+    state.SetBytesProcessed(state.iterations() * n * n * static_cast<int64_t>(sizeof(double)));
+}
+BENCHMARK(BM_LoadBinary)->Apply(_ioSizes)->Unit(benchmark::kMicrosecond);
+
+static void BM_MapBinary(benchmark::State& state) {
+    const index_t n = state.range(0);
+    const std::string path = _ioPath + ".orm";
+    save(path, Mat<double>(n, n, fill::rand));
+    for (auto _ : state) {
+        MappedMat<double> mapped(path);
+        MatView<double> table = mapped.view(0);
+        benchmark::DoNotOptimize(table.data());
+    }
+    std::remove(path.c_str());
+    state.SetBytesProcessed(state.iterations() * n * n * static_cast<int64_t>(sizeof(double)));
+}
+BENCHMARK(BM_MapBinary)->Apply(_ioSizes)->Unit(benchmark::kMicrosecond);
+
+/* Solving the 5-point Poisson system of an n x n grid, densely by LU and sparsely by
+ * conjugate gradient with an incomplete Cholesky preconditioner */
+
+static void _gridSizes(benchmark::internal::Benchmark* bench) {
+    bench->Arg(16)->Arg(32)->Arg(64);
+}
+
+static SparseMat<double> _poisson(index_t side) {
+    std::vector<Triplet<double>> entries;
+    index_t i, j;
+    for (i = 0; i < side; ++i) {
+        for (j = 0; j < side; ++j) {
+            const index_t row = i * side + j;
+            entries.push_back({row, row, 4});
+            if (i > 0) entries.push_back({row, row - side, -1});
+            if (i + 1 < side) entries.push_back({row, row + side, -1});
+            if (j > 0) entries.push_back({row, row - 1, -1});
+            if (j + 1 < side) entries.push_back({row, row + 1, -1});
+        }
+    }
+    return SparseMat<double>(side * side, side * side, entries);
+}
+
+static ColVec<double> _filled(index_t n, double value) {
+    ColVec<double> result(static_cast<int>(n));
+    index_t i;
+    for (i = 0; i < n; ++i) {
+        result.data()[i] = value;
+    }
+    return result;
+}
+
+static void BM_PoissonDenseLU(benchmark::State& state) {
+    const index_t side = state.range(0);
+    if (side > 32) {
+        state.SkipWithError("Dense factorization too slow");
+        return;
+    }
+    const Mat<double> a = _poisson(side).dense();
+    const ColVec<double> b = _filled(side * side, 1);
+    for (auto _ : state) {
+        ColVec<double> x = a.lu().solve(b);
+        benchmark::DoNotOptimize(x.data());
+    }
+}
+BENCHMARK(BM_PoissonDenseLU)->Apply(_gridSizes)->Unit(benchmark::kMicrosecond);
+
+static void BM_PoissonSparseCG(benchmark::State& state) {
+    const index_t side = state.range(0);
+    const SparseMat<double> a = _poisson(side);
+    const ColVec<double> b = _filled(side * side, 1);
+    IterativeOptions<double> options;
+    options.tolerance = 1e-10;
+    for (auto _ : state) {
+        const IncompleteCholesky<double> preconditioner(a);
+        ColVec<double> x = _filled(side * side, 0);
+        IterativeResult<double> result = cg(a, b, x, preconditioner, options);
+        benchmark::DoNotOptimize(result.residual);
+    }
+}
+BENCHMARK(BM_PoissonSparseCG)->Apply(_gridSizes)->Unit(benchmark::kMicrosecond);
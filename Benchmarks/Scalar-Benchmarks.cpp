@@ -0,0 +1,395 @@
+//
+//  Scalar-Benchmarks.cpp
+//  ORCAMath Benchmarks
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include "ORCAMath/ORCAMath.h"
+
+using namespace ORCA;
+
+/* Every benchmark processes a batch of values so loop overhead does not dominate */
+
+static const int _batch = 1024;
+
+/* Quaternions */
+
+static void BM_QuaternionMultiply(benchmark::State& state) {
+    std::vector<Quaternion<double>> q(_batch, Quaternion<double>(0.5, 0.5, 0.5, 0.5));
+    Quaternion<double> r(0.9238795, 0.3826834, 0, 0);
+    for (auto _ : state) {
+        for (Quaternion<double>& value : q) {
+            value = value * r;
+        }
+        benchmark::DoNotOptimize(q.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * _batch);
+}
+BENCHMARK(BM_QuaternionMultiply);
+
+static void BM_QuaternionBatchMultiply(benchmark::State& state) {
+    const index_t n = state.range(0);
+    QuaternionBatch<double> a(n, Quaternion<double>(0.5, 0.5, 0.5, 0.5));
+    Quaternion<double> r(0.9238795, 0.3826834, 0, 0);
+    for (auto _ : state) {
+        a *= r;
+        benchmark::DoNotOptimize(a.component(0));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+    state.counters["FLOPS"] = benchmark::Counter(28.0 * n, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_QuaternionBatchMultiply)->Arg(_batch)->Arg(1 << 16);
+
+static void BM_QuaternionBatchRotate(benchmark::State& state) {
+    const index_t n = state.range(0);
+    QuaternionBatch<double> q(n, Quaternion<double>(0.9238795, 0.3826834, 0, 0));
+    Mat<double> vectors(3, n, fill::ones);
+    for (auto _ : state) {
+        Mat<double> rotated = q.rotate(vectors);
+        benchmark::DoNotOptimize(rotated.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_QuaternionBatchRotate)->Arg(_batch)->Arg(1 << 16);
+
+static void BM_QuaternionRotateSandwich(benchmark::State& state) {
+    Quaternion<double> q(0.9238795, 0.3826834, 0, 0);
+    std::vector<Quaternion<double>> v(_batch, Quaternion<double>(0, 1, 2, 3));
+    for (auto _ : state) {
+        for (Quaternion<double>& value : v) {
+            value = q * value * q.conj();
+        }
+        benchmark::DoNotOptimize(v.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * _batch);
+}
+BENCHMARK(BM_QuaternionRotateSandwich);
+
+static void BM_QuaternionRotateDirect(benchmark::State& state) {
+    Quaternion<double> q(0.9238795, 0.3826834, 0, 0);
+    std::vector<ColVec<double, 3>> v(_batch, ColVec<double, 3>({1, 2, 3}));
+    for (auto _ : state) {
+        for (ColVec<double, 3>& value : v) {
+            value = q.rotate(value);
+        }
+        benchmark::DoNotOptimize(v.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * _batch);
+}
+BENCHMARK(BM_QuaternionRotateDirect);
+
+static void BM_QuaternionRotateCloud(benchmark::State& state) {
+    const index_t n = state.range(0);
+    Quaternion<double> q(0.9238795, 0.3826834, 0, 0);
+    Mat<double> cloud(3, n, fill::ones);
+    for (auto _ : state) {
+        Mat<double> rotated = q.rotate(cloud);
+        benchmark::DoNotOptimize(rotated.data());
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_QuaternionRotateCloud)->Arg(_batch)->Arg(1 << 16);
+
+static void BM_QuaternionSlerp(benchmark::State& state) {
+    Quaternion<double> q1(1, 0, 0, 0);
+    Quaternion<double> q2(0.7071068, 0, 0.7071068, 0);
+    double t = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(slerp(q1, q2, t));
+        t = (t > 1) ? 0 : t + 1e-3;
+    }
+}
+BENCHMARK(BM_QuaternionSlerp);
+
+static void BM_QuaternionSplineSample(benchmark::State& state) {
+    const index_t n = state.range(0);
+    std::vector<double> times = {0, 1, 2, 3};
+    std::vector<Quaternion<double>> keyframes = {Quaternion<double>(1, 0, 0, 0), Quaternion<double>(0.7071068, 0, 0.7071068, 0),
+                                                 Quaternion<double>(0.5, 0.5, 0.5, 0.5), Quaternion<double>(0, 0, 0, 1)};
+    QuaternionSpline<double> spline(times, keyframes);
+    for (auto _ : state) {
+        QuaternionBatch<double> samples = spline.sample(0.0, 3.0 / n, n);
+        benchmark::DoNotOptimize(samples.component(0));
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_QuaternionSplineSample)->Arg(_batch)->Arg(1 << 16);
+
+/* Complex numbers */
+
+static void BM_ComplexSqrt(benchmark::State& state) {
+    std::vector<Complex<double>> z(_batch);
+    int i;
+    for (i = 0; i < _batch; ++i) {
+        z[i] = Complex<double>(i - _batch / 2, i + 1);
+    }
+    for (auto _ : state) {
+        for (const Complex<double>& value : z) {
+            benchmark::DoNotOptimize(sqrt(value));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * _batch);
+}
+BENCHMARK(BM_ComplexSqrt);
+
+static void BM_ComplexVecSqrt(benchmark::State& state) {
+    const index_t n = state.range(0);
+    ComplexVec<double> z(n);
+    index_t i;
+    for (i = 0; i < n; ++i) {
+        z.set(i, Complex<double>(i - n / 2, i + 1));
+    }
+    for (auto _ : state) {
+        ComplexVec<double> roots = sqrt(z);
+        benchmark::DoNotOptimize(roots.real());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_ComplexVecSqrt)->Arg(_batch)->Arg(1 << 16);
+
+static void BM_ComplexMultiply(benchmark::State& state) {
+    std::vector<Complex<double>> z(_batch, Complex<double>(0.6, 0.8));
+    Complex<double> w(0.8, -0.6);
+    for (auto _ : state) {
+        for (Complex<double>& value : z) {
+            value = value * w;
+        }
+        benchmark::DoNotOptimize(z.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * _batch);
+}
+BENCHMARK(BM_ComplexMultiply);
+
+static void BM_ComplexVecMultiply(benchmark::State& state) {
+    const index_t n = state.range(0);
+    ComplexVec<double> z(n, Complex<double>(0.6, 0.8));
+    ComplexVec<double> w(n, Complex<double>(0.8, -0.6));
+    for (auto _ : state) {
+        z *= w;
+        benchmark::DoNotOptimize(z.real());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * n);
+    state.counters["FLOPS"] = benchmark::Counter(6.0 * n, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_ComplexVecMultiply)->Arg(_batch)->Arg(1 << 16);
+
+/* Fourier transforms, reported against the conventional 5 n log2(n) operation count */
+
+static void BM_FFTForward(benchmark::State& state) {
+    const index_t n = state.range(0);
+    ComplexVec<double> x(n, Complex<double>(0.5, -0.25));
+    FFTPlan<double>& plan = FFTPlan<double>::cached(n);
+    for (auto _ : state) {
+        plan.forward(x);
+        benchmark::DoNotOptimize(x.real());
+        benchmark::ClobberMemory();
+    }
+    state.counters["FLOPS"] = benchmark::Counter(5.0 * n * std::log2(n), benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_FFTForward)->RangeMultiplier(4)->Range(64, 1 << 16)->Arg(1000)->Arg(10000);
+
+static void BM_RealFFTForward(benchmark::State& state) {
+    const index_t n = state.range(0);
+    std::vector<double> signal(n, 0.5);
+    RealFFTPlan<double>& plan = RealFFTPlan<double>::cached(n);
+    ComplexVec<double> bins(plan.bins());
+    for (auto _ : state) {
+        plan.forward(signal.data(), bins.real(), bins.imag());
+        benchmark::DoNotOptimize(bins.real());
+        benchmark::ClobberMemory();
+    }
+    state.counters["FLOPS"] = benchmark::Counter(2.5 * n * std::log2(n), benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_RealFFTForward)->RangeMultiplier(4)->Range(64, 1 << 16)->Arg(10000);
+
+static void BM_RealFFTBatch(benchmark::State& state) {
+    const index_t n = state.range(0);
+    const index_t count = 64;
+    std::vector<double> signals(count * n, 0.5);
+    RealFFTPlan<double>& plan = RealFFTPlan<double>::cached(n);
+    ComplexVec<double> bins(count * plan.bins());
+    for (auto _ : state) {
+        plan.forward(signals.data(), n, bins.real(), bins.imag(), plan.bins(), count);
+        benchmark::DoNotOptimize(bins.real());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_RealFFTBatch)->Arg(1024)->Arg(10000);
+
+/* Real wrapper overhead, against the same loop on raw doubles */
+
+static void BM_RealArithmetic(benchmark::State& state) {
+    std::vector<Real<double>> x(_batch, Real<double>(1.0));
+    Real<double> a(1.000001);
+    Real<double> b(0.5);
+    for (auto _ : state) {
+        for (Real<double>& value : x) {
+            value = value * a + b;
+        }
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * _batch);
+}
+BENCHMARK(BM_RealArithmetic);
+
+static void BM_DoubleArithmetic(benchmark::State& state) {
+    std::vector<double> x(_batch, 1.0);
+    double a = 1.000001;
+    double b = 0.5;
+    for (auto _ : state) {
+        for (double& value : x) {
+            value = value * a + b;
+        }
+        benchmark::DoNotOptimize(x.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * _batch);
+}
+BENCHMARK(BM_DoubleArithmetic);
+
+/* Spatial algebra. One articulated-body forward dynamics pass over a 30 joint revolute chain,
+ * with the spatial types and with 6x6 dynamic matrices assembled from 3x3 blocks */
+
+static const int _joints = 30;
+
+static Mat<double, 3, 3> _chainInertia() {
+    return Mat<double, 3, 3>({{0.02, 0.001, 0}, {0.001, 0.03, 0.002}, {0, 0.002, 0.025}});
+}
+
+static ColVec<double, 3> _chainOffset(int i) {
+    return ColVec<double, 3>({0.1 + 0.01 * (i % 3), 0.02 * (i % 2), 0.05});
+}
+
+static ColVec<double, 3> _chainCenter(int i) {
+    return ColVec<double, 3>({0.05, 0.01 * (i % 4), 0.02});
+}
+
+static void BM_ForwardDynamicsSpatial(benchmark::State& state) {
+    std::vector<SpatialTransform<double>> tree, up(_joints);
+    std::vector<SpatialInertia<double>> bodies;
+    std::vector<SpatialMotion<double>> bias(_joints);
+    std::vector<Mat<double, 6, 6>> articulated(_joints);
+    std::vector<SpatialForce<double>> pA(_joints), u(_joints);
+    std::vector<double> q(_joints, 0.3), qd(_joints, 0.2), tau(_joints, 0.1), qdd(_joints), d(_joints), torque(_joints);
+    const SpatialMotion<double> axis(0, 0, 1, 0, 0, 0);
+    int i;
+    for (i = 0; i < _joints; ++i) {
+        tree.push_back(SpatialTransform<double>::rotX(0.5 * (i % 2)) * SpatialTransform<double>::fromTranslation(_chainOffset(i)));
+        bodies.push_back(SpatialInertia<double>(1.0 + 0.1 * i, _chainCenter(i), _chainInertia()));
+    }
+    for (auto _ : state) {
+        SpatialMotion<double> v;
+        for (i = 0; i < _joints; ++i) {
+            up[i] = SpatialTransform<double>::rotZ(q[i]) * tree[i];
+            const SpatialMotion<double> vJ = axis * qd[i];
+            v = up[i] * v + vJ;
+            bias[i] = v.cross(vJ);
+            articulated[i] = bodies[i].toMat();
+            pA[i] = v.cross(bodies[i] * v);
+        }
+        for (i = _joints - 1; i >= 0; --i) {
+            u[i] = articulated[i] * axis;
+            d[i] = u[i].at(2);
+            torque[i] = tau[i] - pA[i].at(2);
+            if (i > 0) {
+                const ColVec<double, 6> column = u[i].toVec();
+                const Mat<double, 6, 6> projected = articulated[i] - (column * column.t()) * (1 / d[i]);
+                articulated[i - 1] += up[i].applyInverse(projected);
+                pA[i - 1] += up[i].applyInverse(pA[i] + projected * bias[i] + u[i] * (torque[i] / d[i]));
+            }
+        }
+        SpatialMotion<double> a(0, 0, 0, 0, 0, 9.81);
+        for (i = 0; i < _joints; ++i) {
+            a = up[i] * a + bias[i];
+            qdd[i] = (torque[i] - dot(u[i], a)) / d[i];
+            a += axis * qdd[i];
+        }
+        benchmark::DoNotOptimize(qdd.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * _joints);
+}
+BENCHMARK(BM_ForwardDynamicsSpatial);
+
+static Mat<double> _skewMat(const ColVec<double, 3>& r) {
+    return Mat<double>({{0, -r.at(2), r.at(1)}, {r.at(2), 0, -r.at(0)}, {-r.at(1), r.at(0), 0}});
+}
+
+static Mat<double> _motionTransformMat(const Mat<double>& e, const ColVec<double, 3>& r) {
+    const Mat<double> zero(3, 3, fill::zeros);
+    const Mat<double> shear = (e * _skewMat(r)) * -1.0;
+    return Mat<double>({{e, zero}, {shear, e}});
+}
+
+static Mat<double> _crossMat(const Mat<double>& v) {
+    const Mat<double> w = _skewMat(ColVec<double, 3>({v.at(0, 0), v.at(1, 0), v.at(2, 0)}));
+    const Mat<double> l = _skewMat(ColVec<double, 3>({v.at(3, 0), v.at(4, 0), v.at(5, 0)}));
+    return Mat<double>({{w, Mat<double>(3, 3, fill::zeros)}, {l, w}});
+}
+
+static void BM_ForwardDynamicsMat(benchmark::State& state) {
+    const Mat<double> zero6(6, 6, fill::zeros), zero1(6, 1, fill::zeros);
+    std::vector<Mat<double>> tree, inertia, up(_joints, zero6), articulated(_joints, zero6);
+    std::vector<Mat<double>> bias(_joints, zero1), pA(_joints, zero1), u(_joints, zero1);
+    std::vector<double> q(_joints, 0.3), qd(_joints, 0.2), tau(_joints, 0.1), qdd(_joints), d(_joints), torque(_joints);
+    Mat<double> axis(6, 1, fill::zeros);
+    axis.set(2, 0, 1);
+    int i;
+    for (i = 0; i < _joints; ++i) {
+        tree.push_back(_motionTransformMat(Mat<double>(SpatialTransform<double>::rotX(0.5 * (i % 2)).rotation()), ColVec<double, 3>(fill::zeros)) * _motionTransformMat(Mat<double>(3, 3, fill::eye), _chainOffset(i)));
+        inertia.push_back(Mat<double>(SpatialInertia<double>(1.0 + 0.1 * i, _chainCenter(i), _chainInertia()).toMat()));
+    }
+    for (auto _ : state) {
+        Mat<double> v(6, 1, fill::zeros);
+        for (i = 0; i < _joints; ++i) {
+            const double c = std::cos(q[i]), s = std::sin(q[i]);
+            const Mat<double> rotation({{c, s, 0}, {-s, c, 0}, {0, 0, 1}});
+            up[i] = _motionTransformMat(rotation, ColVec<double, 3>(fill::zeros)) * tree[i];
+            const Mat<double> vJ = axis * qd[i];
+            v = up[i] * v + vJ;
+            const Mat<double> cross = _crossMat(v);
+            bias[i] = cross * vJ;
+            articulated[i] = inertia[i];
+            pA[i] = (cross.t() * -1.0) * (inertia[i] * v);
+        }
+        for (i = _joints - 1; i >= 0; --i) {
+            u[i] = articulated[i] * axis;
+            d[i] = u[i].at(2, 0);
+            torque[i] = tau[i] - pA[i].at(2, 0);
+            if (i > 0) {
+                const Mat<double> projected = articulated[i] - (u[i] * u[i].t()) * (1 / d[i]);
+                const Mat<double> pa = pA[i] + projected * bias[i] + u[i] * (torque[i] / d[i]);
+                articulated[i - 1] += up[i].t() * projected * up[i];
+                pA[i - 1] += up[i].t() * pa;
+            }
+        }
+        Mat<double> a(6, 1, fill::zeros);
+        a.set(5, 0, 9.81);
+        for (i = 0; i < _joints; ++i) {
+            a = up[i] * a + bias[i];
+            qdd[i] = (torque[i] - (u[i].t() * a).at(0, 0)) / d[i];
+            a += axis * qdd[i];
+        }
+        benchmark::DoNotOptimize(qdd.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * _joints);
+}
+BENCHMARK(BM_ForwardDynamicsMat);
@@ -0,0 +1,277 @@
+//
+//  Arena.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef Arena_h
+#define Arena_h
+
+/* Includes for Arena.h */
+
+#include <cstddef>  // Included for std::size_t
+#include <cstdint>  // Included for std::uintptr_t
+#include <cstdlib>  // Included for malloc and free
+#include "Instrument.h"   // Included for allocation counters
+
+/* Alignment of every block of matrix and vector storage, wide enough for any SIMD register */
+
+#ifndef ORCA_STORAGE_ALIGNMENT
+#define ORCA_STORAGE_ALIGNMENT (64)
+#endif
+
+namespace ORCA {
+
+/**
+ * Bump pointer arena for matrix and vector storage.
+ * Allocation advances an offset into one fixed buffer and never takes a lock or calls malloc;
+ * individual blocks are never freed, the whole arena is rewound at once by arena::Scope
+ * or reset(). Requests that do not fit are served from the heap and counted in overflows()
+ */
+
+class Arena {
+private:
+    /* Below are private members of the Arena class */
+    char* _buffer = nullptr;        // Start of the buffer
+    std::size_t _capacity = 0;      // Size of the buffer in bytes
+    std::size_t _used = 0;          // Offset of the first free byte
+    std::size_t _peak = 0;          // Largest offset reached
+    std::size_t _overflows = 0;     // Requests that did not fit
+    bool _owner = false;            // True if the buffer was allocated by the arena
+
+public:
+
+    /* Below are public constructors for the Arena class */
+
+    /**
+     * Constructs an arena with its own buffer, allocated once here
+     * @param bytes Size of the buffer
+     */
+
+    explicit Arena(std::size_t bytes) {
+        this->_buffer = static_cast<char*>(malloc(bytes));
+        this->_capacity = (this->_buffer != nullptr) ? bytes : 0;
+        this->_owner = true;
+    } /* explicit Arena(std::size_t bytes) */
+
+    /**
+     * Constructs an arena over a caller provided buffer, such as static storage, which must outlive it
+     * @param buffer Start of the buffer
+     * @param bytes Size of the buffer
+     */
+
+    Arena(void* buffer, std::size_t bytes) : _buffer(static_cast<char*>(buffer)), _capacity(bytes) {
+    } /* Arena(void* buffer, std::size_t bytes) */
+
+    Arena(const Arena&) = delete;
+    Arena& operator = (const Arena&) = delete;
+
+    ~Arena() {
+        if (this->_owner) {
+            free(this->_buffer);
+        }
+    } /* ~Arena() */
+
+    /* Below are public getters for the Arena class */
+
+    /**
+     * Returns the size of the buffer in bytes
+     */
+
+    std::size_t capacity() const {
+        return this->_capacity;
+    } /* std::size_t capacity() const */
+
+    /**
+     * Returns the number of bytes in use, including alignment padding
+     */
+
+    std::size_t used() const {
+        return this->_used;
+    } /* std::size_t used() const */
+
+    /**
+     * Returns the largest number of bytes that were in use at once, for sizing the buffer
+     */
+
+    std::size_t peak() const {
+        return this->_peak;
+    } /* std::size_t peak() const */
+
+    /**
+     * Returns the number of requests that did not fit and went to the heap
+     */
+
+    std::size_t overflows() const {
+        return this->_overflows;
+    } /* std::size_t overflows() const */
+
+    /* Below are public member functions of the Arena class */
+
+    /**
+     * Releases every block at once. Storage handed out before must no longer be in use
+     */
+
+    void reset() {
+        this->_used = 0;
+    } /* void reset() */
+
+    /**
+     * Returns an aligned block of the given size with header bytes available in front of it,
+     * or nullptr should it not fit
+     * @param bytes Size of the block
+     * @param header Bytes reserved directly before the block
+     */
+
+    void* _allocate(std::size_t bytes, std::size_t header) {
+        const std::uintptr_t start = reinterpret_cast<std::uintptr_t>(this->_buffer) + this->_used + header;
+        const std::uintptr_t aligned = (start + (ORCA_STORAGE_ALIGNMENT - 1)) & ~static_cast<std::uintptr_t>(ORCA_STORAGE_ALIGNMENT - 1);
+        const std::size_t end = static_cast<std::size_t>(aligned - reinterpret_cast<std::uintptr_t>(this->_buffer)) + bytes;
+        if ((this->_buffer == nullptr) || (end > this->_capacity)) {
+            ++this->_overflows;
+            return nullptr;
+        }
+        this->_used = end;
+        this->_peak = (end > this->_peak) ? end : this->_peak;
+        return reinterpret_cast<void*>(aligned);
+    } /* void* _allocate(std::size_t bytes, std::size_t header) */
+
+    /**
+     * Rewinds the arena to an earlier value of used()
+     * @param mark Value of used() to return to
+     */
+
+    void _rewind(std::size_t mark) {
+        this->_used = mark;
+    } /* void _rewind(std::size_t mark) */
+
+}; /* class Arena */
+
+namespace arena {
+
+/**
+ * Returns the arena used by this thread, nullptr when allocations go to the heap
+ */
+
+inline Arena*& _current() {
+    static thread_local Arena* current = nullptr;
+    return current;
+} /* inline Arena*& _current() */
+
+/**
+ * Serves every Mat and Vec allocated on this thread from an arena while in scope, and releases
+ * them all when the scope ends. Matrices created in the scope must not outlive it.
+ * Scopes nest; an inner scope on the same arena only releases what was allocated inside it.
+ * Worker threads of parallel loops keep their own setting
+ */
+
+class Scope {
+private:
+    Arena* _previous;       // Arena restored on destruction
+    Arena& _arena;          // Arena in use
+    std::size_t _mark;      // Used bytes of the arena when the scope began
+public:
+    /**
+     * @param arena Arena to allocate from
+     */
+
+    explicit Scope(Arena& arena) : _previous(_current()), _arena(arena), _mark(arena.used()) {
+        _current() = &arena;
+    } /* explicit Scope(Arena& arena) */
+
+    Scope(const Scope&) = delete;
+    Scope& operator = (const Scope&) = delete;
+
+    ~Scope() {
+        this->_arena._rewind(this->_mark);
+        _current() = this->_previous;
+    } /* ~Scope() */
+}; /* class Scope */
+
+/**
+ * Sends the allocations of this thread to the heap while in scope, for storage that must
+ * outlive the current arena scope such as cached results and matrices created before it
+ */
+
+class _HeapOnly {
+private:
+    Arena* _previous;   // Arena restored on destruction
+public:
+    /**
+     * @param active False to leave the current arena in use
+     */
+
+    explicit _HeapOnly(bool active = true) : _previous(_current()) {
+        if (active) {
+            _current() = nullptr;
+        }
+    } /* explicit _HeapOnly(bool active = true) */
+
+    _HeapOnly(const _HeapOnly&) = delete;
+    _HeapOnly& operator = (const _HeapOnly&) = delete;
+
+    ~_HeapOnly() {
+        _current() = this->_previous;
+    } /* ~_HeapOnly() */
+}; /* class _HeapOnly */
+
+} /* namespace arena */
+
+/* Every block of storage is preceded by the address to free, nullptr for arena blocks */
+
+struct _StorageHeader {
+    void* base;     // Address returned by malloc, or nullptr if the block belongs to an arena
+}; /* struct _StorageHeader */
+
+/**
+ * Allocates aligned storage for matrix elements, from the current arena if there is one and it has room
+ * @param bytes Size of the storage
+ */
+
+inline void* _allocateStorage(std::size_t bytes) {
+    Arena* current = arena::_current();
+    if (current != nullptr) {
+        void* block = current->_allocate(bytes, sizeof(_StorageHeader));
+        if (block != nullptr) {
+            (static_cast<_StorageHeader*>(block) - 1)->base = nullptr;
+            instrument::_countAllocation(bytes, false);
+            return block;
+        }
+    }
+    void* base = malloc(bytes + sizeof(_StorageHeader) + (ORCA_STORAGE_ALIGNMENT - 1));
+    if (base == nullptr) {
+        return nullptr;
+    }
+    const std::uintptr_t start = reinterpret_cast<std::uintptr_t>(base) + sizeof(_StorageHeader);
+    void* block = reinterpret_cast<void*>((start + (ORCA_STORAGE_ALIGNMENT - 1)) & ~static_cast<std::uintptr_t>(ORCA_STORAGE_ALIGNMENT - 1));
+    (static_cast<_StorageHeader*>(block) - 1)->base = base;
+    instrument::_countAllocation(bytes, true);
+    return block;
+} /* inline void* _allocateStorage(std::size_t bytes) */
+
+/**
+ * Frees storage from _allocateStorage. Arena blocks are left for their scope to release
+ * @param block Storage to free
+ */
+
+inline void _freeStorage(void* block) {
+    if (block != nullptr) {
+        free((static_cast<_StorageHeader*>(block) - 1)->base);
+    }
+} /* inline void _freeStorage(void* block) */
+
+/**
+ * Returns true if storage from _allocateStorage belongs to an arena, false if it is on the heap
+ * @param block Storage to check
+ */
+
+inline bool _isArenaStorage(const void* block) {
+    return (block != nullptr) && ((static_cast<const _StorageHeader*>(block) - 1)->base == nullptr);
+} /* inline bool _isArenaStorage(const void* block) */
+
+} /* namespace ORCA */
+
+#endif /* Arena_h */
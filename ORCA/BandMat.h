@@ -0,0 +1,567 @@
+//
+//  BandMat.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef BandMat_h
+#define BandMat_h
+
+/* Includes for BandMat.h */
+
+#include "Except.h"     // Included for ORCA Exceptions
+#include "Fill.h"       // Included for Fill types
+#include "Mat.h"        // Included for Mat class
+#include "Vec.h"        // Included for ColVec class
+#include "LU.h"         // Included for _pivotMagnitude
+#include "Parallel.h"   // Included for threaded products
+#include <algorithm>    // Included for std::min and std::max
+#include <vector>       // Included for band storage
+
+namespace ORCA {
+
+/**
+ * Square banded matrix with kl diagonals below and ku diagonals above the main diagonal.
+ * Row i stores columns i - kl .. i + ku in a row of width kl + ku + 1, so element (i, j) is
+ * _band[i * (kl + ku + 1) + (j - i + kl)]. Products cost O(n (kl + ku)) per dense column and
+ * det(), solve() and inv() use a banded LU factorization with partial pivoting, which costs
+ * O(n kl (kl + ku)) instead of O(n^3)
+ * @tparam T Element type
+ */
+
+template <class T>
+class BandMat {
+private:
+    /* Below are private members of the BandMat class */
+    index_t _n = 0;         // Number of rows and columns
+    index_t _kl = 0;        // Number of diagonals below the main diagonal
+    index_t _ku = 0;        // Number of diagonals above the main diagonal
+    std::vector<T> _band;   // Band rows, kl + ku + 1 elements each
+
+    /**
+     * Banded LU factorization. Row swaps let U grow to kl + ku diagonals above the main
+     * diagonal, so the work rows are kl elements wider than the band. The multipliers of step k
+     * are stored below the diagonal of column k and pivots[k] is the row swapped with k
+     */
+
+    struct _Factorization {
+        index_t width;                  // Elements per work row, 2 kl + ku + 1
+        std::vector<T> work;            // Work rows, element (i, j) at i * width + (j - i + kl)
+        std::vector<index_t> pivots;    // Row swapped with each row
+        int sign = 1;                   // Sign of the row permutation
+        bool singular = false;          // True should a pivot be zero
+    }; /* struct _Factorization */
+
+    /**
+     * Returns the first stored column of a row
+     */
+
+    index_t _rowFirst(index_t row) const {
+        return std::max<index_t>(0, row - this->_kl);
+    } /* index_t _rowFirst(index_t row) const */
+
+    /**
+     * Returns one past the last stored column of a row
+     */
+
+    index_t _rowLast(index_t row) const {
+        return std::min<index_t>(this->_n, row + this->_ku + 1);
+    } /* index_t _rowLast(index_t row) const */
+
+    /**
+     * Returns the number of elements stored per row
+     */
+
+    index_t _width() const {
+        return this->_kl + this->_ku + 1;
+    } /* index_t _width() const */
+
+    /**
+     * Returns true if element (row, col) lies in the band
+     */
+
+    bool _stored(index_t row, index_t col) const {
+        return (col >= row - this->_kl) && (col <= row + this->_ku);
+    } /* bool _stored(index_t row, index_t col) const */
+
+    /**
+     * Factors the matrix into pivoted banded LU form
+     */
+
+    _Factorization _factor() const {
+        const index_t n = this->_n;
+        const index_t kl = this->_kl;
+        const index_t upper = this->_kl + this->_ku;
+        _Factorization f;
+        f.width = kl + upper + 1;
+        f.work.assign(static_cast<std::size_t>(n * f.width), T(0));
+        f.pivots.resize(static_cast<std::size_t>(n));
+        index_t i, j, k;
+        for (i = 0; i < n; ++i) {
+            for (j = this->_rowFirst(i); j < this->_rowLast(i); ++j) {
+                f.work[i * f.width + (j - i + kl)] = this->_band[i * this->_width() + (j - i + kl)];
+            }
+        }
+        auto element = [&](index_t row, index_t col) -> T& {
+            return f.work[row * f.width + (col - row + kl)];
+        };
+        for (k = 0; k < n; ++k) {
+            /* Choose the largest element in the column among the rows the band reaches */
+            const index_t lastRow = std::min<index_t>(n - 1, k + kl);
+            const index_t lastCol = std::min<index_t>(n - 1, k + upper);
+            index_t pivot = k;
+            for (i = k + 1; i <= lastRow; ++i) {
+                if (_pivotMagnitude(element(i, k)) > _pivotMagnitude(element(pivot, k))) {
+                    pivot = i;
+                }
+            }
+            f.pivots[k] = pivot;
+            if (element(pivot, k) == T(0)) {
+                f.singular = true;
+                continue;
+            }
+            if (pivot != k) {
+                for (j = k; j <= lastCol; ++j) {
+                    std::swap(element(k, j), element(pivot, j));
+                }
+                f.sign = -f.sign;
+            }
+            const T pivotInverse = T(1) / element(k, k);
+            for (i = k + 1; i <= lastRow; ++i) {
+                const T multiplier = element(i, k) * pivotInverse;
+                element(i, k) = multiplier;
+                for (j = k + 1; j <= lastCol; ++j) {
+                    element(i, j) = element(i, j) - multiplier * element(k, j);
+                }
+            }
+        }
+        return f;
+    } /* _Factorization _factor() const */
+
+    /**
+     * Overwrites x (n x p, row-major) with the solution of A * x = x from a factorization
+     */
+
+    void _substitute(const _Factorization& f, T* x, index_t ldx, index_t p) const {
+        const index_t n = this->_n;
+        const index_t kl = this->_kl;
+        const index_t upper = this->_kl + this->_ku;
+        if (f.singular) {
+            throw ORCAExcept::SingularMatrixError(); // No unique solution
+        }
+        auto element = [&](index_t row, index_t col) {
+            return f.work[row * f.width + (col - row + kl)];
+        };
+        index_t i, j, k;
+        /* Forward substitution with the unit lower factor, applying each swap in turn */
+        for (k = 0; k < n; ++k) {
+            T* row = x + k * ldx;
+            if (f.pivots[k] != k) {
+                T* other = x + f.pivots[k] * ldx;
+                for (j = 0; j < p; ++j) {
+                    std::swap(row[j], other[j]);
+                }
+            }
+            const index_t lastRow = std::min<index_t>(n - 1, k + kl);
+            for (i = k + 1; i <= lastRow; ++i) {
+                const T multiplier = element(i, k);
+                T* target = x + i * ldx;
+                for (j = 0; j < p; ++j) {
+                    target[j] = target[j] - multiplier * row[j];
+                }
+            }
+        }
+        /* Back substitution with the upper factor */
+        for (i = n - 1; i >= 0; --i) {
+            T* target = x + i * ldx;
+            const index_t lastCol = std::min<index_t>(n - 1, i + upper);
+            for (k = i + 1; k <= lastCol; ++k) {
+                const T value = element(i, k);
+                const T* source = x + k * ldx;
+                for (j = 0; j < p; ++j) {
+                    target[j] = target[j] - value * source[j];
+                }
+            }
+            const T pivotInverse = T(1) / element(i, i);
+            for (j = 0; j < p; ++j) {
+                target[j] = target[j] * pivotInverse;
+            }
+        }
+    } /* void _substitute(const _Factorization& f, T* x, index_t ldx, index_t p) const */
+
+public:
+
+    /* Below are public constructors for the BandMat class */
+
+    /**
+     * Constructs an n x n banded matrix of zeros
+     * @param n Number of rows and columns
+     * @param kl Number of diagonals below the main diagonal
+     * @param ku Number of diagonals above the main diagonal
+     */
+
+    BandMat(index_t n, index_t kl, index_t ku) : _n(n), _kl(kl), _ku(ku) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((n < 0) || (kl < 0) || (ku < 0) || (kl >= std::max<index_t>(n, 1)) || (ku >= std::max<index_t>(n, 1))) {
+            throw ORCAExcept::BadDimensionsError(); // Negative dimensions or a band wider than the matrix
+        }
+#endif
+#ifndef ORCA_DISABLE_EMPTY_CHECKS
+        if (n == 0) {
+            throw ORCAExcept::EmptyElementError(); // Zero rows or columns
+        }
+#endif
+        this->_band.assign(static_cast<std::size_t>(n * this->_width()), T(0));
+    } /* BandMat(index_t n, index_t kl, index_t ku) */
+
+    /**
+     * Constructs a banded matrix from the band of a square dense matrix.
+     * Elements outside the band are ignored
+     * @param dense Square dense matrix
+     * @param kl Number of diagonals below the main diagonal
+     * @param ku Number of diagonals above the main diagonal
+     */
+
+    BandMat(const Mat<T>& dense, index_t kl, index_t ku) : BandMat(dense.rows(), kl, ku) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (dense.rows() != dense.cols()) {
+            throw ORCAExcept::BadDimensionsError(); // Banded matrices are square
+        }
+#endif
+        index_t i, j;
+        for (i = 0; i < this->_n; ++i) {
+            for (j = this->_rowFirst(i); j < this->_rowLast(i); ++j) {
+                this->_band[i * this->_width() + (j - i + this->_kl)] = dense.at(i, j);
+            }
+        }
+    } /* BandMat(const Mat<T>& dense, index_t kl, index_t ku) */
+
+    /* Below are public getters and setters for the BandMat class */
+
+    /**
+     * Returns the number of rows in the matrix
+     */
+
+    index_t rows() const {
+        return this->_n;
+    } /* index_t rows() const */
+
+    /**
+     * Returns the number of columns in the matrix
+     */
+
+    index_t cols() const {
+        return this->_n;
+    } /* index_t cols() const */
+
+    /**
+     * Returns the number of diagonals below the main diagonal
+     */
+
+    index_t lower() const {
+        return this->_kl;
+    } /* index_t lower() const */
+
+    /**
+     * Returns the number of diagonals above the main diagonal
+     */
+
+    index_t upper() const {
+        return this->_ku;
+    } /* index_t upper() const */
+
+    /**
+     * Returns the element at the specified index, zero outside the band
+     * @param row Element Row Index
+     * @param col Element Column Index
+     */
+
+    T at(index_t row, index_t col) const {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if ((row < 0) || (row >= this->_n) || (col < 0) || (col >= this->_n)) {
+            throw ORCAExcept::OutOfBoundsError(); // Either negative indexing or over indexing
+        }
+#endif
+        return this->_stored(row, col) ? this->_band[row * this->_width() + (col - row + this->_kl)] : T(0);
+    } /* T at(index_t row, index_t col) const */
+
+    /**
+     * Sets the element at the specified index.
+     * An ORCA_OUT_OF_BOUNDS exception is thrown should the index lie outside the band
+     * @param row Element Row Index
+     * @param col Element Column Index
+     * @param elem Element Value
+     */
+
+    void set(index_t row, index_t col, T elem) {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if ((row < 0) || (row >= this->_n) || (col < 0) || (col >= this->_n) || !this->_stored(row, col)) {
+            throw ORCAExcept::OutOfBoundsError(); // Outside the matrix or its band
+        }
+#endif
+        this->_band[row * this->_width() + (col - row + this->_kl)] = elem;
+    } /* void set(index_t row, index_t col, T elem) */
+
+    /**
+     * Returns the band rows, kl + ku + 1 entries per row. Entries outside the matrix are zero
+     */
+
+    const T* data() const {
+        return this->_band.data();
+    } /* const T* data() const */
+
+    /* Below are public member functions of the BandMat class */
+
+    /**
+     * Returns a dense copy of the matrix
+     */
+
+    Mat<T> dense() const {
+        Mat<T> result(this->_n, this->_n, fill::zeros);
+        T* c = result.data();
+        index_t i, j;
+        for (i = 0; i < this->_n; ++i) {
+            for (j = this->_rowFirst(i); j < this->_rowLast(i); ++j) {
+                c[i * result.stride() + j] = this->_band[i * this->_width() + (j - i + this->_kl)];
+            }
+        }
+        return result;
+    } /* Mat<T> dense() const */
+
+    /**
+     * Returns the determinant, the signed product of the banded LU pivots
+     */
+
+    T det() const {
+        const _Factorization f = this->_factor();
+        if (f.singular) {
+            return T(0);
+        }
+        T result = T(f.sign);
+        index_t i;
+        for (i = 0; i < this->_n; ++i) {
+            result = result * f.work[i * f.width + this->_kl];
+        }
+        return result;
+    } /* T det() const */
+
+    /**
+     * Solves A * x = b for every column of b.
+     * An ORCA_SINGULAR_MATRIX exception is thrown should the matrix be singular
+     * @param b Right hand sides
+     */
+
+    Mat<T> solve(const Mat<T>& b) const {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (b.rows() != this->_n) {
+            throw ORCAExcept::BadDimensionsError(); // Right hand side does not match
+        }
+#endif
+        Mat<T> x(b);
+        this->_substitute(this->_factor(), x.data(), x.stride(), x.cols());
+        return x;
+    } /* Mat<T> solve(const Mat<T>& b) const */
+
+    /**
+     * Solves A * x = b.
+     * An ORCA_SINGULAR_MATRIX exception is thrown should the matrix be singular
+     * @param b Right hand side
+     */
+
+    ColVec<T> solve(const ColVec<T>& b) const {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (b.rows() != this->_n) {
+            throw ORCAExcept::BadDimensionsError(); // Right hand side does not match
+        }
+#endif
+        ColVec<T> x(b);
+        this->_substitute(this->_factor(), x.data(), x.stride(), 1);
+        return x;
+    } /* ColVec<T> solve(const ColVec<T>& b) const */
+
+    /**
+     * Returns the inverse, which is dense in general.
+     * An ORCA_SINGULAR_MATRIX exception is thrown should the matrix be singular
+     */
+
+    Mat<T> inv() const {
+        return this->solve(Mat<T>(this->_n, this->_n, fill::eye));
+    } /* Mat<T> inv() const */
+
+    /**
+     * Computes C = A * B for a dense row-major B (p columns) into a dense row-major C
+     */
+
+    void _multiply(const T* b, index_t ldb, index_t p, T* c, index_t ldc) const {
+        _parallelFor(0, this->_n, this->_n * this->_width() * p, [&](index_t first, index_t last) {
+            index_t i, k, j;
+            for (i = first; i < last; ++i) {
+                const T* band = this->_band.data() + i * this->_width();
+                T* out = c + i * ldc;
+                if (p == 1) {
+                    /* Vector products accumulate each row in a register */
+                    T sum = T(0);
+                    for (k = this->_rowFirst(i); k < this->_rowLast(i); ++k) {
+                        sum = sum + band[k - i + this->_kl] * b[k * ldb];
+                    }
+                    out[0] = sum;
+                    continue;
+                }
+                for (j = 0; j < p; ++j) {
+                    out[j] = T(0);
+                }
+                for (k = this->_rowFirst(i); k < this->_rowLast(i); ++k) {
+                    const T scale = band[k - i + this->_kl];
+                    const T* source = b + k * ldb;
+                    for (j = 0; j < p; ++j) {
+                        out[j] = out[j] + scale * source[j];
+                    }
+                }
+            }
+        });
+    } /* void _multiply(const T* b, index_t ldb, index_t p, T* c, index_t ldc) const */
+
+    /**
+     * Computes C = B * A for a dense row-major B (m rows) into a dense row-major C
+     */
+
+    void _multiplyLeft(const T* b, index_t ldb, index_t m, T* c, index_t ldc) const {
+        _parallelFor(0, m, this->_n * this->_width() * m, [&](index_t first, index_t last) {
+            index_t i, k, j;
+            for (i = first; i < last; ++i) {
+                T* out = c + i * ldc;
+                for (j = 0; j < this->_n; ++j) {
+                    out[j] = T(0);
+                }
+                for (k = 0; k < this->_n; ++k) {
+                    const T scale = b[i * ldb + k];
+                    const T* band = this->_band.data() + k * this->_width();
+                    for (j = this->_rowFirst(k); j < this->_rowLast(k); ++j) {
+                        out[j] = out[j] + scale * band[j - k + this->_kl];
+                    }
+                }
+            }
+        });
+    } /* void _multiplyLeft(const T* b, index_t ldb, index_t m, T* c, index_t ldc) const */
+
+}; /* class BandMat */
+
+/* Banded matrices are not scalars to the element-wise operators of Mat */
+
+template <class T>
+struct _matrixLike<BandMat<T>> : std::true_type {};
+
+/* Below are the overloaded math operators for the BandMat class */
+
+/**
+ * Banded matrix times dense matrix
+ * @param a Banded matrix
+ * @param b Dense matrix
+ * @return Dense product
+ */
+
+template <class T>
+Mat<T> operator * (const BandMat<T>& a, const Mat<T>& b) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (a.cols() != b.rows()) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions do not agree
+    }
+#endif
+    if (!b.isDense()) {
+        return a * Mat<T>(b); // Views are materialized first
+    }
+    Mat<T> result(a.rows(), b.cols());
+    a._multiply(b.data(), b.stride(), b.cols(), result.data(), result.stride());
+    return result;
+} /* Mat<T> operator * (const BandMat<T>& a, const Mat<T>& b) */
+
+/**
+ * Banded matrix times dense column vector
+ * @param a Banded matrix
+ * @param x Dense vector
+ * @return Dense product
+ */
+
+template <class T>
+ColVec<T> operator * (const BandMat<T>& a, const ColVec<T>& x) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (a.cols() != x.rows()) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions do not agree
+    }
+#endif
+    if (!x.isDense()) {
+        return a * ColVec<T>(x); // Views are materialized first
+    }
+    ColVec<T> result(static_cast<int>(a.rows()));
+    a._multiply(x.data(), x.stride(), 1, result.data(), result.stride());
+    return result;
+} /* ColVec<T> operator * (const BandMat<T>& a, const ColVec<T>& x) */
+
+/**
+ * Dense matrix times banded matrix
+ * @param b Dense matrix
+ * @param a Banded matrix
+ * @return Dense product
+ */
+
+template <class T>
+Mat<T> operator * (const Mat<T>& b, const BandMat<T>& a) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (b.cols() != a.rows()) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions do not agree
+    }
+#endif
+    if (!b.isDense()) {
+        return Mat<T>(b) * a; // Views are materialized first
+    }
+    Mat<T> result(b.rows(), a.cols());
+    a._multiplyLeft(b.data(), b.stride(), b.rows(), result.data(), result.stride());
+    return result;
+} /* Mat<T> operator * (const Mat<T>& b, const BandMat<T>& a) */
+
+/* Below are nonmember functions for the BandMat class */
+
+/**
+ * Returns the determinant of a banded matrix
+ * @param _m1 Banded matrix
+ */
+
+template <class T>
+T det(const BandMat<T>& _m1) {
+    return _m1.det();
+} /* T det(const BandMat<T>& _m1) */
+
+/**
+ * Returns the inverse of a banded matrix
+ * @param _m1 Banded matrix
+ */
+
+template <class T>
+Mat<T> inv(const BandMat<T>& _m1) {
+    return _m1.inv();
+} /* Mat<T> inv(const BandMat<T>& _m1) */
+
+/**
+ * Returns a dense copy of a banded matrix
+ * @param _m1 Banded matrix
+ */
+
+template <class T>
+Mat<T> dense(const BandMat<T>& _m1) {
+    return _m1.dense();
+} /* Mat<T> dense(const BandMat<T>& _m1) */
+
+/* Below are overloaded stream operators for the BandMat class */
+
+template <class T>
+std::ostream& operator<<(std::ostream& os, const BandMat<T>& m) {
+    os << m.dense();
+    return os;
+} /* std::ostream& operator<<(std::ostream& os, const BandMat<T>& m) */
+
+} /* namespace ORCA */
+
+#endif /* BandMat_h */
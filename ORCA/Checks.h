@@ -0,0 +1,77 @@
+//
+//  Checks.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef Checks_h
+#define Checks_h
+
+/* Includes for Checks.h */
+
+#include "Except.h" // Included for ORCA Exceptions
+
+namespace ORCA {
+
+namespace checks {
+
+/**
+ * Selects the run time checks an operation performs. The flag is a compile time constant and
+ * the checks test it with if constexpr, so a disabled check compiles to no code
+ * @tparam Bounds Index checks
+ */
+
+template <bool Bounds>
+struct Policy {
+    static constexpr bool bounds = Bounds;
+}; /* struct Policy */
+
+/* Below is the policy selected by ORCA_DISABLE_BOUNDS_CHECKS, used by at() and set().
+ * The macro must agree across the translation units of a program, because the class templates
+ * are instantiated with the same names everywhere. Inner loops that have already validated
+ * their indices call unchecked_at() and unchecked_set() instead */
+
+#ifdef ORCA_DISABLE_BOUNDS_CHECKS
+constexpr bool _bounds = false;
+#else
+constexpr bool _bounds = true;
+#endif
+
+typedef Policy<_bounds> Default;   // Checks selected by the macros
+
+} /* namespace checks */
+
+/**
+ * Throws when (row, col) lies outside a rows x cols matrix and the policy checks bounds
+ * @tparam P Check policy
+ */
+
+template <class P>
+void _checkIndex(index_t row, index_t col, index_t rows, index_t cols) {
+    if constexpr (P::bounds) {
+        if ((row < 0) || (row >= rows) || (col < 0) || (col >= cols)) {
+            throw ORCAExcept::OutOfBoundsError(); // Either negative indexing or over indexing
+        }
+    }
+} /* void _checkIndex(index_t row, index_t col, index_t rows, index_t cols) */
+
+/**
+ * Throws when index lies outside a vector of the given length and the policy checks bounds
+ * @tparam P Check policy
+ */
+
+template <class P>
+void _checkIndex(index_t index, index_t length) {
+    if constexpr (P::bounds) {
+        if ((index < 0) || (index >= length)) {
+            throw ORCAExcept::OutOfBoundsError(); // Attempting to index out of bounds
+        }
+    }
+} /* void _checkIndex(index_t index, index_t length) */
+
+} /* namespace ORCA */
+
+#endif /* Checks_h */
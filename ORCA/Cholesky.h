@@ -0,0 +1,743 @@
+//
+//  Cholesky.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef Cholesky_h
+#define Cholesky_h
+
+/* Includes for Cholesky.h */
+
+#include "Except.h"     // Included for ORCA Exceptions
+#include "Mat.h"        // Included for Mat class
+#include "Vec.h"        // Included for ColVec class
+#include "Gemm.h"       // Included for the blocked trailing update
+#include <cmath>        // Included for std::sqrt
+
+/* Matrices larger than this are factored in blocks of this many columns */
+
+#ifndef ORCA_CHOLESKY_BLOCK
+#define ORCA_CHOLESKY_BLOCK 64
+#endif
+
+namespace ORCA {
+
+/* Factorizations of symmetric positive-definite matrices.
+ * Only the lower triangle of the input is read, so the upper triangle may hold anything.
+ * Both cost about n^3 / 3 multiply-adds, half of an LU factorization */
+
+/**
+ * Unblocked Cholesky factorization of the n x n lower triangle stored at a.
+ * On return the lower triangle holds L with A = L * Lt
+ * @param a First element of the matrix
+ * @param ld Row stride
+ * @param n Dimension
+ */
+
+template <class T>
+void _cholUnblocked(T* a, index_t ld, index_t n) {
+    using std::sqrt;
+    index_t i, j, k;
+    for (j = 0; j < n; ++j) {
+        T* rowJ = a + j * ld;
+        T diagonal = rowJ[j];
+        for (k = 0; k < j; ++k) {
+            diagonal = diagonal - rowJ[k] * rowJ[k];
+        }
+        if (!(diagonal > T(0))) {
+            throw ORCAExcept::NotPositiveDefiniteError(); // Leading minor is not positive
+        }
+        diagonal = sqrt(diagonal);
+        rowJ[j] = diagonal;
+        const T diagonalInverse = T(1) / diagonal;
+        for (i = j + 1; i < n; ++i) {
+            T* rowI = a + i * ld;
+            T sum = rowI[j];
+            for (k = 0; k < j; ++k) {
+                sum = sum - rowI[k] * rowJ[k];
+            }
+            rowI[j] = sum * diagonalInverse;
+        }
+    }
+} /* void _cholUnblocked(T* a, index_t ld, index_t n) */
+
+/**
+ * Subtracts A * Bt from the lower triangle of the m x m matrix C, for the trailing updates of
+ * the blocked factorizations. The product is formed in column blocks of ORCA_CHOLESKY_BLOCK,
+ * each from its diagonal down, so the upper triangle costs nothing but the diagonal blocks.
+ * For float and double the blocks go through the GEMM kernel
+ * @param m Rows of A, B and C
+ * @param k Columns of A and B
+ * @param a A storage, row-major
+ * @param lda Row stride of A
+ * @param b B storage, row-major
+ * @param ldb Row stride of B
+ * @param c C storage, row-major
+ * @param ldc Row stride of C
+ * @param scratch At least m * ORCA_CHOLESKY_BLOCK elements, for float and double
+ */
+
+template <class T>
+void _lowerUpdate(index_t m, index_t k, const T* a, index_t lda, const T* b, index_t ldb, T* c, index_t ldc, T* scratch) {
+    constexpr index_t NB = ORCA_CHOLESKY_BLOCK;
+    index_t jb, i, j, p;
+    for (jb = 0; jb < m; jb += NB) {
+        const index_t width = (m - jb < NB) ? (m - jb) : NB;
+        const index_t rows = m - jb;
+        T* block = c + jb * ldc + jb;
+        if constexpr (_hasGemm<T>()) {
+            _gemm(rows, width, k, a + jb * lda, lda, index_t(1), b + jb * ldb, index_t(1), ldb, scratch, width);
+            for (i = 0; i < rows; ++i) {
+                const index_t last = (i < width) ? (i + 1) : width;
+                T* row = block + i * ldc;
+                const T* source = scratch + i * width;
+                for (j = 0; j < last; ++j) {
+                    row[j] = row[j] - source[j];
+                }
+            }
+        } else {
+            (void)scratch;
+            for (i = 0; i < rows; ++i) {
+                const index_t last = (i < width) ? (i + 1) : width;
+                const T* rowA = a + (jb + i) * lda;
+                for (j = 0; j < last; ++j) {
+                    const T* rowB = b + (jb + j) * ldb;
+                    T sum = T(0);
+                    for (p = 0; p < k; ++p) {
+                        sum = sum + rowA[p] * rowB[p];
+                    }
+                    block[i * ldc + j] = block[i * ldc + j] - sum;
+                }
+            }
+        }
+    }
+} /* void _lowerUpdate(index_t m, index_t k, const T* a, index_t lda, const T* b, index_t ldb, T* c, index_t ldc, T* scratch) */
+
+/**
+ * Blocked right-looking Cholesky factorization. Each step factors a diagonal block,
+ * solves for the panel below it and subtracts the panel's outer product from the
+ * lower triangle of the trailing matrix
+ * @param a First element of the matrix
+ * @param ld Row stride
+ * @param n Dimension
+ */
+
+template <class T>
+void _cholBlocked(T* a, index_t ld, index_t n) {
+    constexpr index_t NB = ORCA_CHOLESKY_BLOCK;
+    _GemmBuffer<T> scratch(_hasGemm<T>() ? (n - NB) * NB : 1); // Shared by every trailing update
+    index_t k, i, j, p;
+    for (k = 0; k < n; k += NB) {
+        const index_t nb = (n - k < NB) ? (n - k) : NB;
+        T* diagonalBlock = a + k * ld + k;
+        _cholUnblocked(diagonalBlock, ld, nb);
+        const index_t m = n - k - nb;
+        if (m == 0) {
+            break;
+        }
+
+        /* Panel: L21 = A21 * inv(L11)t, one row at a time */
+        T* panel = a + (k + nb) * ld + k;
+        for (i = 0; i < m; ++i) {
+            T* row = panel + i * ld;
+            for (j = 0; j < nb; ++j) {
+                const T* rowL = diagonalBlock + j * ld;
+                T sum = row[j];
+                for (p = 0; p < j; ++p) {
+                    sum = sum - row[p] * rowL[p];
+                }
+                row[j] = sum / rowL[j];
+            }
+        }
+
+        /* Trailing update: A22 -= L21 * L21t, lower triangle only */
+        _lowerUpdate(m, nb, panel, ld, panel, ld, a + (k + nb) * ld + (k + nb), ld, scratch.data());
+    }
+} /* void _cholBlocked(T* a, index_t ld, index_t n) */
+
+/**
+ * Factors a dense symmetric positive-definite matrix in place.
+ * The lower triangle is overwritten with L such that A = L * Lt and the strict upper
+ * triangle is set to zero. Throws NotPositiveDefiniteError if the matrix is not positive definite
+ * @param matrix Matrix to factor
+ */
+
+template <class T>
+void cholInPlace(Mat<T>& matrix) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (matrix.rows() != matrix.cols()) {
+        throw ORCAExcept::BadDimensionsError(); // Matrix must be square
+    }
+#endif
+    const index_t n = matrix.rows();
+    instrument::_Counted counted(instrument::Op::cholesky, static_cast<double>(n) * n * n / 3);
+    T* a = matrix.data();
+    const index_t ld = matrix.stride();
+    if (n > ORCA_CHOLESKY_BLOCK) {
+        _cholBlocked(a, ld, n);
+    } else {
+        _cholUnblocked(a, ld, n);
+    }
+    index_t i, j;
+    for (i = 0; i < n; ++i) {
+        for (j = i + 1; j < n; ++j) {
+            a[i * ld + j] = T(0);
+        }
+    }
+} /* void cholInPlace(Mat<T>& matrix) */
+
+/**
+ * Unblocked LDLt factorization of the n x n lower triangle stored at a.
+ * On return the strict lower triangle holds L, the diagonal is set to one and d holds D
+ * @param a First element of the matrix
+ * @param ld Row stride
+ * @param d Diagonal of D, n elements
+ * @param n Dimension
+ */
+
+template <class T>
+void _ldltUnblocked(T* a, index_t ld, T* d, index_t n) {
+    index_t i, j, k;
+    for (j = 0; j < n; ++j) {
+        T* rowJ = a + j * ld;
+        T dj = rowJ[j];
+        for (k = 0; k < j; ++k) {
+            dj = dj - rowJ[k] * rowJ[k] * d[k];
+        }
+        if (dj == T(0)) {
+            throw ORCAExcept::SingularMatrixError(); // Zero pivot
+        }
+        d[j] = dj;
+        rowJ[j] = T(1);
+        for (i = j + 1; i < n; ++i) {
+            T* rowI = a + i * ld;
+            T sum = rowI[j];
+            for (k = 0; k < j; ++k) {
+                sum = sum - rowI[k] * rowJ[k] * d[k];
+            }
+            rowI[j] = sum / dj;
+        }
+    }
+} /* void _ldltUnblocked(T* a, index_t ld, T* d, index_t n) */
+
+/**
+ * Blocked right-looking LDLt factorization. The panel is solved as W = A21 * inv(L11)t and
+ * scaled to L21 = W * inv(D1), and W * L21t is subtracted from the lower triangle of the
+ * trailing matrix
+ * @param a First element of the matrix
+ * @param ld Row stride
+ * @param d Diagonal of D, n elements
+ * @param n Dimension
+ */
+
+template <class T>
+void _ldltBlocked(T* a, index_t ld, T* d, index_t n) {
+    constexpr index_t NB = ORCA_CHOLESKY_BLOCK;
+    _GemmBuffer<T> scaled((n - NB) * NB);   // W for the current panel
+    _GemmBuffer<T> scratch(_hasGemm<T>() ? (n - NB) * NB : 1); // Shared by every trailing update
+    index_t k, i, j, p;
+    for (k = 0; k < n; k += NB) {
+        const index_t nb = (n - k < NB) ? (n - k) : NB;
+        T* diagonalBlock = a + k * ld + k;
+        _ldltUnblocked(diagonalBlock, ld, d + k, nb);
+        const index_t m = n - k - nb;
+        if (m == 0) {
+            break;
+        }
+
+        /* Panel: W = A21 * inv(L11)t with L11 unit lower triangular, then L21 = W * inv(D1) */
+        T* panel = a + (k + nb) * ld + k;
+        T* w = scaled.data();
+        for (i = 0; i < m; ++i) {
+            T* row = panel + i * ld;
+            T* rowW = w + i * nb;
+            for (j = 0; j < nb; ++j) {
+                const T* rowL = diagonalBlock + j * ld;
+                T sum = row[j];
+                for (p = 0; p < j; ++p) {
+                    sum = sum - rowW[p] * rowL[p];
+                }
+                rowW[j] = sum;
+            }
+            for (j = 0; j < nb; ++j) {
+                row[j] = rowW[j] / d[k + j];
+            }
+        }
+
+        /* Trailing update: A22 -= L21 * D1 * L21t = W * L21t, lower triangle only */
+        _lowerUpdate(m, nb, w, nb, panel, ld, a + (k + nb) * ld + (k + nb), ld, scratch.data());
+    }
+} /* void _ldltBlocked(T* a, index_t ld, T* d, index_t n) */
+
+/**
+ * Factors a dense symmetric matrix in place as A = L * D * Lt, reading its lower triangle.
+ * The lower triangle is overwritten with the unit lower triangular L, the strict upper triangle
+ * is set to zero and d is resized if needed to hold D. Throws SingularMatrixError if a pivot is zero
+ * @param matrix Matrix to factor
+ * @param d Diagonal of D
+ */
+
+template <class T>
+void ldltInPlace(Mat<T>& matrix, ColVec<T>& d) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (matrix.rows() != matrix.cols()) {
+        throw ORCAExcept::BadDimensionsError(); // Matrix must be square
+    }
+#endif
+    const index_t n = matrix.rows();
+    instrument::_Counted counted(instrument::Op::cholesky, static_cast<double>(n) * n * n / 3);
+    if (d.length() != n) {
+        d = ColVec<T>(static_cast<int>(n));
+    }
+    T* a = matrix.data();
+    const index_t ld = matrix.stride();
+    if (n > ORCA_CHOLESKY_BLOCK) {
+        _ldltBlocked(a, ld, d.data(), n);
+    } else {
+        _ldltUnblocked(a, ld, d.data(), n);
+    }
+    index_t i, j;
+    for (i = 0; i < n; ++i) {
+        for (j = i + 1; j < n; ++j) {
+            a[i * ld + j] = T(0);
+        }
+    }
+} /* void ldltInPlace(Mat<T>& matrix, ColVec<T>& d) */
+
+/**
+ * Overwrites x with the solution of L * Lt * x = x, or of L * D * Lt * x = x if d is given
+ * @param l Factor with a unit (d given) or general lower triangle
+ * @param d Optional diagonal of D
+ * @param x Right hand sides, one per column
+ */
+
+template <class T>
+void _triangularSolveSymmetric(const Mat<T>& l, const T* d, Mat<T>& x) {
+    const index_t n = l.rows();
+    const index_t m = x.cols();
+    const T* a = l.data();
+    const index_t ld = l.stride();
+    T* b = x.data();
+    const index_t ldb = x.stride();
+    index_t i, j, k;
+
+    /* Forward substitution with L */
+    for (i = 0; i < n; ++i) {
+        T* row = b + i * ldb;
+        for (k = 0; k < i; ++k) {
+            const T lik = a[i * ld + k];
+            const T* source = b + k * ldb;
+            for (j = 0; j < m; ++j) {
+                row[j] = row[j] - lik * source[j];
+            }
+        }
+        if (d == nullptr) {
+            const T diagonalInverse = T(1) / a[i * ld + i];
+            for (j = 0; j < m; ++j) {
+                row[j] = row[j] * diagonalInverse;
+            }
+        }
+    }
+
+    /* Diagonal */
+    if (d != nullptr) {
+        for (i = 0; i < n; ++i) {
+            const T diagonalInverse = T(1) / d[i];
+            for (j = 0; j < m; ++j) {
+                b[i * ldb + j] = b[i * ldb + j] * diagonalInverse;
+            }
+        }
+    }
+
+    /* Backward substitution with Lt */
+    for (i = n - 1; i >= 0; --i) {
+        T* row = b + i * ldb;
+        for (k = i + 1; k < n; ++k) {
+            const T lki = a[k * ld + i];
+            const T* source = b + k * ldb;
+            for (j = 0; j < m; ++j) {
+                row[j] = row[j] - lki * source[j];
+            }
+        }
+        if (d == nullptr) {
+            const T diagonalInverse = T(1) / a[i * ld + i];
+            for (j = 0; j < m; ++j) {
+                row[j] = row[j] * diagonalInverse;
+            }
+        }
+    }
+} /* void _triangularSolveSymmetric(const Mat<T>& l, const T* d, Mat<T>& x) */
+
+/**
+ * Cholesky factorization A = L * Lt of a symmetric positive-definite matrix
+ * @tparam T Element type
+ */
+
+template <class T>
+class Chol {
+private:
+    /* Below are private members of the Chol class */
+    Mat<T> _l;  // Lower triangular factor
+
+    /**
+     * Applies the rank-1 modification A + sign * x * xt to the factor
+     * @param x Update vector
+     * @param sign 1 for an update, -1 for a downdate
+     */
+
+    void _rankOne(const ColVec<T>& x, int sign) {
+        using std::sqrt;
+        const index_t n = this->size();
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (x.length() != n) {
+            throw ORCAExcept::BadDimensionsError(); // Update vector has the wrong length
+        }
+#endif
+        ColVec<T> w = x;
+        T* l = this->_l.data();
+        const index_t ld = this->_l.stride();
+        index_t i, k;
+        for (k = 0; k < n; ++k) {
+            const T lkk = l[k * ld + k];
+            const T wk = w.at(k);
+            const T squared = (sign > 0) ? (lkk * lkk + wk * wk) : (lkk * lkk - wk * wk);
+            if (!(squared > T(0))) {
+                throw ORCAExcept::NotPositiveDefiniteError(); // Downdated matrix is not positive definite
+            }
+            const T r = sqrt(squared);
+            const T c = r / lkk;
+            const T s = wk / lkk;
+            l[k * ld + k] = r;
+            for (i = k + 1; i < n; ++i) {
+                T lik = l[i * ld + k];
+                lik = (sign > 0) ? ((lik + s * w.at(i)) / c) : ((lik - s * w.at(i)) / c);
+                l[i * ld + k] = lik;
+                w.set(i, c * w.at(i) - s * lik);
+            }
+        }
+    } /* void _rankOne(const ColVec<T>& x, int sign) */
+
+public:
+
+    /* Below are public constructors for the Chol class */
+
+    /**
+     * Factors a symmetric positive-definite matrix, reading its lower triangle.
+     * Throws NotPositiveDefiniteError if the matrix is not positive definite
+     * @param matrix Matrix to factor
+     */
+
+    explicit Chol(const Mat<T>& matrix) : _l(matrix) {
+        cholInPlace(this->_l);
+    } /* explicit Chol(const Mat<T>& matrix) */
+
+    /* Below are public getters for the Chol class */
+
+    /**
+     * Returns the dimension of the factored matrix
+     */
+
+    index_t size() const {
+        return this->_l.rows();
+    } /* index_t size() const */
+
+    /**
+     * Returns the lower triangular factor
+     */
+
+    const Mat<T>& L() const {
+        return this->_l;
+    } /* const Mat<T>& L() const */
+
+    /* Below are public member functions of the Chol class */
+
+    /**
+     * Returns the determinant of the factored matrix
+     */
+
+    T det() const {
+        T result = T(1);
+        index_t i;
+        for (i = 0; i < this->size(); ++i) {
+            result = result * this->_l.at(i, i) * this->_l.at(i, i);
+        }
+        return result;
+    } /* T det() const */
+
+    /**
+     * Solves A * X = B for every column of B
+     * @param b Right hand sides
+     */
+
+    Mat<T> solve(const Mat<T>& b) const {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (b.rows() != this->size()) {
+            throw ORCAExcept::BadDimensionsError(); // Right hand side has the wrong number of rows
+        }
+#endif
+        Mat<T> x = b;
+        _triangularSolveSymmetric(this->_l, static_cast<const T*>(nullptr), x);
+        return x;
+    } /* Mat<T> solve(const Mat<T>& b) const */
+
+    /**
+     * Solves A * x = b
+     * @param b Right hand side
+     */
+
+    ColVec<T> solve(const ColVec<T>& b) const {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (b.length() != this->size()) {
+            throw ORCAExcept::BadDimensionsError(); // Right hand side has the wrong length
+        }
+#endif
+        ColVec<T> x = b;
+        _triangularSolveSymmetric(this->_l, static_cast<const T*>(nullptr), x);
+        return x;
+    } /* ColVec<T> solve(const ColVec<T>& b) const */
+
+    /**
+     * Returns the inverse of the factored matrix
+     */
+
+    Mat<T> inv() const {
+        return this->solve(Mat<T>(this->size(), this->size(), fill::eye));
+    } /* Mat<T> inv() const */
+
+    /**
+     * Updates the factorization to that of A + x * xt in O(n^2)
+     * @param x Update vector
+     */
+
+    void update(const ColVec<T>& x) {
+        this->_rankOne(x, 1);
+    } /* void update(const ColVec<T>& x) */
+
+    /**
+     * Updates the factorization to that of A - x * xt in O(n^2).
+     * Throws NotPositiveDefiniteError if the result is not positive definite
+     * @param x Downdate vector
+     */
+
+    void downdate(const ColVec<T>& x) {
+        this->_rankOne(x, -1);
+    } /* void downdate(const ColVec<T>& x) */
+
+}; /* class Chol */
+
+/**
+ * Square root free factorization A = L * D * Lt with L unit lower triangular and D diagonal.
+ * Needs no square roots and also handles symmetric matrices that are not positive definite
+ * as long as no leading minor is singular
+ * @tparam T Element type
+ */
+
+template <class T>
+class LDLT {
+private:
+    /* Below are private members of the LDLT class */
+    Mat<T> _l;  // Unit lower triangular factor
+    ColVec<T> _d;   // Diagonal of D
+
+    /**
+     * Applies the rank-1 modification A + alpha * x * xt to the factors
+     * @param x Update vector
+     * @param alpha Scale of the modification
+     */
+
+    void _rankOne(const ColVec<T>& x, T alpha) {
+        const index_t n = this->size();
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (x.length() != n) {
+            throw ORCAExcept::BadDimensionsError(); // Update vector has the wrong length
+        }
+#endif
+        ColVec<T> w = x;
+        T* l = this->_l.data();
+        const index_t ld = this->_l.stride();
+        index_t i, j;
+        for (j = 0; j < n; ++j) {
+            const T p = w.at(j);
+            const T dj = this->_d.at(j);
+            const T updated = dj + alpha * p * p;
+            if (updated == T(0)) {
+                throw ORCAExcept::SingularMatrixError(); // Modified matrix is singular
+            }
+            const T beta = p * alpha / updated;
+            alpha = dj * alpha / updated;
+            this->_d.set(j, updated);
+            for (i = j + 1; i < n; ++i) {
+                w.set(i, w.at(i) - p * l[i * ld + j]);
+                l[i * ld + j] = l[i * ld + j] + beta * w.at(i);
+            }
+        }
+    } /* void _rankOne(const ColVec<T>& x, T alpha) */
+
+public:
+
+    /* Below are public constructors for the LDLT class */
+
+    /**
+     * Factors a symmetric matrix, reading its lower triangle.
+     * Throws SingularMatrixError if a pivot is zero
+     * @param matrix Matrix to factor
+     */
+
+    explicit LDLT(const Mat<T>& matrix) : _l(matrix), _d(static_cast<int>(matrix.rows())) {
+        ldltInPlace(this->_l, this->_d);
+    } /* explicit LDLT(const Mat<T>& matrix) */
+
+    /* Below are public getters for the LDLT class */
+
+    /**
+     * Returns the dimension of the factored matrix
+     */
+
+    index_t size() const {
+        return this->_l.rows();
+    } /* index_t size() const */
+
+    /**
+     * Returns the unit lower triangular factor
+     */
+
+    const Mat<T>& L() const {
+        return this->_l;
+    } /* const Mat<T>& L() const */
+
+    /**
+     * Returns the diagonal of D
+     */
+
+    const ColVec<T>& D() const {
+        return this->_d;
+    } /* const ColVec<T>& D() const */
+
+    /* Below are public member functions of the LDLT class */
+
+    /**
+     * Returns the determinant of the factored matrix
+     */
+
+    T det() const {
+        T result = T(1);
+        index_t i;
+        for (i = 0; i < this->size(); ++i) {
+            result = result * this->_d.at(i);
+        }
+        return result;
+    } /* T det() const */
+
+    /**
+     * Solves A * X = B for every column of B
+     * @param b Right hand sides
+     */
+
+    Mat<T> solve(const Mat<T>& b) const {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (b.rows() != this->size()) {
+            throw ORCAExcept::BadDimensionsError(); // Right hand side has the wrong number of rows
+        }
+#endif
+        Mat<T> x = b;
+        _triangularSolveSymmetric(this->_l, this->_d.data(), x);
+        return x;
+    } /* Mat<T> solve(const Mat<T>& b) const */
+
+    /**
+     * Solves A * x = b
+     * @param b Right hand side
+     */
+
+    ColVec<T> solve(const ColVec<T>& b) const {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (b.length() != this->size()) {
+            throw ORCAExcept::BadDimensionsError(); // Right hand side has the wrong length
+        }
+#endif
+        ColVec<T> x = b;
+        _triangularSolveSymmetric(this->_l, this->_d.data(), x);
+        return x;
+    } /* ColVec<T> solve(const ColVec<T>& b) const */
+
+    /**
+     * Returns the inverse of the factored matrix
+     */
+
+    Mat<T> inv() const {
+        return this->solve(Mat<T>(this->size(), this->size(), fill::eye));
+    } /* Mat<T> inv() const */
+
+    /**
+     * Updates the factorization to that of A + x * xt in O(n^2)
+     * @param x Update vector
+     */
+
+    void update(const ColVec<T>& x) {
+        this->_rankOne(x, T(1));
+    } /* void update(const ColVec<T>& x) */
+
+    /**
+     * Updates the factorization to that of A - x * xt in O(n^2)
+     * @param x Downdate vector
+     */
+
+    void downdate(const ColVec<T>& x) {
+        this->_rankOne(x, T(-1));
+    } /* void downdate(const ColVec<T>& x) */
+
+}; /* class LDLT */
+
+/**
+ * Returns the Cholesky factorization of the matrix. The factorization is cached until the matrix is modified
+ */
+
+template <class T>
+Chol<T> Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>::chol() const {
+    return this->_remember(&_StickyCache<T>::chol, sizeof(T) * this->_n_rows * this->_n_rows, [&] {
+        return Chol<T>(*this);
+    });
+} /* Chol<T> Mat<T>::chol() const */
+
+/**
+ * Returns the LDLt factorization of the matrix. The factorization is cached until the matrix is modified
+ */
+
+template <class T>
+LDLT<T> Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>::ldlt() const {
+    return this->_remember(&_StickyCache<T>::ldlt, sizeof(T) * this->_n_rows * this->_n_rows, [&] {
+        return LDLT<T>(*this);
+    });
+} /* LDLT<T> Mat<T>::ldlt() const */
+
+/* Below are nonmember functions for the Chol and LDLT classes */
+
+/**
+ * Returns the Cholesky factorization of a matrix
+ * @param _m1 Matrix
+ * @return Factorization
+ */
+
+template <class T>
+Chol<T> chol(const Mat<T>& _m1) {
+    return _m1.chol();
+} /* Chol<T> chol(const Mat<T>& _m1) */
+
+/**
+ * Returns the LDLt factorization of a matrix
+ * @param _m1 Matrix
+ * @return Factorization
+ */
+
+template <class T>
+LDLT<T> ldlt(const Mat<T>& _m1) {
+    return _m1.ldlt();
+} /* LDLT<T> ldlt(const Mat<T>& _m1) */
+
+} /* namespace ORCA */
+
+#endif /* Cholesky_h */
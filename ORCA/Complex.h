@@ -14,6 +14,7 @@
 #include "Except.h" // Included for throwing ORCA exceptions
 #include "Constants.h" // Included for constant values
 #include <cmath>    // Included for root and angle calculating
+#include <type_traits> // Included for std::enable_if_t
 
 /* ORCA Print Unit */
 
@@ -195,6 +196,30 @@ public:
     
 };
 
+/**
+ * Component type of a complex element type, void for other types. Used to pick the complex GEMM
+ * @tparam T element type
+ */
+
+template <class T>
+struct _complexBase {
+    typedef void type;
+}; /* struct _complexBase */
+
+template <class T>
+struct _complexBase<Complex<T>> {
+    typedef T type;
+}; /* struct _complexBase<Complex<T>> */
+
+/**
+ * Restricts the non complex operand of the mixed operators to scalar types, so that matrix
+ * operands never instantiate them while other overloads are being considered
+ * @tparam T non complex operand type
+ */
+
+template <class T>
+using _isComplexOperand = std::enable_if_t<std::is_convertible<T, long double>::value, bool>;
+
 /* Below are all overloaded mathematical operators for the complex class */
 
 /**
@@ -220,7 +245,7 @@ auto operator + (Complex<T1> c1, Complex<T2> c2) {
  * @return sum of two numbers
  */
 
-template<class T1, class T2>
+template<class T1, class T2, _isComplexOperand<T2> = true>
 auto operator + (Complex<T1> c1, T2 c2) {
     return c1 + Complex<T2>(c2);
 }
@@ -234,7 +259,7 @@ auto operator + (Complex<T1> c1, T2 c2) {
  * @return sum of two numbers
  */
 
-template<class T1, class T2>
+template<class T1, class T2, _isComplexOperand<T1> = true>
 auto operator + (T1 c1, Complex<T2> c2) {
     return Complex<T1>(c1) + c2;
 }
@@ -263,7 +288,7 @@ auto operator += (Complex<T1>& c1, Complex<T2> c2) {
  * @return sum of two numbers
  */
 
-template<class T1, class T2>
+template<class T1, class T2, _isComplexOperand<T2> = true>
 auto operator += (Complex<T1>& c1, T2 c2) {
     c1 = c1 + Complex<T2>(c2);
     return c1;
@@ -292,7 +317,7 @@ auto operator - (Complex<T1> c1, Complex<T2> c2) {
  * @return difference between numbers
  */
 
-template<class T1, class T2>
+template<class T1, class T2, _isComplexOperand<T2> = true>
 auto operator - (Complex<T1> c1, T2 c2) {
     return c1 - Complex<T2>(c2);
 }
@@ -306,7 +331,7 @@ auto operator - (Complex<T1> c1, T2 c2) {
  * @return difference between numbers
  */
 
-template<class T1, class T2>
+template<class T1, class T2, _isComplexOperand<T1> = true>
 auto operator - (T1 c1, Complex<T2> c2) {
     return Complex<T1>(c1) - c2;
 }
@@ -335,7 +360,7 @@ auto operator -= (Complex<T1>& c1, Complex<T2> c2) {
  * @return difference between numbers
  */
 
-template<class T1, class T2>
+template<class T1, class T2, _isComplexOperand<T2> = true>
 auto operator -= (Complex<T1>& c1, T2 c2) {
     c1 = c1 - Complex<T2>(c2);
     return c1;
@@ -376,7 +401,7 @@ auto operator * (Complex<T1> c1, Complex<T2> c2) {
  * @return product of numbers
  */
 
-template<class T1, class T2>
+template<class T1, class T2, _isComplexOperand<T2> = true>
 auto operator * (Complex<T1> c1, T2 c2) {
     return c1 * Complex<T2>(c2);
 }
@@ -390,7 +415,7 @@ auto operator * (Complex<T1> c1, T2 c2) {
  * @return product of numbers
  */
 
-template<class T1, class T2>
+template<class T1, class T2, _isComplexOperand<T1> = true>
 auto operator * (T1 c1, Complex<T2> c2) {
     return Complex<T1>(c1) * c2;
 }
@@ -419,7 +444,7 @@ auto operator *= (Complex<T1>& c1, Complex<T2> c2) {
  * @return product of numbers
  */
 
-template<class T1, class T2>
+template<class T1, class T2, _isComplexOperand<T2> = true>
 auto operator *= (Complex<T1>& c1, T2 c2) {
     c1 = c1 * Complex<T2>(c2);
     return c1;
@@ -448,7 +473,7 @@ auto operator / (Complex<T1> c1, Complex<T2> c2) {
  * @return product of numbers
  */
 
-template<class T1, class T2>
+template<class T1, class T2, _isComplexOperand<T1> = true>
 auto operator / (T1 c1, Complex<T2> c2) {
     return Complex<T1>(c1) / c2;
 }
@@ -462,7 +487,7 @@ auto operator / (T1 c1, Complex<T2> c2) {
  * @return product of numbers
  */
 
-template<class T1, class T2>
+template<class T1, class T2, _isComplexOperand<T2> = true>
 auto operator / (Complex<T1> c1, T2 c2) {
     return c1 / Complex<T2>(c2);
 }
@@ -491,7 +516,7 @@ auto operator /= (Complex<T1>& c1, Complex<T2> c2) {
  * @return product of numbers
  */
 
-template<class T1, class T2>
+template<class T1, class T2, _isComplexOperand<T2> = true>
 auto operator /= (Complex<T1>& c1, T2 c2) {
     c1 = c1 / Complex<T2>(c2);
     return c1;
@@ -520,7 +545,7 @@ auto operator == (Complex<T1> c1, Complex<T2> c2) {
  * @return equalty comparison
  */
 
-template<class T1, class T2>
+template<class T1, class T2, _isComplexOperand<T2> = true>
 auto operator == (Complex<T1> c1, T2 c2) {
     return c1 == Complex<T2>(c2);
 }
@@ -534,7 +559,7 @@ auto operator == (Complex<T1> c1, T2 c2) {
  * @return equalty comparison
  */
 
-template<class T1, class T2>
+template<class T1, class T2, _isComplexOperand<T2> = true>
 auto operator == (T2 c2, Complex<T1> c1) {
     return c1 == Complex<T2>(c2);
 }
@@ -550,7 +575,7 @@ auto operator == (T2 c2, Complex<T1> c1) {
 
 template<class T1, class T2>
 auto operator != (Complex<T1> c1, Complex<T2> c2) {
-    return (c1.real() != c2.real()) && (c1.imag() != c2.imag());
+    return (c1.real() != c2.real()) || (c1.imag() != c2.imag());
 }
 
 /**
@@ -562,7 +587,7 @@ auto operator != (Complex<T1> c1, Complex<T2> c2) {
  * @return equalty comparison
  */
 
-template<class T1, class T2>
+template<class T1, class T2, _isComplexOperand<T2> = true>
 auto operator != (Complex<T1> c1, T2 c2) {
     return c1 != Complex<T2>(c2);
 }
@@ -576,7 +601,7 @@ auto operator != (Complex<T1> c1, T2 c2) {
  * @return equalty comparison
  */
 
-template<class T1, class T2>
+template<class T1, class T2, _isComplexOperand<T2> = true>
 auto operator != (T2 c2, Complex<T1> c1) {
     return c1 != Complex<T2>(c2);
 }
@@ -610,7 +635,18 @@ std::ostream& operator<<(std::ostream& os, const Complex<T>* c) {
 template <class T>
 auto sqrt(Complex<T> _complex) {
     auto norm = _complex.norm();
-    return Complex<decltype(norm / ORCA_M_ROOT2)>(std::sqrt(norm + _complex.real()), (_complex.imag() > 0 ? 1 : -1) * std::sqrt(norm - _complex.real()))/ORCA_M_ROOT2;
+    return Complex<decltype(norm / ORCA_M_ROOT2)>(std::sqrt(norm + _complex.real()), std::copysign(std::sqrt(norm - _complex.real()), _complex.imag()))/ORCA_M_ROOT2;
+}
+
+/**
+ * Exponential function
+ * @return e raised to the complex number
+ */
+
+template <class T>
+auto exp(Complex<T> _complex) {
+    auto magnitude = std::exp(_complex.real());
+    return Complex<decltype(magnitude)>(magnitude * std::cos(_complex.imag()), magnitude * std::sin(_complex.imag()));
 }
 
 /**
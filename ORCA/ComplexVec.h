@@ -0,0 +1,513 @@
+//
+//  ComplexVec.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef ComplexVec_h
+#define ComplexVec_h
+
+/* Includes for ComplexVec.h */
+
+#include "Except.h"         // Included for ORCA Exceptions
+#include "Complex.h"        // Included for single Complex values
+#include "Gemm.h"           // Included for the SIMD vector operations
+#include "Parallel.h"       // Included for threaded array loops
+#include "Mat.h"            // Included for Mat class
+#include "Vec.h"            // Included for ColVec class
+#include "QuaternionBatch.h"    // Included for _batchLoop
+#include "Arena.h"          // Included for aligned storage allocation
+#include <cmath>            // Included for std::exp, std::cos and std::sin
+#include <initializer_list> // Included for std::initializer_list
+#include <utility>          // Included for std::swap
+
+namespace ORCA {
+
+/**
+ * Array of N complex numbers stored as structure of arrays.
+ * The real parts and the imaginary parts each have their own contiguous array, so the array
+ * kernels process one SIMD vector of complex numbers per step without shuffling components
+ * @tparam T Component type
+ */
+
+template <class T>
+class ComplexVec {
+private:
+    /* Below are private members of the ComplexVec class */
+    T* _data = nullptr;     // Real parts followed by imaginary parts
+    index_t _n = 0;         // Number of complex numbers
+
+    /**
+     * Allocates storage for n complex numbers. Contents are left uninitialized
+     * @param n Number of complex numbers
+     */
+
+    void _allocate(index_t n) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (n < 0) {
+            throw ORCAExcept::BadDimensionsError(); // Attempting to allocate a negative number of elements
+        }
+#endif
+        this->_n = n;
+        if (n > 0) {
+            this->_data = static_cast<T*>(_allocateStorage(sizeof(T) * 2 * static_cast<std::size_t>(n)));
+        }
+    } /* void _allocate(index_t n) */
+
+    /**
+     * Frees the storage of the array
+     */
+
+    void _release() {
+        if (this->_data != nullptr) {
+            _freeStorage(this->_data);
+        }
+        this->_data = nullptr;
+        this->_n = 0;
+    } /* void _release() */
+
+public:
+
+    /* Below are public constructors for the ComplexVec class */
+
+    /**
+     * Default constructor. The array is empty
+     */
+
+    ComplexVec() {}
+
+    /**
+     * Constructs an array of n zeros
+     * @param n Number of complex numbers
+     */
+
+    explicit ComplexVec(index_t n) : ComplexVec(n, Complex<T>()) {}
+
+    /**
+     * Constructs an array of n copies of value
+     * @param n Number of complex numbers
+     * @param value Complex number to copy
+     */
+
+    ComplexVec(index_t n, const Complex<T>& value) {
+        this->_allocate(n);
+        index_t i;
+        for (i = 0; i < n; ++i) {
+            this->real()[i] = value.re();
+            this->imag()[i] = value.im();
+        }
+    } /* ComplexVec(index_t n, const Complex<T>& value) */
+
+    /**
+     * Constructs an array from separate arrays of real and imaginary parts
+     * @param re Real parts
+     * @param im Imaginary parts, nullptr for a real signal
+     * @param n Number of complex numbers
+     */
+
+    ComplexVec(const T* re, const T* im, index_t n) {
+        this->_allocate(n);
+        index_t i;
+        for (i = 0; i < n; ++i) {
+            this->real()[i] = re[i];
+            this->imag()[i] = (im != nullptr) ? im[i] : T(0);
+        }
+    } /* ComplexVec(const T* re, const T* im, index_t n) */
+
+    /**
+     * Constructs an array from an initializer list
+     * @param _castValues Complex numbers
+     */
+
+    ComplexVec(std::initializer_list<Complex<T>> _castValues) {
+        this->_allocate(static_cast<index_t>(_castValues.size()));
+        index_t i = 0;
+        for (const Complex<T>& value : _castValues) {
+            this->set(i++, value);
+        }
+    } /* ComplexVec(std::initializer_list<Complex<T>> _castValues) */
+
+    /**
+     * Constructs an array from a row or column vector of complex numbers
+     * @param _vector Vector to copy
+     */
+
+    explicit ComplexVec(const Mat<Complex<T>>& _vector) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((_vector.rows() != 1) && (_vector.cols() != 1)) {
+            throw ORCAExcept::BadDimensionsError(); // Only vectors convert to an array
+        }
+#endif
+        const bool column = (_vector.cols() == 1);
+        this->_allocate(column ? _vector.rows() : _vector.cols());
+        index_t i;
+        for (i = 0; i < this->_n; ++i) {
+            this->set(i, column ? _vector.at(i, 0) : _vector.at(0, i));
+        }
+    } /* explicit ComplexVec(const Mat<Complex<T>>& _vector) */
+
+    /**
+     * Copy constructor. Performs a deep copy of _other
+     * @param _other Array to copy
+     */
+
+    ComplexVec(const ComplexVec& _other) {
+        this->_allocate(_other._n);
+        index_t i;
+        for (i = 0; i < 2 * this->_n; ++i) {
+            this->_data[i] = _other._data[i];
+        }
+    } /* ComplexVec(const ComplexVec& _other) */
+
+    /**
+     * Move constructor. Takes the storage of _other and leaves it empty
+     * @param _other Array to move from
+     */
+
+    ComplexVec(ComplexVec&& _other) noexcept {
+        std::swap(this->_data, _other._data);
+        std::swap(this->_n, _other._n);
+    } /* ComplexVec(ComplexVec&& _other) */
+
+    ~ComplexVec() {
+        this->_release();
+    } /* ~ComplexVec() */
+
+    /* Below are public operators for the ComplexVec class */
+
+    /**
+     * Copy assignment operator. Storage is reused when both arrays have the same size
+     * @param _other Array to copy
+     */
+
+    ComplexVec& operator = (const ComplexVec& _other) {
+        if (this == &_other) {
+            return *this;
+        }
+        if (this->_n != _other._n) {
+            arena::_HeapOnly heapOnly(!_isArenaStorage(this->_data)); // Storage on the heap stays there
+            this->_release();
+            this->_allocate(_other._n);
+        }
+        index_t i;
+        for (i = 0; i < 2 * this->_n; ++i) {
+            this->_data[i] = _other._data[i];
+        }
+        return *this;
+    } /* ComplexVec& operator = (const ComplexVec& _other) */
+
+    /**
+     * Move assignment operator. Takes the storage of _other. A array on the heap, or without
+     * storage, copies arena storage instead of taking it, so that it keeps its contents after
+     * the arena scope ends
+     * @param _other Array to move from
+     */
+
+    ComplexVec& operator = (ComplexVec&& _other) {
+        if (!_isArenaStorage(this->_data) && _isArenaStorage(_other._data)) {
+            return (*this = static_cast<const ComplexVec&>(_other));
+        }
+        std::swap(this->_data, _other._data);
+        std::swap(this->_n, _other._n);
+        return *this;
+    } /* ComplexVec& operator = (ComplexVec&& _other) */
+
+    /* Below are public getters and setters for the ComplexVec class */
+
+    /**
+     * Returns the number of complex numbers in the array
+     */
+
+    index_t size() const {
+        return this->_n;
+    } /* index_t size() const */
+
+    /**
+     * Returns the contiguous array of real parts
+     */
+
+    T* real() {
+        return this->_data;
+    } /* T* real() */
+
+    const T* real() const {
+        return this->_data;
+    } /* const T* real() const */
+
+    /**
+     * Returns the contiguous array of imaginary parts
+     */
+
+    T* imag() {
+        return this->_data + this->_n;
+    } /* T* imag() */
+
+    const T* imag() const {
+        return this->_data + this->_n;
+    } /* const T* imag() const */
+
+    /**
+     * Returns the complex number at the specified index
+     * @param index Index
+     */
+
+    Complex<T> at(index_t index) const {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if ((index < 0) || (index >= this->_n)) {
+            throw ORCAExcept::OutOfBoundsError(); // Indexed outside the array
+        }
+#endif
+        return Complex<T>(this->_data[index], this->_data[this->_n + index]);
+    } /* Complex<T> at(index_t index) const */
+
+    /**
+     * Sets the complex number at the specified index
+     * @param index Index
+     * @param value Complex number
+     */
+
+    void set(index_t index, const Complex<T>& value) {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if ((index < 0) || (index >= this->_n)) {
+            throw ORCAExcept::OutOfBoundsError(); // Indexed outside the array
+        }
+#endif
+        this->_data[index] = value.re();
+        this->_data[this->_n + index] = value.im();
+    } /* void set(index_t index, const Complex<T>& value) */
+
+    /* Below are public member functions of the ComplexVec class */
+
+    /**
+     * Returns the conjugate of every complex number
+     */
+
+    ComplexVec conj() const {
+        ComplexVec result(*this);
+        T* im = result.imag();
+        index_t i;
+        for (i = 0; i < this->_n; ++i) {
+            im[i] = -im[i];
+        }
+        return result;
+    } /* ComplexVec conj() const */
+
+    /**
+     * Returns the array as an interleaved column vector
+     */
+
+    ColVec<Complex<T>> toColVec() const {
+        ColVec<Complex<T>> result(this->_n);
+        index_t i;
+        for (i = 0; i < this->_n; ++i) {
+            result.set(i, this->at(i));
+        }
+        return result;
+    } /* ColVec<Complex<T>> toColVec() const */
+
+}; /* class ComplexVec */
+
+/* Below are the overloaded math operators for the ComplexVec class */
+
+/**
+ * Computes the product of every pair of complex numbers into out, without allocating
+ * when out already has the right size. out may be a or b
+ * @param a Left complex numbers
+ * @param b Right complex numbers
+ * @param out Products
+ */
+
+template <class T>
+void multiply(const ComplexVec<T>& a, const ComplexVec<T>& b, ComplexVec<T>& out) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (a.size() != b.size()) {
+        throw ORCAExcept::BadDimensionsError(); // Arrays must have the same size
+    }
+#endif
+    if (out.size() != a.size()) {
+        out = ComplexVec<T>(a.size());
+    }
+    const T* ar = a.real(); const T* ai = a.imag();
+    const T* br = b.real(); const T* bi = b.imag();
+    T* outR = out.real(); T* outI = out.imag();
+    _batchLoop<T>(a.size(), 6, [&](auto ops, index_t i) {
+        using O = decltype(ops);
+        auto vr = O::load(ar + i);
+        auto vi = O::load(ai + i);
+        auto wr = O::load(br + i);
+        auto wi = O::load(bi + i);
+        O::store(outR + i, O::fnma(vi, wi, O::mul(vr, wr)));
+        O::store(outI + i, O::fma(vr, wi, O::mul(vi, wr)));
+    });
+} /* void multiply(const ComplexVec<T>& a, const ComplexVec<T>& b, ComplexVec<T>& out) */
+
+/**
+ * Computes the product of every complex number in a with z into out. out may be a
+ * @param a Complex numbers
+ * @param z Single complex number
+ * @param out Products
+ */
+
+template <class T>
+void multiply(const ComplexVec<T>& a, const Complex<T>& z, ComplexVec<T>& out) {
+    if (out.size() != a.size()) {
+        out = ComplexVec<T>(a.size());
+    }
+    const T* ar = a.real(); const T* ai = a.imag();
+    T* outR = out.real(); T* outI = out.imag();
+    _batchLoop<T>(a.size(), 6, [&](auto ops, index_t i) {
+        using O = decltype(ops);
+        auto vr = O::load(ar + i);
+        auto vi = O::load(ai + i);
+        auto zr = O::broadcast(z.re());
+        auto zi = O::broadcast(z.im());
+        O::store(outR + i, O::fnma(vi, zi, O::mul(vr, zr)));
+        O::store(outI + i, O::fma(vr, zi, O::mul(vi, zr)));
+    });
+} /* void multiply(const ComplexVec<T>& a, const Complex<T>& z, ComplexVec<T>& out) */
+
+/**
+ * Multiplication operator for 2 complex arrays, element by element
+ * @param a Left complex numbers
+ * @param b Right complex numbers
+ * @return Products
+ */
+
+template <class T>
+ComplexVec<T> operator * (const ComplexVec<T>& a, const ComplexVec<T>& b) {
+    ComplexVec<T> result;
+    multiply(a, b, result);
+    return result;
+} /* ComplexVec<T> operator * (const ComplexVec<T>& a, const ComplexVec<T>& b) */
+
+/**
+ * Multiplication operator for a complex array and a single complex number
+ * @param a Complex numbers
+ * @param z Complex number
+ * @return Products
+ */
+
+template <class T>
+ComplexVec<T> operator * (const ComplexVec<T>& a, const Complex<T>& z) {
+    ComplexVec<T> result;
+    multiply(a, z, result);
+    return result;
+} /* ComplexVec<T> operator * (const ComplexVec<T>& a, const Complex<T>& z) */
+
+/**
+ * Multiplication operator for a single complex number and a complex array
+ * @param z Complex number
+ * @param a Complex numbers
+ * @return Products
+ */
+
+template <class T>
+ComplexVec<T> operator * (const Complex<T>& z, const ComplexVec<T>& a) {
+    ComplexVec<T> result;
+    multiply(a, z, result);
+    return result;
+} /* ComplexVec<T> operator * (const Complex<T>& z, const ComplexVec<T>& a) */
+
+/**
+ * In place multiplication operator for 2 complex arrays
+ * @param a Left complex numbers, overwritten with the products
+ * @param b Right complex numbers
+ */
+
+template <class T>
+ComplexVec<T>& operator *= (ComplexVec<T>& a, const ComplexVec<T>& b) {
+    multiply(a, b, a);
+    return a;
+} /* ComplexVec<T>& operator *= (ComplexVec<T>& a, const ComplexVec<T>& b) */
+
+/**
+ * In place multiplication operator for a complex array and a single complex number
+ * @param a Complex numbers, overwritten with the products
+ * @param z Complex number
+ */
+
+template <class T>
+ComplexVec<T>& operator *= (ComplexVec<T>& a, const Complex<T>& z) {
+    multiply(a, z, a);
+    return a;
+} /* ComplexVec<T>& operator *= (ComplexVec<T>& a, const Complex<T>& z) */
+
+/* Below are common math functions for the ComplexVec class */
+
+/**
+ * Returns the conjugate of every complex number
+ */
+
+template <class T>
+ComplexVec<T> conj(const ComplexVec<T>& a) {
+    return a.conj();
+} /* ComplexVec<T> conj(const ComplexVec<T>& a) */
+
+/**
+ * Returns the magnitude of every complex number
+ */
+
+template <class T>
+ColVec<T> abs(const ComplexVec<T>& a) {
+    ColVec<T> result(a.size());
+    const T* ar = a.real(); const T* ai = a.imag();
+    T* out = result.data();
+    _batchLoop<T>(a.size(), 4, [&](auto ops, index_t i) {
+        using O = decltype(ops);
+        auto vr = O::load(ar + i);
+        auto vi = O::load(ai + i);
+        O::store(out + i, O::sqrt(O::fma(vi, vi, O::mul(vr, vr))));
+    });
+    return result;
+} /* ColVec<T> abs(const ComplexVec<T>& a) */
+
+/**
+ * Returns the principal square root of every complex number. The imaginary part of the root
+ * has the sign of the imaginary part of the argument, as for sqrt(Complex)
+ */
+
+template <class T>
+ComplexVec<T> sqrt(const ComplexVec<T>& a) {
+    ComplexVec<T> result(a.size());
+    const T* ar = a.real(); const T* ai = a.imag();
+    T* outR = result.real(); T* outI = result.imag();
+    _batchLoop<T>(a.size(), 12, [&](auto ops, index_t i) {
+        using O = decltype(ops);
+        auto vr = O::load(ar + i);
+        auto vi = O::load(ai + i);
+        auto half = O::broadcast(T(0.5));
+        /* The magnitude is never below |re|, so both square roots have non-negative arguments */
+        auto magnitude = O::sqrt(O::fma(vi, vi, O::mul(vr, vr)));
+        O::store(outR + i, O::sqrt(O::mul(half, O::add(magnitude, vr))));
+        O::store(outI + i, O::copysign(O::sqrt(O::mul(half, O::sub(magnitude, vr))), vi));
+    });
+    return result;
+} /* ComplexVec<T> sqrt(const ComplexVec<T>& a) */
+
+/**
+ * Returns e raised to every complex number. The exponential, sine and cosine are evaluated
+ * one element at a time and the loop is split across threads
+ */
+
+template <class T>
+ComplexVec<T> exp(const ComplexVec<T>& a) {
+    ComplexVec<T> result(a.size());
+    const T* ar = a.real(); const T* ai = a.imag();
+    T* outR = result.real(); T* outI = result.imag();
+    _parallelFor(0, a.size(), a.size() * 64, [&](index_t first, index_t last) {
+        index_t i;
+        for (i = first; i < last; ++i) {
+            const T magnitude = std::exp(ar[i]);
+            outR[i] = magnitude * std::cos(ai[i]);
+            outI[i] = magnitude * std::sin(ai[i]);
+        }
+    });
+    return result;
+} /* ComplexVec<T> exp(const ComplexVec<T>& a) */
+
+} /* namespace ORCA */
+
+#endif /* ComplexVec_h */
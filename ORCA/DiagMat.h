@@ -0,0 +1,379 @@
+//
+//  DiagMat.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef DiagMat_h
+#define DiagMat_h
+
+/* Includes for DiagMat.h */
+
+#include "Except.h"     // Included for ORCA Exceptions
+#include "Fill.h"       // Included for Fill types
+#include "Mat.h"        // Included for Mat class
+#include "Vec.h"        // Included for ColVec class
+#include <algorithm>    // Included for std::copy
+#include <vector>       // Included for diagonal storage
+
+namespace ORCA {
+
+/**
+ * Square diagonal matrix. Only the n diagonal elements are stored, products with dense
+ * operands scale their rows or columns in O(n^2), and det() and inv() cost O(n)
+ * @tparam T Element type
+ */
+
+template <class T>
+class DiagMat {
+private:
+    /* Below are private members of the DiagMat class */
+    std::vector<T> _diag;   // Diagonal elements
+
+public:
+
+    /* Below are public constructors for the DiagMat class */
+
+    /**
+     * Constructs an n x n diagonal matrix of zeros
+     * @param n Number of rows and columns
+     */
+
+    explicit DiagMat(index_t n) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (n < 0) {
+            throw ORCAExcept::BadDimensionsError(); // Negative dimensions
+        }
+#endif
+#ifndef ORCA_DISABLE_EMPTY_CHECKS
+        if (n == 0) {
+            throw ORCAExcept::EmptyElementError(); // Zero rows or columns
+        }
+#endif
+        this->_diag.assign(static_cast<std::size_t>(n), T(0));
+    } /* explicit DiagMat(index_t n) */
+
+    /**
+     * Constructs a diagonal matrix from its diagonal elements
+     * @param _castValues Diagonal elements
+     */
+
+    DiagMat(std::initializer_list<T> _castValues) : DiagMat(static_cast<index_t>(_castValues.size())) {
+        std::copy(_castValues.begin(), _castValues.end(), this->_diag.begin());
+    } /* DiagMat(std::initializer_list<T> _castValues) */
+
+    /**
+     * Constructs a diagonal matrix from a vector of its diagonal elements, such as Mat::diag()
+     * @param values Diagonal elements
+     */
+
+    explicit DiagMat(const Vec<T>& values) : DiagMat(values.length()) {
+        index_t i;
+        for (i = 0; i < values.length(); ++i) {
+            this->_diag[i] = values.at(i);
+        }
+    } /* explicit DiagMat(const Vec<T>& values) */
+
+    /* Below are public getters and setters for the DiagMat class */
+
+    /**
+     * Returns the number of rows in the matrix
+     */
+
+    index_t rows() const {
+        return static_cast<index_t>(this->_diag.size());
+    } /* index_t rows() const */
+
+    /**
+     * Returns the number of columns in the matrix
+     */
+
+    index_t cols() const {
+        return static_cast<index_t>(this->_diag.size());
+    } /* index_t cols() const */
+
+    /**
+     * Returns the element at the specified index, zero off the diagonal
+     * @param row Element Row Index
+     * @param col Element Column Index
+     */
+
+    T at(index_t row, index_t col) const {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if ((row < 0) || (row >= this->rows()) || (col < 0) || (col >= this->cols())) {
+            throw ORCAExcept::OutOfBoundsError(); // Either negative indexing or over indexing
+        }
+#endif
+        return (row == col) ? this->_diag[row] : T(0);
+    } /* T at(index_t row, index_t col) const */
+
+    /**
+     * Returns the diagonal element of the given row
+     * @param index Element Index
+     */
+
+    T at(index_t index) const {
+        return this->at(index, index);
+    } /* T at(index_t index) const */
+
+    /**
+     * Sets the diagonal element of the given row
+     * @param index Element Index
+     * @param elem Element Value
+     */
+
+    void set(index_t index, T elem) {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if ((index < 0) || (index >= this->rows())) {
+            throw ORCAExcept::OutOfBoundsError(); // Either negative indexing or over indexing
+        }
+#endif
+        this->_diag[index] = elem;
+    } /* void set(index_t index, T elem) */
+
+    /**
+     * Returns the diagonal elements, rows() entries
+     */
+
+    const T* data() const {
+        return this->_diag.data();
+    } /* const T* data() const */
+
+    /* Below are public member functions of the DiagMat class */
+
+    /**
+     * Returns a dense copy of the matrix
+     */
+
+    Mat<T> dense() const {
+        const index_t n = this->rows();
+        Mat<T> result(n, n, fill::zeros);
+        T* c = result.data();
+        index_t i;
+        for (i = 0; i < n; ++i) {
+            c[i * result.stride() + i] = this->_diag[i];
+        }
+        return result;
+    } /* Mat<T> dense() const */
+
+    /**
+     * Returns the diagonal as a vector
+     */
+
+    ColVec<T> diag() const {
+        ColVec<T> result(static_cast<int>(this->rows()));
+        std::copy(this->_diag.begin(), this->_diag.end(), result.data());
+        return result;
+    } /* ColVec<T> diag() const */
+
+    /**
+     * Returns the sum of the diagonal
+     */
+
+    T trace() const {
+        T result = T(0);
+        for (const T& value : this->_diag) {
+            result = result + value;
+        }
+        return result;
+    } /* T trace() const */
+
+    /**
+     * Returns the determinant, the product of the diagonal
+     */
+
+    T det() const {
+        T result = T(1);
+        for (const T& value : this->_diag) {
+            result = result * value;
+        }
+        return result;
+    } /* T det() const */
+
+    /**
+     * Returns the inverse, the reciprocal of each diagonal element.
+     * An ORCA_SINGULAR_MATRIX exception is thrown should any diagonal element be zero
+     */
+
+    DiagMat<T> inv() const {
+        DiagMat<T> result(this->rows());
+        index_t i;
+        for (i = 0; i < this->rows(); ++i) {
+            if (this->_diag[i] == T(0)) {
+                throw ORCAExcept::SingularMatrixError(); // No inverse
+            }
+            result._diag[i] = T(1) / this->_diag[i];
+        }
+        return result;
+    } /* DiagMat<T> inv() const */
+
+    /**
+     * Computes C = D * B for a dense row-major B (p columns) into a dense row-major C
+     */
+
+    void _scaleRows(const T* b, index_t ldb, index_t p, T* c, index_t ldc) const {
+        index_t i, j;
+        for (i = 0; i < this->rows(); ++i) {
+            const T scale = this->_diag[i];
+            for (j = 0; j < p; ++j) {
+                c[i * ldc + j] = scale * b[i * ldb + j];
+            }
+        }
+    } /* void _scaleRows(const T* b, index_t ldb, index_t p, T* c, index_t ldc) const */
+
+    /**
+     * Computes C = B * D for a dense row-major B (m rows) into a dense row-major C
+     */
+
+    void _scaleCols(const T* b, index_t ldb, index_t m, T* c, index_t ldc) const {
+        index_t i, j;
+        for (i = 0; i < m; ++i) {
+            for (j = 0; j < this->cols(); ++j) {
+                c[i * ldc + j] = b[i * ldb + j] * this->_diag[j];
+            }
+        }
+    } /* void _scaleCols(const T* b, index_t ldb, index_t m, T* c, index_t ldc) const */
+
+}; /* class DiagMat */
+
+/* Diagonal matrices are not scalars to the element-wise operators of Mat */
+
+template <class T>
+struct _matrixLike<DiagMat<T>> : std::true_type {};
+
+/* Below are the overloaded math operators for the DiagMat class */
+
+/**
+ * Diagonal matrix times dense matrix, scaling each row
+ * @param a Diagonal matrix
+ * @param b Dense matrix
+ * @return Dense product
+ */
+
+template <class T>
+Mat<T> operator * (const DiagMat<T>& a, const Mat<T>& b) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (a.cols() != b.rows()) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions do not agree
+    }
+#endif
+    if (!b.isDense()) {
+        return a * Mat<T>(b); // Views are materialized first
+    }
+    Mat<T> result(a.rows(), b.cols());
+    a._scaleRows(b.data(), b.stride(), b.cols(), result.data(), result.stride());
+    return result;
+} /* Mat<T> operator * (const DiagMat<T>& a, const Mat<T>& b) */
+
+/**
+ * Diagonal matrix times dense column vector
+ * @param a Diagonal matrix
+ * @param x Dense vector
+ * @return Dense product
+ */
+
+template <class T>
+ColVec<T> operator * (const DiagMat<T>& a, const ColVec<T>& x) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (a.cols() != x.rows()) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions do not agree
+    }
+#endif
+    if (!x.isDense()) {
+        return a * ColVec<T>(x); // Views are materialized first
+    }
+    ColVec<T> result(static_cast<int>(a.rows()));
+    a._scaleRows(x.data(), x.stride(), 1, result.data(), result.stride());
+    return result;
+} /* ColVec<T> operator * (const DiagMat<T>& a, const ColVec<T>& x) */
+
+/**
+ * Dense matrix times diagonal matrix, scaling each column
+ * @param b Dense matrix
+ * @param a Diagonal matrix
+ * @return Dense product
+ */
+
+template <class T>
+Mat<T> operator * (const Mat<T>& b, const DiagMat<T>& a) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (b.cols() != a.rows()) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions do not agree
+    }
+#endif
+    if (!b.isDense()) {
+        return Mat<T>(b) * a; // Views are materialized first
+    }
+    Mat<T> result(b.rows(), a.cols());
+    a._scaleCols(b.data(), b.stride(), b.rows(), result.data(), result.stride());
+    return result;
+} /* Mat<T> operator * (const Mat<T>& b, const DiagMat<T>& a) */
+
+/**
+ * Diagonal matrix times diagonal matrix
+ * @param a Diagonal matrix
+ * @param b Diagonal matrix
+ * @return Diagonal product
+ */
+
+template <class T>
+DiagMat<T> operator * (const DiagMat<T>& a, const DiagMat<T>& b) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (a.cols() != b.rows()) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions do not agree
+    }
+#endif
+    DiagMat<T> result(a.rows());
+    index_t i;
+    for (i = 0; i < a.rows(); ++i) {
+        result.set(i, a.at(i) * b.at(i));
+    }
+    return result;
+} /* DiagMat<T> operator * (const DiagMat<T>& a, const DiagMat<T>& b) */
+
+/* Below are nonmember functions for the DiagMat class */
+
+/**
+ * Returns the determinant of a diagonal matrix
+ * @param _m1 Diagonal matrix
+ */
+
+template <class T>
+T det(const DiagMat<T>& _m1) {
+    return _m1.det();
+} /* T det(const DiagMat<T>& _m1) */
+
+/**
+ * Returns the inverse of a diagonal matrix
+ * @param _m1 Diagonal matrix
+ */
+
+template <class T>
+DiagMat<T> inv(const DiagMat<T>& _m1) {
+    return _m1.inv();
+} /* DiagMat<T> inv(const DiagMat<T>& _m1) */
+
+/**
+ * Returns a dense copy of a diagonal matrix
+ * @param _m1 Diagonal matrix
+ */
+
+template <class T>
+Mat<T> dense(const DiagMat<T>& _m1) {
+    return _m1.dense();
+} /* Mat<T> dense(const DiagMat<T>& _m1) */
+
+/* Below are overloaded stream operators for the DiagMat class */
+
+template <class T>
+std::ostream& operator<<(std::ostream& os, const DiagMat<T>& m) {
+    os << m.dense();
+    return os;
+} /* std::ostream& operator<<(std::ostream& os, const DiagMat<T>& m) */
+
+} /* namespace ORCA */
+
+#endif /* DiagMat_h */
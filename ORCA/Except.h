@@ -147,6 +147,82 @@ public:
     }
 };
 
+/* SingularMatrixError: Thrown when an operation requires an invertible matrix */
+
+class SingularMatrixError : public ORCAException {
+public:
+    
+    /**
+     * Default constructor.
+     */
+    
+    SingularMatrixError() {
+        this->_code = ORCA_SINGULAR_MATRIX;
+        this->_desc = "ORCA Singular Matrix Error: ";
+    }
+};
+
+/* NotPositiveDefiniteError: Thrown when an operation requires a positive-definite matrix */
+
+class NotPositiveDefiniteError : public ORCAException {
+public:
+    
+    /**
+     * Default constructor.
+     */
+    
+    NotPositiveDefiniteError() {
+        this->_code = ORCA_NOT_POSITIVE_DEFINITE;
+        this->_desc = "ORCA Not Positive Definite Error: ";
+    }
+};
+
+
+/* FileError: Thrown when a file cannot be opened, read, written or mapped */
+
+class FileError : public ORCAException {
+public:
+    
+    /**
+     * Default constructor.
+     */
+    
+    FileError() {
+        this->_code = ORCA_FILE_ERROR;
+        this->_desc = "ORCA File Error: ";
+    }
+};
+
+/* BadFormatError: Thrown when a file does not hold matrices of the requested element type */
+
+class BadFormatError : public ORCAException {
+public:
+    
+    /**
+     * Default constructor.
+     */
+    
+    BadFormatError() {
+        this->_code = ORCA_BAD_FORMAT;
+        this->_desc = "ORCA Bad Format Error: ";
+    }
+};
+
+/* ReadOnlyError: Thrown when writing through a range of a const matrix */
+
+class ReadOnlyError : public ORCAException {
+public:
+    
+    /**
+     * Default constructor.
+     */
+    
+    ReadOnlyError() {
+        this->_code = ORCA_READ_ONLY;
+        this->_desc = "ORCA Read Only Error: ";
+    }
+};
+
 
 
 /* Overloaded stream operators for printing error codes */
@@ -0,0 +1,875 @@
+//
+//  FFT.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef FFT_h
+#define FFT_h
+
+/* Includes for FFT.h */
+
+#include "Except.h"         // Included for ORCA Exceptions
+#include "Complex.h"        // Included for Complex class
+#include "ComplexVec.h"     // Included for split real and imaginary storage
+#include "Mat.h"            // Included for Mat class
+#include "Vec.h"            // Included for ColVec class
+#include "Parallel.h"       // Included for batched transforms across threads
+#include <cmath>            // Included for std::cos and std::sin
+#include <memory>           // Included for std::unique_ptr
+#include <unordered_map>    // Included for the plan caches
+#include <utility>          // Included for std::swap
+#include <vector>           // Included for plan tables
+
+namespace ORCA {
+
+/**
+ * Precomputed complex discrete Fourier transform of a fixed size.
+ * The size is split into passes of radix 4, 2, 3 and 5, and any other prime factor p is handled
+ * by a direct p point butterfly, so sizes with large prime factors cost O(n p).
+ * The passes follow the Stockham algorithm, which reorders the output as it goes and needs no
+ * bit reversal; every pass reads one buffer and writes the other, so a transform ping-pongs
+ * between the caller's arrays and the plan's work arrays. Twiddle factors are computed once in
+ * the constructor. The forward transform is X[k] = sum x[j] e^(-2 pi i j k / n), and the inverse
+ * is scaled by 1/n. A plan owns its work arrays, so one plan must not run on several threads at
+ * once; cached() keeps one plan per size and thread
+ * @tparam T Component type
+ */
+
+template <class T>
+class FFTPlan {
+private:
+
+    /* One Stockham pass */
+    struct _Pass {
+        index_t radix;      // Butterfly size p
+        index_t span;       // Length L of the sub-transforms entering the pass
+        index_t stride;     // Number s of interleaved sub-transforms, n / L
+        index_t twiddles;   // Offset of the (p - 1) * L / p twiddle factors of the pass
+        index_t roots;      // Offset of the p roots of unity for the direct butterfly
+    };
+
+    /* Below are private members of the FFTPlan class */
+    index_t _n = 0;                 // Transform size
+    std::vector<_Pass> _passes;     // Passes in execution order
+    std::vector<T> _twiddleRe;      // Real parts of the twiddle factors of every pass
+    std::vector<T> _twiddleIm;      // Imaginary parts of the twiddle factors of every pass
+    std::vector<T> _rootRe;         // Real parts of the roots of unity for the direct butterflies
+    std::vector<T> _rootIm;         // Imaginary parts of the roots of unity for the direct butterflies
+    ComplexVec<T> _work;            // Work arrays for single transforms
+
+    /**
+     * Calls body(j, q) for every butterfly of a pass. The loop over whichever of j and q has
+     * more iterations is innermost, so early passes (s small) still run long contiguous loops
+     */
+
+    template <class F>
+    static void _sweep(index_t m, index_t s, F&& body) {
+        index_t j, q;
+        if (s >= m) {
+            for (j = 0; j < m; ++j) {
+                for (q = 0; q < s; ++q) {
+                    body(j, q);
+                }
+            }
+        } else {
+            for (q = 0; q < s; ++q) {
+                for (j = 0; j < m; ++j) {
+                    body(j, q);
+                }
+            }
+        }
+    } /* static void _sweep(index_t m, index_t s, F&& body) */
+
+    /**
+     * Runs one pass from x into y. Sub-transform q of length L, element j + r L / p, moves to
+     * element p j + t of sub-transform q after the p point butterfly and the twiddle w^(j t)
+     */
+
+    void _pass(const _Pass& pass, const T* xr, const T* xi, T* yr, T* yi) const {
+        const index_t p = pass.radix;
+        const index_t s = pass.stride;
+        const index_t m = pass.span / p;
+        const index_t sm = s * m;
+        const T* twr = this->_twiddleRe.data() + pass.twiddles;
+        const T* twi = this->_twiddleIm.data() + pass.twiddles;
+        if (p == 4) {
+            _sweep(m, s, [&](index_t j, index_t q) {
+                const index_t in = s * j + q;
+                const index_t out = s * 4 * j + q;
+                const T a0r = xr[in], a0i = xi[in];
+                const T a1r = xr[in + sm], a1i = xi[in + sm];
+                const T a2r = xr[in + 2 * sm], a2i = xi[in + 2 * sm];
+                const T a3r = xr[in + 3 * sm], a3i = xi[in + 3 * sm];
+                const T t0r = a0r + a2r, t0i = a0i + a2i;
+                const T t1r = a0r - a2r, t1i = a0i - a2i;
+                const T t2r = a1r + a3r, t2i = a1i + a3i;
+                const T t3r = a1i - a3i, t3i = a3r - a1r;   // -i (a1 - a3)
+                const T b1r = t1r + t3r, b1i = t1i + t3i;
+                const T b2r = t0r - t2r, b2i = t0i - t2i;
+                const T b3r = t1r - t3r, b3i = t1i - t3i;
+                const T w1r = twr[j], w1i = twi[j];
+                const T w2r = twr[m + j], w2i = twi[m + j];
+                const T w3r = twr[2 * m + j], w3i = twi[2 * m + j];
+                yr[out] = t0r + t2r;
+                yi[out] = t0i + t2i;
+                yr[out + s] = b1r * w1r - b1i * w1i;
+                yi[out + s] = b1r * w1i + b1i * w1r;
+                yr[out + 2 * s] = b2r * w2r - b2i * w2i;
+                yi[out + 2 * s] = b2r * w2i + b2i * w2r;
+                yr[out + 3 * s] = b3r * w3r - b3i * w3i;
+                yi[out + 3 * s] = b3r * w3i + b3i * w3r;
+            });
+        } else if (p == 2) {
+            _sweep(m, s, [&](index_t j, index_t q) {
+                const index_t in = s * j + q;
+                const index_t out = s * 2 * j + q;
+                const T a0r = xr[in], a0i = xi[in];
+                const T a1r = xr[in + sm], a1i = xi[in + sm];
+                const T dr = a0r - a1r, di = a0i - a1i;
+                const T wr = twr[j], wi = twi[j];
+                yr[out] = a0r + a1r;
+                yi[out] = a0i + a1i;
+                yr[out + s] = dr * wr - di * wi;
+                yi[out + s] = dr * wi + di * wr;
+            });
+        } else if (p == 3) {
+            const T c = T(0.86602540378443864676);  // sin(2 pi / 3)
+            _sweep(m, s, [&](index_t j, index_t q) {
+                const index_t in = s * j + q;
+                const index_t out = s * 3 * j + q;
+                const T a0r = xr[in], a0i = xi[in];
+                const T a1r = xr[in + sm], a1i = xi[in + sm];
+                const T a2r = xr[in + 2 * sm], a2i = xi[in + 2 * sm];
+                const T sr = a1r + a2r, si = a1i + a2i;
+                const T mr = a0r - T(0.5) * sr, mi = a0i - T(0.5) * si;
+                const T er = c * (a1i - a2i), ei = c * (a2r - a1r);     // -i sin(2 pi / 3) (a1 - a2)
+                const T b1r = mr + er, b1i = mi + ei;
+                const T b2r = mr - er, b2i = mi - ei;
+                const T w1r = twr[j], w1i = twi[j];
+                const T w2r = twr[m + j], w2i = twi[m + j];
+                yr[out] = a0r + sr;
+                yi[out] = a0i + si;
+                yr[out + s] = b1r * w1r - b1i * w1i;
+                yi[out + s] = b1r * w1i + b1i * w1r;
+                yr[out + 2 * s] = b2r * w2r - b2i * w2i;
+                yi[out + 2 * s] = b2r * w2i + b2i * w2r;
+            });
+        } else if (p == 5) {
+            const T c1 = T(0.30901699437494742410);     // cos(2 pi / 5)
+            const T c2 = T(-0.80901699437494742410);    // cos(4 pi / 5)
+            const T s1 = T(0.95105651629515357212);     // sin(2 pi / 5)
+            const T s2 = T(0.58778525229247312917);     // sin(4 pi / 5)
+            _sweep(m, s, [&](index_t j, index_t q) {
+                const index_t in = s * j + q;
+                const index_t out = s * 5 * j + q;
+                const T a0r = xr[in], a0i = xi[in];
+                const T a1r = xr[in + sm], a1i = xi[in + sm];
+                const T a2r = xr[in + 2 * sm], a2i = xi[in + 2 * sm];
+                const T a3r = xr[in + 3 * sm], a3i = xi[in + 3 * sm];
+                const T a4r = xr[in + 4 * sm], a4i = xi[in + 4 * sm];
+                const T u1r = a1r + a4r, u1i = a1i + a4i;
+                const T u2r = a2r + a3r, u2i = a2i + a3i;
+                const T d1r = a1r - a4r, d1i = a1i - a4i;
+                const T d2r = a2r - a3r, d2i = a2i - a3i;
+                const T m1r = a0r + c1 * u1r + c2 * u2r, m1i = a0i + c1 * u1i + c2 * u2i;
+                const T m2r = a0r + c2 * u1r + c1 * u2r, m2i = a0i + c2 * u1i + c1 * u2i;
+                const T n1r = s1 * d1r + s2 * d2r, n1i = s1 * d1i + s2 * d2i;
+                const T n2r = s2 * d1r - s1 * d2r, n2i = s2 * d1i - s1 * d2i;
+                /* Output t is m -/+ i n, with -i n = (n.im, -n.re) */
+                const T b1r = m1r + n1i, b1i = m1i - n1r;
+                const T b4r = m1r - n1i, b4i = m1i + n1r;
+                const T b2r = m2r + n2i, b2i = m2i - n2r;
+                const T b3r = m2r - n2i, b3i = m2i + n2r;
+                const T w1r = twr[j], w1i = twi[j];
+                const T w2r = twr[m + j], w2i = twi[m + j];
+                const T w3r = twr[2 * m + j], w3i = twi[2 * m + j];
+                const T w4r = twr[3 * m + j], w4i = twi[3 * m + j];
+                yr[out] = a0r + u1r + u2r;
+                yi[out] = a0i + u1i + u2i;
+                yr[out + s] = b1r * w1r - b1i * w1i;
+                yi[out + s] = b1r * w1i + b1i * w1r;
+                yr[out + 2 * s] = b2r * w2r - b2i * w2i;
+                yi[out + 2 * s] = b2r * w2i + b2i * w2r;
+                yr[out + 3 * s] = b3r * w3r - b3i * w3i;
+                yi[out + 3 * s] = b3r * w3i + b3i * w3r;
+                yr[out + 4 * s] = b4r * w4r - b4i * w4i;
+                yi[out + 4 * s] = b4r * w4i + b4i * w4r;
+            });
+        } else {
+            const T* rootRe = this->_rootRe.data() + pass.roots;
+            const T* rootIm = this->_rootIm.data() + pass.roots;
+            _sweep(m, s, [&](index_t j, index_t q) {
+                const index_t in = s * j + q;
+                const index_t out = s * p * j + q;
+                index_t r, t;
+                for (t = 0; t < p; ++t) {
+                    T sumR = 0, sumI = 0;
+                    index_t root = 0;   // (r t) mod p
+                    for (r = 0; r < p; ++r) {
+                        const T ar = xr[in + r * sm], ai = xi[in + r * sm];
+                        sumR += ar * rootRe[root] - ai * rootIm[root];
+                        sumI += ar * rootIm[root] + ai * rootRe[root];
+                        root += t;
+                        if (root >= p) {
+                            root -= p;
+                        }
+                    }
+                    if (t == 0) {
+                        yr[out] = sumR;
+                        yi[out] = sumI;
+                    } else {
+                        const T wr = twr[(t - 1) * m + j], wi = twi[(t - 1) * m + j];
+                        yr[out + t * s] = sumR * wr - sumI * wi;
+                        yi[out + t * s] = sumR * wi + sumI * wr;
+                    }
+                }
+            });
+        }
+    } /* void _pass(const _Pass& pass, const T* xr, const T* xi, T* yr, T* yi) const */
+
+public:
+
+    /* Below are public constructors for the FFTPlan class */
+
+    /**
+     * Builds the passes and twiddle factors for transforms of size n
+     * @param n Transform size, at least 1
+     */
+
+    explicit FFTPlan(index_t n) : _n(n), _work(n) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (n < 1) {
+            throw ORCAExcept::BadDimensionsError(); // Transforms need at least one element
+        }
+#endif
+        std::vector<index_t> radices;
+        index_t rest = n;
+        while (rest % 4 == 0) {
+            radices.push_back(4);
+            rest /= 4;
+        }
+        if (rest % 2 == 0) {
+            radices.push_back(2);
+            rest /= 2;
+        }
+        index_t factor;
+        for (factor = 3; factor * factor <= rest; factor += 2) {
+            while (rest % factor == 0) {
+                radices.push_back(factor);
+                rest /= factor;
+            }
+        }
+        if (rest > 1) {
+            radices.push_back(rest);
+        }
+        const long double tau = 6.283185307179586476925286766559L;
+        index_t span = n;
+        for (index_t p : radices) {
+            _Pass pass = {p, span, n / span, static_cast<index_t>(this->_twiddleRe.size()), static_cast<index_t>(this->_rootRe.size())};
+            const index_t m = span / p;
+            index_t t, j;
+            for (t = 1; t < p; ++t) {
+                for (j = 0; j < m; ++j) {
+                    const long double angle = -tau * static_cast<long double>(j * t) / static_cast<long double>(span);
+                    this->_twiddleRe.push_back(static_cast<T>(std::cos(angle)));
+                    this->_twiddleIm.push_back(static_cast<T>(std::sin(angle)));
+                }
+            }
+            if (p > 5) {
+                for (t = 0; t < p; ++t) {
+                    const long double angle = -tau * static_cast<long double>(t) / static_cast<long double>(p);
+                    this->_rootRe.push_back(static_cast<T>(std::cos(angle)));
+                    this->_rootIm.push_back(static_cast<T>(std::sin(angle)));
+                }
+            }
+            this->_passes.push_back(pass);
+            span = m;
+        }
+    } /* explicit FFTPlan(index_t n) */
+
+    /* Below are public getters for the FFTPlan class */
+
+    /**
+     * Returns the transform size
+     */
+
+    index_t size() const {
+        return this->_n;
+    } /* index_t size() const */
+
+    /**
+     * Returns the plan for size n kept for the calling thread, building it on first use
+     * @param n Transform size
+     */
+
+    static FFTPlan& cached(index_t n) {
+        static thread_local std::unordered_map<index_t, std::unique_ptr<FFTPlan>> plans;
+        std::unique_ptr<FFTPlan>& plan = plans[n];
+        if (!plan) {
+            plan.reset(new FFTPlan(n));
+        }
+        return *plan;
+    } /* static FFTPlan& cached(index_t n) */
+
+    /* Below are public member functions of the FFTPlan class */
+
+    /**
+     * Unscaled forward transform of re + i im in place, using the given work arrays.
+     * The inverse transform is the same kernel with the real and imaginary arrays exchanged
+     * @param re Real parts, n elements
+     * @param im Imaginary parts, n elements
+     * @param workRe Work array, n elements
+     * @param workIm Work array, n elements
+     */
+
+    void _transform(T* re, T* im, T* workRe, T* workIm) const {
+        T* xr = re;
+        T* xi = im;
+        T* yr = workRe;
+        T* yi = workIm;
+        for (const _Pass& pass : this->_passes) {
+            this->_pass(pass, xr, xi, yr, yi);
+            std::swap(xr, yr);
+            std::swap(xi, yi);
+        }
+        if (xr != re) {
+            index_t i;
+            for (i = 0; i < this->_n; ++i) {
+                re[i] = xr[i];
+                im[i] = xi[i];
+            }
+        }
+    } /* void _transform(T* re, T* im, T* workRe, T* workIm) const */
+
+    /**
+     * Forward transform in place
+     * @param re Real parts, n elements
+     * @param im Imaginary parts, n elements
+     */
+
+    void forward(T* re, T* im) {
+        this->_transform(re, im, this->_work.real(), this->_work.imag());
+    } /* void forward(T* re, T* im) */
+
+    /**
+     * Inverse transform in place, scaled by 1/n
+     * @param re Real parts, n elements
+     * @param im Imaginary parts, n elements
+     */
+
+    void inverse(T* re, T* im) {
+        this->_transform(im, re, this->_work.imag(), this->_work.real());
+        const T scale = T(1) / static_cast<T>(this->_n);
+        index_t i;
+        for (i = 0; i < this->_n; ++i) {
+            re[i] *= scale;
+            im[i] *= scale;
+        }
+    } /* void inverse(T* re, T* im) */
+
+    /**
+     * Forward transform of an array in place
+     * @param signal Complex numbers, n elements
+     */
+
+    void forward(ComplexVec<T>& signal) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (signal.size() != this->_n) {
+            throw ORCAExcept::BadDimensionsError(); // Array size differs from the plan size
+        }
+#endif
+        this->forward(signal.real(), signal.imag());
+    } /* void forward(ComplexVec<T>& signal) */
+
+    /**
+     * Inverse transform of an array in place, scaled by 1/n
+     * @param spectrum Complex numbers, n elements
+     */
+
+    void inverse(ComplexVec<T>& spectrum) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (spectrum.size() != this->_n) {
+            throw ORCAExcept::BadDimensionsError(); // Array size differs from the plan size
+        }
+#endif
+        this->inverse(spectrum.real(), spectrum.imag());
+    } /* void inverse(ComplexVec<T>& spectrum) */
+
+    /**
+     * Forward transforms of count signals in place, split across threads. Signal k occupies
+     * re[k * stride, k * stride + n) and im[k * stride, k * stride + n)
+     * @param re Real parts
+     * @param im Imaginary parts
+     * @param count Number of signals
+     * @param stride Distance between consecutive signals, at least n
+     */
+
+    void forward(T* re, T* im, index_t count, index_t stride) {
+        this->_batch(re, im, count, stride, false);
+    } /* void forward(T* re, T* im, index_t count, index_t stride) */
+
+    /**
+     * Inverse transforms of count signals in place, scaled by 1/n and split across threads
+     * @param re Real parts
+     * @param im Imaginary parts
+     * @param count Number of signals
+     * @param stride Distance between consecutive signals, at least n
+     */
+
+    void inverse(T* re, T* im, index_t count, index_t stride) {
+        this->_batch(re, im, count, stride, true);
+    } /* void inverse(T* re, T* im, index_t count, index_t stride) */
+
+private:
+
+    /**
+     * Runs count transforms. A single range reuses the plan's work arrays, and every other range
+     * allocates its own
+     */
+
+    void _batch(T* re, T* im, index_t count, index_t stride, bool inverse) {
+        const index_t n = this->_n;
+        const index_t work = count * n * (4 * static_cast<index_t>(this->_passes.size()) + 1);
+        _parallelFor(0, count, work, [&](index_t first, index_t last) {
+            ComplexVec<T> local;
+            ComplexVec<T>& buffer = ((first == 0) && (last == count)) ? this->_work : local;
+            if (buffer.size() != n) {
+                buffer = ComplexVec<T>(n);
+            }
+            const T scale = T(1) / static_cast<T>(n);
+            index_t k, i;
+            for (k = first; k < last; ++k) {
+                T* r = re + k * stride;
+                T* m = im + k * stride;
+                if (inverse) {
+                    this->_transform(m, r, buffer.imag(), buffer.real());
+                    for (i = 0; i < n; ++i) {
+                        r[i] *= scale;
+                        m[i] *= scale;
+                    }
+                } else {
+                    this->_transform(r, m, buffer.real(), buffer.imag());
+                }
+            }
+        });
+    } /* void _batch(T* re, T* im, index_t count, index_t stride, bool inverse) */
+
+}; /* class FFTPlan */
+
+/**
+ * Precomputed discrete Fourier transform of real signals of a fixed size.
+ * The n / 2 + 1 non-negative frequency bins are returned; the others are their conjugates.
+ * Even sizes pack the even and odd samples into the real and imaginary parts of a complex
+ * signal of size n / 2, transform that, and separate the two halves with one twiddle per bin,
+ * which halves the work of a complex transform. Odd sizes run a complex transform of size n.
+ * The inverse is scaled by 1/n. A plan owns its work arrays, so one plan must not run on
+ * several threads at once; cached() keeps one plan per size and thread
+ * @tparam T Component type
+ */
+
+template <class T>
+class RealFFTPlan {
+private:
+    /* Below are private members of the RealFFTPlan class */
+    index_t _n = 0;                 // Signal size
+    FFTPlan<T> _complex;            // Transform of size n / 2 for even n, n for odd n
+    std::vector<T> _twiddleRe;      // Real parts of e^(-2 pi i k / n), k < n / 2
+    std::vector<T> _twiddleIm;      // Imaginary parts of e^(-2 pi i k / n), k < n / 2
+    ComplexVec<T> _packed;          // Packed complex signal for single transforms
+    ComplexVec<T> _work;            // Work arrays for single transforms
+
+    /**
+     * Returns the complex transform size for a signal size
+     */
+
+    static index_t _complexSize(index_t n) {
+        return (n % 2 == 0) ? (n / 2) : n;
+    } /* static index_t _complexSize(index_t n) */
+
+    /**
+     * Forward transform of one signal using the given packed and work arrays
+     */
+
+    void _forward(const T* signal, T* re, T* im, T* zr, T* zi, T* wr, T* wi) const {
+        const index_t n = this->_n;
+        index_t k;
+        if (n % 2 != 0) {
+            for (k = 0; k < n; ++k) {
+                zr[k] = signal[k];
+                zi[k] = 0;
+            }
+            this->_complex._transform(zr, zi, wr, wi);
+            for (k = 0; k <= n / 2; ++k) {
+                re[k] = zr[k];
+                im[k] = zi[k];
+            }
+            return;
+        }
+        const index_t h = n / 2;
+        for (k = 0; k < h; ++k) {
+            zr[k] = signal[2 * k];
+            zi[k] = signal[2 * k + 1];
+        }
+        this->_complex._transform(zr, zi, wr, wi);
+        const T z0r = zr[0], z0i = zi[0];
+        for (k = 1; k < h; ++k) {
+            /* E = (Z[k] + conj(Z[h - k])) / 2 and O = -i (Z[k] - conj(Z[h - k])) / 2 */
+            const T ar = zr[k], ai = zi[k];
+            const T br = zr[h - k], bi = -zi[h - k];
+            const T er = T(0.5) * (ar + br), ei = T(0.5) * (ai + bi);
+            const T odr = T(0.5) * (ai - bi), odi = T(0.5) * (br - ar);
+            const T tr = this->_twiddleRe[k], ti = this->_twiddleIm[k];
+            re[k] = er + (odr * tr - odi * ti);
+            im[k] = ei + (odr * ti + odi * tr);
+        }
+        re[0] = z0r + z0i;
+        im[0] = 0;
+        re[h] = z0r - z0i;
+        im[h] = 0;
+    } /* void _forward(const T* signal, T* re, T* im, T* zr, T* zi, T* wr, T* wi) const */
+
+    /**
+     * Inverse transform of one spectrum using the given packed and work arrays
+     */
+
+    void _inverse(const T* re, const T* im, T* signal, T* zr, T* zi, T* wr, T* wi) const {
+        const index_t n = this->_n;
+        index_t k;
+        if (n % 2 != 0) {
+            zr[0] = re[0];
+            zi[0] = 0;
+            for (k = 1; k <= n / 2; ++k) {
+                zr[k] = re[k];
+                zi[k] = im[k];
+                zr[n - k] = re[k];
+                zi[n - k] = -im[k];
+            }
+            this->_complex._transform(zi, zr, wi, wr);
+            const T scale = T(1) / static_cast<T>(n);
+            for (k = 0; k < n; ++k) {
+                signal[k] = zr[k] * scale;
+            }
+            return;
+        }
+        const index_t h = n / 2;
+        const T scale = T(0.5) / static_cast<T>(h);
+        for (k = 0; k < h; ++k) {
+            /* E = (X[k] + conj(X[h - k])) / 2, O = (X[k] - conj(X[h - k])) conj(w^k) / 2, Z = E + i O */
+            const T ar = re[k], ai = im[k];
+            const T br = re[h - k], bi = -im[h - k];
+            const T er = scale * (ar + br), ei = scale * (ai + bi);
+            const T dr = scale * (ar - br), di = scale * (ai - bi);
+            const T tr = this->_twiddleRe[k], ti = -this->_twiddleIm[k];
+            const T odr = dr * tr - di * ti, odi = dr * ti + di * tr;
+            zr[k] = er - odi;
+            zi[k] = ei + odr;
+        }
+        this->_complex._transform(zi, zr, wi, wr);
+        for (k = 0; k < h; ++k) {
+            signal[2 * k] = zr[k];
+            signal[2 * k + 1] = zi[k];
+        }
+    } /* void _inverse(const T* re, const T* im, T* signal, T* zr, T* zi, T* wr, T* wi) const */
+
+    /**
+     * Runs count transforms. A single range reuses the plan's arrays, and every other range
+     * allocates its own
+     */
+
+    template <class F>
+    void _batch(index_t count, F&& transform) {
+        const index_t c = _complexSize(this->_n);
+        _parallelFor(0, count, count * this->_n * 16, [&](index_t first, index_t last) {
+            ComplexVec<T> localPacked, localWork;
+            const bool whole = (first == 0) && (last == count);
+            ComplexVec<T>& packed = whole ? this->_packed : localPacked;
+            ComplexVec<T>& work = whole ? this->_work : localWork;
+            if (packed.size() != c) {
+                packed = ComplexVec<T>(c);
+                work = ComplexVec<T>(c);
+            }
+            index_t k;
+            for (k = first; k < last; ++k) {
+                transform(k, packed.real(), packed.imag(), work.real(), work.imag());
+            }
+        });
+    } /* void _batch(index_t count, F&& transform) */
+
+public:
+
+    /* Below are public constructors for the RealFFTPlan class */
+
+    /**
+     * Builds the transform for real signals of size n
+     * @param n Signal size, at least 1
+     */
+
+    explicit RealFFTPlan(index_t n) : _n(n), _complex(_complexSize(n)), _packed(_complexSize(n)), _work(_complexSize(n)) {
+        if (n % 2 == 0) {
+            const long double tau = 6.283185307179586476925286766559L;
+            index_t k;
+            for (k = 0; k < n / 2; ++k) {
+                const long double angle = -tau * static_cast<long double>(k) / static_cast<long double>(n);
+                this->_twiddleRe.push_back(static_cast<T>(std::cos(angle)));
+                this->_twiddleIm.push_back(static_cast<T>(std::sin(angle)));
+            }
+        }
+    } /* explicit RealFFTPlan(index_t n) */
+
+    /* Below are public getters for the RealFFTPlan class */
+
+    /**
+     * Returns the signal size
+     */
+
+    index_t size() const {
+        return this->_n;
+    } /* index_t size() const */
+
+    /**
+     * Returns the number of frequency bins, n / 2 + 1
+     */
+
+    index_t bins() const {
+        return this->_n / 2 + 1;
+    } /* index_t bins() const */
+
+    /**
+     * Returns the plan for size n kept for the calling thread, building it on first use
+     * @param n Signal size
+     */
+
+    static RealFFTPlan& cached(index_t n) {
+        static thread_local std::unordered_map<index_t, std::unique_ptr<RealFFTPlan>> plans;
+        std::unique_ptr<RealFFTPlan>& plan = plans[n];
+        if (!plan) {
+            plan.reset(new RealFFTPlan(n));
+        }
+        return *plan;
+    } /* static RealFFTPlan& cached(index_t n) */
+
+    /* Below are public member functions of the RealFFTPlan class */
+
+    /**
+     * Forward transform of one signal
+     * @param signal Samples, n elements
+     * @param re Real parts of the bins, n / 2 + 1 elements
+     * @param im Imaginary parts of the bins, n / 2 + 1 elements
+     */
+
+    void forward(const T* signal, T* re, T* im) {
+        this->_forward(signal, re, im, this->_packed.real(), this->_packed.imag(), this->_work.real(), this->_work.imag());
+    } /* void forward(const T* signal, T* re, T* im) */
+
+    /**
+     * Inverse transform of one spectrum, scaled by 1/n. Only the real parts of the zero and,
+     * for even n, the n / 2 frequency bins are used
+     * @param re Real parts of the bins, n / 2 + 1 elements
+     * @param im Imaginary parts of the bins, n / 2 + 1 elements
+     * @param signal Samples, n elements
+     */
+
+    void inverse(const T* re, const T* im, T* signal) {
+        this->_inverse(re, im, signal, this->_packed.real(), this->_packed.imag(), this->_work.real(), this->_work.imag());
+    } /* void inverse(const T* re, const T* im, T* signal) */
+
+    /**
+     * Forward transforms of count signals, split across threads. Signal k starts at
+     * signals + k * signalStride and its bins at re + k * binStride and im + k * binStride
+     * @param signals Samples
+     * @param signalStride Distance between consecutive signals, at least n
+     * @param re Real parts of the bins
+     * @param im Imaginary parts of the bins
+     * @param binStride Distance between consecutive spectra, at least n / 2 + 1
+     * @param count Number of signals
+     */
+
+    void forward(const T* signals, index_t signalStride, T* re, T* im, index_t binStride, index_t count) {
+        this->_batch(count, [&](index_t k, T* zr, T* zi, T* wr, T* wi) {
+            this->_forward(signals + k * signalStride, re + k * binStride, im + k * binStride, zr, zi, wr, wi);
+        });
+    } /* void forward(const T* signals, index_t signalStride, T* re, T* im, index_t binStride, index_t count) */
+
+    /**
+     * Inverse transforms of count spectra, scaled by 1/n and split across threads
+     * @param re Real parts of the bins
+     * @param im Imaginary parts of the bins
+     * @param binStride Distance between consecutive spectra, at least n / 2 + 1
+     * @param signals Samples
+     * @param signalStride Distance between consecutive signals, at least n
+     * @param count Number of spectra
+     */
+
+    void inverse(const T* re, const T* im, index_t binStride, T* signals, index_t signalStride, index_t count) {
+        this->_batch(count, [&](index_t k, T* zr, T* zi, T* wr, T* wi) {
+            this->_inverse(re + k * binStride, im + k * binStride, signals + k * signalStride, zr, zi, wr, wi);
+        });
+    } /* void inverse(const T* re, const T* im, index_t binStride, T* signals, index_t signalStride, index_t count) */
+
+}; /* class RealFFTPlan */
+
+/* Below are the transform functions, which use the cached plans */
+
+/**
+ * Copies a row or column vector into contiguous storage
+ * @param _vector Vector to copy
+ * @param out Destination, one element per vector element
+ */
+
+template <class T>
+void _copyVector(const Mat<T>& _vector, T* out) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if ((_vector.rows() != 1) && (_vector.cols() != 1)) {
+        throw ORCAExcept::BadDimensionsError(); // Only vectors are transformed
+    }
+#endif
+    const index_t length = (_vector.cols() == 1) ? _vector.rows() : _vector.cols();
+    const T* base;
+    index_t rowStride, colStride;
+    const bool stored = _vector._layout(base, rowStride, colStride);
+    const index_t step = (_vector.cols() == 1) ? rowStride : colStride;
+    index_t i;
+    for (i = 0; i < length; ++i) {
+        if (stored) {
+            out[i] = base[i * step];
+        } else {
+            out[i] = (_vector.cols() == 1) ? _vector.at(i, 0) : _vector.at(0, i);
+        }
+    }
+} /* void _copyVector(const Mat<T>& _vector, T* out) */
+
+/**
+ * Returns the forward transform of a complex signal
+ * @param signal Complex samples
+ */
+
+template <class T>
+ComplexVec<T> fft(const ComplexVec<T>& signal) {
+    ComplexVec<T> result(signal);
+    if (result.size() > 0) {
+        FFTPlan<T>::cached(result.size()).forward(result);
+    }
+    return result;
+} /* ComplexVec<T> fft(const ComplexVec<T>& signal) */
+
+/**
+ * Returns the inverse transform of a spectrum, scaled by 1/n
+ * @param spectrum Complex bins
+ */
+
+template <class T>
+ComplexVec<T> ifft(const ComplexVec<T>& spectrum) {
+    ComplexVec<T> result(spectrum);
+    if (result.size() > 0) {
+        FFTPlan<T>::cached(result.size()).inverse(result);
+    }
+    return result;
+} /* ComplexVec<T> ifft(const ComplexVec<T>& spectrum) */
+
+/**
+ * Returns the n / 2 + 1 non-negative frequency bins of a real signal
+ * @param signal Row or column vector of samples
+ */
+
+template <class T>
+ComplexVec<T> rfft(const Mat<T>& signal) {
+    const index_t n = signal.rows() * signal.cols();
+    ColVec<T> samples(n);
+    _copyVector(signal, samples.data());
+    RealFFTPlan<T>& plan = RealFFTPlan<T>::cached(n);
+    ComplexVec<T> result(plan.bins());
+    plan.forward(samples.data(), result.real(), result.imag());
+    return result;
+} /* ComplexVec<T> rfft(const Mat<T>& signal) */
+
+/**
+ * Returns the real signal of size n with the given non-negative frequency bins, scaled by 1/n
+ * @param spectrum n / 2 + 1 complex bins
+ * @param n Signal size
+ */
+
+template <class T>
+ColVec<T> irfft(const ComplexVec<T>& spectrum, index_t n) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if ((n < 1) || (spectrum.size() != n / 2 + 1)) {
+        throw ORCAExcept::BadDimensionsError(); // A signal of size n has n / 2 + 1 bins
+    }
+#endif
+    ColVec<T> result(n);
+    RealFFTPlan<T>::cached(n).inverse(spectrum.real(), spectrum.imag(), result.data());
+    return result;
+} /* ColVec<T> irfft(const ComplexVec<T>& spectrum, index_t n) */
+
+/**
+ * Returns the transforms of every row of a complex matrix, one spectrum per row
+ * @param signals One signal per row
+ */
+
+template <class T>
+Mat<Complex<T>> fftRows(const Mat<Complex<T>>& signals) {
+    const index_t count = signals.rows();
+    const index_t n = signals.cols();
+    Mat<Complex<T>> result(count, n);
+    if ((count == 0) || (n == 0)) {
+        return result;
+    }
+    ComplexVec<T> planes(count * n);
+    T* re = planes.real();
+    T* im = planes.imag();
+    index_t k, i;
+    for (k = 0; k < count; ++k) {
+        for (i = 0; i < n; ++i) {
+            const Complex<T> value = signals.at(k, i);
+            re[k * n + i] = value.re();
+            im[k * n + i] = value.im();
+        }
+    }
+    FFTPlan<T>::cached(n).forward(re, im, count, n);
+    for (k = 0; k < count; ++k) {
+        for (i = 0; i < n; ++i) {
+            result.set(k, i, Complex<T>(re[k * n + i], im[k * n + i]));
+        }
+    }
+    return result;
+} /* Mat<Complex<T>> fftRows(const Mat<Complex<T>>& signals) */
+
+/**
+ * Returns the non-negative frequency bins of every row of a real matrix, one spectrum of
+ * n / 2 + 1 bins per row
+ * @param signals One signal per row
+ */
+
+template <class T>
+Mat<Complex<T>> rfftRows(const Mat<T>& signals) {
+    const index_t count = signals.rows();
+    const index_t n = signals.cols();
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (n < 1) {
+        throw ORCAExcept::BadDimensionsError(); // Signals need at least one sample
+    }
+#endif
+    RealFFTPlan<T>& plan = RealFFTPlan<T>::cached(n);
+    const index_t bins = plan.bins();
+    Mat<Complex<T>> result(count, bins);
+    if (count == 0) {
+        return result;
+    }
+    Mat<T> samples(signals);
+    ComplexVec<T> planes(count * bins);
+    plan.forward(samples.data(), samples.stride(), planes.real(), planes.imag(), bins, count);
+    index_t k, i;
+    for (k = 0; k < count; ++k) {
+        for (i = 0; i < bins; ++i) {
+            result.set(k, i, Complex<T>(planes.real()[k * bins + i], planes.imag()[k * bins + i]));
+        }
+    }
+    return result;
+} /* Mat<Complex<T>> rfftRows(const Mat<T>& signals) */
+
+} /* namespace ORCA */
+
+#endif /* FFT_h */
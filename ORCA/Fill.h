@@ -19,6 +19,7 @@ namespace fill {
     fillType value = 0x2;
     fillType eye = 0x3;
     fillType rand = 0x4;
+    fillType randn = 0x5;
 }
 
 #endif /* Fill_h */
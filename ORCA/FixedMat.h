@@ -0,0 +1,1021 @@
+//
+//  FixedMat.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef FixedMat_h
+#define FixedMat_h
+
+/* Includes for FixedMat.h */
+
+#include "Except.h" // Included for ORCA Exceptions
+#include "Checks.h" // Included for check policies
+#include "Fill.h"   // Included for Fill types
+#include "Mat.h"    // Included for conversion to and from dynamic matrices
+#include "Vec.h"    // Included for conversion to and from dynamic vectors
+#include <type_traits>  // Included for std::enable_if
+#include <utility>      // Included for std::index_sequence
+
+namespace ORCA {
+
+/**
+ * Returns true if the dimensions describe a fixed-size matrix
+ * @param rows number of rows
+ * @param cols number of columns
+ */
+
+constexpr bool _isFixed(index_t rows, index_t cols) {
+    return (rows > 0) && (cols > 0);
+} /* constexpr bool _isFixed(index_t rows, index_t cols) */
+
+/**
+ * True for matrices and the classes derived from them, so the scalar operators below
+ * never take a vector operand such as ColVec<T, N> in place of a scalar
+ */
+
+template <class T, index_t R, index_t C>
+std::true_type _matTest(const Mat<T, R, C>*);
+
+std::false_type _matTest(...);
+
+template <class T>
+constexpr bool _isMatType = decltype(_matTest(std::declval<T*>()))::value;
+
+/**
+ * Fixed-size matrix class
+ * Elements are stored inline in row-major order, so the matrix lives entirely on the stack.
+ * There are no virtual functions and all dimension checks are performed at compile time.
+ * Intended for the small matrices common in kinematics (3x3, 4x4, 6x6)
+ * @tparam T Element type
+ * @tparam R Number of rows
+ * @tparam C Number of columns
+ */
+
+template <class T, index_t R, index_t C>
+class Mat {
+    static_assert(_isFixed(R, C), "ORCA: Fixed-size matrix dimensions must be positive");
+protected:
+
+    /* Below are protected variables of the fixed-size Mat class */
+
+    T _data[R * C];     // Inline storage for matrix elements in row-major order
+
+    /* Below are protected member functions of the fixed-size Mat class */
+
+    /**
+     * Checks that an index lies within the matrix
+     * @param row row of element
+     * @param col column of element
+     */
+
+    static void _checkBounds(index_t row, index_t col) {
+        _checkIndex<checks::Default>(row, col, R, C);
+    } /* static void _checkBounds(index_t row, index_t col) */
+
+public:
+
+    /* Below are public constructors for the fixed-size Mat class */
+
+    /**
+     * Default constructor. Like the built in types, the elements are left uninitialized
+     */
+
+    Mat() {
+
+    } /* Mat() */
+
+    /**
+     * Construct and populate matrix
+     * @param type Fill Type
+     */
+
+    Mat(fill::fillType type) {
+        index_t i;
+        switch (type) {
+            case fill::zeros:
+                this->fill(0); // Fill Martix with Zeros
+                break;
+            case fill::ones:
+                this->fill(1); // Fill the matrix with Ones
+                break;
+            case fill::eye:
+                this->fill(0); // Fill with Identity Matrix
+                for (i = 0; (i < R) && (i < C); ++i) {
+                    this->_data[i * C + i] = 1;
+                }
+                break;
+            default:
+#ifndef ORCA_DISABLE_ERROR_CHECKS
+                throw ORCAExcept::UnknownFillError();
+#endif
+                break;
+        }
+    } /* Mat(fill::fillType type) */
+
+    /**
+     * Construct and populate matrix with element
+     * @param type Fill Type
+     * @param elem Element to fill the matrix with
+     */
+
+    Mat(fill::fillType type, T elem) {
+        switch (type) {
+            case fill::value:
+                this->fill(elem); // Fill Martix with element
+                break;
+            default:
+#ifndef ORCA_DISABLE_ERROR_CHECKS
+                throw ORCAExcept::UnknownFillError();
+#endif
+                break;
+        }
+    } /* Mat(fill::fillType type, T elem) */
+
+    /**
+     * Casted constructor from std::initializer_list.
+     * @param _castValues Values for array
+     */
+
+    Mat(std::initializer_list<std::initializer_list<T> > _castValues) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (static_cast<index_t>(_castValues.size()) != R) {
+            throw ORCAExcept::BadDimensionsError(); // Wrong number of rows in list
+        }
+#endif
+        index_t i,j;
+        for (i = 0; i < R; ++i) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+            if (static_cast<index_t>((_castValues.begin() + i)->size()) != C) {
+                throw ORCAExcept::BadDimensionsError(); // Wrong number of columns in row
+            }
+#endif
+            for (j = 0; j < C; ++j) {
+                this->_data[i * C + j] = *(((_castValues.begin() + i)->begin()) + j);
+            }
+        }
+    } /* Mat(std::initializer_list<std::initializer_list<T> > _castValues) */
+
+    /**
+     * Casted constructor from another fixed-size matrix of the same dimensions
+     * @tparam T1 class of other matrix
+     * @param _castM Other matrix
+     */
+
+    template <class T1>
+    Mat(const Mat<T1, R, C>& _castM) {
+        index_t i;
+        for (i = 0; i < R * C; ++i) {
+            this->_data[i] = _castM.data()[i];
+        }
+    } /* Mat(const Mat<T1, R, C>& _castM) */
+
+    /**
+     * Casted constructor from a dynamic matrix.
+     * An ORCA_BAD_DIMENSIONS exception is thrown should the dimensions not match
+     * @tparam T1 class of other matrix
+     * @param _castM Other matrix
+     */
+
+    template <class T1>
+    explicit Mat(const Mat<T1>& _castM) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((_castM.rows() != R) || (_castM.cols() != C)) {
+            throw ORCAExcept::BadDimensionsError(); // Dynamic matrix has the wrong dimensions
+        }
+#endif
+        index_t i,j;
+        for (i = 0; i < R; ++i) {
+            for (j = 0; j < C; ++j) {
+                this->_data[i * C + j] = _castM.at(i, j);
+            }
+        }
+    } /* explicit Mat(const Mat<T1>& _castM) */
+
+    /* Below are public operators for the fixed-size Mat class */
+
+    /**
+     * Conversion to a dynamic matrix
+     * @return Heap allocated copy of the matrix
+     */
+
+    operator Mat<T>() const {
+        Mat<T> result(R, C);
+        index_t i,j;
+        for (i = 0; i < R; ++i) {
+            for (j = 0; j < C; ++j) {
+                result.set(i, j, this->_data[i * C + j]);
+            }
+        }
+        return result;
+    } /* operator Mat<T>() const */
+
+    /* Below are public setters for the fixed-size Mat class */
+
+    /**
+     * Assigns an element at the speciifed index.
+     * @param row Element Row Index
+     * @param col Element Column Index
+     * @param elem Element to be added
+     */
+
+    void set(index_t row, index_t col, T elem) {
+        _checkBounds(row, col);
+        this->_data[row * C + col] = elem;
+    } /* void set(index_t row, index_t col, T elem) */
+
+    /**
+     * Assigns an element without bounds checks, for indices already known to be valid
+     * @param row Element Row Index
+     * @param col Element Column Index
+     * @param elem Element to be added
+     */
+
+    void unchecked_set(index_t row, index_t col, T elem) {
+        this->_data[row * C + col] = elem;
+    } /* void unchecked_set(index_t row, index_t col, T elem) */
+
+    /**
+     * Fills the matrix with the specified element
+     * @param elem The element to fill the matrix with
+     */
+
+    void fill(T elem) {
+        index_t i;
+        for (i = 0; i < R * C; ++i) {
+            this->_data[i] = elem;
+        }
+    } /* void fill(T elem) */
+
+    /* Below are public getters for the fixed-size Mat class */
+
+    /**
+     * Returns element at the specified index
+     * @param row Element Row Index
+     * @param col Element Column Index
+     */
+
+    T at(index_t row, index_t col) const {
+        _checkBounds(row, col);
+        return this->_data[row * C + col];
+    } /* T at(index_t row, index_t col) const */
+
+    /**
+     * Returns the element at the specified index without bounds checks, for indices already
+     * known to be valid
+     * @param row Element Row Index
+     * @param col Element Column Index
+     */
+
+    T unchecked_at(index_t row, index_t col) const {
+        return this->_data[row * C + col];
+    } /* T unchecked_at(index_t row, index_t col) const */
+
+    /**
+     * Returns a pointer to the row-major element storage
+     */
+
+    T* data() {
+        return this->_data;
+    } /* T* data() */
+
+    /**
+     * Returns a pointer to the row-major element storage
+     */
+
+    const T* data() const {
+        return this->_data;
+    } /* const T* data() const */
+
+    /**
+     * Returns number of rows in matrix
+     */
+
+    static constexpr index_t rows() {
+        return R;
+    } /* static constexpr index_t rows() */
+
+    /**
+     * Returns number of columns in matrix
+     */
+
+    static constexpr index_t cols() {
+        return C;
+    } /* static constexpr index_t cols() */
+
+    /**
+     * Returns the transpose of the matrix.
+     * Unlike the dynamic matrix no container is used, copying a small matrix is cheaper than indirection
+     * @return Matrix Transpose
+     */
+
+    Mat<T, C, R> t() const {
+        Mat<T, C, R> result;
+        index_t i,j;
+        for (i = 0; i < R; ++i) {
+            for (j = 0; j < C; ++j) {
+                result.data()[j * R + i] = this->_data[i * C + j];
+            }
+        }
+        return result;
+    } /* Mat<T, C, R> t() const */
+
+    /* Below are member functions of the fixed-size Mat class */
+
+    T trace() const;
+    T det() const;
+    Mat<T, R, C> inv() const;
+
+}; /* Mat<T, R, C> class */
+
+/**
+ * Fixed-size column vector class
+ * @tparam T Element type
+ * @tparam N Number of elements
+ */
+
+template <class T, index_t N>
+class ColVec : public Mat<T, N, 1> {
+public:
+
+    /* Below are public constructors for the fixed-size ColVec class */
+
+    /**
+     * Default constructor. Like the built in types, the elements are left uninitialized
+     */
+
+    ColVec() {
+
+    } /* ColVec() */
+
+    /**
+     * Construct and populate vector
+     * @param type Fill Type
+     */
+
+    ColVec(fill::fillType type) : Mat<T, N, 1>(type) {
+    } /* ColVec(fill::fillType type) */
+
+    /**
+     * Construct and populate vector with element
+     * @param type Fill Type
+     * @param elem Element to fill the vector with
+     */
+
+    ColVec(fill::fillType type, T elem) : Mat<T, N, 1>(type, elem) {
+    } /* ColVec(fill::fillType type, T elem) */
+
+    /**
+     * Constructs a vector from an initializer list
+     * An ORCA_BAD_DIMENSIONS exception is thrown should the length of the list not equal N
+     * @param _casted_values values to cast to vector
+     */
+
+    ColVec(std::initializer_list<T> _casted_values) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (static_cast<index_t>(_casted_values.size()) != N) {
+            throw ORCAExcept::BadDimensionsError(); // Wrong number of elements in list
+        }
+#endif
+        index_t i;
+        for (i = 0; i < N; ++i) {
+            this->_data[i] = *(_casted_values.begin() + i);
+        }
+    } /* ColVec(std::initializer_list<T> _casted_values) */
+
+    /**
+     * Casted constructor from a fixed-size single column matrix
+     * @tparam T1 class of other matrix
+     * @param _castM Other matrix
+     */
+
+    template <class T1>
+    ColVec(const Mat<T1, N, 1>& _castM) : Mat<T, N, 1>(_castM) {
+    } /* ColVec(const Mat<T1, N, 1>& _castM) */
+
+    /**
+     * Casted constructor from a dynamic vector.
+     * An ORCA_BAD_DIMENSIONS exception is thrown should the length not match
+     * @tparam T1 class of other vector
+     * @param _casted Other vector
+     */
+
+    template <class T1>
+    explicit ColVec(const Vec<T1>& _casted) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (_casted.length() != N) {
+            throw ORCAExcept::BadDimensionsError(); // Dynamic vector has the wrong length
+        }
+#endif
+        index_t i;
+        for (i = 0; i < N; ++i) {
+            this->_data[i] = _casted.at(i);
+        }
+    } /* explicit ColVec(const Vec<T1>& _casted) */
+
+    /* Below are public operators for the fixed-size ColVec class */
+
+    /**
+     * Conversion to a dynamic column vector
+     * @return Heap allocated copy of the vector
+     */
+
+    operator ColVec<T>() const {
+        ColVec<T> result(N);
+        index_t i;
+        for (i = 0; i < N; ++i) {
+            result.set(i, this->_data[i]);
+        }
+        return result;
+    } /* operator ColVec<T>() const */
+
+    /* Below are public setters for the fixed-size ColVec class */
+
+    using Mat<T, N, 1>::set;
+
+    /**
+     * Assigns an element at the speciifed index.
+     * @param index Element  Index
+     * @param elem Element
+     */
+
+    void set(index_t index, T elem) {
+        this->_checkBounds(index, 0);
+        this->_data[index] = elem;
+    } /* void set(index_t index, T elem) */
+
+    using Mat<T, N, 1>::unchecked_set;
+
+    /**
+     * Assigns an element without bounds checks, for indices already known to be valid
+     * @param index Element  Index
+     * @param elem Element
+     */
+
+    void unchecked_set(index_t index, T elem) {
+        this->_data[index] = elem;
+    } /* void unchecked_set(index_t index, T elem) */
+
+    /* Below are public getters for the fixed-size ColVec class */
+
+    using Mat<T, N, 1>::at;
+
+    /**
+     * Returns element at the specified index
+     * @param index Element  Index
+     * @return element at index
+     */
+
+    T at(index_t index) const {
+        this->_checkBounds(index, 0);
+        return this->_data[index];
+    } /* T at(index_t index) const */
+
+    using Mat<T, N, 1>::unchecked_at;
+
+    /**
+     * Returns the element at the specified index without bounds checks, for indices already
+     * known to be valid
+     * @param index Element  Index
+     * @return element at index
+     */
+
+    T unchecked_at(index_t index) const {
+        return this->_data[index];
+    } /* T unchecked_at(index_t index) const */
+
+    /**
+     * Returns the number of elements in the vector
+     */
+
+    static constexpr index_t length() {
+        return N;
+    } /* static constexpr index_t length() */
+
+}; /* ColVec<T, N> class */
+
+/* Below are the unrolled kernels for the fixed-size Mat class */
+
+/**
+ * Unrolled dot product of a matrix row and a matrix column
+ * @tparam C Number of columns in the right matrix, the stride of the column
+ * @param row first element of the row
+ * @param col first element of the column
+ */
+
+template <index_t C, class T1, class T2, std::size_t... K>
+inline auto _fixedDot(const T1* row, const T2* col, std::index_sequence<K...>) {
+    return (... + (row[K] * col[K * C]));
+} /* inline auto _fixedDot(const T1* row, const T2* col, std::index_sequence<K...>) */
+
+/**
+ * Unrolled matrix product. Every output element is expanded at compile time
+ * @tparam K Inner dimension of the product
+ * @tparam C Number of columns in the result
+ * @param a left matrix storage
+ * @param b right matrix storage
+ * @param c result storage
+ */
+
+template <index_t K, index_t C, class T1, class T2, class T3, std::size_t... I>
+inline void _fixedMultiply(const T1* a, const T2* b, T3* c, std::index_sequence<I...>) {
+    ((c[I] = _fixedDot<C>(a + (I / C) * K, b + (I % C), std::make_index_sequence<K>())), ...);
+} /* inline void _fixedMultiply(const T1* a, const T2* b, T3* c, std::index_sequence<I...>) */
+
+/**
+ * Unrolled sum of the diagonal elements
+ * @tparam N Dimension of the square matrix
+ * @param a matrix storage
+ */
+
+template <index_t N, class T, std::size_t... I>
+inline T _fixedTrace(const T* a, std::index_sequence<I...>) {
+    return (... + a[I * (N + 1)]);
+} /* inline T _fixedTrace(const T* a, std::index_sequence<I...>) */
+
+/**
+ * Magnitude used for pivot selection
+ */
+
+template <class T>
+inline T _fixedMagnitude(T value) {
+    return (value < 0 ? -value : value);
+} /* inline T _fixedMagnitude(T value) */
+
+/**
+ * Throws SingularMatrixError for a zero determinant or pivot, as the dynamic inv() does
+ * @param value Determinant or pivot
+ */
+
+template <class T>
+inline void _fixedCheckPivot(T value) {
+    if (value == T(0)) {
+        throw ORCAExcept::SingularMatrixError(); // Matrix has no inverse
+    }
+} /* inline void _fixedCheckPivot(T value) */
+
+/* Below are member functions of the fixed-size Mat class */
+
+/**
+ * Returns the trace of a matrix
+ * @return Trace of matrix
+ */
+
+template <class T, index_t R, index_t C>
+T Mat<T, R, C>::trace() const {
+    static_assert(R == C, "ORCA: trace() requires a square matrix");
+    return _fixedTrace<R>(this->_data, std::make_index_sequence<R>());
+} /* T Mat<T, R, C>::trace() const */
+
+/**
+ * Returns the determinant of the matrix.
+ * Closed forms are used up to 4x4, larger matrices use elimination with partial pivoting
+ * @return Determinant of matrix
+ */
+
+template <class T, index_t R, index_t C>
+T Mat<T, R, C>::det() const {
+    static_assert(R == C, "ORCA: det() requires a square matrix");
+    const T* m = this->_data;
+    if constexpr (R == 1) {
+        return m[0];
+    }
+    else if constexpr (R == 2) {
+        return m[0] * m[3] - m[1] * m[2];
+    }
+    else if constexpr (R == 3) {
+        return m[0] * (m[4] * m[8] - m[5] * m[7])
+             - m[1] * (m[3] * m[8] - m[5] * m[6])
+             + m[2] * (m[3] * m[7] - m[4] * m[6]);
+    }
+    else if constexpr (R == 4) {
+        /* 2x2 minors of the top and bottom row pairs */
+        T s0 = m[0] * m[5] - m[4] * m[1];
+        T s1 = m[0] * m[6] - m[4] * m[2];
+        T s2 = m[0] * m[7] - m[4] * m[3];
+        T s3 = m[1] * m[6] - m[5] * m[2];
+        T s4 = m[1] * m[7] - m[5] * m[3];
+        T s5 = m[2] * m[7] - m[6] * m[3];
+        T c5 = m[10] * m[15] - m[14] * m[11];
+        T c4 = m[9] * m[15] - m[13] * m[11];
+        T c3 = m[9] * m[14] - m[13] * m[10];
+        T c2 = m[8] * m[15] - m[12] * m[11];
+        T c1 = m[8] * m[14] - m[12] * m[10];
+        T c0 = m[8] * m[13] - m[12] * m[9];
+        return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+    }
+    else {
+        T a[R * R];
+        index_t i,j,k;
+        for (i = 0; i < R * R; ++i) {
+            a[i] = m[i];
+        }
+        T result = 1;
+        for (k = 0; k < R; ++k) {
+            /* Select the largest pivot in the column */
+            index_t pivot = k;
+            for (i = k + 1; i < R; ++i) {
+                if (_fixedMagnitude(a[i * R + k]) > _fixedMagnitude(a[pivot * R + k])) {
+                    pivot = i;
+                }
+            }
+            if (a[pivot * R + k] == 0) {
+                return 0;
+            }
+            if (pivot != k) {
+                for (j = 0; j < R; ++j) {
+                    T temp = a[k * R + j];
+                    a[k * R + j] = a[pivot * R + j];
+                    a[pivot * R + j] = temp;
+                }
+                result = -result;
+            }
+            result *= a[k * R + k];
+            for (i = k + 1; i < R; ++i) {
+                T factor = a[i * R + k] / a[k * R + k];
+                for (j = k + 1; j < R; ++j) {
+                    a[i * R + j] -= factor * a[k * R + j];
+                }
+            }
+        }
+        return result;
+    }
+} /* T Mat<T, R, C>::det() const */
+
+/**
+ * Returns the inverse of the matrix.
+ * Closed forms are used up to 4x4, larger matrices use Gauss-Jordan elimination with partial pivoting.
+ * Throws SingularMatrixError if the matrix is singular
+ * @return Matrix Inverse
+ */
+
+template <class T, index_t R, index_t C>
+Mat<T, R, C> Mat<T, R, C>::inv() const {
+    static_assert(R == C, "ORCA: inv() requires a square matrix");
+    const T* m = this->_data;
+    Mat<T, R, C> result;
+    T* r = result.data();
+    if constexpr (R == 1) {
+        _fixedCheckPivot(m[0]);
+        r[0] = 1 / m[0];
+    }
+    else if constexpr (R == 2) {
+        T det = m[0] * m[3] - m[1] * m[2];
+        _fixedCheckPivot(det);
+        T invDet = 1 / det;
+        r[0] = m[3] * invDet;
+        r[1] = -m[1] * invDet;
+        r[2] = -m[2] * invDet;
+        r[3] = m[0] * invDet;
+    }
+    else if constexpr (R == 3) {
+        T c0 = m[4] * m[8] - m[5] * m[7];
+        T c1 = m[5] * m[6] - m[3] * m[8];
+        T c2 = m[3] * m[7] - m[4] * m[6];
+        T det = m[0] * c0 + m[1] * c1 + m[2] * c2;
+        _fixedCheckPivot(det);
+        T invDet = 1 / det;
+        r[0] = c0 * invDet;
+        r[1] = (m[2] * m[7] - m[1] * m[8]) * invDet;
+        r[2] = (m[1] * m[5] - m[2] * m[4]) * invDet;
+        r[3] = c1 * invDet;
+        r[4] = (m[0] * m[8] - m[2] * m[6]) * invDet;
+        r[5] = (m[2] * m[3] - m[0] * m[5]) * invDet;
+        r[6] = c2 * invDet;
+        r[7] = (m[1] * m[6] - m[0] * m[7]) * invDet;
+        r[8] = (m[0] * m[4] - m[1] * m[3]) * invDet;
+    }
+    else if constexpr (R == 4) {
+        T s0 = m[0] * m[5] - m[4] * m[1];
+        T s1 = m[0] * m[6] - m[4] * m[2];
+        T s2 = m[0] * m[7] - m[4] * m[3];
+        T s3 = m[1] * m[6] - m[5] * m[2];
+        T s4 = m[1] * m[7] - m[5] * m[3];
+        T s5 = m[2] * m[7] - m[6] * m[3];
+        T c5 = m[10] * m[15] - m[14] * m[11];
+        T c4 = m[9] * m[15] - m[13] * m[11];
+        T c3 = m[9] * m[14] - m[13] * m[10];
+        T c2 = m[8] * m[15] - m[12] * m[11];
+        T c1 = m[8] * m[14] - m[12] * m[10];
+        T c0 = m[8] * m[13] - m[12] * m[9];
+        T det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        _fixedCheckPivot(det);
+        T invDet = 1 / det;
+        r[0] = (m[5] * c5 - m[6] * c4 + m[7] * c3) * invDet;
+        r[1] = (-m[1] * c5 + m[2] * c4 - m[3] * c3) * invDet;
+        r[2] = (m[13] * s5 - m[14] * s4 + m[15] * s3) * invDet;
+        r[3] = (-m[9] * s5 + m[10] * s4 - m[11] * s3) * invDet;
+        r[4] = (-m[4] * c5 + m[6] * c2 - m[7] * c1) * invDet;
+        r[5] = (m[0] * c5 - m[2] * c2 + m[3] * c1) * invDet;
+        r[6] = (-m[12] * s5 + m[14] * s2 - m[15] * s1) * invDet;
+        r[7] = (m[8] * s5 - m[10] * s2 + m[11] * s1) * invDet;
+        r[8] = (m[4] * c4 - m[5] * c2 + m[7] * c0) * invDet;
+        r[9] = (-m[0] * c4 + m[1] * c2 - m[3] * c0) * invDet;
+        r[10] = (m[12] * s4 - m[13] * s2 + m[15] * s0) * invDet;
+        r[11] = (-m[8] * s4 + m[9] * s2 - m[11] * s0) * invDet;
+        r[12] = (-m[4] * c3 + m[5] * c1 - m[6] * c0) * invDet;
+        r[13] = (m[0] * c3 - m[1] * c1 + m[2] * c0) * invDet;
+        r[14] = (-m[12] * s3 + m[13] * s1 - m[14] * s0) * invDet;
+        r[15] = (m[8] * s3 - m[9] * s1 + m[10] * s0) * invDet;
+    }
+    else {
+        T a[R * R];
+        index_t i,j,k;
+        for (i = 0; i < R * R; ++i) {
+            a[i] = m[i];
+        }
+        result = Mat<T, R, C>(fill::eye);
+        for (k = 0; k < R; ++k) {
+            /* Select the largest pivot in the column */
+            index_t pivot = k;
+            for (i = k + 1; i < R; ++i) {
+                if (_fixedMagnitude(a[i * R + k]) > _fixedMagnitude(a[pivot * R + k])) {
+                    pivot = i;
+                }
+            }
+            if (pivot != k) {
+                for (j = 0; j < R; ++j) {
+                    T temp = a[k * R + j];
+                    a[k * R + j] = a[pivot * R + j];
+                    a[pivot * R + j] = temp;
+                    temp = r[k * R + j];
+                    r[k * R + j] = r[pivot * R + j];
+                    r[pivot * R + j] = temp;
+                }
+            }
+            _fixedCheckPivot(a[k * R + k]);
+            T invPivot = 1 / a[k * R + k];
+            for (j = 0; j < R; ++j) {
+                a[k * R + j] *= invPivot;
+                r[k * R + j] *= invPivot;
+            }
+            for (i = 0; i < R; ++i) {
+                if (i != k) {
+                    T factor = a[i * R + k];
+                    for (j = 0; j < R; ++j) {
+                        a[i * R + j] -= factor * a[k * R + j];
+                        r[i * R + j] -= factor * r[k * R + j];
+                    }
+                }
+            }
+        }
+    }
+    return result;
+} /* Mat<T, R, C> Mat<T, R, C>::inv() const */
+
+/* Below are overloaded stream operators for the fixed-size Mat class */
+
+/** Overloaded stream by reference */
+
+template <class T, index_t R, index_t C>
+std::enable_if_t<_isFixed(R, C), std::ostream&> operator<<(std::ostream& os, const Mat<T, R, C>& mat) {
+    index_t i,j;
+    for (i = 0; i < R; ++i) {
+        if (i != 0) {
+            os << std::endl;
+        }
+        os << mat.at(i, 0);
+        for (j = 1; j < C; ++j) {
+            os << " " << mat.at(i, j);
+        }
+    }
+    return os;
+} /* std::ostream& operator<<(std::ostream& os, const Mat<T, R, C>& mat) */
+
+/* Below are overloaded math operators for the fixed-size Mat class */
+
+/**
+ * Overloaded comparison operator for 2 fixed-size matricies
+ * @tparam T1 left class
+ * @tparam T2 right class
+ * @param m1 left matrix
+ * @param m2 right matrix
+ */
+
+template <class T1, class T2, index_t R1, index_t C1, index_t R2, index_t C2>
+std::enable_if_t<_isFixed(R1, C1) && _isFixed(R2, C2), bool> operator == (const Mat<T1, R1, C1>& m1, const Mat<T2, R2, C2>& m2) {
+    if ((R1 != R2) || (C1 != C2)) {
+        return false;
+    }
+    index_t i;
+    for (i = 0; i < R1 * C1; ++i) {
+        if (m1.data()[i] != m2.data()[i]) {
+            return false;
+        }
+    }
+    return true;
+} /* bool operator == (const Mat<T1, R1, C1>& m1, const Mat<T2, R2, C2>& m2) */
+
+/**
+ * Overloaded addition operator for 2 fixed-size matricies
+ * @tparam T1 left class
+ * @tparam T2 right class
+ * @param m1 left matrix
+ * @param m2 right matrix
+ */
+
+template <class T1, class T2, index_t R1, index_t C1, index_t R2, index_t C2>
+std::enable_if_t<_isFixed(R1, C1) && _isFixed(R2, C2), Mat<decltype(std::declval<T1>() + std::declval<T2>()), R1, C1>> operator + (const Mat<T1, R1, C1>& m1, const Mat<T2, R2, C2>& m2) {
+    static_assert((R1 == R2) && (C1 == C2), "ORCA: Matricies being added had incompatible dimensions");
+    Mat<decltype(std::declval<T1>() + std::declval<T2>()), R1, C1> result;
+    index_t i;
+    for (i = 0; i < R1 * C1; ++i) {
+        result.data()[i] = m1.data()[i] + m2.data()[i];
+    }
+    return result;
+} /* operator + (const Mat<T1, R1, C1>& m1, const Mat<T2, R2, C2>& m2) */
+
+/**
+ * Overloaded subtraction operator for 2 fixed-size matricies
+ * @tparam T1 left class
+ * @tparam T2 right class
+ * @param m1 left matrix
+ * @param m2 right matrix
+ */
+
+template <class T1, class T2, index_t R1, index_t C1, index_t R2, index_t C2>
+std::enable_if_t<_isFixed(R1, C1) && _isFixed(R2, C2), Mat<decltype(std::declval<T1>() - std::declval<T2>()), R1, C1>> operator - (const Mat<T1, R1, C1>& m1, const Mat<T2, R2, C2>& m2) {
+    static_assert((R1 == R2) && (C1 == C2), "ORCA: Matricies being subtracted had incompatible dimensions");
+    Mat<decltype(std::declval<T1>() - std::declval<T2>()), R1, C1> result;
+    index_t i;
+    for (i = 0; i < R1 * C1; ++i) {
+        result.data()[i] = m1.data()[i] - m2.data()[i];
+    }
+    return result;
+} /* operator - (const Mat<T1, R1, C1>& m1, const Mat<T2, R2, C2>& m2) */
+
+/**
+ * Overloaded unary operator for fixed-size matricies
+ * @tparam T  class
+ * @param m1  matrix
+ */
+
+template <class T, index_t R, index_t C>
+std::enable_if_t<_isFixed(R, C), Mat<T, R, C>> operator - (const Mat<T, R, C>& m1) {
+    Mat<T, R, C> result;
+    index_t i;
+    for (i = 0; i < R * C; ++i) {
+        result.data()[i] = -m1.data()[i];
+    }
+    return result;
+} /* Mat<T, R, C> operator - (const Mat<T, R, C>& m1) */
+
+/**
+ * Overloaded += operator for fixed-size matricies
+ * @tparam T1 left class
+ * @tparam T2 right class
+ * @param m1 left matrix
+ * @param m2 right matrix
+ */
+
+template <class T1, class T2, index_t R, index_t C>
+std::enable_if_t<_isFixed(R, C), Mat<T1, R, C>&> operator += (Mat<T1, R, C>& m1, const Mat<T2, R, C>& m2) {
+    index_t i;
+    for (i = 0; i < R * C; ++i) {
+        m1.data()[i] += m2.data()[i];
+    }
+    return m1;
+} /* Mat<T1, R, C>& operator += (Mat<T1, R, C>& m1, const Mat<T2, R, C>& m2) */
+
+/**
+ * Overloaded -= operator for fixed-size matricies
+ * @tparam T1 left class
+ * @tparam T2 right class
+ * @param m1 left matrix
+ * @param m2 right matrix
+ */
+
+template <class T1, class T2, index_t R, index_t C>
+std::enable_if_t<_isFixed(R, C), Mat<T1, R, C>&> operator -= (Mat<T1, R, C>& m1, const Mat<T2, R, C>& m2) {
+    index_t i;
+    for (i = 0; i < R * C; ++i) {
+        m1.data()[i] -= m2.data()[i];
+    }
+    return m1;
+} /* Mat<T1, R, C>& operator -= (Mat<T1, R, C>& m1, const Mat<T2, R, C>& m2) */
+
+/**
+ * Overloaded * operator for 2 fixed-size matricies. The product is fully unrolled at compile time
+ * @tparam T1 left class
+ * @tparam T2 right class
+ * @param m1 left matrix
+ * @param m2 right matrix
+ */
+
+template <class T1, class T2, index_t R1, index_t C1, index_t R2, index_t C2>
+std::enable_if_t<_isFixed(R1, C1) && _isFixed(R2, C2), Mat<decltype(std::declval<T1>() * std::declval<T2>()), R1, C2>> operator * (const Mat<T1, R1, C1>& m1, const Mat<T2, R2, C2>& m2) {
+    static_assert(C1 == R2, "ORCA: Matricies being multiplied had incompatible dimensions");
+    Mat<decltype(std::declval<T1>() * std::declval<T2>()), R1, C2> result;
+    _fixedMultiply<C1, C2>(m1.data(), m2.data(), result.data(), std::make_index_sequence<R1 * C2>());
+    return result;
+} /* operator * (const Mat<T1, R1, C1>& m1, const Mat<T2, R2, C2>& m2) */
+
+/**
+ * Overloaded * operator for a fixed-size matrix and column vector. The product is fully unrolled at compile time
+ * @tparam T1 left class
+ * @tparam T2 right class
+ * @param m1 left matrix
+ * @param v2 right vector
+ */
+
+template <class T1, class T2, index_t R1, index_t C1, index_t N>
+std::enable_if_t<_isFixed(R1, C1) && _isFixed(N, 1), ColVec<decltype(std::declval<T1>() * std::declval<T2>()), R1>> operator * (const Mat<T1, R1, C1>& m1, const ColVec<T2, N>& v2) {
+    static_assert(C1 == N, "ORCA: Matrix and vector being multiplied had incompatible dimensions");
+    ColVec<decltype(std::declval<T1>() * std::declval<T2>()), R1> result;
+    _fixedMultiply<C1, 1>(m1.data(), v2.data(), result.data(), std::make_index_sequence<R1>());
+    return result;
+} /* operator * (const Mat<T1, R1, C1>& m1, const ColVec<T2, N>& v2) */
+
+/**
+ * Overloaded * operator for a fixed-size matrix and scalar
+ * @tparam T1 left class
+ * @tparam T2 right class
+ * @param m1 left matrix
+ * @param t2 right value
+ */
+
+template <class T1, class T2, index_t R, index_t C>
+std::enable_if_t<_isFixed(R, C) && !_isMatType<T2>, Mat<decltype(std::declval<T1>() * std::declval<T2>()), R, C>> operator * (const Mat<T1, R, C>& m1, T2 t2) {
+    Mat<decltype(std::declval<T1>() * std::declval<T2>()), R, C> result;
+    index_t i;
+    for (i = 0; i < R * C; ++i) {
+        result.data()[i] = m1.data()[i] * t2;
+    }
+    return result;
+} /* operator * (const Mat<T1, R, C>& m1, T2 t2) */
+
+/**
+ * Overloaded * operator for a scalar and fixed-size matrix
+ * @tparam T1 left class
+ * @tparam T2 right class
+ * @param t1 left value
+ * @param m2 right matrix
+ */
+
+template <class T1, class T2, index_t R, index_t C>
+std::enable_if_t<_isFixed(R, C) && !_isMatType<T1>, Mat<decltype(std::declval<T1>() * std::declval<T2>()), R, C>> operator * (T1 t1, const Mat<T2, R, C>& m2) {
+    Mat<decltype(std::declval<T1>() * std::declval<T2>()), R, C> result;
+    index_t i;
+    for (i = 0; i < R * C; ++i) {
+        result.data()[i] = t1 * m2.data()[i];
+    }
+    return result;
+} /* operator * (T1 t1, const Mat<T2, R, C>& m2) */
+
+/**
+ * Overloaded *= operator for a fixed-size matrix and scalar
+ * @tparam T1 left class
+ * @tparam T2 right class
+ * @param m1 left matrix
+ * @param t2 right value
+ */
+
+template <class T1, class T2, index_t R, index_t C>
+std::enable_if_t<_isFixed(R, C) && !_isMatType<T2>, Mat<T1, R, C>&> operator *= (Mat<T1, R, C>& m1, T2 t2) {
+    index_t i;
+    for (i = 0; i < R * C; ++i) {
+        m1.data()[i] *= t2;
+    }
+    return m1;
+} /* Mat<T1, R, C>& operator *= (Mat<T1, R, C>& m1, T2 t2) */
+
+/* Below are nonmember functions for the fixed-size Mat class */
+
+/**
+ * Returns the trace of a fixed-size matrix
+ * @return Trace of matrix
+ */
+
+template <class T, index_t R, index_t C>
+std::enable_if_t<_isFixed(R, C), T> trace(const Mat<T, R, C>& _mat) {
+    return _mat.trace();
+} /* T trace(const Mat<T, R, C>& _mat) */
+
+/**
+ * Computes the determinant of a fixed-size matrix
+ * @param _m1 Matrix
+ * @returns Determinant of matrix
+ */
+
+template <class T, index_t R, index_t C>
+std::enable_if_t<_isFixed(R, C), T> det(const Mat<T, R, C>& _m1) {
+    return _m1.det();
+} /* T det(const Mat<T, R, C>& _m1) */
+
+/**
+ * Computes the inverse of a fixed-size matrix
+ * @param _m1 Matrix
+ * @returns Inverse of matrix
+ */
+
+template <class T, index_t R, index_t C>
+std::enable_if_t<_isFixed(R, C), Mat<T, R, C>> inv(const Mat<T, R, C>& _m1) {
+    return _m1.inv();
+} /* Mat<T, R, C> inv(const Mat<T, R, C>& _m1) */
+
+} /* ORCA namespace */
+
+#endif /* FixedMat_h */
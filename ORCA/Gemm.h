@@ -0,0 +1,533 @@
+//
+//  Gemm.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef Gemm_h
+#define Gemm_h
+
+/* Includes for Gemm.h */
+
+#include "Arena.h"      // Included for arena aware scratch storage
+#include "Parallel.h"   // Included for splitting the product across threads
+#include <cmath>    // Included for std::sqrt
+#include <cstddef>  // Included for std::size_t
+#include <new>      // Included for std::bad_alloc
+#include <type_traits>  // Included for std::is_same
+
+#ifndef ORCA_DISABLE_SIMD
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+#endif /* ORCA_DISABLE_SIMD */
+
+/* Products with fewer multiply-adds than this use the simple dense loop in Mat.h */
+
+#ifndef ORCA_GEMM_MIN_SIZE
+#define ORCA_GEMM_MIN_SIZE (32 * 32 * 32)
+#endif
+
+namespace ORCA {
+
+/* Dense GEMM kernel for float and double.
+ *
+ * C (m x n) = A (m x k) * B (k x n), following the usual three level blocking scheme:
+ * B is packed in KC x NC blocks of NR wide column panels, A in MC x KC blocks of MR tall row
+ * panels, and a register blocked MR x NR micro-kernel multiplies one panel of each.
+ * A and B are addressed through a row and a column stride, so transposed operands are packed
+ * directly without being copied first. C is row-major with a row stride.
+ *
+ * The micro-kernel is selected at compile time from the instruction sets enabled for the
+ * translation unit (AVX-512, AVX2 with FMA, NEON), falling back to portable C++ that the
+ * compiler is free to vectorize. Define ORCA_DISABLE_SIMD to force the portable kernel. */
+
+/**
+ * Portable vector operations. A "vector" of one element keeps the kernels generic,
+ * and the vector kernels use it for the elements left over after the last full vector
+ * @tparam T Element type
+ */
+
+template <class T>
+struct _ScalarOps {
+    using vec = T;
+    static constexpr index_t width = 1;
+    static vec zero() { return T(0); }
+    static vec load(const T* p) { return *p; }
+    static void store(T* p, vec v) { *p = v; }
+    static vec broadcast(T t) { return t; }
+    static vec fma(vec a, vec b, vec c) { return c + a * b; }
+    static vec fnma(vec a, vec b, vec c) { return c - a * b; }
+    static vec add(vec a, vec b) { return a + b; }
+    static vec sub(vec a, vec b) { return a - b; }
+    static vec mul(vec a, vec b) { return a * b; }
+    static vec div(vec a, vec b) { return a / b; }
+    static vec sqrt(vec a) { using std::sqrt; return sqrt(a); }
+    static vec copysign(vec a, vec b) { using std::copysign; return copysign(a, b); }
+    static vec abs(vec a) { using std::abs; return abs(a); }
+    static vec selectGreater(vec a, vec b, vec x, vec y) { return (a > b) ? x : y; }    // x where a > b, y elsewhere
+}; /* struct _ScalarOps */
+
+/**
+ * Vector operations used by the kernels, specialized below for the enabled instruction set.
+ * The primary template is the portable scalar version
+ * @tparam T Element type
+ */
+
+template <class T>
+struct _SimdOps : _ScalarOps<T> {
+    static constexpr index_t kernelRows = 4;
+}; /* struct _SimdOps */
+
+#ifndef ORCA_DISABLE_SIMD
+#if defined(__AVX512F__)
+
+template <>
+struct _SimdOps<double> {
+    using vec = __m512d;
+    static constexpr index_t width = 8;
+    static constexpr index_t kernelRows = 8;
+    static vec zero() { return _mm512_setzero_pd(); }
+    static vec load(const double* p) { return _mm512_loadu_pd(p); }
+    static void store(double* p, vec v) { _mm512_storeu_pd(p, v); }
+    static vec broadcast(double t) { return _mm512_set1_pd(t); }
+    static vec fma(vec a, vec b, vec c) { return _mm512_fmadd_pd(a, b, c); }
+    static vec add(vec a, vec b) { return _mm512_add_pd(a, b); }
+    static vec fnma(vec a, vec b, vec c) { return _mm512_fnmadd_pd(a, b, c); }
+    static vec sub(vec a, vec b) { return _mm512_sub_pd(a, b); }
+    static vec mul(vec a, vec b) { return _mm512_mul_pd(a, b); }
+    static vec div(vec a, vec b) { return _mm512_div_pd(a, b); }
+    static vec sqrt(vec a) { return _mm512_sqrt_pd(a); }
+    static vec copysign(vec a, vec b) {
+        const __m512i sign = _mm512_set1_epi64(static_cast<long long>(0x8000000000000000ULL));
+        return _mm512_castsi512_pd(_mm512_or_si512(_mm512_andnot_si512(sign, _mm512_castpd_si512(a)), _mm512_and_si512(sign, _mm512_castpd_si512(b))));
+    }
+    static vec abs(vec a) { return _mm512_abs_pd(a); }
+    static vec selectGreater(vec a, vec b, vec x, vec y) { return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(a, b, _CMP_GT_OQ), y, x); }
+}; /* struct _SimdOps<double> */
+
+template <>
+struct _SimdOps<float> {
+    using vec = __m512;
+    static constexpr index_t width = 16;
+    static constexpr index_t kernelRows = 8;
+    static vec zero() { return _mm512_setzero_ps(); }
+    static vec load(const float* p) { return _mm512_loadu_ps(p); }
+    static void store(float* p, vec v) { _mm512_storeu_ps(p, v); }
+    static vec broadcast(float t) { return _mm512_set1_ps(t); }
+    static vec fma(vec a, vec b, vec c) { return _mm512_fmadd_ps(a, b, c); }
+    static vec add(vec a, vec b) { return _mm512_add_ps(a, b); }
+    static vec fnma(vec a, vec b, vec c) { return _mm512_fnmadd_ps(a, b, c); }
+    static vec sub(vec a, vec b) { return _mm512_sub_ps(a, b); }
+    static vec mul(vec a, vec b) { return _mm512_mul_ps(a, b); }
+    static vec div(vec a, vec b) { return _mm512_div_ps(a, b); }
+    static vec sqrt(vec a) { return _mm512_sqrt_ps(a); }
+    static vec copysign(vec a, vec b) {
+        const __m512i sign = _mm512_set1_epi32(static_cast<int>(0x80000000U));
+        return _mm512_castsi512_ps(_mm512_or_si512(_mm512_andnot_si512(sign, _mm512_castps_si512(a)), _mm512_and_si512(sign, _mm512_castps_si512(b))));
+    }
+    static vec abs(vec a) { return _mm512_abs_ps(a); }
+    static vec selectGreater(vec a, vec b, vec x, vec y) { return _mm512_mask_blend_ps(_mm512_cmp_ps_mask(a, b, _CMP_GT_OQ), y, x); }
+}; /* struct _SimdOps<float> */
+
+#elif defined(__AVX2__) && defined(__FMA__)
+
+template <>
+struct _SimdOps<double> {
+    using vec = __m256d;
+    static constexpr index_t width = 4;
+    static constexpr index_t kernelRows = 6;
+    static vec zero() { return _mm256_setzero_pd(); }
+    static vec load(const double* p) { return _mm256_loadu_pd(p); }
+    static void store(double* p, vec v) { _mm256_storeu_pd(p, v); }
+    static vec broadcast(double t) { return _mm256_set1_pd(t); }
+    static vec fma(vec a, vec b, vec c) { return _mm256_fmadd_pd(a, b, c); }
+    static vec add(vec a, vec b) { return _mm256_add_pd(a, b); }
+    static vec fnma(vec a, vec b, vec c) { return _mm256_fnmadd_pd(a, b, c); }
+    static vec sub(vec a, vec b) { return _mm256_sub_pd(a, b); }
+    static vec mul(vec a, vec b) { return _mm256_mul_pd(a, b); }
+    static vec div(vec a, vec b) { return _mm256_div_pd(a, b); }
+    static vec sqrt(vec a) { return _mm256_sqrt_pd(a); }
+    static vec copysign(vec a, vec b) { const vec sign = _mm256_set1_pd(-0.0); return _mm256_or_pd(_mm256_andnot_pd(sign, a), _mm256_and_pd(sign, b)); }
+    static vec abs(vec a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), a); }
+    static vec selectGreater(vec a, vec b, vec x, vec y) { return _mm256_blendv_pd(y, x, _mm256_cmp_pd(a, b, _CMP_GT_OQ)); }
+}; /* struct _SimdOps<double> */
+
+template <>
+struct _SimdOps<float> {
+    using vec = __m256;
+    static constexpr index_t width = 8;
+    static constexpr index_t kernelRows = 6;
+    static vec zero() { return _mm256_setzero_ps(); }
+    static vec load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, vec v) { _mm256_storeu_ps(p, v); }
+    static vec broadcast(float t) { return _mm256_set1_ps(t); }
+    static vec fma(vec a, vec b, vec c) { return _mm256_fmadd_ps(a, b, c); }
+    static vec add(vec a, vec b) { return _mm256_add_ps(a, b); }
+    static vec fnma(vec a, vec b, vec c) { return _mm256_fnmadd_ps(a, b, c); }
+    static vec sub(vec a, vec b) { return _mm256_sub_ps(a, b); }
+    static vec mul(vec a, vec b) { return _mm256_mul_ps(a, b); }
+    static vec div(vec a, vec b) { return _mm256_div_ps(a, b); }
+    static vec sqrt(vec a) { return _mm256_sqrt_ps(a); }
+    static vec copysign(vec a, vec b) { const vec sign = _mm256_set1_ps(-0.0f); return _mm256_or_ps(_mm256_andnot_ps(sign, a), _mm256_and_ps(sign, b)); }
+    static vec abs(vec a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    static vec selectGreater(vec a, vec b, vec x, vec y) { return _mm256_blendv_ps(y, x, _mm256_cmp_ps(a, b, _CMP_GT_OQ)); }
+}; /* struct _SimdOps<float> */
+
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+
+template <>
+struct _SimdOps<double> {
+    using vec = float64x2_t;
+    static constexpr index_t width = 2;
+    static constexpr index_t kernelRows = 8;
+    static vec zero() { return vdupq_n_f64(0.0); }
+    static vec load(const double* p) { return vld1q_f64(p); }
+    static void store(double* p, vec v) { vst1q_f64(p, v); }
+    static vec broadcast(double t) { return vdupq_n_f64(t); }
+    static vec fma(vec a, vec b, vec c) { return vfmaq_f64(c, a, b); }
+    static vec add(vec a, vec b) { return vaddq_f64(a, b); }
+    static vec fnma(vec a, vec b, vec c) { return vfmsq_f64(c, a, b); }
+    static vec sub(vec a, vec b) { return vsubq_f64(a, b); }
+    static vec mul(vec a, vec b) { return vmulq_f64(a, b); }
+    static vec div(vec a, vec b) { return vdivq_f64(a, b); }
+    static vec sqrt(vec a) { return vsqrtq_f64(a); }
+    static vec copysign(vec a, vec b) { return vbslq_f64(vreinterpretq_u64_f64(vdupq_n_f64(-0.0)), b, a); }
+    static vec abs(vec a) { return vabsq_f64(a); }
+    static vec selectGreater(vec a, vec b, vec x, vec y) { return vbslq_f64(vcgtq_f64(a, b), x, y); }
+}; /* struct _SimdOps<double> */
+
+template <>
+struct _SimdOps<float> {
+    using vec = float32x4_t;
+    static constexpr index_t width = 4;
+    static constexpr index_t kernelRows = 8;
+    static vec zero() { return vdupq_n_f32(0.0f); }
+    static vec load(const float* p) { return vld1q_f32(p); }
+    static void store(float* p, vec v) { vst1q_f32(p, v); }
+    static vec broadcast(float t) { return vdupq_n_f32(t); }
+    static vec fma(vec a, vec b, vec c) { return vfmaq_f32(c, a, b); }
+    static vec add(vec a, vec b) { return vaddq_f32(a, b); }
+    static vec fnma(vec a, vec b, vec c) { return vfmsq_f32(c, a, b); }
+    static vec sub(vec a, vec b) { return vsubq_f32(a, b); }
+    static vec mul(vec a, vec b) { return vmulq_f32(a, b); }
+    static vec div(vec a, vec b) { return vdivq_f32(a, b); }
+    static vec sqrt(vec a) { return vsqrtq_f32(a); }
+    static vec copysign(vec a, vec b) { return vbslq_f32(vreinterpretq_u32_f32(vdupq_n_f32(-0.0f)), b, a); }
+    static vec abs(vec a) { return vabsq_f32(a); }
+    static vec selectGreater(vec a, vec b, vec x, vec y) { return vbslq_f32(vcgtq_f32(a, b), x, y); }
+}; /* struct _SimdOps<float> */
+
+#endif
+#endif /* ORCA_DISABLE_SIMD */
+
+/**
+ * Blocking parameters of the GEMM kernel
+ * MR x NR is the register tile, KC x NR panels of B stay in L1,
+ * MC x KC blocks of A stay in L2 and KC x NC blocks of B in L3
+ * @tparam T Element type
+ */
+
+template <class T>
+struct _GemmBlocking {
+    static constexpr index_t vectors = (_SimdOps<T>::width == 1) ? 4 : 2;   // Vectors per row of the register tile
+    static constexpr index_t MR = _SimdOps<T>::kernelRows;
+    static constexpr index_t NR = _SimdOps<T>::width * vectors;
+    static constexpr index_t KC = 256;
+    static constexpr index_t MC = MR * (96 / MR);
+    static constexpr index_t NC = NR * (2048 / NR);
+}; /* struct _GemmBlocking */
+
+/**
+ * Returns true if the element type has a GEMM kernel
+ * @tparam T Element type
+ */
+
+template <class T>
+constexpr bool _hasGemm() {
+    return std::is_same<T, float>::value || std::is_same<T, double>::value;
+} /* constexpr bool _hasGemm() */
+
+/**
+ * Aligned scratch storage for packed panels, taken from the current arena when there is one.
+ * Released when it leaves scope
+ * @tparam T Element type
+ */
+
+template <class T>
+class _GemmBuffer {
+private:
+    T* _data;   // Packed elements
+public:
+    explicit _GemmBuffer(index_t elements) {
+        this->_data = static_cast<T*>(_allocateStorage(sizeof(T) * static_cast<std::size_t>(elements)));
+        if (this->_data == nullptr) {
+            throw std::bad_alloc();
+        }
+    } /* explicit _GemmBuffer(index_t elements) */
+
+    _GemmBuffer(const _GemmBuffer&) = delete;
+    _GemmBuffer& operator = (const _GemmBuffer&) = delete;
+
+    ~_GemmBuffer() {
+        _freeStorage(this->_data);
+    } /* ~_GemmBuffer() */
+
+    T* data() {
+        return this->_data;
+    } /* T* data() */
+}; /* class _GemmBuffer */
+
+/**
+ * Packs a kc x nc block of B into NR wide panels. Within a panel the NR elements of each
+ * row are contiguous. The last panel is padded with zeros
+ * @param b first element of the block
+ * @param rsb row stride of B
+ * @param csb column stride of B
+ * @param packed destination, at least kc * ceil(nc / NR) * NR elements
+ */
+
+template <class T>
+void _gemmPackB(index_t kc, index_t nc, const T* b, index_t rsb, index_t csb, T* packed) {
+    constexpr index_t NR = _GemmBlocking<T>::NR;
+    index_t jr, p, j;
+    for (jr = 0; jr < nc; jr += NR) {
+        const index_t nr = (nc - jr < NR) ? (nc - jr) : NR;
+        const T* panel = b + jr * csb;
+        if ((nr == NR) && (csb == 1)) {
+            for (p = 0; p < kc; ++p) {
+                const T* row = panel + p * rsb;
+                for (j = 0; j < NR; ++j) {
+                    packed[j] = row[j];
+                }
+                packed += NR;
+            }
+            continue;
+        }
+        for (p = 0; p < kc; ++p) {
+            const T* row = panel + p * rsb;
+            for (j = 0; j < nr; ++j) {
+                packed[j] = row[j * csb];
+            }
+            for (; j < NR; ++j) {
+                packed[j] = T(0);
+            }
+            packed += NR;
+        }
+    }
+} /* void _gemmPackB(...) */
+
+/**
+ * Packs an mc x kc block of A into MR tall panels. Within a panel the MR elements of each
+ * column are contiguous. The last panel is padded with zeros
+ * @param a first element of the block
+ * @param rsa row stride of A
+ * @param csa column stride of A
+ * @param packed destination, at least kc * ceil(mc / MR) * MR elements
+ */
+
+template <class T>
+void _gemmPackA(index_t mc, index_t kc, const T* a, index_t rsa, index_t csa, T* packed) {
+    constexpr index_t MR = _GemmBlocking<T>::MR;
+    index_t ir, p, i;
+    for (ir = 0; ir < mc; ir += MR) {
+        const index_t mr = (mc - ir < MR) ? (mc - ir) : MR;
+        const T* panel = a + ir * rsa;
+        for (p = 0; p < kc; ++p) {
+            const T* col = panel + p * csa;
+            for (i = 0; i < mr; ++i) {
+                packed[i] = col[i * rsa];
+            }
+            for (; i < MR; ++i) {
+                packed[i] = T(0);
+            }
+            packed += MR;
+        }
+    }
+} /* void _gemmPackA(...) */
+
+/**
+ * Register blocked micro-kernel. Multiplies an MR x kc panel of A with a kc x NR panel of B
+ * and stores (accumulate == false) or adds (accumulate == true) the MR x NR result into C
+ * @param a packed A panel
+ * @param b packed B panel
+ * @param c first element of the C tile
+ * @param ldc row stride of C
+ */
+
+template <class T>
+void _gemmMicroKernel(index_t kc, const T* a, const T* b, T* c, index_t ldc, bool accumulate) {
+    using simd = _SimdOps<T>;
+    using vec = typename simd::vec;
+    constexpr index_t MR = _GemmBlocking<T>::MR;
+    constexpr index_t NV = _GemmBlocking<T>::vectors;
+    constexpr index_t W = simd::width;
+    vec acc[MR][NV];
+    index_t i, v, p;
+    for (i = 0; i < MR; ++i) {
+        for (v = 0; v < NV; ++v) {
+            acc[i][v] = simd::zero();
+        }
+    }
+    for (p = 0; p < kc; ++p) {
+        vec bv[NV];
+        for (v = 0; v < NV; ++v) {
+            bv[v] = simd::load(b + v * W);
+        }
+        for (i = 0; i < MR; ++i) {
+            const vec ai = simd::broadcast(a[i]);
+            for (v = 0; v < NV; ++v) {
+                acc[i][v] = simd::fma(ai, bv[v], acc[i][v]);
+            }
+        }
+        a += MR;
+        b += NV * W;
+    }
+    for (i = 0; i < MR; ++i) {
+        T* row = c + i * ldc;
+        for (v = 0; v < NV; ++v) {
+            if (accumulate) {
+                simd::store(row + v * W, simd::add(simd::load(row + v * W), acc[i][v]));
+            } else {
+                simd::store(row + v * W, acc[i][v]);
+            }
+        }
+    }
+} /* void _gemmMicroKernel(...) */
+
+/**
+ * Multiplies a packed mc x kc block of A with a packed kc x nc block of B into C.
+ * Partial tiles on the bottom and right edges go through a scratch tile
+ * @param aPacked packed A block
+ * @param bPacked packed B block
+ * @param c first element of the C block
+ * @param ldc row stride of C
+ * @param accumulate false for the first kc block, true afterwards
+ */
+
+template <class T>
+void _gemmMacroKernel(index_t mc, index_t nc, index_t kc, const T* aPacked, const T* bPacked, T* c, index_t ldc, bool accumulate) {
+    constexpr index_t MR = _GemmBlocking<T>::MR;
+    constexpr index_t NR = _GemmBlocking<T>::NR;
+    alignas(64) T edge[MR * NR];
+    index_t ir, jr, i, j;
+    for (jr = 0; jr < nc; jr += NR) {
+        const index_t nr = (nc - jr < NR) ? (nc - jr) : NR;
+        const T* bPanel = bPacked + jr * kc;
+        for (ir = 0; ir < mc; ir += MR) {
+            const index_t mr = (mc - ir < MR) ? (mc - ir) : MR;
+            const T* aPanel = aPacked + ir * kc;
+            T* cTile = c + ir * ldc + jr;
+            if ((mr == MR) && (nr == NR)) {
+                _gemmMicroKernel(kc, aPanel, bPanel, cTile, ldc, accumulate);
+                continue;
+            }
+            _gemmMicroKernel(kc, aPanel, bPanel, edge, NR, false);
+            for (i = 0; i < mr; ++i) {
+                for (j = 0; j < nr; ++j) {
+                    cTile[i * ldc + j] = accumulate ? (cTile[i * ldc + j] + edge[i * NR + j]) : edge[i * NR + j];
+                }
+            }
+        }
+    }
+} /* void _gemmMacroKernel(...) */
+
+/**
+ * Computes the columns [jc, jc + nc) of C = A * B
+ * @param a A storage
+ * @param rsa row stride of A
+ * @param csa column stride of A
+ * @param b B storage
+ * @param rsb row stride of B
+ * @param csb column stride of B
+ * @param c C storage, row-major
+ * @param ldc row stride of C
+ */
+
+template <class T>
+void _gemmColumns(index_t m, index_t k, index_t jc, index_t nc, const T* a, index_t rsa, index_t csa, const T* b, index_t rsb, index_t csb, T* c, index_t ldc) {
+    constexpr index_t MR = _GemmBlocking<T>::MR;
+    constexpr index_t NR = _GemmBlocking<T>::NR;
+    constexpr index_t KC = _GemmBlocking<T>::KC;
+    constexpr index_t MC = _GemmBlocking<T>::MC;
+    const index_t kcMax = (k < KC) ? k : KC;
+    const index_t mcMax = (m < MC) ? m : MC;
+    _GemmBuffer<T> bPacked(kcMax * (((nc + NR - 1) / NR) * NR));
+    _GemmBuffer<T> aPacked(kcMax * (((mcMax + MR - 1) / MR) * MR));
+    index_t pc, ic;
+    for (pc = 0; pc < k; pc += KC) {
+        const index_t kc = (k - pc < KC) ? (k - pc) : KC;
+        _gemmPackB(kc, nc, b + pc * rsb + jc * csb, rsb, csb, bPacked.data());
+        for (ic = 0; ic < m; ic += MC) {
+            const index_t mc = (m - ic < MC) ? (m - ic) : MC;
+            _gemmPackA(mc, kc, a + ic * rsa + pc * csa, rsa, csa, aPacked.data());
+            _gemmMacroKernel(mc, nc, kc, aPacked.data(), bPacked.data(), c + ic * ldc + jc, ldc, pc != 0);
+        }
+    }
+} /* void _gemmColumns(...) */
+
+/**
+ * Computes C = A * B for float or double operands
+ * @param m rows of A and C
+ * @param n columns of B and C
+ * @param k columns of A and rows of B, must be positive
+ * @param a A storage
+ * @param rsa row stride of A
+ * @param csa column stride of A
+ * @param b B storage
+ * @param rsb row stride of B
+ * @param csb column stride of B
+ * @param c C storage, row-major, overwritten
+ * @param ldc row stride of C
+ */
+
+template <class T>
+void _gemm(index_t m, index_t n, index_t k, const T* a, index_t rsa, index_t csa, const T* b, index_t rsb, index_t csb, T* c, index_t ldc) {
+    constexpr index_t MR = _GemmBlocking<T>::MR;
+    constexpr index_t NR = _GemmBlocking<T>::NR;
+    constexpr index_t NC = _GemmBlocking<T>::NC;
+    
+    /* The output is split into a grid of tiles, aligned to the register tile, that are
+     * computed independently. With threading disabled there is a single tile */
+    
+    const index_t rowPanels = (m + MR - 1) / MR;
+    const index_t colPanels = (n + NR - 1) / NR;
+    index_t tileCols = 1;
+    index_t tileRows = 1;
+#ifndef ORCA_DISABLE_PARALLEL
+    if ((m * n * k >= parallel::minWork()) && !ThreadPool::insideLoop()) {
+        const index_t threads = parallel::threads();
+        tileCols = (colPanels < threads) ? colPanels : threads;
+        tileRows = (threads + tileCols - 1) / tileCols;
+        tileRows = (rowPanels < tileRows) ? rowPanels : tileRows;
+    }
+#endif
+    const index_t rowsPerTile = ((rowPanels + tileRows - 1) / tileRows) * MR;
+    const index_t colsPerTile = ((colPanels + tileCols - 1) / tileCols) * NR;
+    
+    _parallelFor(0, tileRows * tileCols, m * n * k, [&](index_t first, index_t last) {
+        index_t tile, jc;
+        for (tile = first; tile < last; ++tile) {
+            const index_t i0 = (tile / tileCols) * rowsPerTile;
+            const index_t j0 = (tile % tileCols) * colsPerTile;
+            if ((i0 >= m) || (j0 >= n)) {
+                continue;
+            }
+            const index_t mt = (m - i0 < rowsPerTile) ? (m - i0) : rowsPerTile;
+            const index_t j1 = (n - j0 < colsPerTile) ? n : (j0 + colsPerTile);
+            for (jc = j0; jc < j1; jc += NC) {
+                const index_t nc = (j1 - jc < NC) ? (j1 - jc) : NC;
+                _gemmColumns(mt, k, jc, nc, a + i0 * rsa, rsa, csa, b, rsb, csb, c + i0 * ldc, ldc);
+            }
+        }
+    });
+} /* void _gemm(...) */
+
+} /* namespace ORCA */
+
+#endif /* Gemm_h */
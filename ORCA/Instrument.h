@@ -0,0 +1,320 @@
+//
+//  Instrument.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef Instrument_h
+#define Instrument_h
+
+/* Includes for Instrument.h */
+
+#include <cstddef>  // Included for std::size_t
+#include <cstdint>  // Included for counter types
+#include <ostream>  // Included for exporting counters
+
+/*
+ * Define ORCA_ENABLE_INSTRUMENTATION before including ORCA to count storage allocations, deep
+ * copies and the calls and estimated floating point operations of products and factorizations.
+ * Without it every hook is an empty inline function and the counters stay at zero
+ */
+
+namespace ORCA {
+
+namespace instrument {
+
+#ifdef ORCA_ENABLE_INSTRUMENTATION
+constexpr bool enabled = true;
+#else
+constexpr bool enabled = false;
+#endif
+
+/* Operations counted by calls and estimated flops */
+
+enum class Op : int {
+    multiply,   // Matrix products, 2 * m * k * n
+    rref,       // Gauss-Jordan reduction, 2 * min(m, n) * (m - 1) * n
+    det,        // Determinants computed from a new factorization, 2 * n^3 / 3
+    inv,        // Inverses, 2 * n^3
+    lu,         // LU factorizations, 2 * n^3 / 3
+    cholesky    // Cholesky and LDLt factorizations, n^3 / 3
+};
+
+constexpr int _opCount = 6;
+
+/**
+ * Returns the name of an operation, as used when exporting counters
+ * @param op Operation
+ */
+
+inline const char* name(Op op) {
+    static const char* const names[_opCount] = {"multiply", "rref", "det", "inv", "lu", "cholesky"};
+    return names[static_cast<int>(op)];
+} /* inline const char* name(Op op) */
+
+/**
+ * Counter values of one thread. Subtracting two snapshots gives the work done between them
+ */
+
+struct Counters {
+    uint64_t allocations = 0;       // Storage blocks allocated for matrices, vectors and scratch
+    uint64_t heapAllocations = 0;   // Blocks of those that came from the heap rather than an arena
+    uint64_t bytesAllocated = 0;    // Bytes in those blocks
+    uint64_t copies = 0;            // Deep copies of matrix elements, including casts and assignments
+    uint64_t bytesCopied = 0;       // Bytes written by those copies
+    uint64_t _calls[_opCount] = {}; // Calls of each operation
+    uint64_t _flops[_opCount] = {}; // Estimated flops of each operation
+
+    /**
+     * Returns the number of calls of an operation
+     * @param op Operation
+     */
+
+    uint64_t calls(Op op) const {
+        return this->_calls[static_cast<int>(op)];
+    } /* uint64_t calls(Op op) const */
+
+    /**
+     * Returns the estimated flops of an operation
+     * @param op Operation
+     */
+
+    uint64_t flops(Op op) const {
+        return this->_flops[static_cast<int>(op)];
+    } /* uint64_t flops(Op op) const */
+
+    /**
+     * Returns the estimated flops of every operation
+     */
+
+    uint64_t totalFlops() const {
+        uint64_t total = 0;
+        int i;
+        for (i = 0; i < _opCount; ++i) {
+            total += this->_flops[i];
+        }
+        return total;
+    } /* uint64_t totalFlops() const */
+
+    /**
+     * Returns the counts accumulated since an earlier snapshot
+     * @param _other Earlier snapshot
+     */
+
+    Counters operator - (const Counters& _other) const {
+        Counters result;
+        result.allocations = this->allocations - _other.allocations;
+        result.heapAllocations = this->heapAllocations - _other.heapAllocations;
+        result.bytesAllocated = this->bytesAllocated - _other.bytesAllocated;
+        result.copies = this->copies - _other.copies;
+        result.bytesCopied = this->bytesCopied - _other.bytesCopied;
+        int i;
+        for (i = 0; i < _opCount; ++i) {
+            result._calls[i] = this->_calls[i] - _other._calls[i];
+            result._flops[i] = this->_flops[i] - _other._flops[i];
+        }
+        return result;
+    } /* Counters operator - (const Counters& _other) const */
+
+    /**
+     * Adds the counts of another snapshot, such as one taken on a worker thread
+     * @param _other Counts to add
+     */
+
+    Counters& operator += (const Counters& _other) {
+        this->allocations += _other.allocations;
+        this->heapAllocations += _other.heapAllocations;
+        this->bytesAllocated += _other.bytesAllocated;
+        this->copies += _other.copies;
+        this->bytesCopied += _other.bytesCopied;
+        int i;
+        for (i = 0; i < _opCount; ++i) {
+            this->_calls[i] += _other._calls[i];
+            this->_flops[i] += _other._flops[i];
+        }
+        return *this;
+    } /* Counters& operator += (const Counters& _other) */
+
+}; /* struct Counters */
+
+/**
+ * Returns the running counters of this thread
+ */
+
+inline Counters& _local() {
+    static thread_local Counters counters;
+    return counters;
+} /* inline Counters& _local() */
+
+/**
+ * Returns the depth of counted operations running on this thread. Only the outermost one
+ * is counted, so the factorization inside det() is not counted again as lu
+ */
+
+inline int& _depth() {
+    static thread_local int depth = 0;
+    return depth;
+} /* inline int& _depth() */
+
+/**
+ * Returns the counts of this thread since it started, or since the last reset()
+ */
+
+inline Counters snapshot() {
+    return _local();
+} /* inline Counters snapshot() */
+
+/**
+ * Sets the counters of this thread back to zero
+ */
+
+inline void reset() {
+    _local() = Counters();
+} /* inline void reset() */
+
+/**
+ * Counts the work done on this thread while in scope, such as one control cycle.
+ * Scopes nest, each one sees everything done since it began. Work done by worker threads
+ * of parallel loops is counted on those threads
+ */
+
+class Scope {
+private:
+    Counters _start;    // Counters of this thread when the scope began
+public:
+    Scope() : _start(snapshot()) {
+    } /* Scope() */
+
+    /**
+     * Returns the counts since the scope began
+     */
+
+    Counters counters() const {
+        return snapshot() - this->_start;
+    } /* Counters counters() const */
+
+    /**
+     * Starts counting again from zero
+     */
+
+    void restart() {
+        this->_start = snapshot();
+    } /* void restart() */
+}; /* class Scope */
+
+/* Below are the hooks called by ORCA operations, empty unless ORCA_ENABLE_INSTRUMENTATION is defined */
+
+/**
+ * Counts a storage allocation
+ * @param bytes Size of the block
+ * @param heap True if the block came from the heap rather than an arena
+ */
+
+inline void _countAllocation(std::size_t bytes, bool heap) {
+#ifdef ORCA_ENABLE_INSTRUMENTATION
+    Counters& counters = _local();
+    ++counters.allocations;
+    counters.heapAllocations += heap ? 1 : 0;
+    counters.bytesAllocated += bytes;
+#else
+    (void)bytes;
+    (void)heap;
+#endif
+} /* inline void _countAllocation(std::size_t bytes, bool heap) */
+
+/**
+ * Counts a deep copy of matrix elements
+ * @param bytes Bytes written
+ */
+
+inline void _countCopy(std::size_t bytes) {
+#ifdef ORCA_ENABLE_INSTRUMENTATION
+    Counters& counters = _local();
+    ++counters.copies;
+    counters.bytesCopied += bytes;
+#else
+    (void)bytes;
+#endif
+} /* inline void _countCopy(std::size_t bytes) */
+
+/**
+ * Counts one call of an operation while in scope, unless it runs inside another counted operation
+ */
+
+class _Counted {
+private:
+#ifdef ORCA_ENABLE_INSTRUMENTATION
+    Op _op;         // Operation being counted
+    bool _outer;    // True if no other counted operation is running on this thread
+#endif
+public:
+    /**
+     * @param op Operation
+     * @param flops Estimated flops, or 0 to add them later with flops()
+     */
+
+    explicit _Counted(Op op, double flops = 0) {
+#ifdef ORCA_ENABLE_INSTRUMENTATION
+        this->_op = op;
+        this->_outer = (_depth()++ == 0);
+        if (this->_outer) {
+            ++_local()._calls[static_cast<int>(op)];
+        }
+        this->flops(flops);
+#else
+        (void)op;
+        (void)flops;
+#endif
+    } /* explicit _Counted(Op op, double flops = 0) */
+
+    _Counted(const _Counted&) = delete;
+    _Counted& operator = (const _Counted&) = delete;
+
+    ~_Counted() {
+#ifdef ORCA_ENABLE_INSTRUMENTATION
+        --_depth();
+#endif
+    } /* ~_Counted() */
+
+    /**
+     * Adds estimated flops to the operation, for calls that did not reuse a cached result
+     * @param flops Estimated flops
+     */
+
+    void flops(double flops) {
+#ifdef ORCA_ENABLE_INSTRUMENTATION
+        if (this->_outer) {
+            _local()._flops[static_cast<int>(this->_op)] += static_cast<uint64_t>(flops);
+        }
+#else
+        (void)flops;
+#endif
+    } /* void flops(double flops) */
+}; /* class _Counted */
+
+/**
+ * Writes counters as one JSON object, with the calls and flops of every operation
+ */
+
+inline std::ostream& operator<<(std::ostream& os, const Counters& counters) {
+    os << "{\"allocations\": " << counters.allocations
+       << ", \"heapAllocations\": " << counters.heapAllocations
+       << ", \"bytesAllocated\": " << counters.bytesAllocated
+       << ", \"copies\": " << counters.copies
+       << ", \"bytesCopied\": " << counters.bytesCopied;
+    int i;
+    for (i = 0; i < _opCount; ++i) {
+        os << ", \"" << name(static_cast<Op>(i)) << "\": {\"calls\": " << counters._calls[i] << ", \"flops\": " << counters._flops[i] << "}";
+    }
+    os << ", \"totalFlops\": " << counters.totalFlops() << "}";
+    return os;
+} /* inline std::ostream& operator<<(std::ostream& os, const Counters& counters) */
+
+} /* namespace instrument */
+
+} /* namespace ORCA */
+
+#endif /* Instrument_h */
@@ -0,0 +1,818 @@
+//
+//  Iterative.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef Iterative_h
+#define Iterative_h
+
+/* Includes for Iterative.h */
+
+#include "Except.h"     // Included for ORCA Exceptions
+#include "Mat.h"        // Included for Mat class
+#include "Vec.h"        // Included for ColVec class
+#include "MatExpr.h"    // Included for multiply()
+#include "SparseMat.h"  // Included for SparseMat class
+#include <algorithm>    // Included for std::min and std::fill
+#include <cmath>        // Included for std::sqrt
+#include <limits>       // Included for the default tolerance
+#include <type_traits>  // Included for operator detection
+#include <utility>      // Included for std::swap
+#include <vector>       // Included for the GMRES basis
+
+namespace ORCA {
+
+/*
+ * Iterative solvers for A * x = b, where A is a dense Mat, a SparseMat, or a matrix-free
+ * operator. A matrix-free operator is any callable taking (const ColVec<T>& x, ColVec<T>& y)
+ * and writing y = A * x, or taking (const ColVec<T>& x) and returning A * x, which costs a copy
+ * of the result per product. Preconditioners
+ * are callables of the same form applying an approximate inverse of A, such as Jacobi or
+ * IncompleteCholesky. x holds the initial guess on entry, so the solution of the previous time
+ * step warm-starts the next one, and receives the solution. Only products with A are needed,
+ * so A is never factored or inverted
+ */
+
+/**
+ * Stopping rules for the iterative solvers
+ * @tparam T Element type
+ */
+
+template <class T>
+struct IterativeOptions {
+    T tolerance = std::sqrt(std::numeric_limits<T>::epsilon());    // Largest accepted ||b - A * x|| / ||b||
+    index_t maxIterations = 0;  // Products with A allowed, 0 allows 10 * n
+    index_t restart = 30;       // Basis vectors GMRES keeps before restarting
+};
+
+/**
+ * Outcome of an iterative solve
+ * @tparam T Element type
+ */
+
+template <class T>
+struct IterativeResult {
+    index_t iterations = 0;     // Products with A, not counting the final residual check
+    T residual = T(0);          // ||b - A * x|| / ||b|| of the returned x
+    bool converged = false;     // True if residual is at most the tolerance
+};
+
+/* Preconditioner placeholder for unpreconditioned solves */
+
+struct _NoPreconditioner {
+};
+
+/* Below are the vector kernels shared by the solvers */
+
+/**
+ * Returns the dot product of two vectors of n elements
+ */
+
+template <class T>
+T _dot(const T* a, const T* b, index_t n) {
+    T sum = T(0);
+    index_t i;
+    for (i = 0; i < n; ++i) {
+        sum = sum + a[i] * b[i];
+    }
+    return sum;
+} /* T _dot(const T* a, const T* b, index_t n) */
+
+/**
+ * Adds alpha * x to y, both of n elements
+ */
+
+template <class T>
+void _axpy(T alpha, const T* x, T* y, index_t n) {
+    index_t i;
+    for (i = 0; i < n; ++i) {
+        y[i] = y[i] + alpha * x[i];
+    }
+} /* void _axpy(T alpha, const T* x, T* y, index_t n) */
+
+/**
+ * Checks that an operator is square with n rows. Matrix-free operators are taken as they are
+ * @param a Operator
+ * @param n Rows of the right hand side
+ */
+
+template <class T, class A>
+void _checkOperator(const A& a, index_t n) {
+    if constexpr (std::is_base_of<Mat<T>, A>::value || std::is_same<A, SparseMat<T>>::value) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((a.rows() != n) || (a.cols() != n)) {
+            throw ORCAExcept::BadDimensionsError(); // Operator must be square and match b
+        }
+#endif
+    }
+} /* void _checkOperator(const A& a, index_t n) */
+
+/**
+ * Writes y = a * x for a dense matrix, a sparse matrix or a matrix-free operator
+ * @param a Operator
+ * @param x Vector to multiply
+ * @param y Receives the product
+ */
+
+template <class T, class A>
+void _applyOperator(const A& a, const ColVec<T>& x, ColVec<T>& y) {
+    if constexpr (std::is_base_of<Mat<T>, A>::value) {
+        multiply(y, a, x);
+    } else if constexpr (std::is_same<A, SparseMat<T>>::value) {
+        a._multiply(x.data(), x.stride(), 1, y.data(), y.stride());
+    } else if constexpr (std::is_invocable<const A&, const ColVec<T>&, ColVec<T>&>::value) {
+        a(x, y);
+    } else {
+        /* The product is copied into y, whose storage the solvers keep addressing */
+        const ColVec<T> product(a(x));
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (product.rows() != y.rows()) {
+            throw ORCAExcept::BadDimensionsError(); // Operator returned a vector of another length
+        }
+#endif
+        const T* source = product.data();
+        T* target = y.data();
+        index_t i;
+        for (i = 0; i < y.rows(); ++i) {
+            target[i] = source[i];
+        }
+    }
+} /* void _applyOperator(const A& a, const ColVec<T>& x, ColVec<T>& y) */
+
+/**
+ * Writes z = M^-1 * r for a preconditioner, or copies r when there is none
+ * @param m Preconditioner
+ * @param r Residual
+ * @param z Receives the preconditioned residual
+ */
+
+template <class T, class P>
+void _applyPreconditioner(const P& m, const ColVec<T>& r, ColVec<T>& z) {
+    if constexpr (std::is_same<P, _NoPreconditioner>::value) {
+        const T* source = r.data();
+        T* target = z.data();
+        index_t i;
+        for (i = 0; i < r.rows(); ++i) {
+            target[i] = source[i];
+        }
+    } else {
+        _applyOperator(m, r, z);
+    }
+} /* void _applyPreconditioner(const P& m, const ColVec<T>& r, ColVec<T>& z) */
+
+/**
+ * Writes r = b - a * x and returns its norm
+ */
+
+template <class T, class A>
+T _residual(const A& a, const ColVec<T>& b, const ColVec<T>& x, ColVec<T>& r) {
+    _applyOperator(a, x, r);
+    const T* source = b.data();
+    T* target = r.data();
+    index_t i;
+    for (i = 0; i < b.rows(); ++i) {
+        target[i] = source[i] - target[i];
+    }
+    return std::sqrt(_dot(target, target, b.rows()));
+} /* T _residual(const A& a, const ColVec<T>& b, const ColVec<T>& x, ColVec<T>& r) */
+
+/**
+ * Checks the right hand side and initial guess, and returns the iteration limit
+ */
+
+template <class T, class A>
+index_t _startSolve(const A& a, const ColVec<T>& b, const ColVec<T>& x, const IterativeOptions<T>& options) {
+    _checkOperator<T>(a, b.rows());
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (x.rows() != b.rows()) {
+        throw ORCAExcept::BadDimensionsError(); // Initial guess must match b
+    }
+#endif
+    return (options.maxIterations > 0) ? options.maxIterations : 10 * b.rows();
+} /* index_t _startSolve(const A& a, const ColVec<T>& b, const ColVec<T>& x, const IterativeOptions<T>& options) */
+
+/**
+ * Returns true if the elements of a vector are stored one after another, as the solvers address them
+ */
+
+template <class T>
+bool _isContiguous(const ColVec<T>& v) {
+    return (v.data() != nullptr) && ((v.rows() == 1) || (v.stride() == 1));
+} /* bool _isContiguous(const ColVec<T>& v) */
+
+/**
+ * Runs a solver on contiguous copies of b and x, for strided and lazy views, and writes the
+ * solution back into x
+ * @param b Right hand side
+ * @param x Initial guess, receives the solution
+ * @param solve Solver called with the copies
+ */
+
+template <class T, class S>
+IterativeResult<T> _solveContiguous(const ColVec<T>& b, ColVec<T>& x, S solve) {
+    const ColVec<T> contiguousB = b;
+    ColVec<T> contiguousX = x;
+    const IterativeResult<T> result = solve(contiguousB, contiguousX);
+    index_t i;
+    for (i = 0; i < x.rows(); ++i) {
+        x.set(i, contiguousX.at(i));
+    }
+    return result;
+} /* IterativeResult<T> _solveContiguous(const ColVec<T>& b, ColVec<T>& x, S solve) */
+
+/* Below are the preconditioners */
+
+/**
+ * Jacobi preconditioner, dividing by the diagonal of A. Cheap to build and apply, and effective
+ * for diagonally dominant systems and systems whose rows are scaled very differently
+ * @tparam T Element type
+ */
+
+template <class T>
+class Jacobi {
+private:
+    /* Below are private members of the Jacobi class */
+    std::vector<T> _inverse;    // Reciprocal of each diagonal element
+
+    /**
+     * Stores the reciprocal of a diagonal element, throwing SingularMatrixError for zeros
+     */
+
+    void _store(index_t i, T diagonal) {
+        if (diagonal == T(0)) {
+            throw ORCAExcept::SingularMatrixError(); // Zero diagonal element
+        }
+        this->_inverse[i] = T(1) / diagonal;
+    } /* void _store(index_t i, T diagonal) */
+
+public:
+
+    /* Below are public constructors for the Jacobi class */
+
+    /**
+     * Builds the preconditioner of a dense square matrix
+     * @param a Matrix to precondition
+     */
+
+    explicit Jacobi(const Mat<T>& a) {
+        _checkOperator<T>(a, a.rows());
+        this->_inverse.resize(static_cast<std::size_t>(a.rows()));
+        index_t i;
+        for (i = 0; i < a.rows(); ++i) {
+            this->_store(i, a.at(i, i));
+        }
+    } /* explicit Jacobi(const Mat<T>& a) */
+
+    /**
+     * Builds the preconditioner of a sparse square matrix
+     * @param a Matrix to precondition
+     */
+
+    explicit Jacobi(const SparseMat<T>& a) {
+        _checkOperator<T>(a, a.rows());
+        this->_inverse.resize(static_cast<std::size_t>(a.rows()));
+        index_t i;
+        for (i = 0; i < a.rows(); ++i) {
+            this->_store(i, a.at(i, i));
+        }
+    } /* explicit Jacobi(const SparseMat<T>& a) */
+
+    /* Below are public member functions of the Jacobi class */
+
+    /**
+     * Writes z = D^-1 * r
+     * @param r Residual
+     * @param z Receives the preconditioned residual
+     */
+
+    void operator () (const ColVec<T>& r, ColVec<T>& z) const {
+        const T* source = r.data();
+        T* target = z.data();
+        index_t i;
+        for (i = 0; i < r.rows(); ++i) {
+            target[i] = source[i] * this->_inverse[i];
+        }
+    } /* void operator () (const ColVec<T>& r, ColVec<T>& z) const */
+
+}; /* class Jacobi */
+
+/**
+ * Incomplete Cholesky preconditioner IC(0) of a symmetric positive-definite matrix. L keeps the
+ * sparsity pattern of the lower triangle of A, so building and applying it costs O(nonZeros).
+ * A shift factors A + shift * diag(A) instead, which helps when IC(0) breaks down
+ * @tparam T Element type
+ */
+
+template <class T>
+class IncompleteCholesky {
+private:
+    /* Below are private members of the IncompleteCholesky class */
+    index_t _n = 0;                     // Dimension of the matrix
+    std::vector<index_t> _rowStart;     // Offset of the first entry of each row of L, plus the total at the end
+    std::vector<index_t> _colIndex;     // Column of each entry, the diagonal entry last in its row
+    std::vector<T> _values;             // Value of each entry
+
+    /**
+     * Factors the lower triangle of a in its own sparsity pattern.
+     * Throws NotPositiveDefiniteError if a pivot is not positive
+     */
+
+    void _factor(const SparseMat<T>& a, T shift) {
+        _checkOperator<T>(a, a.rows());
+        this->_n = a.rows();
+        this->_rowStart.assign(static_cast<std::size_t>(this->_n) + 1, 0);
+        const index_t* rowStart = a.rowStart();
+        const index_t* colIndex = a.colIndex();
+        const T* values = a.values();
+        index_t i, e;
+        for (i = 0; i < this->_n; ++i) {
+            for (e = rowStart[i]; (e < rowStart[i + 1]) && (colIndex[e] <= i); ++e) {
+                this->_colIndex.push_back(colIndex[e]);
+                this->_values.push_back(values[e]);
+            }
+            this->_rowStart[i + 1] = static_cast<index_t>(this->_values.size());
+            if ((this->_rowStart[i + 1] == this->_rowStart[i]) || (this->_colIndex.back() != i)) {
+                throw ORCAExcept::NotPositiveDefiniteError(); // Missing diagonal element
+            }
+        }
+        for (i = 0; i < this->_n; ++i) {
+            const index_t first = this->_rowStart[i];
+            const index_t diagonal = this->_rowStart[i + 1] - 1;
+            for (e = first; e < diagonal; ++e) {
+                /* L(i, k) = (A(i, k) - sum of L(i, j) * L(k, j) over the shared columns j < k) / L(k, k) */
+                const index_t k = this->_colIndex[e];
+                index_t p = first;
+                index_t q = this->_rowStart[k];
+                const index_t kDiagonal = this->_rowStart[k + 1] - 1;
+                T sum = this->_values[e];
+                while ((p < e) && (q < kDiagonal)) {
+                    if (this->_colIndex[p] == this->_colIndex[q]) {
+                        sum = sum - this->_values[p] * this->_values[q];
+                        ++p;
+                        ++q;
+                    } else if (this->_colIndex[p] < this->_colIndex[q]) {
+                        ++p;
+                    } else {
+                        ++q;
+                    }
+                }
+                this->_values[e] = sum / this->_values[kDiagonal];
+            }
+            T pivot = this->_values[diagonal] * (T(1) + shift);
+            for (e = first; e < diagonal; ++e) {
+                pivot = pivot - this->_values[e] * this->_values[e];
+            }
+            if (!(pivot > T(0))) {
+                throw ORCAExcept::NotPositiveDefiniteError(); // Factorization broke down, a shift may help
+            }
+            this->_values[diagonal] = std::sqrt(pivot);
+        }
+    } /* void _factor(const SparseMat<T>& a, T shift) */
+
+public:
+
+    /* Below are public constructors for the IncompleteCholesky class */
+
+    /**
+     * Factors a sparse symmetric positive-definite matrix, reading its lower triangle
+     * @param a Matrix to precondition
+     * @param shift Relative amount added to the diagonal before factoring
+     */
+
+    explicit IncompleteCholesky(const SparseMat<T>& a, T shift = T(0)) {
+        this->_factor(a, shift);
+    } /* explicit IncompleteCholesky(const SparseMat<T>& a, T shift = T(0)) */
+
+    /**
+     * Factors the nonzero pattern of a dense symmetric positive-definite matrix, reading its lower triangle
+     * @param a Matrix to precondition
+     * @param shift Relative amount added to the diagonal before factoring
+     */
+
+    explicit IncompleteCholesky(const Mat<T>& a, T shift = T(0)) {
+        this->_factor(SparseMat<T>(a), shift);
+    } /* explicit IncompleteCholesky(const Mat<T>& a, T shift = T(0)) */
+
+    /* Below are public member functions of the IncompleteCholesky class */
+
+    /**
+     * Returns the number of stored entries of L
+     */
+
+    index_t nonZeros() const {
+        return static_cast<index_t>(this->_values.size());
+    } /* index_t nonZeros() const */
+
+    /**
+     * Returns the incomplete factor L as a sparse matrix
+     */
+
+    SparseMat<T> L() const {
+        std::vector<Triplet<T>> entries;
+        entries.reserve(this->_values.size());
+        index_t i, e;
+        for (i = 0; i < this->_n; ++i) {
+            for (e = this->_rowStart[i]; e < this->_rowStart[i + 1]; ++e) {
+                entries.push_back(Triplet<T>{i, this->_colIndex[e], this->_values[e]});
+            }
+        }
+        return SparseMat<T>(this->_n, this->_n, entries);
+    } /* SparseMat<T> L() const */
+
+    /**
+     * Writes z = (L * Lt)^-1 * r by forward and back substitution
+     * @param r Residual
+     * @param z Receives the preconditioned residual
+     */
+
+    void operator () (const ColVec<T>& r, ColVec<T>& z) const {
+        const T* source = r.data();
+        T* target = z.data();
+        index_t i, e;
+        for (i = 0; i < this->_n; ++i) {
+            const index_t diagonal = this->_rowStart[i + 1] - 1;
+            T sum = source[i];
+            for (e = this->_rowStart[i]; e < diagonal; ++e) {
+                sum = sum - this->_values[e] * target[this->_colIndex[e]];
+            }
+            target[i] = sum / this->_values[diagonal];
+        }
+        for (i = this->_n; i-- > 0;) {
+            /* Rows of L are the columns of Lt, so each solved element is subtracted from those above it */
+            const index_t diagonal = this->_rowStart[i + 1] - 1;
+            const T value = target[i] / this->_values[diagonal];
+            target[i] = value;
+            for (e = this->_rowStart[i]; e < diagonal; ++e) {
+                target[this->_colIndex[e]] = target[this->_colIndex[e]] - this->_values[e] * value;
+            }
+        }
+    } /* void operator () (const ColVec<T>& r, ColVec<T>& z) const */
+
+}; /* class IncompleteCholesky */
+
+/* Below are the solvers */
+
+/**
+ * Solves A * x = b by the preconditioned conjugate gradient method. A and the preconditioner
+ * must be symmetric positive definite. Each iteration costs one product with A and one
+ * preconditioner application. The recursive residual is replaced by the true residual whenever
+ * it reports convergence the true residual does not confirm.
+ * Throws NotPositiveDefiniteError if A or the preconditioner is found to be indefinite
+ * @param a Dense matrix, sparse matrix or matrix-free operator
+ * @param b Right hand side
+ * @param x Initial guess, receives the solution
+ * @param m Preconditioner
+ * @param options Tolerance and iteration limit
+ */
+
+template <class T, class A, class P, class = std::enable_if_t<!std::is_same<P, IterativeOptions<T>>::value>>
+IterativeResult<T> cg(const A& a, const ColVec<T>& b, ColVec<T>& x, const P& m, const IterativeOptions<T>& options = IterativeOptions<T>()) {
+    if (!_isContiguous(b) || !_isContiguous(x)) {
+        return _solveContiguous(b, x, [&](const ColVec<T>& contiguousB, ColVec<T>& contiguousX) {
+            return cg(a, contiguousB, contiguousX, m, options);
+        });
+    }
+    const index_t limit = _startSolve(a, b, x, options);
+    const index_t n = b.rows();
+    IterativeResult<T> result;
+    const T bNorm = std::sqrt(_dot(b.data(), b.data(), n));
+    if (bNorm == T(0)) {
+        for (index_t i = 0; i < n; ++i) {
+            x.data()[i] = T(0);
+        }
+        result.converged = true;
+        return result;
+    }
+    const T target = options.tolerance * bNorm;
+    ColVec<T> r(static_cast<int>(n)), z(static_cast<int>(n)), p(static_cast<int>(n)), q(static_cast<int>(n));
+    T* xs = x.data();
+    T* rs = r.data();
+    T* zs = z.data();
+    T* ps = p.data();
+    T* qs = q.data();
+    T rNorm = _residual(a, b, x, r);
+    bool restart = true;
+    T rz = T(0);
+    index_t i;
+    while (result.iterations < limit) {
+        if (rNorm <= target) {
+            rNorm = _residual(a, b, x, r); // Confirm with the true residual
+            if (rNorm <= target) {
+                break;
+            }
+            restart = true;
+        }
+        _applyPreconditioner(m, r, z);
+        const T rzNext = _dot(rs, zs, n);
+        if (!(rzNext > T(0))) {
+            throw ORCAExcept::NotPositiveDefiniteError(); // Preconditioner is not positive definite
+        }
+        if (restart) {
+            for (i = 0; i < n; ++i) {
+                ps[i] = zs[i];
+            }
+            restart = false;
+        } else {
+            const T beta = rzNext / rz;
+            for (i = 0; i < n; ++i) {
+                ps[i] = zs[i] + beta * ps[i];
+            }
+        }
+        rz = rzNext;
+        _applyOperator(a, p, q);
+        ++result.iterations;
+        const T pq = _dot(ps, qs, n);
+        if (!(pq > T(0))) {
+            throw ORCAExcept::NotPositiveDefiniteError(); // Operator is not positive definite
+        }
+        const T alpha = rz / pq;
+        _axpy(alpha, ps, xs, n);
+        _axpy(-alpha, qs, rs, n);
+        rNorm = std::sqrt(_dot(rs, rs, n));
+    }
+    result.residual = _residual(a, b, x, r) / bNorm;
+    result.converged = (result.residual <= options.tolerance);
+    return result;
+} /* IterativeResult<T> cg(const A& a, const ColVec<T>& b, ColVec<T>& x, const P& m, const IterativeOptions<T>& options) */
+
+/**
+ * Solves A * x = b by the conjugate gradient method without a preconditioner
+ * @param a Dense matrix, sparse matrix or matrix-free operator, symmetric positive definite
+ * @param b Right hand side
+ * @param x Initial guess, receives the solution
+ * @param options Tolerance and iteration limit
+ */
+
+template <class T, class A>
+IterativeResult<T> cg(const A& a, const ColVec<T>& b, ColVec<T>& x, const IterativeOptions<T>& options = IterativeOptions<T>()) {
+    return cg(a, b, x, _NoPreconditioner(), options);
+} /* IterativeResult<T> cg(const A& a, const ColVec<T>& b, ColVec<T>& x, const IterativeOptions<T>& options) */
+
+/**
+ * Solves A * x = b by the preconditioned minimum residual method. A must be symmetric but may be
+ * indefinite, as in saddle point and constrained systems; the preconditioner must be symmetric
+ * positive definite. Each iteration costs one product with A and one preconditioner application.
+ * Throws NotPositiveDefiniteError if the preconditioner is found to be indefinite
+ * @param a Dense matrix, sparse matrix or matrix-free operator
+ * @param b Right hand side
+ * @param x Initial guess, receives the solution
+ * @param m Preconditioner
+ * @param options Tolerance and iteration limit
+ */
+
+template <class T, class A, class P, class = std::enable_if_t<!std::is_same<P, IterativeOptions<T>>::value>>
+IterativeResult<T> minres(const A& a, const ColVec<T>& b, ColVec<T>& x, const P& m, const IterativeOptions<T>& options = IterativeOptions<T>()) {
+    if (!_isContiguous(b) || !_isContiguous(x)) {
+        return _solveContiguous(b, x, [&](const ColVec<T>& contiguousB, ColVec<T>& contiguousX) {
+            return minres(a, contiguousB, contiguousX, m, options);
+        });
+    }
+    const index_t limit = _startSolve(a, b, x, options);
+    const index_t n = b.rows();
+    IterativeResult<T> result;
+    const T bNorm = std::sqrt(_dot(b.data(), b.data(), n));
+    ColVec<T> residualA(static_cast<int>(n)), residualB(static_cast<int>(n)), y(static_cast<int>(n)), v(static_cast<int>(n));
+    ColVec<T> w(static_cast<int>(n)), w1(static_cast<int>(n)), w2(static_cast<int>(n));
+    ColVec<T>* r1 = &residualA; // The last two Lanczos residuals, swapped instead of copied
+    ColVec<T>* r2 = &residualB;
+    T* xs = x.data();
+    T* ys = y.data();
+    T* vs = v.data();
+    T* ws = w.data();
+    T* w1s = w1.data();
+    T* w2s = w2.data();
+    index_t i;
+    if (bNorm == T(0)) {
+        for (i = 0; i < n; ++i) {
+            xs[i] = T(0);
+        }
+        result.converged = true;
+        return result;
+    }
+
+    /* The recurrences estimate the residual in the norm of the preconditioner, so the
+     * target is scaled by the same norm of b and every estimate is confirmed with the true residual */
+    _applyPreconditioner(m, b, y);
+    const T bNormM = std::sqrt(_dot(b.data(), ys, n));
+    T rNorm = _residual(a, b, x, *r1);
+    while ((rNorm > options.tolerance * bNorm) && (result.iterations < limit)) {
+        T* r1s = r1->data();
+        T* r2s = r2->data();
+        for (i = 0; i < n; ++i) {
+            r2s[i] = r1s[i];
+            ws[i] = T(0);
+            w2s[i] = T(0);
+        }
+        _applyPreconditioner(m, *r1, y);
+        const T beta1 = _dot(r1s, ys, n);
+        if (!(beta1 > T(0))) {
+            throw ORCAExcept::NotPositiveDefiniteError(); // Preconditioner is not positive definite
+        }
+        T beta = std::sqrt(beta1);
+        T oldBeta = T(0), dbar = T(0), epsilon = T(0), phibar = beta, cs = T(-1), sn = T(0);
+        while (result.iterations < limit) {
+            const T scale = T(1) / beta;
+            for (i = 0; i < n; ++i) {
+                vs[i] = scale * ys[i];
+            }
+            _applyOperator(a, v, y);
+            ++result.iterations;
+            if (oldBeta != T(0)) {
+                _axpy(-beta / oldBeta, r1s, ys, n);
+            }
+            const T alpha = _dot(vs, ys, n);
+            _axpy(-alpha / beta, r2s, ys, n);
+            std::swap(r1, r2);
+            std::swap(r1s, r2s);
+            for (i = 0; i < n; ++i) {
+                r2s[i] = ys[i];
+            }
+            _applyPreconditioner(m, *r2, y);
+            oldBeta = beta;
+            const T betaSquared = _dot(r2s, ys, n);
+            if (betaSquared < T(0)) {
+                throw ORCAExcept::NotPositiveDefiniteError(); // Preconditioner is not positive definite
+            }
+            beta = std::sqrt(betaSquared);
+
+            /* Apply the previous rotation, then the rotation eliminating beta */
+            const T oldEpsilon = epsilon;
+            const T delta = cs * dbar + sn * alpha;
+            const T gbar = sn * dbar - cs * alpha;
+            epsilon = sn * beta;
+            dbar = -cs * beta;
+            T gamma = std::sqrt(gbar * gbar + beta * beta);
+            if (gamma < std::numeric_limits<T>::min()) {
+                gamma = std::numeric_limits<T>::min();
+            }
+            cs = gbar / gamma;
+            sn = beta / gamma;
+            const T phi = cs * phibar;
+            phibar = sn * phibar;
+
+            /* w = (v - oldEpsilon * w1 - delta * w2) / gamma, keeping the previous two directions */
+            std::swap(w1s, w2s);
+            std::swap(w2s, ws);
+            const T inverseGamma = T(1) / gamma;
+            for (i = 0; i < n; ++i) {
+                ws[i] = (vs[i] - oldEpsilon * w1s[i] - delta * w2s[i]) * inverseGamma;
+            }
+            _axpy(phi, ws, xs, n);
+            if ((phibar <= options.tolerance * bNormM) || (beta == T(0))) {
+                break;
+            }
+        }
+        rNorm = _residual(a, b, x, *r1); // Restarts from the true residual if the estimate was optimistic
+    }
+    result.residual = rNorm / bNorm;
+    result.converged = (result.residual <= options.tolerance);
+    return result;
+} /* IterativeResult<T> minres(const A& a, const ColVec<T>& b, ColVec<T>& x, const P& m, const IterativeOptions<T>& options) */
+
+/**
+ * Solves A * x = b by the minimum residual method without a preconditioner
+ * @param a Dense matrix, sparse matrix or matrix-free operator, symmetric
+ * @param b Right hand side
+ * @param x Initial guess, receives the solution
+ * @param options Tolerance and iteration limit
+ */
+
+template <class T, class A>
+IterativeResult<T> minres(const A& a, const ColVec<T>& b, ColVec<T>& x, const IterativeOptions<T>& options = IterativeOptions<T>()) {
+    return minres(a, b, x, _NoPreconditioner(), options);
+} /* IterativeResult<T> minres(const A& a, const ColVec<T>& b, ColVec<T>& x, const IterativeOptions<T>& options) */
+
+/**
+ * Solves A * x = b by restarted GMRES with right preconditioning, for general square A.
+ * Each iteration costs one product with A, one preconditioner application and an orthogonalization
+ * against the basis, which is rebuilt every options.restart iterations. Right preconditioning keeps
+ * the residual estimate equal to the true residual of A * x = b
+ * @param a Dense matrix, sparse matrix or matrix-free operator
+ * @param b Right hand side
+ * @param x Initial guess, receives the solution
+ * @param m Preconditioner
+ * @param options Tolerance, iteration limit and restart length
+ */
+
+template <class T, class A, class P, class = std::enable_if_t<!std::is_same<P, IterativeOptions<T>>::value>>
+IterativeResult<T> gmres(const A& a, const ColVec<T>& b, ColVec<T>& x, const P& m, const IterativeOptions<T>& options = IterativeOptions<T>()) {
+    if (!_isContiguous(b) || !_isContiguous(x)) {
+        return _solveContiguous(b, x, [&](const ColVec<T>& contiguousB, ColVec<T>& contiguousX) {
+            return gmres(a, contiguousB, contiguousX, m, options);
+        });
+    }
+    const index_t limit = _startSolve(a, b, x, options);
+    const index_t n = b.rows();
+    const index_t restart = (options.restart > 0) ? std::min(options.restart, n) : std::min<index_t>(30, n);
+    IterativeResult<T> result;
+    const T bNorm = std::sqrt(_dot(b.data(), b.data(), n));
+    T* xs = x.data();
+    index_t i, j, k;
+    if (bNorm == T(0)) {
+        for (i = 0; i < n; ++i) {
+            xs[i] = T(0);
+        }
+        result.converged = true;
+        return result;
+    }
+    const T target = options.tolerance * bNorm;
+    ColVec<T> r(static_cast<int>(n)), z(static_cast<int>(n));
+    std::vector<ColVec<T>> basis(static_cast<std::size_t>(restart + 1), r);
+    std::vector<T> h(static_cast<std::size_t>((restart + 1) * restart));     // Hessenberg matrix, column j at h[j * (restart + 1)]
+    std::vector<T> g(static_cast<std::size_t>(restart + 1)), cs(static_cast<std::size_t>(restart)), sn(static_cast<std::size_t>(restart));
+    T* rs = r.data();
+    T* zs = z.data();
+    T rNorm = _residual(a, b, x, r);
+    while ((rNorm > target) && (result.iterations < limit)) {
+        T* v0 = basis[0].data();
+        for (i = 0; i < n; ++i) {
+            v0[i] = rs[i] / rNorm;
+        }
+        std::fill(g.begin(), g.end(), T(0));
+        g[0] = rNorm;
+        index_t size = 0;
+        while ((size < restart) && (result.iterations < limit)) {
+            /* Extend the basis with the orthogonalized product of the newest vector */
+            j = size;
+            _applyPreconditioner(m, basis[j], z);
+            _applyOperator(a, z, basis[j + 1]);
+            T* w = basis[j + 1].data();
+            ++result.iterations;
+            T* column = h.data() + j * (restart + 1);
+            for (k = 0; k <= j; ++k) {
+                const T* vk = basis[k].data();
+                column[k] = _dot(w, vk, n);
+                _axpy(-column[k], vk, w, n);
+            }
+            const T wNorm = std::sqrt(_dot(w, w, n));
+            column[j + 1] = wNorm;
+            if (wNorm != T(0)) {
+                const T scale = T(1) / wNorm;
+                for (i = 0; i < n; ++i) {
+                    w[i] = w[i] * scale;
+                }
+            }
+
+            /* Reduce the new column to upper triangular form with Givens rotations */
+            for (k = 0; k < j; ++k) {
+                const T upper = cs[k] * column[k] + sn[k] * column[k + 1];
+                column[k + 1] = -sn[k] * column[k] + cs[k] * column[k + 1];
+                column[k] = upper;
+            }
+            const T radius = std::sqrt(column[j] * column[j] + column[j + 1] * column[j + 1]);
+            cs[j] = (radius == T(0)) ? T(1) : column[j] / radius;
+            sn[j] = (radius == T(0)) ? T(0) : column[j + 1] / radius;
+            column[j] = radius;
+            column[j + 1] = T(0);
+            g[j + 1] = -sn[j] * g[j];
+            g[j] = cs[j] * g[j];
+            ++size;
+            if ((std::abs(g[j + 1]) <= target) || (wNorm == T(0))) {
+                break; // Converged, or the Krylov space holds the solution
+            }
+        }
+
+        /* Solve the triangular system for the basis coefficients and update x = x + M^-1 * V * y */
+        for (k = size; k-- > 0;) {
+            T sum = g[k];
+            for (j = k + 1; j < size; ++j) {
+                sum = sum - h[j * (restart + 1) + k] * g[j];
+            }
+            const T diagonal = h[k * (restart + 1) + k];
+            g[k] = (diagonal == T(0)) ? T(0) : sum / diagonal;
+        }
+        for (i = 0; i < n; ++i) {
+            rs[i] = T(0);
+        }
+        for (k = 0; k < size; ++k) {
+            _axpy(g[k], basis[k].data(), rs, n);
+        }
+        _applyPreconditioner(m, r, z);
+        _axpy(T(1), zs, xs, n);
+        rNorm = _residual(a, b, x, r);
+    }
+    result.residual = rNorm / bNorm;
+    result.converged = (rNorm <= target);
+    return result;
+} /* IterativeResult<T> gmres(const A& a, const ColVec<T>& b, ColVec<T>& x, const P& m, const IterativeOptions<T>& options) */
+
+/**
+ * Solves A * x = b by restarted GMRES without a preconditioner
+ * @param a Dense matrix, sparse matrix or matrix-free operator
+ * @param b Right hand side
+ * @param x Initial guess, receives the solution
+ * @param options Tolerance, iteration limit and restart length
+ */
+
+template <class T, class A>
+IterativeResult<T> gmres(const A& a, const ColVec<T>& b, ColVec<T>& x, const IterativeOptions<T>& options = IterativeOptions<T>()) {
+    return gmres(a, b, x, _NoPreconditioner(), options);
+} /* IterativeResult<T> gmres(const A& a, const ColVec<T>& b, ColVec<T>& x, const IterativeOptions<T>& options) */
+
+} /* namespace ORCA */
+
+#endif /* Iterative_h */
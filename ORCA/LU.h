@@ -0,0 +1,345 @@
+//
+//  LU.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef LU_h
+#define LU_h
+
+/* Includes for LU.h */
+
+#include "Except.h"     // Included for ORCA Exceptions
+#include "Mat.h"        // Included for Mat class
+#include "Vec.h"        // Included for ColVec class
+#include "Parallel.h"   // Included for threaded row updates
+#include <cmath>        // Included for std::abs
+#include <vector>       // Included for the row permutation
+
+namespace ORCA {
+
+/**
+ * Returns the magnitude used to choose pivots
+ * @param value Element
+ */
+
+template <class T>
+auto _pivotMagnitude(const T& value) {
+    using std::abs;
+    return abs(value);
+} /* auto _pivotMagnitude(const T& value) */
+
+/**
+ * LU factorization with partial pivoting, P * A = L * U
+ * L is unit lower triangular and U upper triangular; both are stored packed in one matrix.
+ * Factoring costs O(n^3) once, after which each solve() costs O(n^2) per right hand side
+ * @tparam T Element type
+ */
+
+template <class T>
+class LU {
+private:
+    /* Below are private members of the LU class */
+    Mat<T> _lu;                     // L below the diagonal (unit diagonal implied), U on and above
+    std::vector<index_t> _perm;     // Row i of P * A is row _perm[i] of A
+    int _sign = 1;                  // Sign of the permutation
+    bool _singular = false;         // True if a zero pivot was found
+
+    /**
+     * Factors the matrix held in _lu in place
+     */
+
+    void _factor() {
+        const index_t n = this->_lu.rows();
+        T* a = this->_lu.data();
+        const index_t ld = this->_lu.stride();
+        index_t i, j, k;
+        for (k = 0; k < n; ++k) {
+            /* Choose the largest remaining element in the column as pivot */
+            index_t pivot = k;
+            for (i = k + 1; i < n; ++i) {
+                if (_pivotMagnitude(a[i * ld + k]) > _pivotMagnitude(a[pivot * ld + k])) {
+                    pivot = i;
+                }
+            }
+            if (a[pivot * ld + k] == T(0)) {
+                this->_singular = true;
+                continue;
+            }
+            if (pivot != k) {
+                for (j = 0; j < n; ++j) {
+                    T temp = a[k * ld + j];
+                    a[k * ld + j] = a[pivot * ld + j];
+                    a[pivot * ld + j] = temp;
+                }
+                index_t tempIndex = this->_perm[k];
+                this->_perm[k] = this->_perm[pivot];
+                this->_perm[pivot] = tempIndex;
+                this->_sign = -this->_sign;
+            }
+
+            /* Update the trailing rows, which are independent of each other */
+            const T* pivotRow = a + k * ld;
+            const T pivotInverse = T(1) / pivotRow[k];
+            _parallelFor(k + 1, n, (n - k) * (n - k), [&](index_t first, index_t last) {
+                index_t r, c;
+                for (r = first; r < last; ++r) {
+                    T* row = a + r * ld;
+                    const T multiplier = row[k] * pivotInverse;
+                    row[k] = multiplier;
+                    for (c = k + 1; c < n; ++c) {
+                        row[c] = row[c] - multiplier * pivotRow[c];
+                    }
+                }
+            });
+        }
+    } /* void _factor() */
+
+    /**
+     * Overwrites x (n x m, row-major) with the solution of L * U * x = x
+     * @param x Right hand sides, already permuted
+     */
+
+    void _substitute(Mat<T>& x) const {
+        const index_t n = this->_lu.rows();
+        const index_t m = x.cols();
+        const T* a = this->_lu.data();
+        const index_t ld = this->_lu.stride();
+        T* b = x.data();
+        const index_t ldb = x.stride();
+        index_t i, j, k;
+
+        /* Forward substitution with the unit lower triangle */
+        for (i = 1; i < n; ++i) {
+            T* row = b + i * ldb;
+            for (k = 0; k < i; ++k) {
+                const T l = a[i * ld + k];
+                const T* source = b + k * ldb;
+                for (j = 0; j < m; ++j) {
+                    row[j] = row[j] - l * source[j];
+                }
+            }
+        }
+
+        /* Backward substitution with the upper triangle */
+        for (i = n - 1; i >= 0; --i) {
+            T* row = b + i * ldb;
+            for (k = i + 1; k < n; ++k) {
+                const T u = a[i * ld + k];
+                const T* source = b + k * ldb;
+                for (j = 0; j < m; ++j) {
+                    row[j] = row[j] - u * source[j];
+                }
+            }
+            const T diagonalInverse = T(1) / a[i * ld + i];
+            for (j = 0; j < m; ++j) {
+                row[j] = row[j] * diagonalInverse;
+            }
+        }
+    } /* void _substitute(Mat<T>& x) const */
+
+    /**
+     * Returns the rows of b in pivot order
+     * @param b Right hand sides
+     */
+
+    Mat<T> _permute(const Mat<T>& b) const {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (b.rows() != this->_lu.rows()) {
+            throw ORCAExcept::BadDimensionsError(); // Right hand side has the wrong number of rows
+        }
+#endif
+        if (this->_singular) {
+            throw ORCAExcept::SingularMatrixError(); // No unique solution
+        }
+        Mat<T> x(b.rows(), b.cols());
+        index_t i, j;
+        for (i = 0; i < b.rows(); ++i) {
+            for (j = 0; j < b.cols(); ++j) {
+                x.set(i, j, b.at(this->_perm[i], j));
+            }
+        }
+        return x;
+    } /* Mat<T> _permute(const Mat<T>& b) const */
+
+public:
+
+    /* Below are public constructors for the LU class */
+
+    /**
+     * Factors a square matrix. Singular matrices are factored as far as possible;
+     * det() then returns 0 and solve() and inv() throw SingularMatrixError
+     * @param matrix Matrix to factor
+     */
+
+    explicit LU(const Mat<T>& matrix) : _lu(matrix) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (matrix.rows() != matrix.cols()) {
+            throw ORCAExcept::BadDimensionsError(); // Matrix must be square
+        }
+#endif
+#ifndef ORCA_DISABLE_EMPTY_CHECKS
+        if (matrix.rows() == 0) {
+            throw ORCAExcept::EmptyElementError(); // Attempting to factor an empty matrix
+        }
+#endif
+        instrument::_Counted counted(instrument::Op::lu, 2.0 * matrix.rows() * matrix.rows() * matrix.rows() / 3);
+        this->_perm.resize(static_cast<std::size_t>(matrix.rows()));
+        index_t i;
+        for (i = 0; i < matrix.rows(); ++i) {
+            this->_perm[i] = i;
+        }
+        this->_factor();
+    } /* explicit LU(const Mat<T>& matrix) */
+
+    /* Below are public getters for the LU class */
+
+    /**
+     * Returns the dimension of the factored matrix
+     */
+
+    index_t size() const {
+        return this->_lu.rows();
+    } /* index_t size() const */
+
+    /**
+     * Returns true if the factored matrix is singular
+     */
+
+    bool isSingular() const {
+        return this->_singular;
+    } /* bool isSingular() const */
+
+    /**
+     * Returns the unit lower triangular factor
+     */
+
+    Mat<T> L() const {
+        const index_t n = this->size();
+        Mat<T> result(n, n, fill::eye);
+        index_t i, j;
+        for (i = 1; i < n; ++i) {
+            for (j = 0; j < i; ++j) {
+                result.set(i, j, this->_lu.at(i, j));
+            }
+        }
+        return result;
+    } /* Mat<T> L() const */
+
+    /**
+     * Returns the upper triangular factor
+     */
+
+    Mat<T> U() const {
+        const index_t n = this->size();
+        Mat<T> result(n, n, fill::zeros);
+        index_t i, j;
+        for (i = 0; i < n; ++i) {
+            for (j = i; j < n; ++j) {
+                result.set(i, j, this->_lu.at(i, j));
+            }
+        }
+        return result;
+    } /* Mat<T> U() const */
+
+    /**
+     * Returns the permutation matrix P
+     */
+
+    Mat<T> P() const {
+        const index_t n = this->size();
+        Mat<T> result(n, n, fill::zeros);
+        index_t i;
+        for (i = 0; i < n; ++i) {
+            result.set(i, this->_perm[i], 1);
+        }
+        return result;
+    } /* Mat<T> P() const */
+
+    /* Below are public member functions of the LU class */
+
+    /**
+     * Returns the determinant of the factored matrix
+     */
+
+    T det() const {
+        if (this->_singular) {
+            return T(0);
+        }
+        T result = T(this->_sign);
+        index_t i;
+        for (i = 0; i < this->size(); ++i) {
+            result = result * this->_lu.at(i, i);
+        }
+        return result;
+    } /* T det() const */
+
+    /**
+     * Solves A * x = b for a single right hand side
+     * @param b Right hand side
+     * @return x
+     */
+
+    ColVec<T> solve(const ColVec<T>& b) const {
+        Mat<T> x = this->_permute(b);
+        this->_substitute(x);
+        ColVec<T> result(static_cast<int>(x.rows()));
+        index_t i;
+        for (i = 0; i < x.rows(); ++i) {
+            result.set(i, x.at(i, 0));
+        }
+        return result;
+    } /* ColVec<T> solve(const ColVec<T>& b) const */
+
+    /**
+     * Solves A * X = B for every column of B
+     * @param b Right hand sides, one per column
+     * @return X
+     */
+
+    Mat<T> solve(const Mat<T>& b) const {
+        Mat<T> x = this->_permute(b);
+        this->_substitute(x);
+        return x;
+    } /* Mat<T> solve(const Mat<T>& b) const */
+
+    /**
+     * Returns the inverse of the factored matrix
+     */
+
+    Mat<T> inv() const {
+        return this->solve(Mat<T>(this->size(), this->size(), fill::eye));
+    } /* Mat<T> inv() const */
+
+}; /* class LU */
+
+/**
+ * Returns the LU factorization of the matrix. The factorization is cached until the matrix is modified
+ */
+
+template <class T>
+LU<T> Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>::lu() const {
+    return this->_remember(&_StickyCache<T>::lu, (sizeof(T) * this->_n_rows + sizeof(index_t)) * this->_n_rows, [&] {
+        return LU<T>(*this);
+    });
+} /* LU<T> Mat<T>::lu() const */
+
+/* Below are nonmember functions for the LU class */
+
+/**
+ * Returns the LU factorization of a matrix
+ * @param _m1 Matrix
+ * @return Factorization
+ */
+
+template <class T>
+LU<T> lu(const Mat<T>& _m1) {
+    return _m1.lu();
+} /* LU<T> lu(const Mat<T>& _m1) */
+
+} /* namespace ORCA */
+
+#endif /* LU_h */
@@ -13,8 +13,19 @@
 /* Includes for Mat.h */
 
 #include "Except.h" // Included for ORCA Exceptions
+#include "Checks.h" // Included for check policies
+#include "Arena.h"  // Included for storage allocation
 #include "Fill.h"   // Included for Fill types
-#include <random>   // Included for Fill Rand
+#include "Gemm.h"   // Included for the blocked matrix multiply kernel
+#include "Parallel.h"   // Included for threaded row elimination
+#include "Random.h" // Included for Fill Rand
+#include "Real.h"   // Included for the storage type of Real elements
+#include "Instrument.h" // Included for operation counters
+#include "Complex.h"    // Included for the complex GEMM
+#include <atomic>   // Included for the sticky compute memory counter
+#include <memory>   // Included for the shared sticky compute cache
+#include <utility>  // Included for std::move and std::swap
+#include <type_traits>  // Included for std::enable_if
 
 namespace ORCA {
 
@@ -24,11 +35,232 @@ class Vec;
 template <class T>
 class RowVec;
 
-template <class T>
+/* Matrices and column vectors with dimensions of ORCA_DYNAMIC are sized at runtime and heap allocated.
+ * Any other dimensions select the fixed-size, stack allocated types defined in FixedMat.h */
+
+template <class T, index_t R = ORCA_DYNAMIC, index_t C = ORCA_DYNAMIC>
+class Mat;
+
+template <class T, index_t N = ORCA_DYNAMIC>
 class ColVec;
 
+template <class E>
+class MatExpr;
+
+template <class T>
+class LU;
+
+template <class T>
+class Chol;
+
+template <class T>
+class LDLT;
+
+template <class T>
+class MatView;
+
+template <class T>
+class VecView;
+
+/* _isMatrix<T> is true for Mat and anything derived from it, including the lazy views.
+ * It keeps the scalar overloads of the arithmetic operators from capturing matrix operands */
+
+template <class T, index_t R, index_t C>
+std::true_type _matrixTest(const Mat<T, R, C>*);
+
+std::false_type _matrixTest(const void*);
+
+template <class T>
+constexpr bool _isMatrix = decltype(_matrixTest(std::declval<std::decay_t<T>*>()))::value;
+
+/* _matrixLike<T> marks matrix types that are not derived from Mat, such as sparse matrices,
+ * so the scalar overloads leave them alone as well. It is specialized next to each such type */
+
+template <class T>
+struct _matrixLike : std::false_type {};
+
+/* _isDynamicMatrix<T> is true only for runtime sized matrices and the types derived from them */
+
+template <class T>
+std::true_type _dynamicMatrixTest(const Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>*);
+
+std::false_type _dynamicMatrixTest(const void*);
+
+template <class T>
+constexpr bool _isDynamicMatrix = decltype(_dynamicMatrixTest(std::declval<std::decay_t<T>*>()))::value;
+
+/* _matrixElement_t<M> is the element type of a matrix, or of a class derived from one */
+
+template <class T, index_t R, index_t C>
+T _matrixElement(const Mat<T, R, C>*);
+
+template <class M>
+using _matrixElement_t = decltype(_matrixElement(std::declval<std::decay_t<M>*>()));
+
+/* Sticky compute keeps the results of expensive queries (det, inv, diag and factorizations)
+ * until the matrix is modified. Every mutation advances the matrix epoch and drops the cache.
+ * Caches are shared between a matrix and its unmodified copies and are not synchronized,
+ * so a matrix must not be queried from several threads at once.
+ * Defining ORCA_DISABLE_STICKY_COMPUTE removes the cache and recomputes every result */
+
+/* Default limit in bytes on the memory held by all sticky compute caches together */
+
+#ifndef ORCA_STICKY_COMPUTE_BUDGET
+#define ORCA_STICKY_COMPUTE_BUDGET (static_cast<std::size_t>(-1))
+#endif
+
+namespace sticky {
+
+/**
+ * Returns the process wide setting storage
+ */
+
+inline std::atomic<std::size_t>& _usage() {
+    static std::atomic<std::size_t> usage{0};
+    return usage;
+} /* inline std::atomic<std::size_t>& _usage() */
+
+inline std::atomic<std::size_t>& _budget() {
+    static std::atomic<std::size_t> budget{ORCA_STICKY_COMPUTE_BUDGET};
+    return budget;
+} /* inline std::atomic<std::size_t>& _budget() */
+
+/**
+ * Sets the limit on memory held by cached results. Results that do not fit are recomputed on every call.
+ * Lowering the limit does not evict results already cached
+ * @param bytes Limit in bytes, 0 disables caching of matrix results
+ */
+
+inline void setBudget(std::size_t bytes) {
+    _budget() = bytes;
+} /* inline void setBudget(std::size_t bytes) */
+
+/**
+ * Returns the limit on memory held by cached results
+ */
+
+inline std::size_t budget() {
+    return _budget();
+} /* inline std::size_t budget() */
+
+/**
+ * Returns the memory currently held by cached results
+ */
+
+inline std::size_t usage() {
+    return _usage();
+} /* inline std::size_t usage() */
+
+} /* namespace sticky */
+
+/**
+ * Results computed from one version of a matrix's contents
+ * @tparam T Element type
+ */
+
+template <class T>
+struct _StickyCache {
+    bool hasDet = false;                // True once det has been computed
+    T det = T();                        // Determinant
+    std::unique_ptr<Mat<T>> inv;        // Inverse
+    std::unique_ptr<Vec<T>> diag;       // Diagonal
+    std::unique_ptr<LU<T>> lu;          // LU factorization
+    std::unique_ptr<Chol<T>> chol;      // Cholesky factorization
+    std::unique_ptr<LDLT<T>> ldlt;      // LDLt factorization
+    std::size_t bytes = 0;              // Memory charged against the budget
+
+    _StickyCache() = default;
+    _StickyCache(const _StickyCache&) = delete;
+    _StickyCache& operator = (const _StickyCache&) = delete;
+
+    ~_StickyCache() {
+        sticky::_usage() -= this->bytes;
+    } /* ~_StickyCache() */
+
+    /**
+     * Charges a result against the budget
+     * @param size Memory used by the result
+     * @return true if the result fits in the budget and may be cached
+     */
+
+    bool reserve(std::size_t size) {
+        std::atomic<std::size_t>& usage = sticky::_usage();
+        std::size_t current = usage.load();
+        do {
+            if ((current > sticky::budget()) || (size > sticky::budget() - current)) {
+                return false;
+            }
+        } while (!usage.compare_exchange_weak(current, current + size));
+        this->bytes += size;
+        return true;
+    } /* bool reserve(std::size_t size) */
+}; /* struct _StickyCache */
+
+/* Width in bytes of the square tiles used when transposing, one cache line so that every row
+ * of a tile is a whole line. Wider tiles map the columns of power of two strides onto too few cache sets */
+
+#ifndef ORCA_TRANSPOSE_BLOCK
+#define ORCA_TRANSPOSE_BLOCK (64)
+#endif
+
+/**
+ * Returns the edge length in elements of the transpose tiles for elements of the given size
+ * @param size Size of an element in bytes
+ */
+
+constexpr index_t _transposeBlock(std::size_t size) {
+    return (ORCA_TRANSPOSE_BLOCK / size > 1) ? static_cast<index_t>(ORCA_TRANSPOSE_BLOCK / size) : 1;
+} /* constexpr index_t _transposeBlock(std::size_t size) */
+
+/**
+ * Copies a rows x cols matrix stored with element (i, j) at source[i * rowStride + j * colStride]
+ * into row-major storage. The copy goes tile by tile so that a transposed source, read along its
+ * columns, and the destination, written along its rows, both stay in cache.
+ * Large copies are split into bands of tiles across threads
+ * @param source Address of element (0, 0)
+ * @param rowStride Elements between consecutive rows of the source
+ * @param colStride Elements between consecutive columns of the source
+ * @param rows Number of rows
+ * @param cols Number of columns
+ * @param destination Address of element (0, 0) of the destination
+ * @param ld Row stride of the destination
+ */
+
+template <class T1, class T2>
+void _stridedCopy(const T1* source, index_t rowStride, index_t colStride, index_t rows, index_t cols, T2* destination, index_t ld) {
+    const index_t block = _transposeBlock(sizeof(T1) > sizeof(T2) ? sizeof(T1) : sizeof(T2));
+    const bool alongColumns = (colStride < 0 ? -colStride : colStride) > (rowStride < 0 ? -rowStride : rowStride);
+    _parallelFor(0, (rows + block - 1) / block, rows * cols, [&](index_t firstBand, index_t lastBand) {
+        index_t band, jj, i, j;
+        for (band = firstBand; band < lastBand; ++band) {
+            const index_t ii = band * block;
+            const index_t iEnd = (rows - ii < block) ? rows : (ii + block);
+            for (jj = 0; jj < cols; jj += block) {
+                const index_t jEnd = (cols - jj < block) ? cols : (jj + block);
+                if (alongColumns) {
+                    for (j = jj; j < jEnd; ++j) {
+                        for (i = ii; i < iEnd; ++i) {
+                            destination[i * ld + j] = source[i * rowStride + j * colStride];
+                        }
+                    }
+                } else {
+                    for (i = ii; i < iEnd; ++i) {
+                        for (j = jj; j < jEnd; ++j) {
+                            destination[i * ld + j] = source[i * rowStride + j * colStride];
+                        }
+                    }
+                }
+            }
+        }
+    });
+} /* void _stridedCopy(...) */
+
 template <class T>
-class Mat {
+class Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC> {
+    /* Writable views tell the matrix owning their storage when its elements change */
+    friend class MatView<T>;
+    friend class VecView<T>;
+    
 private:
     
     /**
@@ -39,7 +271,7 @@ private:
     
     virtual void _allocate(index_t rows, index_t cols) {
         /* Check for proper dimensions in allocation */
-#ifndef ORCA_DISABLE_DIMENSION_CHECKS
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
         if ((rows < 0) || (cols < 0)) {
             throw ORCAExcept::BadDimensionsError(); // Attempting to allocate a negative amount of rows or columns
         }
@@ -52,11 +284,11 @@ private:
         /* Initialize Elements */
         this->_n_rows = rows;
         this->_n_cols = cols;
-        this->_mat = static_cast<T*>(malloc(sizeof(T) * rows * cols));
-        /* Reset sitckyCompute parameters of the matrix only of stickyCompute is enabled */
-#ifndef ORCA_DISABLE_STICKY_COMPUTE
-        this->_stickyComputeMask = 0;
-#endif
+        this->_ld = cols;
+        this->_mat = static_cast<T*>(_allocateStorage(sizeof(T) * rows * cols));
+        this->_owner = true;
+        /* Discard results computed for the previous contents */
+        this->_touch();
     }
     
     /**
@@ -66,13 +298,10 @@ private:
      * @return address of requested element
      */
     
+    template <class P = checks::Default>
     T* _address(index_t row, index_t col) const {
-#ifndef ORCA_DISABLE_BOUNDS_CHECKS
-        if ((row > this->_n_rows) || (row < 0) || (col > this->_n_cols) || (col < 0)) {
-            throw ORCAExcept::OutOfBoundsError(); // Either negative indexing or over indexing
-        }
-#endif
-        return this->_mat + col + (row * this->_n_cols);
+        _checkIndex<P>(row, col, this->_n_rows, this->_n_cols);
+        return this->_mat + col + (row * this->_ld);
     }
     
 protected:
@@ -104,6 +333,31 @@ protected:
             this->_n_rows = matrix->cols();
         } /* MatTr(Mat<T>* matrix) */
         
+        /**
+         * Copy constructor. Copies the reference to the parent matrix, no elements are copied
+         * @param _other Transpose container to copy
+         */
+        
+        MatTr(const MatTr& _other) : Mat<T>() {
+            this->_matrix = _other._matrix;
+            this->_n_cols = _other._n_cols;
+            this->_n_rows = _other._n_rows;
+        } /* MatTr(const MatTr& _other) */
+        
+        /* Below are public operators for the MatTr class */
+        
+        /**
+         * Assignment operator. Rebinds the container to the parent matrix of _other
+         * @param _other Transpose container to copy
+         */
+        
+        MatTr& operator = (const MatTr& _other) {
+            this->_matrix = _other._matrix;
+            this->_n_cols = _other._n_cols;
+            this->_n_rows = _other._n_rows;
+            return *this;
+        } /* MatTr& operator = (const MatTr& _other) */
+        
         
         
         /* Below are public getters for the Mat class */
@@ -118,10 +372,26 @@ protected:
             return this->_matrix->at(col, row); //Index the matrix
         } /* virtual T at(index_t row, index_t col) const */
         
+        /**
+         * Transposes of stored matrices read the parent storage with its strides swapped
+         */
+        
+        virtual bool _layout(const T*& base, index_t& rowStride, index_t& colStride) const override {
+            return this->_matrix->_layout(base, colStride, rowStride);
+        } /* virtual bool _layout(const T*& base, index_t& rowStride, index_t& colStride) const override */
+        
+        /**
+         * Returns the storage of the matrix this is the transpose of
+         */
+        
+        virtual const void* storage() const override {
+            return this->_matrix->storage();
+        } /* virtual const void* storage() const */
+        
     }; /* class Mat<T>::MatTr : public Mat<T> */
     
     /* Class definition for SubMat */
-    /* This class is a read-only container to speed up range indexing operations */
+    /* This class is a container to speed up range indexing operations. Writes go into the parent */
     
     class SubMat : public Mat<T> {
     protected:
@@ -131,12 +401,46 @@ protected:
         index_t _r2;
         index_t _c1;
         index_t _c2;
+        bool _writable = false;   // False for ranges of const matrices, which must not be written through
+        
+        /**
+         * Returns the matrix owning the storage written through this range
+         */
+        
+        virtual Mat<T>* _storageOwner() override {
+#ifndef ORCA_DISABLE_READ_ONLY_CHECKS
+            if (!this->_writable) {
+                throw ORCAExcept::ReadOnlyError(); // Attempting to write through a range of a const matrix
+            }
+#endif
+            return const_cast<Mat<T>*>(this->_matrix)->_storageOwner();
+        } /* virtual Mat<T>* _storageOwner() override */
+        
+        /**
+         * Points this container at the same parent range as _other
+         * @param _other Submatrix container to copy
+         */
+        
+        void _rebind(const SubMat& _other) {
+            this->_matrix = _other._matrix;
+            this->_mat = _other._mat;
+            this->_ld = _other._ld;
+            this->_n_rows = _other._n_rows;
+            this->_n_cols = _other._n_cols;
+            this->_r1 = _other._r1;
+            this->_r2 = _other._r2;
+            this->_c1 = _other._c1;
+            this->_c2 = _other._c2;
+            this->_writable = _other._writable;
+        } /* void _rebind(const SubMat& _other) */
+        
     public:
         
         /* Below are public constructors for the SubMat class */
         
         /**
-         * Constructor from pointer to matrix
+         * Constructor from pointer to a const matrix, the range is read-only.
+         * Ranges of dense matrices point into the parent storage, so operators read them directly
          * @param matrix Address of matrix
          */
         
@@ -145,6 +449,11 @@ protected:
             if ((r2 < r1) || (c2 < c1)) {
                 throw ORCAExcept::BadDimensionsError(); // Attempting to initialize with negative dimensions
             }
+#endif
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+            if ((r1 < 0) || (c1 < 0) || (r2 >= matrix->rows()) || (c2 >= matrix->cols())) {
+                throw ORCAExcept::OutOfBoundsError(); // Range extends outside the parent matrix
+            }
 #endif
             this->_matrix = matrix;
             this->_n_rows = r2 - r1 + 1;
@@ -153,10 +462,43 @@ protected:
             this->_r2 = r2;
             this->_c1 = c1;
             this->_c2 = c2;
+            if (matrix->isDense()) {
+                this->_mat = matrix->_mat + r1 * matrix->_ld + c1;
+                this->_ld = matrix->_ld;
+            }
+        } /* SubMat(const Mat<T>* matrix, index_t r1, index_t r2, index_t c1, index_t c2) */
+        
+        /**
+         * Constructor from pointer to matrix. Writes through the range go into the matrix
+         * and discard its cached results
+         * @param matrix Address of matrix
+         */
+        
+        SubMat(Mat<T>* matrix, index_t r1, index_t r2, index_t c1, index_t c2) : SubMat(static_cast<const Mat<T>*>(matrix), r1, r2, c1, c2) {
+            this->_writable = true;
         } /* SubMat(Mat<T>* matrix, index_t r1, index_t r2, index_t c1, index_t c2) */
         
+        /**
+         * Copy constructor. Copies the reference to the parent matrix, no elements are copied
+         * @param _other Submatrix container to copy
+         */
+        
+        SubMat(const SubMat& _other) : Mat<T>() {
+            this->_rebind(_other);
+        } /* SubMat(const SubMat& _other) */
+        
         /* Below are public operators for the SubMat class */
         
+        /**
+         * Assignment operator. Rebinds the container to the parent range of _other
+         * @param _other Submatrix container to copy
+         */
+        
+        SubMat& operator = (const SubMat& _other) {
+            this->_rebind(_other);
+            return *this;
+        } /* SubMat& operator = (const SubMat& _other) */
+        
         /**
          * Index operator for SubMatrix
          * If the matrix has only 1 row, it returns the element at the index
@@ -182,70 +524,79 @@ protected:
          */
         
         virtual T at(index_t row, index_t col) const override {
-#ifndef ORCA_DISABLE_BOUNDS_CHECKS
-            /* Additional bounds check to prevent going into parent matrix */
-            if ((row < 0) || (row > this->_n_rows) || (col < 0) || (col > this->_n_cols)) {
-                throw ORCAExcept::OutOfBoundsError(); // Attempted to index into parent matrix
-            }
-#endif
+            _checkIndex<checks::Default>(row, col, this->_n_rows, this->_n_cols); // Additional bounds check to prevent going into parent matrix
             return this->_matrix->at(row + this->_r1, col + this->_c1); //Index the matrix
         } /* virtual T at(index_t row, index_t col) const */
         
-    }; /* class SubMat : public Mat<T> */
-    
-    /* Class definition for MatInv */
-    /* This class is a read-only container to speed up inverse read operations */
-    
-    class MatInv : public Mat<T> {
-    private:
+        /* Below are public setters for the SubMat class */
+        
         /**
-         * Allocates memory space for Matrix
-         * @param rows number or rows to be allocated
-         * @param cols number of columns to be allocated
+         * Assigns an element of the parent matrix and discards the results cached for it
+         * @param row Element Row Index
+         * @param col Element Column Index
+         * @param elem Element to be added
          */
         
-        virtual void _allocate(index_t rows, index_t cols) {
-            /* Check for proper dimensions in allocation */
-#ifndef ORCA_DISABLE_DIMENSION_CHECKS
-            if ((rows < 0) || (cols < 0)) {
-                throw ORCAExcept::BadDimensionsError(); // Attempting to allocate a negative amount of rows or columns
+        virtual void set(index_t row, index_t col, T elem) override {
+            Mat<T>* owner = this->_storageOwner();
+            if (this->_mat == nullptr) {
+                _checkIndex<checks::Default>(row, col, this->_n_rows, this->_n_cols);
+                const_cast<Mat<T>*>(this->_matrix)->set(row + this->_r1, col + this->_c1, elem); // Lazy parents write through their own set()
+                return;
             }
-#endif
-#ifndef ORCA_DISABLE_EMPTY_CHECKS
-            if ((rows == 0) || (cols == 0)) {
-                throw ORCAExcept::EmptyElementError(); // Attemping to allocate a zero amount of rows or columns
+            *(this->_address(row, col)) = elem;
+            this->_touch();
+            if (owner != nullptr) {
+                owner->_touch();
             }
-#endif
-            /* Initialize Elements */
-            this->_n_rows = rows;
-            this->_n_cols = cols;
-            this->_mat = static_cast<T*>(malloc(sizeof(T) * rows * cols));
-            /* Reset sitckyCompute parameters of the matrix only of stickyCompute is enabled */
-        }
-    public:
-        MatInv(Mat<T> _castM) {
-            _allocate(_castM.rows(), _castM.cols());
-            index_t i,j;
-            for (i = 0; i < this->rows(); ++i) {
-                for (j = 0; j < this->cols(); ++j) {
-                    this->set(i, j, _castM.at(i,j));
-                }
+        } /* virtual void set(index_t row, index_t col, T elem) override */
+        
+        /**
+         * Returns a pointer to the first element in the parent storage, or nullptr for ranges of
+         * lazy views. The results cached for the parent matrix are discarded
+         */
+        
+        virtual T* data() override {
+            Mat<T>* owner = this->_storageOwner();
+            this->_touch();
+            if (owner != nullptr) {
+                owner->_touch();
             }
-        } /* MatInv(Mat<T> _castM) */
+            return this->_mat;
+        } /* virtual T* data() override */
+        
+        /**
+         * Ranges of stored matrices, including transposed ones, are offsets into the parent storage
+         */
         
-    };
+        virtual bool _layout(const T*& base, index_t& rowStride, index_t& colStride) const override {
+            if (!this->_matrix->_layout(base, rowStride, colStride)) {
+                return false;
+            }
+            base += this->_r1 * rowStride + this->_c1 * colStride;
+            return true;
+        } /* virtual bool _layout(const T*& base, index_t& rowStride, index_t& colStride) const override */
+        
+        /**
+         * Returns the storage of the matrix this is the submatrix of
+         */
+        
+        virtual const void* storage() const override {
+            return this->_matrix->storage();
+        } /* virtual const void* storage() const */
+        
+    }; /* class SubMat : public Mat<T> */
     
     /* Below are protcted variables of the Mat class */
     
-    T* _mat;                    // Storage pointer for matrix elements
-    index_t _n_rows;                // Number of rows in the matrix
-    index_t _n_cols;                // Number of columns in the matrix
+    T* _mat = nullptr;          // Storage pointer for matrix elements
+    index_t _n_rows = 0;            // Number of rows in the matrix
+    index_t _n_cols = 0;            // Number of columns in the matrix
+    index_t _ld = 0;                // Number of elements between the starts of consecutive rows in _mat
+    bool _owner = false;        // True if _mat was allocated by this matrix and must be freed by it. Views never own storage
+    unsigned long long _epoch = 0;  // Incremented every time the contents may have changed
 #ifndef ORCA_DISABLE_STICKY_COMPUTE
-    unsigned long long _stickyComputeMask;     // State of stickyCompute storage for Matrix class. Only included if stickyCompute is enabled
-    T _det;                     // Determinant of matrix. Only included if stickyCompute is enabled
-    //Vec<T>* _diag;                   // Diagonal of matrix
-    //Mat<T> _transpose;             // Transpose of matrix. Only included if stickyCompute is enabled
-    MatInv* _inv;                   // Inverse of matrix. Only included if stickyCompute is enabled.
+    mutable std::shared_ptr<_StickyCache<T>> _cache;   // Results computed from the current contents. Shared by unmodified copies
 #endif
     
     /* Below are protected constuctors for the Mat class */
@@ -258,44 +609,303 @@ protected:
         
     } /* Mat() */
     
-    /* Below are protected filler classes for the Mat class */
+    /* Below are protected storage management functions for the Mat class */
     
     /**
-     * Fills a Matrix with Zeros
+     * Returns the matrix owning the storage this matrix writes into, whose cached results writes
+     * must discard. Views return the matrix they were taken from, nullptr for external buffers
      */
     
-    void zeros() {
-        index_t i; // Row Index
-        index_t j; // Column Index
-        
+    virtual Mat<T>* _storageOwner() {
+        return this;
+    } /* virtual Mat<T>* _storageOwner() */
+    
+    /**
+     * Returns true if the matrix owns storage allocated on the heap rather than in an arena
+     */
+    
+    bool _ownsHeapStorage() const {
+        return this->_owner && !_isArenaStorage(this->_mat);
+    } /* bool _ownsHeapStorage() const */
+    
+    /**
+     * Frees the storage owned by the matrix and leaves it empty.
+     * Storage that is not owned (views) is left untouched.
+     */
+    
+    void _release() {
+        if (this->_owner) {
+            _freeStorage(this->_mat);
+        }
+        this->_mat = nullptr;
+        this->_owner = false;
+        this->_n_rows = 0;
+        this->_n_cols = 0;
+        this->_ld = 0;
+        this->_touch();
+    } /* void _release() */
+    
+    /**
+     * Marks the contents as changed. Advances the epoch and drops this matrix's reference to
+     * its cached results; unmodified copies sharing the cache keep it
+     */
+    
+    void _touch() {
+        ++this->_epoch;
+#ifndef ORCA_DISABLE_STICKY_COMPUTE
+        this->_cache.reset();
+#endif
+    } /* void _touch() */
+    
+    /**
+     * Returns the cache of results for the current contents, creating it if needed
+     */
+    
+#ifndef ORCA_DISABLE_STICKY_COMPUTE
+    _StickyCache<T>& _sticky() const {
+        if (!this->_cache) {
+            this->_cache = std::make_shared<_StickyCache<T>>();
+        }
+        return *this->_cache;
+    } /* _StickyCache<T>& _sticky() const */
+#endif
+    
+    /**
+     * Returns a cached result, computing and caching it first if needed.
+     * Views and results that do not fit in the memory budget are computed without caching
+     * @param slot Cache entry holding the result
+     * @param bytes Memory used by the result
+     * @param compute Function computing the result
+     */
+    
+    template <class R, class F>
+    R _remember(std::unique_ptr<R> _StickyCache<T>::* slot, std::size_t bytes, F compute) const {
+#ifndef ORCA_DISABLE_STICKY_COMPUTE
+        if (this->_owner) {
+            _StickyCache<T>& cache = this->_sticky();
+            std::unique_ptr<R>& entry = cache.*slot;
+            if (entry) {
+                return *entry;
+            }
+            R result = compute();
+            if (cache.reserve(bytes)) {
+                arena::_HeapOnly heapOnly; // The cache outlives any arena scope the result was computed in
+                entry.reset(new R(result));
+            }
+            return result;
+        }
+#endif
+        return compute();
+    } /* R _remember(std::unique_ptr<R> _StickyCache<T>::* slot, std::size_t bytes, F compute) const */
+    
+    /**
+     * Allocates storage and copies every element of _other into it.
+     * Elements are read through at() so views are materialized correctly.
+     * @param _other Matrix to copy
+     */
+    
+    void _copyFrom(const Mat<T>& _other) {
+        if ((_other._n_rows == 0) || (_other._n_cols == 0)) {
+            return; // Nothing to copy from an empty matrix
+        }
+        this->_allocate(_other._n_rows, _other._n_cols);
+        this->_assignElements(_other);
+        this->_shareCache(_other);
+    } /* void _copyFrom(const Mat<T>& _other) */
+    
+    /**
+     * Shares the cached results of _other, whose contents this matrix now holds
+     * @param _other Matrix that was copied
+     */
+    
+    void _shareCache(const Mat<T>& _other) {
+#ifndef ORCA_DISABLE_STICKY_COMPUTE
+        if (_other._owner) {
+            this->_cache = _other._cache;
+        }
+#endif
+    } /* void _shareCache(const Mat<T>& _other) */
+    
+    /**
+     * Copies every element of _castM into this matrix, which must already have the same dimensions.
+     * Dense sources are copied row by row through their storage, transposed and strided ones
+     * tile by tile, anything else goes through at()
+     * @param _castM Matrix to copy
+     */
+    
+    template <class T1>
+    void _assignElements(const Mat<T1>& _castM) {
+        instrument::_countCopy(sizeof(T) * this->_n_rows * this->_n_cols);
+        index_t i,j;
+        const T1* base;
+        index_t rowStride, colStride;
+        if (!_castM.isDense() && _castM._layout(base, rowStride, colStride)) {
+            _stridedCopy(base, rowStride, colStride, this->_n_rows, this->_n_cols, this->_mat, this->_ld);
+            return;
+        }
+        if (_castM.isDense()) {
+            const T1* source = _castM.data();
+            index_t sourceStride = _castM.stride();
+            for (i = 0; i < this->_n_rows; ++i) {
+                T* row = this->_mat + i * this->_ld;
+                const T1* sourceRow = source + i * sourceStride;
+                for (j = 0; j < this->_n_cols; ++j) {
+                    row[j] = sourceRow[j];
+                }
+            }
+            return;
+        }
         for (i = 0; i < this->_n_rows; ++i) {
             for (j = 0; j < this->_n_cols; ++j) {
-                /* All error codes for 'set' function will be satisfied. No need to check return codes*/
-                this->set(i, j, 0);
+                *(this->_address(i, j)) = _castM.at(i, j);
+            }
+        }
+    } /* void _assignElements(const Mat<T1>& _castM) */
+    
+    /**
+     * Copies every element of _block into this matrix with its first element at (row, col).
+     * The block must fit, dense blocks are copied row by row through their storage
+     * @param row Row of the first element of the block
+     * @param col Column of the first element of the block
+     * @param _block Matrix to copy
+     */
+    
+    template <class T1>
+    void _assignBlock(index_t row, index_t col, const Mat<T1>& _block) {
+        index_t i,j;
+        T* destination = this->_mat + row * this->_ld + col;
+        if (_block.isDense()) {
+            const T1* source = _block.data();
+            index_t sourceStride = _block.stride();
+            for (i = 0; i < _block.rows(); ++i) {
+                T* destinationRow = destination + i * this->_ld;
+                const T1* sourceRow = source + i * sourceStride;
+                for (j = 0; j < _block.cols(); ++j) {
+                    destinationRow[j] = sourceRow[j];
+                }
+            }
+            return;
+        }
+        for (i = 0; i < _block.rows(); ++i) {
+            for (j = 0; j < _block.cols(); ++j) {
+                destination[i * this->_ld + j] = _block.at(i, j);
             }
         }
+    } /* void _assignBlock(index_t row, index_t col, const Mat<T1>& _block) */
+    
+    /**
+     * Combines every element of this matrix with the matching element read from a source.
+     * Owned storage is updated directly, views through at() and set(). Defined in MatExpr.h
+     * @param read Function returning element (row, col) of the source
+     * @param op Function taking an element by reference and the source element
+     */
+    
+    template <class R, class Op>
+    void _updateElements(R read, Op op);
+    
+    /**
+     * Combines every element of this matrix with the matching element of _other.
+     * Sources sharing storage with this matrix are copied first. Defined in MatExpr.h
+     * @param _other Matrix of the same dimensions
+     * @param op Function taking an element by reference and the source element
+     */
+    
+    template <class T1, class Op>
+    void _combine(const Mat<T1>& _other, Op op);
+    
+    /**
+     * Combines every element of this matrix with the matching element of an expression.
+     * Expressions reading this matrix out of order are evaluated first. Defined in MatExpr.h
+     * @param _expr Expression of the same dimensions
+     * @param op Function taking an element by reference and the source element
+     */
+    
+    template <class E, class Op>
+    void _combine(const MatExpr<E>& _expr, Op op);
+    
+    /**
+     * Takes the storage of _other if it owns it, otherwise performs a deep copy.
+     * _other is left empty when its storage is taken.
+     * @param _other Matrix to move from
+     */
+    
+    void _moveFrom(Mat<T>& _other) {
+        if (!_other._owner) {
+            this->_copyFrom(_other); // Views must be materialized, their storage belongs to the parent
+            return;
+        }
+        this->_mat = _other._mat;
+        this->_n_rows = _other._n_rows;
+        this->_n_cols = _other._n_cols;
+        this->_ld = _other._ld;
+        this->_owner = true;
+        ++this->_epoch;
+#ifndef ORCA_DISABLE_STICKY_COMPUTE
+        this->_cache = std::move(_other._cache);
+#endif
+        _other._touch();
+        _other._mat = nullptr;
+        _other._owner = false;
+        _other._n_rows = 0;
+        _other._n_cols = 0;
+        _other._ld = 0;
+    } /* void _moveFrom(Mat<T>& _other) */
+    
+    /* Below are protected filler classes for the Mat class */
+    
+    /**
+     * Fills a Matrix with Zeros
+     */
+    
+    void zeros() {
+        this->fill(0);
     } /* void zeros() */
     
     /**
      * Fills a Matrix with Random Values
      * @param lowerBound Lower Bound
      * @param upperBound Upper Bound
+     * @param generator Random number generator, advanced
      */
     
-    void randFill(T lowerBound, T upperBound) {
-        std::default_random_engine generator(static_cast<unsigned int>(std::chrono::system_clock::now().time_since_epoch().count()));
-        std::uniform_real_distribution<T> distribution(lowerBound, upperBound);
-        
+    void randFill(T lowerBound, T upperBound, Rng& generator) {
         index_t i; // Row Index
-        index_t j; // Column Index
-        
         for (i = 0; i < this->_n_rows; ++i) {
-            for (j = 0; j < this->_n_cols; ++j) {
-                /* All error codes for 'set' function will be satisfied. No need to check return codes*/
-                this->set(i, j, distribution(generator));
-            }
+            generator.uniform(this->_mat + i * this->_ld, this->_n_cols, lowerBound, upperBound);
+        }
+        this->_touch();
+    } /* randFill(T lowerBound, T upperBound, Rng& generator) */
+    
+    /**
+     * Fills a Matrix with Normally Distributed Values
+     * @param mean Mean
+     * @param stddev Standard deviation
+     * @param generator Random number generator, advanced
+     */
+    
+    void randnFill(T mean, T stddev, Rng& generator) {
+        index_t i; // Row Index
+        for (i = 0; i < this->_n_rows; ++i) {
+            generator.normal(this->_mat + i * this->_ld, this->_n_cols, mean, stddev);
         }
-    } /* randFill(T lowerBound, T upperBound) */
+        this->_touch();
+    } /* randnFill(T mean, T stddev, Rng& generator) */
+    
+    /**
+     * Fills a Matrix with either random fill type
+     * @param type rand or randn
+     * @param a Lower Bound or Mean
+     * @param b Upper Bound or Standard deviation
+     * @param generator Random number generator, advanced
+     */
+    
+    void _randomFill(fill::fillType type, T a, T b, Rng& generator) {
+        if (type == fill::randn) {
+            this->randnFill(a, b, generator);
+        } else {
+            this->randFill(a, b, generator);
+        }
+    } /* void _randomFill(fill::fillType type, T a, T b, Rng& generator) */
     
     /**
      * Fills the largest left corner square sub-matrix with the identity.
@@ -307,7 +917,7 @@ protected:
         /* Fill the diagonal with 1's */
         index_t i;
         for (i = 0; (i < this->_n_rows) && (i < this->_n_cols); i++) {
-            this->set(i,i,1);
+            this->_mat[i * this->_ld + i] = 1;
         }
     } /* void eye() */
     
@@ -320,11 +930,12 @@ protected:
         index_t i; // Row Index
         index_t j; // Column Index
         for (i = 0; i < this->_n_rows; ++i) {
+            T* row = this->_mat + i * this->_ld;
             for (j = 0; j < this->_n_cols; ++j) {
-                /* All error codes for 'set' function will be satisfied. No need to check return codes*/
-                this->set(i, j, elem);
+                row[j] = elem;
             }
         }
+        this->_touch();
     } /* void fill(T elem) */
     
     /**
@@ -339,6 +950,39 @@ public:
     
     /* Below are public constructors for the Mat class */
     
+    /**
+     * Copy constructor. Performs a deep copy of _other.
+     * Copying a view (transpose, submatrix, row or column) materializes it into a new matrix
+     * @param _other Matrix to copy
+     */
+    
+    Mat(const Mat<T>& _other) {
+        this->_copyFrom(_other);
+    } /* Mat(const Mat<T>& _other) */
+    
+    /**
+     * Move constructor. Takes ownership of the storage of _other, leaving it empty.
+     * Views do not own their storage and are copied instead
+     * @param _other Matrix to move
+     */
+    
+    Mat(Mat<T>&& _other) {
+        this->_moveFrom(_other);
+    } /* Mat(Mat<T>&& _other) */
+    
+    /**
+     * Constructor from a matrix expression. The expression is evaluated in a single pass
+     * directly into the new storage
+     * @tparam E class of the expression
+     * @param _expr Expression to evaluate
+     */
+    
+    template <class E>
+    Mat(const MatExpr<E>& _expr) {
+        this->_allocate(_expr.rows(), _expr.cols());
+        _expr._evalInto(this->_mat, this->_ld);
+    } /* Mat(const MatExpr<E>& _expr) */
+    
     /**
      * Casted constructor from another matrix
      * @tparam T1 class of other matrix
@@ -346,15 +990,10 @@ public:
      */
     
     template <class T1>
-    Mat(Mat<T1> _castM) {
+    Mat(const Mat<T1>& _castM) {
         _allocate(_castM.rows(), _castM.cols());
-        index_t i,j;
-        for (i = 0; i < this->rows(); ++i) {
-            for (j = 0; j < this->cols(); ++j) {
-                this->set(i, j, _castM.at(i,j));
-            }
-        }
-    } /* Mat(int rows, int cols) */
+        this->_assignElements(_castM);
+    } /* Mat(const Mat<T1>& _castM) */
     
     
     /**
@@ -364,12 +1003,7 @@ public:
     
     Mat(MatTr _castM) {
         _allocate(_castM.rows(), _castM.cols());
-        index_t i,j;
-        for (i = 0; i < this->rows(); ++i) {
-            for (j = 0; j < this->cols(); ++j) {
-                this->set(i, j, _castM.at(i,j));
-            }
-        }
+        this->_assignElements(_castM);
     } /* Mat(MatTr _castM) */
     
     /**
@@ -379,12 +1013,7 @@ public:
     
     Mat(MatTr* _castM) {
         _allocate(_castM->rows(), _castM->cols());
-        index_t i,j;
-        for (i = 0; i < this->rows(); ++i) {
-            for (j = 0; j < this->cols(); ++j) {
-                this->set(i, j, _castM->at(i,j));
-            }
-        }
+        this->_assignElements(*_castM);
     } /* Mat(MatTr* _castM) */
     
     /**
@@ -394,12 +1023,7 @@ public:
     
     Mat(SubMat _castM) {
         _allocate(_castM.rows(), _castM.cols());
-        index_t i,j;
-        for (i = 0; i < this->rows(); ++i) {
-            for (j = 0; j < this->cols(); ++j) {
-                this->set(i, j, _castM.at(i,j));
-            }
-        }
+        this->_assignElements(_castM);
     } /* Mat(SubMat _castM) */
     
     /**
@@ -409,12 +1033,7 @@ public:
     
     Mat(SubMat* _castM) {
         _allocate(_castM->rows(), _castM->cols());
-        index_t i,j;
-        for (i = 0; i < this->rows(); ++i) {
-            for (j = 0; j < this->cols(); ++j) {
-                this->set(i, j, _castM->at(i,j));
-            }
-        }
+        this->_assignElements(*_castM);
     } /* Mat(SubMat* _castM) */
     
     /**
@@ -425,13 +1044,8 @@ public:
     template <class T1>
     Mat(Mat<T1> *_castM){
         _allocate(_castM->rows(), _castM->cols());
-        int i,j;
-        for (i = 0; i < this->rows(); ++i) {
-            for (j = 0; j < this->cols(); ++j) {
-                this->set(i, j, _castM->at(i,j));
-            }
-        }
-    } /* Mat(int rows, int cols) */
+        this->_assignElements(*_castM);
+    } /* Mat(Mat<T1> *_castM) */
     
     /**
      * Allocates a matrix with the specified number of rows and columns
@@ -453,14 +1067,14 @@ public:
         index_t i,j;
         for (i = 0; i < this->_n_rows; ++i) {
             for (j = 0; j < this->_n_cols; ++j) {
-#ifndef ORCA_DISABLE_DIMENSION_CHECKS
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
                 /* Ensure that all rows have the same number of elements */
                 if ((_castValues.begin() + i)->size() != _n_cols) {
                     throw ORCAExcept::BadDimensionsError(); // Inconsitant size in matrix rows
                 }
 #endif
                 
-                this->set(i, j, *(((_castValues.begin() + i)->begin()) + j));
+                this->unchecked_set(i, j, *(((_castValues.begin() + i)->begin()) + j));
             }
         }
     } /* Mat(std::initializer_list<std::initializer_list<T> > _castValues) */
@@ -488,14 +1102,14 @@ public:
             index_t rowNumTemp = (*(((_castValues.begin() + i)->begin()))).rows();
             rowNum += rowNumTemp;
             for (j = 0; j < (*(_castValues.begin() + i)).size(); ++j) {
-#ifndef ORCA_DISABLE_DIMENSION_CHECKS
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
                 if ((*(((_castValues.begin() + i)->begin() + j))).rows() != rowNumTemp) {
                     throw ORCAExcept::BadDimensionsError(); // Inconsistant row numbers in block
                 }
 #endif
                 colNumTemp += (*(((_castValues.begin() + i)->begin() + j))).cols();
             }
-#ifndef ORCA_DISABLE_DIMENSION_CHECKS
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
             if (colNumTemp != colNum) {
                 throw ORCAExcept::BadDimensionsError(); // Inconsistant column numbers in block
             }
@@ -505,18 +1119,12 @@ public:
         _allocate(rowNum, colNum);
         index_t rowStart = 0;
         index_t colStart = 0;
-        index_t iInnerLoop = 0;
-        index_t jInnerLoop = 0;
         for (i = 0; i < _castValues.size(); ++i) {
             colStart = 0;
             for (j = 0; j < (*(_castValues.begin() + i)).size(); ++j) {
-                auto M =  (*(((_castValues.begin() + i)->begin() + j)));
-                for (iInnerLoop = 0; iInnerLoop < M.rows(); ++iInnerLoop) {
-                    for (jInnerLoop = 0; jInnerLoop < M.cols(); ++jInnerLoop) {
-                        this->set(rowStart + iInnerLoop, colStart + jInnerLoop, M.at(iInnerLoop,jInnerLoop));
-                    }
-                }
-                colStart += M.rows();
+                const Mat<T1>& M = (*(((_castValues.begin() + i)->begin() + j)));
+                this->_assignBlock(rowStart, colStart, M);
+                colStart += M.cols();
             }
             rowStart += (*(((_castValues.begin() + i)->begin()))).rows();
         }
@@ -542,7 +1150,8 @@ public:
                 this->ones(); // Fill the matrix with Ones
                 break;
             case fill::rand:
-                this->randFill(0, 1); // Fill with random between 0 and 1
+            case fill::randn:
+                this->_randomFill(type, 0, 1, rng::local()); // Fill with random between 0 and 1, or standard normal
                 break;
             default:
 #ifndef ORCA_DISABLE_ERROR_CHECKS
@@ -575,19 +1184,45 @@ public:
     } /* Mat(int rows, int cols, fill::fillType type, T elem) */
     
     /**
-     * Construct and populate matrix with element
+     * Construct and populate matrix with random elements from the given generator
+     * @param rows number of rows
+     * @param cols number of columns
+     * @param type Fill Type, rand for uniform in [0, 1) or randn for standard normal
+     * @param generator Random number generator, advanced
+     */
+    
+    Mat(index_t rows, index_t cols, fill::fillType type, Rng& generator) : Mat(rows, cols, type, 0, 1, generator) {
+    } /* Mat(index_t rows, index_t cols, fill::fillType type, Rng& generator) */
+    
+    /**
+     * Construct and populate matrix with random elements
+     * @param rows number of rows
+     * @param cols number of columns
+     * @param type Fill Type
+     * @param randLower lowerBound for rand, mean for randn
+     * @param randUpper upperBound for rand, standard deviation for randn
+     */
+    
+    Mat(index_t rows, index_t cols, fill::fillType type, T randLower, T randUpper) : Mat(rows, cols, type, randLower, randUpper, rng::local()) {
+    } /* Mat(index_t rows, index_t cols, fill::fillType type, T randLower, T randUpper) */
+    
+    /**
+     * Construct and populate matrix with random elements from the given generator.
+     * Equal seeds give equal matrices
      * @param rows number of rows
      * @param cols number of columns
      * @param type Fill Type
-     * @param randLower lowerBound
-     * @param randUpper upperBound
+     * @param randLower lowerBound for rand, mean for randn
+     * @param randUpper upperBound for rand, standard deviation for randn
+     * @param generator Random number generator, advanced
      */
     
-    Mat(index_t rows, index_t cols, fill::fillType type, T randLower, T randUpper) {
+    Mat(index_t rows, index_t cols, fill::fillType type, T randLower, T randUpper, Rng& generator) {
         _allocate(rows, cols);
         switch (type) {
             case fill::rand:
-                this->randFill(randLower, randUpper); // Fill with random between randLower and randUpper
+            case fill::randn:
+                this->_randomFill(type, randLower, randUpper, generator);
                 break;
             default:
 #ifndef ORCA_DISABLE_ERROR_CHECKS
@@ -595,10 +1230,134 @@ public:
 #endif
                 break;
         }
-    } /* Mat(int rows, int cols, fill::fillType type, T elem) */
+    } /* Mat(index_t rows, index_t cols, fill::fillType type, T randLower, T randUpper, Rng& generator) */
+    
+    /* Below are public destructors for the Mat class */
+    
+    /**
+     * Destructor. Frees the storage owned by the matrix
+     */
+    
+    virtual ~Mat() {
+        this->_release();
+    } /* virtual ~Mat() */
     
     /* Below are public operators for the Mat class */
     
+    /**
+     * Copy assignment operator. Performs a deep copy of _other.
+     * Existing storage is reused when both matrices own storage of the same dimensions
+     * @param _other Matrix to copy
+     */
+    
+    Mat<T>& operator = (const Mat<T>& _other) {
+        if (this == &_other) {
+            return *this;
+        }
+        if (this->_owner && _other._owner && (this->_n_rows == _other._n_rows) && (this->_n_cols == _other._n_cols)) {
+            this->_assignElements(_other);
+            this->_touch();
+            this->_shareCache(_other);
+            return *this;
+        }
+        /* Copy into a temporary first, _other might be a view of this matrix.
+         * Matrices on the heap stay there, they may have been created before the current arena scope */
+        arena::_HeapOnly heapOnly(this->_ownsHeapStorage());
+        Mat<T> temp(_other);
+        this->_release();
+        this->_moveFrom(temp);
+        return *this;
+    } /* Mat<T>& operator = (const Mat<T>& _other) */
+    
+    /**
+     * Move assignment operator. Takes ownership of the storage of _other, leaving it empty.
+     * A matrix on the heap copies arena storage instead of taking it, so that it keeps its
+     * contents after the arena scope ends
+     * @param _other Matrix to move
+     */
+    
+    Mat<T>& operator = (Mat<T>&& _other) {
+        if (this == &_other) {
+            return *this;
+        }
+        if (!_other._owner || (this->_ownsHeapStorage() && _isArenaStorage(_other._mat))) {
+            return (*this = static_cast<const Mat<T>&>(_other)); // Views and arena storage are copied
+        }
+        this->_release();
+        this->_moveFrom(_other);
+        return *this;
+    } /* Mat<T>& operator = (Mat<T>&& _other) */
+    
+    /**
+     * Assignment from a matrix expression. If this matrix already has the right dimensions and
+     * the expression does not read it through a transposed or offset view, the result is written
+     * in place. Otherwise the expression is evaluated into a temporary first
+     * @tparam E class of the expression
+     * @param _expr Expression to evaluate
+     */
+    
+    template <class E>
+    Mat<T>& operator = (const MatExpr<E>& _expr) {
+        if (this->_owner && (this->_n_rows == _expr.rows()) && (this->_n_cols == _expr.cols()) && !_expr.aliases(*this)) {
+            _expr._evalInto(this->_mat, this->_ld);
+            this->_touch();
+            return *this;
+        }
+        Mat<T> temp(_expr);
+        return (*this = std::move(temp));
+    } /* Mat<T>& operator = (const MatExpr<E>& _expr) */
+    
+    /**
+     * Adds _other to this matrix in place. Owned storage is updated directly, views are
+     * updated through set(). Defined in MatExpr.h
+     * @param _other Matrix of the same dimensions
+     */
+    
+    template <class T1>
+    Mat<T>& operator += (const Mat<T1>& _other);
+    
+    /**
+     * Adds an expression to this matrix in place, without evaluating it into a temporary
+     * unless it reads this matrix out of order. Defined in MatExpr.h
+     * @param _expr Expression of the same dimensions
+     */
+    
+    template <class E>
+    Mat<T>& operator += (const MatExpr<E>& _expr);
+    
+    /**
+     * Subtracts _other from this matrix in place. Defined in MatExpr.h
+     * @param _other Matrix of the same dimensions
+     */
+    
+    template <class T1>
+    Mat<T>& operator -= (const Mat<T1>& _other);
+    
+    /**
+     * Subtracts an expression from this matrix in place. Defined in MatExpr.h
+     * @param _expr Expression of the same dimensions
+     */
+    
+    template <class E>
+    Mat<T>& operator -= (const MatExpr<E>& _expr);
+    
+    /**
+     * Multiplies this matrix by a square matrix from the right, keeping its storage.
+     * The product reads every element of this matrix, so it is formed in a temporary first;
+     * multiply() with a separate destination avoids the temporary. Defined in MatExpr.h
+     * @param _other Square matrix with as many rows as this matrix has columns
+     */
+    
+    template <class T1>
+    Mat<T>& operator *= (const Mat<T1>& _other);
+    
+    /**
+     * Scales every element of this matrix in place. Defined in MatExpr.h
+     * @param scalar Scale factor
+     */
+    
+    Mat<T>& operator *= (T scalar);
+    
     /**
      * Index operator for Matrix
      * Returns the row at the specified index wrapped in a
@@ -624,12 +1383,27 @@ public:
     virtual void set(index_t row, index_t col, T elem) {
         /* Assign Element */
         *(_address(row, col)) = elem;
-#ifndef ORCA_DISABLE_STICKY_COMPUTE
-        /* Reset sticky compute mask */
-        this->_stickyComputeMask = 0;
-#endif
+        this->_touch();
     } /* set(int row, int col, T elem) */
     
+    /**
+     * Assigns an element without bounds checks, for inner loops whose indices are already known
+     * to be valid. Matrices owning their storage are written directly, and views go through set()
+     * so the matrix they write into still discards its cached results
+     * @param row Element Row Index
+     * @param col Element Column Index
+     * @param elem Element to be added
+     */
+    
+    void unchecked_set(index_t row, index_t col, T elem) {
+        if (this->_owner) {
+            this->_mat[row * this->_ld + col] = elem;
+            this->_touch();
+            return;
+        }
+        this->set(row, col, elem);
+    } /* void unchecked_set(index_t row, index_t col, T elem) */
+    
     /**
      * Set a row in the matrix equal to _vec
      * @param row row number
@@ -637,7 +1411,7 @@ public:
      */
     
     virtual void setRow(index_t row, Vec<T> _vec) {
-#ifndef ORCA_DISABLE_DIMENSION_CHECKS
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
         if (_vec.length() != this->_n_cols) {
             throw ORCAExcept::BadDimensionsError(); // Attempting to add a row of the wrong size
         }
@@ -678,6 +1452,21 @@ public:
         return *(_address(row, col)); //Index the matrix
     } /* virtual T at(index_t row, index_t col) const */
     
+    /**
+     * Returns the element at the specified index without bounds checks, for inner loops whose
+     * indices are already known to be valid. Matrices with storage are read directly, and views
+     * without storage go through at()
+     * @param row Element Row Index
+     * @param col Element Column Index
+     */
+    
+    T unchecked_at(index_t row, index_t col) const {
+        if (this->_mat != nullptr) {
+            return this->_mat[row * this->_ld + col];
+        }
+        return this->at(row, col);
+    } /* T unchecked_at(index_t row, index_t col) const */
+    
     /**
      * Returns a pointer to the submatrix in the given range
      * @param row1 row start index
@@ -691,19 +1480,46 @@ public:
     } /* virtual T at(index_t row1, index_t row2, index_t col1, index_t col2) const */
     
     /**
-     * Returns a pointer to the submatrix in the given range
+     * Returns the submatrix in the given range. Writes through it go into this matrix
+     * @param row1 row start index
+     * @param row2 row end index
+     * @param col1 Col start index
+     * @param col2 col2 Col send index
+     */
+    
+    virtual SubMat range(index_t row1, index_t row2, index_t col1, index_t col2) {
+        return SubMat(this, row1, row2, col1, col2); //Index the matrix
+    } /* virtual SubMat range(index_t row1, index_t row2, index_t col1, index_t col2) */
+    
+    /**
+     * Returns a pointer to the submatrix in the given range
+     * @param rows row range
+     * @param columns column range
+     */
+    
+    virtual SubMat range(std::initializer_list<index_t> rows, std::initializer_list<index_t> columns) const {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((rows.size() != 2) || (columns.size() != 2)) {
+            throw ORCAExcept::BadDimensionsError();
+        }
+#endif
+        return SubMat(this, *(rows.begin()), *(rows.begin() + 1), *(columns.begin()), *(columns.begin() + 1)); //Index the matrix
+    } /* virtual SubMat range(std::initializer_list<index_t>* rows, std::initializer_list<index_t>* columns) const */
+    
+    /**
+     * Returns the submatrix in the given range. Writes through it go into this matrix
      * @param rows row range
      * @param columns column range
      */
     
-    virtual SubMat range(std::initializer_list<index_t> rows, std::initializer_list<index_t> columns) const {
+    virtual SubMat range(std::initializer_list<index_t> rows, std::initializer_list<index_t> columns) {
 #ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
         if ((rows.size() != 2) || (columns.size() != 2)) {
             throw ORCAExcept::BadDimensionsError();
         }
 #endif
         return SubMat(this, *(rows.begin()), *(rows.begin() + 1), *(columns.begin()), *(columns.begin() + 1)); //Index the matrix
-    } /* virtual SubMat range(std::initializer_list<index_t>* rows, std::initializer_list<index_t>* columns) const */
+    } /* virtual SubMat range(std::initializer_list<index_t> rows, std::initializer_list<index_t> columns) */
     
     
     /**
@@ -722,34 +1538,94 @@ public:
         return this->_n_cols;
     } /* index_t cols() const */
     
+    /**
+     * Returns a counter that changes whenever the contents of the matrix may have changed
+     */
+    
+    unsigned long long epoch() const {
+        return this->_epoch;
+    } /* unsigned long long epoch() const */
+    
+    /**
+     * Returns true if the elements can be addressed directly through data() and stride().
+     * Lazy views such as transposes and submatrices return false and must be read through at()
+     */
+    
+    bool isDense() const {
+        return this->_mat != nullptr;
+    } /* bool isDense() const */
+    
+    /**
+     * Describes where the elements are stored, element (row, col) being base[row * rowStride + col * colStride].
+     * Dense matrices have a column stride of 1. Transposes and ranges of stored matrices describe the
+     * parent storage, so kernels can read them in place. Returns false for views that have no storage
+     * @param base Set to the address of element (0, 0)
+     * @param rowStride Set to the number of elements between consecutive rows
+     * @param colStride Set to the number of elements between consecutive columns
+     */
+    
+    virtual bool _layout(const T*& base, index_t& rowStride, index_t& colStride) const {
+        if (this->_mat == nullptr) {
+            return false;
+        }
+        base = this->_mat;
+        rowStride = this->_ld;
+        colStride = 1;
+        return true;
+    } /* virtual bool _layout(const T*& base, index_t& rowStride, index_t& colStride) const */
+    
+    /**
+     * Returns the address of the storage this matrix reads its elements from.
+     * Views return the storage of the matrix they refer to
+     */
+    
+    virtual const void* storage() const {
+        return this->_mat;
+    } /* virtual const void* storage() const */
+    
+    /**
+     * Returns a pointer to the first element, or nullptr for lazy views.
+     * Element (row, col) is located at data()[row * stride() + col].
+     * Writing through the pointer bypasses set(), so any sticky computed results are discarded.
+     * Views of another matrix discard the results of that matrix as well
+     */
+    
+    virtual T* data() {
+        this->_touch();
+        return this->_mat;
+    } /* virtual T* data() */
+    
+    /**
+     * Returns a pointer to the first element, or nullptr for lazy views.
+     * Element (row, col) is located at data()[row * stride() + col]
+     */
+    
+    const T* data() const {
+        return this->_mat;
+    } /* const T* data() const */
+    
+    /**
+     * Returns the number of elements between the starts of consecutive rows in data()
+     */
+    
+    index_t stride() const {
+        return this->_ld;
+    } /* index_t stride() const */
+    
     /**
      * Returns a vector of the diagonal of the matrix
      */
     
     Vec<T> diag() const {
-        //TODO: Sticky compute features for Diag
-#if 0
-#ifndef ORCA_DISABLE_STICKY_COMPUTE
-        if ((this->_stickyComputeMask & ORCA_STICKY_COMPUTE_DIAG_MASK) != 0) {
-            return _diag;
-        }
-        else {
-            this->_stickyComputeMask |= ORCA_STICKY_COMPUTE_DIAG_MASK;
-        }
-#endif
-#endif
-        
-        Vec<T> result(std::min(this->_n_rows, this->_n_cols));
-        index_t i;
-        for (i = 0; i < result.length(); ++i) {
-            result.set(i, this->at(i,i));
-        }
-#if 0
-#ifndef ORCA_DISABLE_STICKY_COMPUTE
-        _diag = result;
-#endif
-#endif
-        return result;
+        const index_t length = std::min(this->_n_rows, this->_n_cols);
+        return this->_remember(&_StickyCache<T>::diag, sizeof(T) * length, [&] {
+            Vec<T> result(length);
+            index_t i;
+            for (i = 0; i < length; ++i) {
+                result.set(i, this->at(i,i));
+            }
+            return result;
+        });
     } /* Vec<T> diag() const */
     
     /**
@@ -766,38 +1642,103 @@ public:
      * @return Matrix Transpose
      */
     
-    MatTr t() {
+    MatTr t() const {
         return MatTr(this);
     }
     
     /**
-     * Returns the inverse of the matrix
-     * @return Matrix Inverse
+     * Transposes the matrix in place. Square matrices with storage swap mirrored pairs of tiles
+     * and allocate nothing. Other owned matrices are transposed tile by tile into new storage;
+     * views cannot change shape and must be square
      */
     
-    Mat<T> inv() {
-#ifndef ORCA_DISABLE_STICKY_COMPUTE
-        if ((this->_stickyComputeMask & ORCA_STICKY_COMPUTE_INV_MASK) != 0) {
-            /* Inverse has been calculated, return previous result */
-            return *this->_inv;
+    void transposeInPlace() {
+        index_t i,j;
+        if ((this->_n_rows == this->_n_cols) && this->isDense()) {
+            T* a = this->data();
+            const index_t n = this->_n_rows;
+            const index_t ld = this->_ld;
+            const index_t block = _transposeBlock(sizeof(T));
+            index_t ii, jj;
+            for (ii = 0; ii < n; ii += block) {
+                const index_t iEnd = (n - ii < block) ? n : (ii + block);
+                for (i = ii; i < iEnd; ++i) {
+                    for (j = i + 1; j < iEnd; ++j) {
+                        std::swap(a[i * ld + j], a[j * ld + i]); // Diagonal tile
+                    }
+                }
+                for (jj = ii + block; jj < n; jj += block) {
+                    const index_t jEnd = (n - jj < block) ? n : (jj + block);
+                    for (i = ii; i < iEnd; ++i) {
+                        for (j = jj; j < jEnd; ++j) {
+                            std::swap(a[i * ld + j], a[j * ld + i]);
+                        }
+                    }
+                }
+            }
+            return;
+        }
+        if (this->_owner) {
+            Mat<T> transposed(this->t());
+            *this = std::move(transposed);
+            return;
+        }
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (this->_n_rows != this->_n_cols) {
+            throw ORCAExcept::BadDimensionsError(); // Views cannot change shape
         }
 #endif
+        for (i = 0; i < this->_n_rows; ++i) {
+            for (j = i + 1; j < this->_n_cols; ++j) {
+                T upper = this->unchecked_at(i, j);
+                this->unchecked_set(i, j, this->unchecked_at(j, i));
+                this->unchecked_set(j, i, upper);
+            }
+        }
+    } /* void transposeInPlace() */
+    
+    /**
+     * Returns the LU factorization of the matrix with partial pivoting.
+     * Defined in LU.h
+     * @return Factorization object
+     */
+    
+    LU<T> lu() const;
+    
+    /**
+     * Returns the Cholesky factorization of a symmetric positive-definite matrix.
+     * Only the lower triangle is read. Defined in Cholesky.h
+     * @return Factorization object
+     */
+    
+    Chol<T> chol() const;
+    
+    /**
+     * Returns the LDLt factorization of a symmetric matrix.
+     * Only the lower triangle is read. Defined in Cholesky.h
+     * @return Factorization object
+     */
+    
+    LDLT<T> ldlt() const;
+    
+    /**
+     * Returns the inverse of the matrix, computed from its LU factorization.
+     * Throws SingularMatrixError if the matrix is singular
+     * @return Matrix Inverse
+     */
+    
+    Mat<T> inv() const {
 #ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
         if (this->_n_rows != this->_n_cols) {
             throw ORCAExcept::BadDimensionsError(); // Matrix must be square
         }
 #endif
-
-#ifndef ORCA_DISABLE_STICKY_COMPUTE
-        //TODO: this copying performs the fill operation twice
-        this->_inv = new MatInv((*this).rref(Mat<T>(this->_n_rows, this->_n_cols, fill::eye)));
-        this->_stickyComputeMask |= ORCA_STICKY_COMPUTE_INV_MASK;
-        return *this->_inv;
-#else
-        return (*this).rref(Mat<T>(this->_n_rows, this->_n_cols, fill::eye));
-#endif
-        
-    }
+        instrument::_Counted counted(instrument::Op::inv);
+        return this->_remember(&_StickyCache<T>::inv, sizeof(T) * this->_n_rows * this->_n_cols, [&] {
+            counted.flops(2.0 * this->_n_rows * this->_n_rows * this->_n_rows);
+            return this->lu().inv();
+        });
+    } /* Mat<T> inv() const */
     
     /**
      * Returns the specified row
@@ -805,11 +1746,7 @@ public:
      */
     
     MatRow getRow(index_t row) {
-#ifndef ORCA_DISABLE_BOUNDS_CHECKS
-        if ((row > this->_n_rows) || (row < 0)) {
-            throw ORCAExcept::OutOfBoundsError(); // Attempted to grab a row out of bounds
-        }
-#endif
+        _checkIndex<checks::Default>(row, this->_n_rows); // Attempted to grab a row out of bounds
         return MatRow(this, row);
     } /* MatRow getRow(index_t row) */
     
@@ -819,14 +1756,36 @@ public:
      */
     
     MatCol getCol(index_t col) {
-#ifndef ORCA_DISABLE_BOUNDS_CHECKS
-        if ((col > this->_n_cols) || (col < 0)) {
-            throw ORCAExcept::OutOfBoundsError(); // Attempted to grab a col out of bounds
-        }
-#endif
+        _checkIndex<checks::Default>(col, this->_n_cols); // Attempted to grab a col out of bounds
         return MatCol(this, col);
     } /* MatCol getCol(index_t col) */
     
+    /**
+     * Returns a writable view of the rows row1 to row2 and columns col1 to col2, inclusive.
+     * Assigning to the view or applying +=, -= or *= to it changes this matrix in place.
+     * The view must not outlive the storage of this matrix. Defined in MatView.h
+     * @param row1 row start index
+     * @param row2 row end index
+     * @param col1 column start index
+     * @param col2 column end index
+     */
+    
+    MatView<T> block(index_t row1, index_t row2, index_t col1, index_t col2);
+    
+    /**
+     * Returns a writable 1 x n view of the specified row. Defined in MatView.h
+     * @param row row number
+     */
+    
+    MatView<T> row(index_t row);
+    
+    /**
+     * Returns a writable view of the specified column. Defined in MatView.h
+     * @param col column number
+     */
+    
+    VecView<T> col(index_t col);
+    
     /* Below are the row operatations for the Mat class */
     
     /**
@@ -836,6 +1795,18 @@ public:
      */
     
     virtual void rowSwap(index_t r1, index_t r2) {
+        if (this->isDense()) {
+            T* row1 = this->_address(r1, 0);
+            T* row2 = this->_address(r2, 0);
+            index_t i;
+            for (i = 0; i < this->_n_cols; ++i) {
+                T temp = row1[i];
+                row1[i] = row2[i];
+                row2[i] = temp;
+            }
+            this->_touch();
+            return;
+        }
         //TODO: Issues with overloaded 'at' for MatRow makes this consruction necesarry
         MatRow r1Temp = this->getRow(r1);
         Vec<T> r1TempLoaded(this->_n_cols);
@@ -845,7 +1816,7 @@ public:
         }
         
         for (i = 0; i < this->_n_cols; ++i) {
-            this->set(r1, i, this->at(r2, i));
+            this->unchecked_set(r1, i, this->unchecked_at(r2, i));
         }
         this->setRow(r2, r1TempLoaded);
     } /* virtual void rowSwap(index_t r1, index_t r2) */
@@ -857,8 +1828,16 @@ public:
      */
     virtual void rowMutliply(index_t r1, T t1) {
         index_t i;
+        if (this->isDense()) {
+            T* row1 = this->_address(r1, 0);
+            for (i = 0; i < this->_n_cols; ++i) {
+                row1[i] = t1 * row1[i];
+            }
+            this->_touch();
+            return;
+        }
         for (i = 0; i < this->_n_cols; ++i) {
-            this->set(r1, i, t1 * this->at(r1, i));
+            this->unchecked_set(r1, i, t1 * this->unchecked_at(r1, i));
         }
     } /* virtual void rowMutliply(index_t r1, T t1) */
     
@@ -870,8 +1849,17 @@ public:
     
     virtual void rowAdd(index_t r1, index_t r2) {
         index_t i;
+        if (this->isDense()) {
+            T* row1 = this->_address(r1, 0);
+            const T* row2 = this->_address(r2, 0);
+            for (i = 0; i < this->_n_cols; ++i) {
+                row1[i] = row1[i] + row2[i];
+            }
+            this->_touch();
+            return;
+        }
         for (i = 0; i < this->_n_cols; ++i) {
-            this->set(r1, i, this->at(r1, i) + this->at(r2, i));
+            this->unchecked_set(r1, i, this->unchecked_at(r1, i) + this->unchecked_at(r2, i));
         }
     } /* virtual void rowAdd(index_t r1, index_t r2) */
     
@@ -883,71 +1871,103 @@ public:
     
     virtual void rowAdd(index_t r1, index_t r2, T multiply) {
         index_t i;
+        if (this->isDense()) {
+            T* row1 = this->_address(r1, 0);
+            const T* row2 = this->_address(r2, 0);
+            for (i = 0; i < this->_n_cols; ++i) {
+                row1[i] = row1[i] + multiply * row2[i];
+            }
+            this->_touch();
+            return;
+        }
         for (i = 0; i < this->_n_cols; ++i) {
-            this->set(r1, i, this->at(r1, i) + multiply*this->at(r2, i));
+            this->unchecked_set(r1, i, this->unchecked_at(r1, i) + multiply*this->unchecked_at(r2, i));
         }
     } /* virtual void rowAdd(index_t r1, index_t r2, T mulitply) */
     
-    /* Below are member functions of the Mat class */
+protected:
     
-    T det() {
-#ifndef ORCA_DISABLE_STICKY_COMPUTE
-        if ((this->_stickyComputeMask & ORCA_STICKY_COMPUTE_DET_MASK) != 0) {
-            return this->_det;
+    /* Below are protected member functions of the Mat class */
+    
+    /**
+     * Eliminates column lead from every row in [firstRow, rows) other than pivotRow by
+     * adding the appropriate multiple of pivotRow, whose lead element must be 1.
+     * If other is given the same row operations are applied to it.
+     * Both matrices must be dense. Rows are independent, so large eliminations are split across threads
+     * @param pivotRow Row used to eliminate
+     * @param lead Column being eliminated
+     * @param firstRow First row to eliminate
+     * @param other Optional matrix receiving the same row operations
+     */
+    
+    void _eliminate(index_t pivotRow, index_t lead, index_t firstRow, Mat<T>* other) {
+        const index_t cols = this->_n_cols;
+        const index_t otherCols = (other == nullptr) ? 0 : other->_n_cols;
+        const T* pivot = this->_address(pivotRow, 0);
+        const T* otherPivot = (other == nullptr) ? nullptr : other->_address(pivotRow, 0);
+        _parallelFor(firstRow, this->_n_rows, (this->_n_rows - firstRow) * (cols + otherCols), [&](index_t first, index_t last) {
+            index_t i, j;
+            for (i = first; i < last; ++i) {
+                if (i == pivotRow) {
+                    continue;
+                }
+                T* row = this->_mat + i * this->_ld;
+                const T multiply = -row[lead];
+                if (other != nullptr) {
+                    T* otherRow = other->_mat + i * other->_ld;
+                    for (j = 0; j < otherCols; ++j) {
+                        otherRow[j] = otherRow[j] + multiply * otherPivot[j];
+                    }
+                }
+                for (j = 0; j < cols; ++j) {
+                    row[j] = row[j] + multiply * pivot[j];
+                }
+            }
+        });
+        this->_touch();
+        if (other != nullptr) {
+            other->_touch();
         }
-#endif
+    } /* void _eliminate(index_t pivotRow, index_t lead, index_t firstRow, Mat<T>* other) */
+    
+public:
+    
+    /* Below are member functions of the Mat class */
+    
+    /**
+     * Returns the determinant of the matrix, computed from its LU factorization
+     * @return Determinant
+     */
+    
+    T det() const {
 #ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
         if (this->_n_rows != this->_n_cols) {
             throw ORCAExcept::BadDimensionsError();
         }
 #endif
-        index_t lead = 0;
-        index_t r;
-        T multiplier = 1.0;
-        Mat<T> matClone = this;
-        for (r = 0; r < matClone.rows(); ++r) {
-            if (matClone.cols() < lead) {
-                return 0;
-            }
-            index_t i = r;
-            while (matClone.at(i,lead) == 0) {
-                ++i;
-                if (matClone.rows() == i) {
-                    i = r;
-                    ++lead;
-                    if (matClone.cols() == lead) {
-                        return 0;
-                    }
-                }
-            }
-            matClone.rowSwap(i,r);
-            multiplier *= ((((i - r) % 2) == 0) ? 1 : -1);
-            if (matClone.at(r,lead) != 0) {
-                multiplier *= matClone.at(r,lead);
-                matClone.rowMutliply(r, 1 / (matClone.at(r,lead)));
-            }
-            
-            for (i = r; i < matClone.rows(); ++i ) {
-                if (i != r) {
-                    matClone.rowAdd(i, r, -matClone.at(i,lead));
-                }
-            }
-            ++lead;
-        }
+        instrument::_Counted counted(instrument::Op::det);
 #ifndef ORCA_DISABLE_STICKY_COMPUTE
-        this->_stickyComputeMask |= ORCA_STICKY_COMPUTE_DET_MASK;
-        this->_det = multiplier * matClone.diag().prod();
-        return this->_det;
+        if (this->_owner && this->_cache && this->_cache->hasDet) {
+            return this->_cache->det;
+        }
+        counted.flops(2.0 * this->_n_rows * this->_n_rows * this->_n_rows / 3);
+        T result = this->lu().det();
+        if (this->_owner) {
+            this->_sticky().det = result;
+            this->_sticky().hasDet = true;
+        }
+        return result;
 #else
-        return multiplier * matClone.diag().prod();
+        counted.flops(2.0 * this->_n_rows * this->_n_rows * this->_n_rows / 3);
+        return this->lu().det();
 #endif
-        
-    } /* T det() */
+    } /* T det() const */
     /**
      * Performs Gaussian-Elimination on the matrix to reduce it to rowreduced echelon form
      * @return Reduced Matrix
      */
     Mat<T> rref() {
+        instrument::_Counted counted(instrument::Op::rref, 2.0 * std::min(this->_n_rows, this->_n_cols) * (this->_n_rows - 1) * this->_n_cols);
         Mat<T> _m1Clone = this;
         index_t lead = 0;
         index_t r;
@@ -972,11 +1992,7 @@ public:
                 _m1Clone.rowMutliply(r, 1 / (_m1Clone.at(r,lead)));
             }
             
-            for (i = 0; i < _m1Clone.rows(); ++i ) {
-                if (i != r) {
-                    _m1Clone.rowAdd(i, r, -_m1Clone.at(i,lead));
-                }
-            }
+            _m1Clone._eliminate(r, lead, 0, nullptr);
             ++lead;
         }
         return _m1Clone;
@@ -990,6 +2006,7 @@ public:
      */
     
     Mat<T> rref(Mat<T> _m2) {
+        instrument::_Counted counted(instrument::Op::rref, 2.0 * std::min(this->_n_rows, this->_n_cols) * (this->_n_rows - 1) * (this->_n_cols + _m2.cols()));
         Mat<T> _m1Clone = this;
         Mat<T> _m2Clone = _m2;
         
@@ -1022,12 +2039,7 @@ public:
                 _m2Clone.rowMutliply(r, 1 / (_m1Clone.at(r,lead)));
             }
             
-            for (i = 0; i < _m1Clone.rows(); ++i ) {
-                if (i != r) {
-                    _m2Clone.rowAdd(i, r, -_m1Clone.at(i,lead));
-                    _m1Clone.rowAdd(i, r, -_m1Clone.at(i,lead));
-                }
-            }
+            _m1Clone._eliminate(r, lead, 0, &_m2Clone);
             ++lead;
         }
         return _m2Clone;
@@ -1079,87 +2091,171 @@ std::ostream& operator<<(std::ostream& os, const Mat<T>& mat) {
  */
 
 template<class T1, class T2>
-bool operator == (Mat<T1> m1, Mat<T2> m2) {
+bool operator == (const Mat<T1>& m1, const Mat<T2>& m2) {
     if ((m1.rows() != m2.rows()) || (m1.cols() != m2.cols())) {
         return false;
     }
     index_t i,j;
     for (i = 0; i < m1.rows(); ++i) {
         for (j = 0; j < m1.cols(); ++j) {
-            if (m1.at(i, j) != m2.at(i,j)) {
+            if (m1.unchecked_at(i, j) != m2.unchecked_at(i,j)) {
                 return false;
             }
         }
     }
     return true;
-} /* bool operator == (Mat<T1> m1, Mat<T2> m2) */
+} /* bool operator == (const Mat<T1>& m1, const Mat<T2>& m2) */
 
 /**
- * Overloaded addition operator for 2 matricies
- * @tparam T1 left class
- * @tparam T2 right class
- * @param m1 left matrix
- * @param m2 right matrix
+ * Dense product kernel. Computes the m x p matrix c = a * b where a is m x n and b is n x p.
+ * Every operand is addressed as pointer[row * ld + col]. The i-k-j loop order keeps the
+ * innermost loop running along contiguous rows of b and c
+ * @param a left operand storage
+ * @param lda row stride of a
+ * @param b right operand storage
+ * @param ldb row stride of b
+ * @param c result storage, overwritten
+ * @param ldc row stride of c
  */
 
-template<class T1, class T2>
-auto operator + (Mat<T1> m1, Mat<T2> m2) {
-#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
-    if ((m1.rows() != m2.rows()) || (m1.cols() != m2.cols())) {
-        throw ORCAExcept::BadDimensionsError(); // Matricies being added had incompatible dimensions
-    }
-#endif
-    int i, j;
-    Mat<decltype(m1.at(0, 0) + m2.at(0,0))> m3(m1.rows(),m1.cols());
-    for (i = 0; i < m1.rows(); ++i) {
-        for (j = 0; j < m1.cols(); ++j) {
-            m3.set(i, j, m1.at(i,j) + m2.at(i,j));
+template<class T1, class T2, class T3>
+void _denseMultiply(const T1* a, index_t lda, const T2* b, index_t ldb, T3* c, index_t ldc, index_t m, index_t n, index_t p) {
+    index_t i, j, k;
+    for (i = 0; i < m; ++i) {
+        T3* cRow = c + i * ldc;
+        const T1* aRow = a + i * lda;
+        const T2* bRow = b;
+        for (j = 0; j < p; ++j) {
+            cRow[j] = aRow[0] * bRow[j];
+        }
+        for (k = 1; k < n; ++k) {
+            const T1 aik = aRow[k];
+            bRow = b + k * ldb;
+            for (j = 0; j < p; ++j) {
+                cRow[j] += aik * bRow[j];
+            }
         }
     }
-    return m3;
-} /* auto operator + (Mat<T1> m1, Mat<T2> m2) */
+} /* void _denseMultiply(...) */
 
 /**
- * Overloaded += operator
- * @tparam T1 left class
- * @tparam T2 right class
- * @param m1 left matrix
- * @param m2 right matrix
+ * Computes C = A * B for Complex<float> or Complex<double> operands with the real GEMM kernel.
+ * The real and imaginary parts are split into separate planes stacked as [Ar; Ai] and [Br Bi],
+ * so a single real product gives the four blocks that combine into Cr = Ar Br - Ai Bi
+ * and Ci = Ar Bi + Ai Br, the same number of multiply-adds as the complex product
+ * @param m rows of A and C
+ * @param n columns of B and C
+ * @param k columns of A and rows of B, must be positive
+ * @param a A storage
+ * @param rsa row stride of A
+ * @param csa column stride of A
+ * @param b B storage
+ * @param rsb row stride of B
+ * @param csb column stride of B
+ * @param c C storage, row-major, overwritten
+ * @param ldc row stride of C
  */
 
-template<class T1, class T2>
-auto operator += (Mat<T1> &m1, Mat<T2> &m2) {
-    m1 = m1 + m2;
-    return m1;
-} /* auto operator += (Mat<T1> &m1, Mat<T2> &m2) */
+template <class S>
+void _complexGemm(index_t m, index_t n, index_t k, const Complex<S>* a, index_t rsa, index_t csa, const Complex<S>* b, index_t rsb, index_t csb, Complex<S>* c, index_t ldc) {
+    _GemmBuffer<S> left(2 * m * k);     // [Ar; Ai], 2m x k
+    _GemmBuffer<S> right(2 * k * n);    // [Br Bi], k x 2n
+    _GemmBuffer<S> product(4 * m * n);  // [Ar Br, Ar Bi; Ai Br, Ai Bi], 2m x 2n
+    S* l = left.data();
+    S* r = right.data();
+    S* p = product.data();
+    index_t i, j;
+    for (i = 0; i < m; ++i) {
+        for (j = 0; j < k; ++j) {
+            const Complex<S> value = a[i * rsa + j * csa];
+            l[i * k + j] = value.real();
+            l[(m + i) * k + j] = value.imag();
+        }
+    }
+    for (i = 0; i < k; ++i) {
+        for (j = 0; j < n; ++j) {
+            const Complex<S> value = b[i * rsb + j * csb];
+            r[i * 2 * n + j] = value.real();
+            r[i * 2 * n + n + j] = value.imag();
+        }
+    }
+    _gemm(2 * m, 2 * n, k, l, k, index_t(1), r, 2 * n, index_t(1), p, 2 * n);
+    for (i = 0; i < m; ++i) {
+        const S* top = p + i * 2 * n;
+        const S* bottom = p + (m + i) * 2 * n;
+        for (j = 0; j < n; ++j) {
+            c[i * ldc + j] = Complex<S>(top[j] - bottom[n + j], top[n + j] + bottom[j]);
+        }
+    }
+} /* void _complexGemm(...) */
 
 /**
- * Overloaded - operator
+ * Writes the product m1 * m2 into dense row-major storage. Large float and double products,
+ * Real<float> and Real<double> included, go through the blocked kernel in Gemm.h and large
+ * Complex<float> and Complex<double> products through _complexGemm, transposes and ranges
+ * included. Other stored operands go through _denseMultiply, and views without storage
+ * are read through at()
  * @tparam T1 left class
  * @tparam T2 right class
+ * @tparam T3 class of the result
  * @param m1 left matrix
  * @param m2 right matrix
+ * @param c result storage, overwritten
+ * @param ldc row stride of c
  */
 
-template<class T1, class T2>
-auto operator - (Mat<T1> m1, Mat<T2> m2) {
-#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
-    if ((m1.rows() != m2.rows()) || (m1.cols() != m2.cols())) {
-        throw ORCAExcept::BadDimensionsError(); // Matricies being subtracted had incompatible dimensions
+template<class T1, class T2, class T3>
+void _multiplyInto(const Mat<T1>& m1, const Mat<T2>& m2, T3* c, index_t ldc) {
+    const T1* a;
+    const T2* b;
+    index_t rsa, csa, rsb, csb;
+    if ((m1.cols() == m2.rows()) && (m1.cols() > 0) && m1._layout(a, rsa, csa) && m2._layout(b, rsb, csb)) {
+        typedef typename _complexBase<T1>::type C1;
+        if constexpr (std::is_same<T1, T2>::value && std::is_same<T1, T3>::value && _hasGemm<C1>()) {
+            if (4 * m1.rows() * m1.cols() * m2.cols() >= ORCA_GEMM_MIN_SIZE) {
+                _complexGemm(m1.rows(), m2.cols(), m1.cols(), a, rsa, csa, b, rsb, csb, c, ldc);
+                return;
+            }
+        }
+        /* Real elements are multiplied as the type they wrap */
+        typedef _storage_t<T1> S1;
+        typedef _storage_t<T2> S2;
+        typedef _storage_t<T3> S3;
+        if constexpr (std::is_same<S1, S2>::value && std::is_same<S1, S3>::value && _hasGemm<S1>()) {
+            if (m1.rows() * m1.cols() * m2.cols() >= ORCA_GEMM_MIN_SIZE) {
+                /* The packing step reads transposed operands with their own strides */
+                _gemm(m1.rows(), m2.cols(), m1.cols(), reinterpret_cast<const S1*>(a), rsa, csa, reinterpret_cast<const S1*>(b), rsb, csb, reinterpret_cast<S1*>(c), ldc);
+                return;
+            }
+        }
+        if ((csa == 1) && (csb == 1)) {
+            _denseMultiply(reinterpret_cast<const S1*>(a), rsa, reinterpret_cast<const S2*>(b), rsb, reinterpret_cast<S3*>(c), ldc, m1.rows(), m1.cols(), m2.cols());
+            return;
+        }
+        /* Small products copy transposed operands into row-major order, tile by tile */
+        if (csa != 1) {
+            _multiplyInto(Mat<T1>(m1), m2, c, ldc);
+            return;
+        }
+        _multiplyInto(m1, Mat<T2>(m2), c, ldc);
+        return;
     }
-#endif
-    Mat<decltype(m1.at(0, 0) + m2.at(0,0))> m3(m1.rows(),m1.cols());
-    int i, j;
+    
+    index_t i,j,k;
+    
     for (i = 0; i < m1.rows(); ++i) {
-        for (j = 0; j < m1.cols(); ++j) {
-            m3.set(i, j, m1.at(i,j) - m2.at(i,j));
+        for (j = 0; j < m2.cols(); ++j) {
+            auto dotRes = m1.unchecked_at(i, 0) * m2.unchecked_at(0, j);
+            for (k = 1; k < m1.cols(); ++k) {
+                dotRes += m1.unchecked_at(i, k) * m2.unchecked_at(k, j);
+            }
+            c[i * ldc + j] = dotRes;
         }
     }
-    return m3;
-} /* auto operator - (Mat<T1> m1, Mat<T2> m2) */
+} /* void _multiplyInto(const Mat<T1>& m1, const Mat<T2>& m2, T3* c, index_t ldc) */
 
 /**
- * Overloaded -= operator
+ * Overloaded * operator for 2 matricies. The product is written into a new matrix by _multiplyInto
  * @tparam T1 left class
  * @tparam T2 right class
  * @param m1 left matrix
@@ -1167,102 +2263,28 @@ auto operator - (Mat<T1> m1, Mat<T2> m2) {
  */
 
 template<class T1, class T2>
-auto operator -= (Mat<T1> &m1, Mat<T2> m2) {
-    m1 = m1 - m2;
-    return m1;
-} /* auto operator -= (Mat<T1> &m1, Mat<T2> m2) */
-
-/**
- * Overloaded unary operator
- * @tparam T  class
- * @param m1  matrix
- */
-
-template<class T>
-auto operator - (Mat<T> m1) {
-    Mat<T> result(m1.rows(), m1.cols());
-    int i,j;
-    for (i = 0; i < result.rows(); ++i) {
-        for (j = 0; j < result.cols(); ++j) {
-            result.set(i, j, -m1.at(i, j));
-        }
-    }
-    return result;
-} /* auto operator - (Mat<T> m1) */
-
-
-template<class T1, class T2>
-auto operator * (Mat<T1> m1, Mat<T2> m2) {
+auto operator * (const Mat<T1>& m1, const Mat<T2>& m2) {
 #ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
     if (m1.cols() != m2.rows()) {
-        errno = ORCA_BAD_DIMENSIONS;
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions of the product disagree
     }
 #endif
     
 #ifndef ORCA_DISABLE_EMPTY_CHECKS
     if (m1.rows() == 0 || m1.cols() == 0 || m2.rows() == 0 || m2.cols() == 0) {
-        errno = ORCA_EMPTY_ELEMENT;
+        throw ORCAExcept::EmptyElementError(); // Product of an empty matrix
     }
 #endif
     
-    Mat<decltype(m1.at(0,0)*m2.at(0,0))> result(m1.rows(), m2.cols());
-    
-    int i,j;
-    
-    for (i = 0; i < m1.rows(); ++i) {
-        for (j = 0; j < m2.cols(); ++j) {
-            auto v1 = m1.getRow(i);
-            auto v2 = m2.getCol(j);
-            
-            //TODO: It doesn't want to call the overriden dot() for matrow and matcol, this is a temporary solution
-            
-            auto dotRes = v1.at(0) * v2.at(0);
-            index_t k;
-            for (k = 1; k < v1.length(); ++k) {
-                dotRes += v1.at(k) * v2.at(k);
-            }
-            
-            result.set(i, j, dotRes);
-        }
-    }
+    instrument::_Counted counted(instrument::Op::multiply, 2.0 * m1.rows() * m1.cols() * m2.cols());
+    Mat<decltype(std::declval<T1>() * std::declval<T2>())> result(m1.rows(), m2.cols());
+    _multiplyInto(m1, m2, result.data(), result.stride());
     return result;
-} /* auto operator * (Mat<T1> m1, Mat<T2> m2) */
+} /* auto operator * (const Mat<T1>& m1, const Mat<T2>& m2) */
 
 
 
 
-/**
- * Overloaded *   operator
- * @tparam T1 left class
- * @tparam T2 right class
- * @param m1 left matrix
- * @param t2 right value
- */
-
-template<class T1, class T2>
-auto operator * (Mat<T1> m1, T2 t2) {
-    int i, j;
-    for (i = 0; i < m1.rows(); ++i) {
-        for (j = 0; j < m1.cols(); ++j) {
-            m1.set(i, j, m1.at(i,j) * t2);
-        }
-    }
-    return m1;
-} /* auto operator * (Mat<T1> m1, T2 t2) */
-
-/**
- * Overloaded *   operator for matrix and vector
- * @tparam T1 left class
- * @tparam T2 right class
- * @param m1 left matrix
- * @param v2 right value
- */
-
-template<class T1, class T2>
-auto operator * (Mat<T1> m1, ColVec<T2> v2) {
-    return m1 * Mat<T2>(v2);
-} /* auto operator * (Mat<T1> m1, T2 t2) */
-
 /**
  * Overloaded *   operator for matrix and vector
  * @tparam T1 left class
@@ -1272,36 +2294,9 @@ auto operator * (Mat<T1> m1, ColVec<T2> v2) {
  */
 
 template<class T1, class T2>
-auto operator *= (Mat<T1> m1, ColVec<T2> v2) {
-    m1 = m1 * Mat<T2>(v2);
-    return m1;
-} /* auto operator *= (Mat<T1> m1, T2 t2) */
-
-/**
- * Overloaded *  operator
- * @tparam T1 right class
- * @tparam T2 left class
- * @param m1 right matrix
- * @param t2 left value
- */
-
-template<class T1, class T2>
-auto operator * (T1 t2, Mat<T2> m1) {
-    return m1 * t2;
-} /* auto operator * (T1 t2, Mat<T2> m1) */
-
-/**
- * Overloaded *=   operator
- * @tparam T1 right class
- * @tparam T2 left class
- * @param m1 right matrix
- * @param t2 left value
- */
-
-template<class T1, class T2>
-auto operator *= (Mat<T1> &m1, T2 t2) {
-    return m1 * t2;
-} /* auto operator *= (Mat<T1> &m1, T2 t2) */
+auto operator * (const Mat<T1>& m1, const ColVec<T2>& v2) {
+    return m1 * static_cast<const Mat<T2>&>(v2);
+} /* auto operator * (const Mat<T1>& m1, const ColVec<T2>& v2) */
 
 /* Below are nonmember functions for the Mat class */
 
@@ -0,0 +1,862 @@
+//
+//  MatBatch.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef MatBatch_h
+#define MatBatch_h
+
+/* Includes for MatBatch.h */
+
+#include "Except.h"             // Included for ORCA Exceptions
+#include "Checks.h"             // Included for check policies
+#include "Gemm.h"               // Included for the SIMD vector operations
+#include "QuaternionBatch.h"    // Included for the batch loop
+#include "Mat.h"                // Included for Mat class
+#include "Vec.h"                // Included for ColVec class
+#include "Arena.h"              // Included for aligned storage allocation
+#include <utility>              // Included for std::swap
+
+namespace ORCA {
+
+/* Kernels shared by the batch operations. Each one handles the problems starting at lane,
+ * one SIMD vector of problems at a time, so every vector instruction works on the same element
+ * of width independent matrices and no problem ever branches on its own values */
+
+/**
+ * Gaussian elimination with partial pivoting of one vector of problems, applied in place to the
+ * n x n matrices a and the n x m right hand sides b. Pivots are chosen per problem by swapping
+ * each candidate row into the pivot row wherever it has the larger magnitude.
+ * When perm is not null the multipliers are kept below the diagonal and perm is permuted with
+ * the rows, leaving an LU factorization. A zero pivot leaves its column unreduced
+ * @tparam O Vector operations
+ * @param a Matrices, element (r, c) of problem p at a[(r * n + c) * stride + p]
+ * @param b Right hand sides, laid out the same way with m columns
+ * @param perm Row order of each problem, or nullptr
+ * @param sign Receives the sign of each row permutation, or nullptr
+ */
+
+template <class O, class T>
+void _batchEliminate(T* a, T* b, T* perm, T* sign, index_t n, index_t m, index_t stride, index_t lane) {
+    using vec = typename O::vec;
+    const vec zero = O::zero();
+    const vec one = O::broadcast(T(1));
+    vec parity = one;
+    T* const pa = a + lane;
+    T* const pb = b + lane;
+    index_t i,j,k;
+    for (k = 0; k < n; ++k) {
+        for (i = k + 1; i < n; ++i) {
+            const vec current = O::abs(O::load(pa + (k * n + k) * stride));
+            const vec candidate = O::abs(O::load(pa + (i * n + k) * stride));
+            auto swap = [&](T* row, T* other) {
+                const vec x = O::load(row);
+                const vec y = O::load(other);
+                O::store(row, O::selectGreater(candidate, current, y, x));
+                O::store(other, O::selectGreater(candidate, current, x, y));
+            };
+            for (j = (perm != nullptr) ? 0 : k; j < n; ++j) {
+                swap(pa + (k * n + j) * stride, pa + (i * n + j) * stride);
+            }
+            for (j = 0; j < m; ++j) {
+                swap(pb + (k * m + j) * stride, pb + (i * m + j) * stride);
+            }
+            if (perm != nullptr) {
+                swap(perm + lane + k * stride, perm + lane + i * stride);
+            }
+            parity = O::selectGreater(candidate, current, O::sub(zero, parity), parity);
+        }
+        const vec pivot = O::load(pa + (k * n + k) * stride);
+        const vec inverse = O::selectGreater(O::abs(pivot), zero, O::div(one, pivot), zero);
+        for (i = k + 1; i < n; ++i) {
+            T* factorAddress = pa + (i * n + k) * stride;
+            const vec factor = O::mul(O::load(factorAddress), inverse);
+            if (perm != nullptr) {
+                O::store(factorAddress, factor);
+            }
+            for (j = k + 1; j < n; ++j) {
+                T* element = pa + (i * n + j) * stride;
+                O::store(element, O::fnma(factor, O::load(pa + (k * n + j) * stride), O::load(element)));
+            }
+            for (j = 0; j < m; ++j) {
+                T* element = pb + (i * m + j) * stride;
+                O::store(element, O::fnma(factor, O::load(pb + (k * m + j) * stride), O::load(element)));
+            }
+        }
+    }
+    if (sign != nullptr) {
+        O::store(sign + lane, parity);
+    }
+} /* void _batchEliminate(...) */
+
+/**
+ * Solves U x = b in place for one vector of problems, with U the upper triangle of a
+ * @tparam O Vector operations
+ */
+
+template <class O, class T>
+void _batchBackSubstitute(const T* a, T* b, index_t n, index_t m, index_t stride, index_t lane) {
+    using vec = typename O::vec;
+    const T* const pa = a + lane;
+    T* const pb = b + lane;
+    index_t i,j,c;
+    for (i = n - 1; i >= 0; --i) {
+        const vec diagonal = O::load(pa + (i * n + i) * stride);
+        for (j = 0; j < m; ++j) {
+            vec x = O::load(pb + (i * m + j) * stride);
+            for (c = i + 1; c < n; ++c) {
+                x = O::fnma(O::load(pa + (i * n + c) * stride), O::load(pb + (c * m + j) * stride), x);
+            }
+            O::store(pb + (i * m + j) * stride, O::div(x, diagonal));
+        }
+    }
+} /* void _batchBackSubstitute(...) */
+
+/**
+ * Solves L x = b in place for one vector of problems, with L the unit lower triangle of a
+ * @tparam O Vector operations
+ */
+
+template <class O, class T>
+void _batchForwardSubstitute(const T* a, T* b, index_t n, index_t m, index_t stride, index_t lane) {
+    using vec = typename O::vec;
+    const T* const pa = a + lane;
+    T* const pb = b + lane;
+    index_t i,j,c;
+    for (i = 1; i < n; ++i) {
+        for (j = 0; j < m; ++j) {
+            vec x = O::load(pb + (i * m + j) * stride);
+            for (c = 0; c < i; ++c) {
+                x = O::fnma(O::load(pa + (i * n + c) * stride), O::load(pb + (c * m + j) * stride), x);
+            }
+            O::store(pb + (i * m + j) * stride, x);
+        }
+    }
+} /* void _batchForwardSubstitute(...) */
+
+/**
+ * Returns the distance between the element arrays of a batch of count matrices: count rounded up
+ * to an odd number of cache lines. A power of two distance would put every array of a problem in
+ * the same cache set and evict them from each other
+ * @param count Number of matrices
+ */
+
+template <class T>
+index_t _batchStride(index_t count) {
+    const index_t line = 64 / static_cast<index_t>(sizeof(T));
+    if ((count <= 1) || (64 % sizeof(T) != 0)) {
+        return count;
+    }
+    index_t lines = (count + line - 1) / line;
+    if ((lines % 2) == 0) {
+        ++lines;
+    }
+    return lines * line;
+} /* index_t _batchStride(index_t count) */
+
+template <class T>
+class MatBatchLU;
+
+/**
+ * Batch of independent matrices of the same size, stored interleaved with the batch innermost:
+ * element (row, col) of every matrix is one contiguous array, so the batch operations process one
+ * SIMD vector of problems per instruction and split the batch across threads when it is large.
+ * Intended for thousands of small (3x3 to 12x12) problems, where looping over Mat would pay for an
+ * allocation and scalar code per problem
+ * @tparam T Element type
+ */
+
+template <class T>
+class MatBatch {
+private:
+    /* Below are private members of the MatBatch class */
+    T* _data = nullptr;     // One array per (row, col) in row-major order, _stride elements apart
+    index_t _count = 0;     // Number of matrices
+    index_t _stride = 0;    // Distance between the arrays of consecutive elements
+    index_t _rows = 0;      // Rows of each matrix
+    index_t _cols = 0;      // Columns of each matrix
+
+    /**
+     * Allocates storage for count rows x cols matrices. Contents are left uninitialized
+     */
+
+    void _allocate(index_t count, index_t rows, index_t cols) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((count < 0) || (rows < 0) || (cols < 0)) {
+            throw ORCAExcept::BadDimensionsError(); // Attempting to allocate a negative size
+        }
+#endif
+        this->_count = count;
+        this->_stride = _batchStride<T>(count);
+        this->_rows = rows;
+        this->_cols = cols;
+        if (count * rows * cols > 0) {
+            this->_data = static_cast<T*>(_allocateStorage(sizeof(T) * static_cast<std::size_t>(this->_stride * rows * cols)));
+        }
+    } /* void _allocate(index_t count, index_t rows, index_t cols) */
+
+    /**
+     * Frees the storage of the batch
+     */
+
+    void _release() {
+        if (this->_data != nullptr) {
+            _freeStorage(this->_data);
+        }
+        this->_data = nullptr;
+        this->_count = 0;
+        this->_stride = 0;
+        this->_rows = 0;
+        this->_cols = 0;
+    } /* void _release() */
+
+    /**
+     * Copies the elements of _other, which has the same size
+     */
+
+    void _copy(const MatBatch& _other) {
+        index_t i;
+        for (i = 0; i < this->_stride * this->_rows * this->_cols; ++i) {
+            this->_data[i] = _other._data[i];
+        }
+    } /* void _copy(const MatBatch& _other) */
+
+    /**
+     * Checks that index names a matrix and (row, col) an element of it
+     */
+
+    void _checkElement(index_t index, index_t row, index_t col) const {
+        _checkIndex<checks::Default>(index, this->_count);
+        _checkIndex<checks::Default>(row, col, this->_rows, this->_cols);
+    } /* void _checkElement(index_t index, index_t row, index_t col) const */
+
+public:
+
+    /* Below are public constructors for the MatBatch class */
+
+    /**
+     * Default constructor. The batch is empty
+     */
+
+    MatBatch() {}
+
+    /**
+     * Constructs a batch of count rows x cols matrices with every element set to zero
+     * @param count Number of matrices
+     * @param rows Rows of each matrix
+     * @param cols Columns of each matrix
+     */
+
+    MatBatch(index_t count, index_t rows, index_t cols) {
+        this->_allocate(count, rows, cols);
+        index_t i;
+        for (i = 0; i < this->_stride * rows * cols; ++i) {
+            this->_data[i] = T(0);
+        }
+    } /* MatBatch(index_t count, index_t rows, index_t cols) */
+
+    /**
+     * Constructs a batch of count copies of a matrix
+     * @param count Number of matrices
+     * @param value Matrix to copy
+     */
+
+    MatBatch(index_t count, const Mat<T>& value) {
+        this->_allocate(count, value.rows(), value.cols());
+        index_t i,r,c;
+        for (r = 0; r < this->_rows; ++r) {
+            for (c = 0; c < this->_cols; ++c) {
+                const T elem = value.at(r, c);
+                T* element = this->data(r, c);
+                for (i = 0; i < count; ++i) {
+                    element[i] = elem;
+                }
+            }
+        }
+    } /* MatBatch(index_t count, const Mat<T>& value) */
+
+    /**
+     * Copy constructor. Performs a deep copy of _other
+     * @param _other Batch to copy
+     */
+
+    MatBatch(const MatBatch& _other) {
+        this->_allocate(_other._count, _other._rows, _other._cols);
+        this->_copy(_other);
+    } /* MatBatch(const MatBatch& _other) */
+
+    /**
+     * Move constructor. Takes the storage of _other and leaves it empty
+     * @param _other Batch to move from
+     */
+
+    MatBatch(MatBatch&& _other) noexcept {
+        std::swap(this->_data, _other._data);
+        std::swap(this->_count, _other._count);
+        std::swap(this->_stride, _other._stride);
+        std::swap(this->_rows, _other._rows);
+        std::swap(this->_cols, _other._cols);
+    } /* MatBatch(MatBatch&& _other) */
+
+    ~MatBatch() {
+        this->_release();
+    } /* ~MatBatch() */
+
+    /* Below are public operators for the MatBatch class */
+
+    /**
+     * Copy assignment operator. Storage is reused when both batches have the same size
+     * @param _other Batch to copy
+     */
+
+    MatBatch& operator = (const MatBatch& _other) {
+        if (this == &_other) {
+            return *this;
+        }
+        if ((this->_count != _other._count) || (this->_rows * this->_cols != _other._rows * _other._cols)) {
+            arena::_HeapOnly heapOnly(!_isArenaStorage(this->_data)); // Storage on the heap stays there
+            this->_release();
+            this->_allocate(_other._count, _other._rows, _other._cols);
+        }
+        this->_rows = _other._rows;
+        this->_cols = _other._cols;
+        this->_copy(_other);
+        return *this;
+    } /* MatBatch& operator = (const MatBatch& _other) */
+
+    /**
+     * Move assignment operator. Takes the storage of _other. A batch on the heap, or without
+     * storage, copies arena storage instead of taking it, so that it keeps its contents after
+     * the arena scope ends
+     * @param _other Batch to move from
+     */
+
+    MatBatch& operator = (MatBatch&& _other) {
+        if (!_isArenaStorage(this->_data) && _isArenaStorage(_other._data)) {
+            return (*this = static_cast<const MatBatch&>(_other));
+        }
+        std::swap(this->_data, _other._data);
+        std::swap(this->_count, _other._count);
+        std::swap(this->_stride, _other._stride);
+        std::swap(this->_rows, _other._rows);
+        std::swap(this->_cols, _other._cols);
+        return *this;
+    } /* MatBatch& operator = (MatBatch&& _other) */
+
+    /* Below are public getters and setters for the MatBatch class */
+
+    /**
+     * Returns the number of matrices in the batch
+     */
+
+    index_t count() const {
+        return this->_count;
+    } /* index_t count() const */
+
+    /**
+     * Returns the number of rows of each matrix
+     */
+
+    index_t rows() const {
+        return this->_rows;
+    } /* index_t rows() const */
+
+    /**
+     * Returns the number of columns of each matrix
+     */
+
+    index_t cols() const {
+        return this->_cols;
+    } /* index_t cols() const */
+
+    /**
+     * Returns the distance between the arrays of consecutive elements. It is count() rounded up
+     * to whole cache lines, and to an odd number of them so the arrays do not share cache sets
+     */
+
+    index_t stride() const {
+        return this->_stride;
+    } /* index_t stride() const */
+
+    /**
+     * Returns the storage of the batch. Element (row, col) of matrix index is at
+     * data()[(row * cols() + col) * stride() + index]
+     */
+
+    T* data() {
+        return this->_data;
+    } /* T* data() */
+
+    const T* data() const {
+        return this->_data;
+    } /* const T* data() const */
+
+    /**
+     * Returns the array holding element (row, col) of every matrix
+     * @param row row of element
+     * @param col column of element
+     */
+
+    T* data(index_t row, index_t col) {
+        _checkIndex<checks::Default>(row, col, this->_rows, this->_cols);
+        return this->_data + (row * this->_cols + col) * this->_stride;
+    } /* T* data(index_t row, index_t col) */
+
+    const T* data(index_t row, index_t col) const {
+        _checkIndex<checks::Default>(row, col, this->_rows, this->_cols);
+        return this->_data + (row * this->_cols + col) * this->_stride;
+    } /* const T* data(index_t row, index_t col) const */
+
+    /**
+     * Returns an element of one matrix
+     * @param index Matrix
+     * @param row row of element
+     * @param col column of element
+     */
+
+    T at(index_t index, index_t row, index_t col) const {
+        this->_checkElement(index, row, col);
+        return this->_data[(row * this->_cols + col) * this->_stride + index];
+    } /* T at(index_t index, index_t row, index_t col) const */
+
+    /**
+     * Sets an element of one matrix
+     * @param index Matrix
+     * @param row row of element
+     * @param col column of element
+     * @param elem Element to set
+     */
+
+    void set(index_t index, index_t row, index_t col, T elem) {
+        this->_checkElement(index, row, col);
+        this->_data[(row * this->_cols + col) * this->_stride + index] = elem;
+    } /* void set(index_t index, index_t row, index_t col, T elem) */
+
+    /**
+     * Returns a copy of one matrix
+     * @param index Matrix
+     */
+
+    Mat<T> mat(index_t index) const {
+        _checkIndex<checks::Default>(index, this->_count);
+        Mat<T> result(this->_rows, this->_cols);
+        index_t r,c;
+        for (r = 0; r < this->_rows; ++r) {
+            for (c = 0; c < this->_cols; ++c) {
+                result.unchecked_set(r, c, this->_data[(r * this->_cols + c) * this->_stride + index]);
+            }
+        }
+        return result;
+    } /* Mat<T> mat(index_t index) const */
+
+    /**
+     * Replaces one matrix.
+     * An ORCA_BAD_DIMENSIONS exception is thrown should the matrix have a different size
+     * @param index Matrix
+     * @param value New matrix
+     */
+
+    void setMat(index_t index, const Mat<T>& value) {
+        _checkIndex<checks::Default>(index, this->_count);
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((value.rows() != this->_rows) || (value.cols() != this->_cols)) {
+            throw ORCAExcept::BadDimensionsError(); // Matrix does not match the batch
+        }
+#endif
+        index_t r,c;
+        for (r = 0; r < this->_rows; ++r) {
+            for (c = 0; c < this->_cols; ++c) {
+                this->_data[(r * this->_cols + c) * this->_stride + index] = value.unchecked_at(r, c);
+            }
+        }
+    } /* void setMat(index_t index, const Mat<T>& value) */
+
+    /* Below are public member functions of the MatBatch class */
+
+    /**
+     * Returns the LU factorization of every matrix
+     */
+
+    MatBatchLU<T> lu() const;
+
+    /**
+     * Returns the determinant of every matrix
+     */
+
+    ColVec<T> det() const;
+
+    /**
+     * Returns the inverse of every matrix.
+     * An ORCA_SINGULAR_MATRIX exception is thrown should any matrix be singular
+     */
+
+    MatBatch<T> inv() const;
+
+    /**
+     * Solves A x = b for every matrix A of the batch and the matching right hand sides.
+     * An ORCA_SINGULAR_MATRIX exception is thrown should any matrix be singular
+     * @param b Right hand sides, one matrix per problem
+     */
+
+    MatBatch<T> solve(const MatBatch<T>& b) const;
+
+}; /* class MatBatch */
+
+/**
+ * Throws unless every diagonal element of every matrix in the batch is nonzero
+ * @param u Batch of upper triangular factors
+ */
+
+template <class T>
+void _checkBatchPivots(const MatBatch<T>& u) {
+    index_t i,k;
+    for (k = 0; k < u.rows(); ++k) {
+        const T* diagonal = u.data(k, k);
+        for (i = 0; i < u.count(); ++i) {
+            if (diagonal[i] == T(0)) {
+                throw ORCAExcept::SingularMatrixError(); // No unique solution
+            }
+        }
+    }
+} /* void _checkBatchPivots(const MatBatch<T>& u) */
+
+/**
+ * Checks that a batch holds square matrices, and that a second batch, if given, matches it
+ */
+
+template <class T>
+void _checkBatchSystem(const MatBatch<T>& a, const MatBatch<T>* b) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (a.rows() != a.cols()) {
+        throw ORCAExcept::BadDimensionsError(); // Matrices must be square
+    }
+    if ((b != nullptr) && ((b->count() != a.count()) || (b->rows() != a.rows()))) {
+        throw ORCAExcept::BadDimensionsError(); // Right hand sides do not match the matrices
+    }
+#endif
+#ifndef ORCA_DISABLE_EMPTY_CHECKS
+    if (a.rows() == 0) {
+        throw ORCAExcept::EmptyElementError(); // Attempting to factor empty matrices
+    }
+#endif
+} /* void _checkBatchSystem(const MatBatch<T>& a, const MatBatch<T>* b) */
+
+/**
+ * LU factorizations with partial pivoting of a batch of square matrices, P A = L U per problem.
+ * Singular matrices are factored as far as possible; det() then returns 0 for them and
+ * solve() and inv() throw SingularMatrixError
+ * @tparam T Element type
+ */
+
+template <class T>
+class MatBatchLU {
+private:
+
+    /* Below are private members of the MatBatchLU class */
+
+    MatBatch<T> _lu;        // Unit lower triangle below the diagonal, upper triangle on and above
+    MatBatch<T> _perm;      // Original row of each factored row, stored as an n x 1 batch
+    ColVec<T> _sign;        // Sign of each row permutation
+
+public:
+
+    /* Below are public constructors for the MatBatchLU class */
+
+    /**
+     * Factors every matrix of a batch
+     * @param matrices Square matrices to factor
+     */
+
+    explicit MatBatchLU(const MatBatch<T>& matrices) : _lu(matrices), _perm(matrices.count(), matrices.rows(), 1), _sign(static_cast<int>(matrices.count())) {
+        _checkBatchSystem<T>(matrices, nullptr);
+        const index_t n = matrices.rows();
+        const index_t count = matrices.count();
+        index_t i,k;
+        for (k = 0; k < n; ++k) {
+            T* row = this->_perm.data(k, 0);
+            for (i = 0; i < count; ++i) {
+                row[i] = T(k);
+            }
+        }
+        const index_t stride = this->_lu.stride();
+        T* a = this->_lu.data();
+        T* perm = this->_perm.data();
+        T* sign = this->_sign.data();
+        _batchLoop<T>(count, n * n * n, [&](auto ops, index_t lane) {
+            using O = decltype(ops);
+            _batchEliminate<O>(a, a, perm, sign, n, 0, stride, lane);
+        });
+    } /* explicit MatBatchLU(const MatBatch<T>& matrices) */
+
+    /* Below are public getters for the MatBatchLU class */
+
+    /**
+     * Returns the number of factored matrices
+     */
+
+    index_t count() const {
+        return this->_lu.count();
+    } /* index_t count() const */
+
+    /**
+     * Returns the dimension of the factored matrices
+     */
+
+    index_t size() const {
+        return this->_lu.rows();
+    } /* index_t size() const */
+
+    /**
+     * Returns the factors of every matrix, L below the diagonal with its unit diagonal implied and U on and above
+     */
+
+    const MatBatch<T>& factors() const {
+        return this->_lu;
+    } /* const MatBatch<T>& factors() const */
+
+    /**
+     * Returns true if any matrix of the batch is singular
+     */
+
+    bool isSingular() const {
+        index_t i,k;
+        for (k = 0; k < this->size(); ++k) {
+            const T* diagonal = this->_lu.data(k, k);
+            for (i = 0; i < this->count(); ++i) {
+                if (diagonal[i] == T(0)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    } /* bool isSingular() const */
+
+    /* Below are public member functions of the MatBatchLU class */
+
+    /**
+     * Returns the determinant of every factored matrix
+     */
+
+    ColVec<T> det() const {
+        const index_t n = this->size();
+        const index_t count = this->count();
+        const index_t stride = this->_lu.stride();
+        ColVec<T> result(this->_sign);
+        const T* a = this->_lu.data();
+        T* out = result.data();
+        _batchLoop<T>(count, n, [&](auto ops, index_t lane) {
+            using O = decltype(ops);
+            typename O::vec product = O::load(out + lane);
+            index_t k;
+            for (k = 0; k < n; ++k) {
+                product = O::mul(product, O::load(a + (k * n + k) * stride + lane));
+            }
+            O::store(out + lane, product);
+        });
+        return result;
+    } /* ColVec<T> det() const */
+
+    /**
+     * Solves A x = b for every factored matrix A and the matching right hand sides
+     * @param b Right hand sides, one matrix per problem
+     * @return x
+     */
+
+    MatBatch<T> solve(const MatBatch<T>& b) const {
+        _checkBatchSystem<T>(this->_lu, &b);
+        _checkBatchPivots(this->_lu);
+        const index_t n = this->size();
+        const index_t m = b.cols();
+        const index_t count = this->count();
+        MatBatch<T> x(count, n, m);
+        index_t i,r,c;
+        for (r = 0; r < n; ++r) {
+            const T* source = this->_perm.data(r, 0);
+            for (c = 0; c < m; ++c) {
+                T* row = x.data(r, c);
+                for (i = 0; i < count; ++i) {
+                    row[i] = b.data()[(static_cast<index_t>(source[i]) * m + c) * b.stride() + i];
+                }
+            }
+        }
+        const index_t stride = x.stride();
+        const T* a = this->_lu.data();
+        T* out = x.data();
+        _batchLoop<T>(count, n * n * m, [&](auto ops, index_t lane) {
+            using O = decltype(ops);
+            _batchForwardSubstitute<O>(a, out, n, m, stride, lane);
+            _batchBackSubstitute<O>(a, out, n, m, stride, lane);
+        });
+        return x;
+    } /* MatBatch<T> solve(const MatBatch<T>& b) const */
+
+    /**
+     * Returns the inverse of every factored matrix
+     */
+
+    MatBatch<T> inv() const {
+        return this->solve(MatBatch<T>(this->count(), Mat<T>(this->size(), this->size(), fill::eye)));
+    } /* MatBatch<T> inv() const */
+
+}; /* class MatBatchLU */
+
+template <class T>
+MatBatchLU<T> MatBatch<T>::lu() const {
+    return MatBatchLU<T>(*this);
+} /* MatBatchLU<T> MatBatch<T>::lu() const */
+
+template <class T>
+ColVec<T> MatBatch<T>::det() const {
+    _checkBatchSystem<T>(*this, nullptr);
+    const index_t n = this->_rows;
+    const index_t count = this->_count;
+    const index_t stride = this->_stride;
+    MatBatch<T> work(*this);
+    ColVec<T> result(static_cast<int>(count));
+    T* a = work.data();
+    T* out = result.data();
+    _batchLoop<T>(count, n * n * n, [&](auto ops, index_t lane) {
+        using O = decltype(ops);
+        _batchEliminate<O>(a, a, static_cast<T*>(nullptr), out, n, 0, stride, lane);
+        typename O::vec product = O::load(out + lane);
+        index_t k;
+        for (k = 0; k < n; ++k) {
+            product = O::mul(product, O::load(a + (k * n + k) * stride + lane));
+        }
+        O::store(out + lane, product);
+    });
+    return result;
+} /* ColVec<T> MatBatch<T>::det() const */
+
+/**
+ * Solves work x = x in place for every problem, eliminating and substituting each vector of
+ * problems in one pass while it is in cache. Both batches must hold the same number of matrices.
+ * An ORCA_SINGULAR_MATRIX exception is thrown should any matrix be singular
+ * @param work Square matrices, overwritten by their elimination
+ * @param x Right hand sides, overwritten by the solutions
+ */
+
+template <class T>
+void _batchSolveInPlace(MatBatch<T>& work, MatBatch<T>& x) {
+    const index_t n = work.rows();
+    const index_t m = x.cols();
+    const index_t stride = work.stride();
+    T* a = work.data();
+    T* out = x.data();
+    _batchLoop<T>(work.count(), n * n * (n + m), [&](auto ops, index_t lane) {
+        using O = decltype(ops);
+        _batchEliminate<O>(a, out, static_cast<T*>(nullptr), static_cast<T*>(nullptr), n, m, stride, lane);
+        _batchBackSubstitute<O>(a, out, n, m, stride, lane);
+    });
+    _checkBatchPivots(work);
+} /* void _batchSolveInPlace(MatBatch<T>& work, MatBatch<T>& x) */
+
+template <class T>
+MatBatch<T> MatBatch<T>::solve(const MatBatch<T>& b) const {
+    _checkBatchSystem<T>(*this, &b);
+    MatBatch<T> work(*this);
+    MatBatch<T> x(b);
+    _batchSolveInPlace(work, x);
+    return x;
+} /* MatBatch<T> MatBatch<T>::solve(const MatBatch<T>& b) const */
+
+template <class T>
+MatBatch<T> MatBatch<T>::inv() const {
+    _checkBatchSystem<T>(*this, nullptr);
+    MatBatch<T> work(*this);
+    MatBatch<T> x(this->_count, this->_rows, this->_rows);
+    index_t i,k;
+    for (k = 0; k < this->_rows; ++k) {
+        T* diagonal = x.data(k, k);
+        for (i = 0; i < this->_count; ++i) {
+            diagonal[i] = T(1);
+        }
+    }
+    _batchSolveInPlace(work, x);
+    return x;
+} /* MatBatch<T> MatBatch<T>::inv() const */
+
+/* Below are nonmember functions for the MatBatch class */
+
+/**
+ * Overloaded * operator for 2 batches, multiplying matching matrices
+ * An ORCA_BAD_DIMENSIONS exception is thrown should the batches or matrices not match
+ * @param b1 left batch
+ * @param b2 right batch
+ */
+
+template <class T>
+MatBatch<T> operator * (const MatBatch<T>& b1, const MatBatch<T>& b2) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if ((b1.count() != b2.count()) || (b1.cols() != b2.rows())) {
+        throw ORCAExcept::BadDimensionsError(); // Batches being multiplied had incompatible dimensions
+    }
+#endif
+    const index_t rows = b1.rows();
+    const index_t inner = b1.cols();
+    const index_t cols = b2.cols();
+    const index_t count = b1.count();
+    MatBatch<T> result(count, rows, cols);
+    const index_t stride = result.stride();
+    const T* a = b1.data();
+    const T* b = b2.data();
+    T* c = result.data();
+    _batchLoop<T>(count, rows * inner * cols, [&](auto ops, index_t lane) {
+        using O = decltype(ops);
+        index_t i,j,k;
+        for (i = 0; i < rows; ++i) {
+            for (j = 0; j < cols; ++j) {
+                typename O::vec sum = O::zero();
+                for (k = 0; k < inner; ++k) {
+                    sum = O::fma(O::load(a + (i * inner + k) * stride + lane), O::load(b + (k * cols + j) * stride + lane), sum);
+                }
+                O::store(c + (i * cols + j) * stride + lane, sum);
+            }
+        }
+    });
+    return result;
+} /* MatBatch<T> operator * (const MatBatch<T>& b1, const MatBatch<T>& b2) */
+
+/**
+ * Returns the determinant of every matrix of a batch
+ */
+
+template <class T>
+ColVec<T> det(const MatBatch<T>& _b1) {
+    return _b1.det();
+} /* ColVec<T> det(const MatBatch<T>& _b1) */
+
+/**
+ * Returns the inverse of every matrix of a batch
+ */
+
+template <class T>
+MatBatch<T> inv(const MatBatch<T>& _b1) {
+    return _b1.inv();
+} /* MatBatch<T> inv(const MatBatch<T>& _b1) */
+
+/**
+ * Returns the LU factorization of every matrix of a batch
+ */
+
+template <class T>
+MatBatchLU<T> lu(const MatBatch<T>& _b1) {
+    return _b1.lu();
+} /* MatBatchLU<T> lu(const MatBatch<T>& _b1) */
+
+/**
+ * Solves A x = b for every matrix of a and the matching right hand sides of b
+ */
+
+template <class T>
+MatBatch<T> solve(const MatBatch<T>& a, const MatBatch<T>& b) {
+    return a.solve(b);
+} /* MatBatch<T> solve(const MatBatch<T>& a, const MatBatch<T>& b) */
+
+} /* namespace ORCA */
+
+#endif /* MatBatch_h */
@@ -0,0 +1,830 @@
+//
+//  MatExpr.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef MatExpr_h
+#define MatExpr_h
+
+/* Includes for MatExpr.h */
+
+#include "Except.h" // Included for ORCA Exceptions
+#include "Mat.h"    // Included for Mat class
+#include "Parallel.h"   // Included for splitting evaluation across threads
+#include "Vec.h"    // Included for ColVec class
+#include <type_traits>  // Included for std::enable_if
+#include <utility>      // Included for std::forward
+
+namespace ORCA {
+
+/* Element-wise arithmetic on runtime sized matrices is lazy.
+ * The +, - and scalar * operators return small expression objects instead of matrices.
+ * Assigning an expression to a Mat (or constructing a Mat from one) evaluates the whole
+ * chain in a single loop directly into the destination, so A + B - C builds no temporaries.
+ * Matrix products are not element-wise and are evaluated eagerly into a Mat, which then
+ * becomes a leaf of the surrounding expression.
+ *
+ * Named matrices, transposes and submatrices are held by reference and never copied.
+ * Temporaries are moved into the expression so that it never refers to a destroyed matrix */
+
+/**
+ * Base class of all matrix expressions
+ * @tparam E Concrete expression class
+ */
+
+template <class E>
+class MatExpr {
+public:
+
+    /* Below are public getters for the MatExpr class */
+
+    /**
+     * Returns the concrete expression
+     */
+
+    const E& self() const {
+        return static_cast<const E&>(*this);
+    } /* const E& self() const */
+
+    /**
+     * Returns the number of rows of the result
+     */
+
+    index_t rows() const {
+        return this->self().rows();
+    } /* index_t rows() const */
+
+    /**
+     * Returns the number of columns of the result
+     */
+
+    index_t cols() const {
+        return this->self().cols();
+    } /* index_t cols() const */
+
+    /**
+     * Evaluates a single element of the result
+     * @param row Element Row Index
+     * @param col Element Column Index
+     */
+
+    auto at(index_t row, index_t col) const {
+        return this->self().at(row, col);
+    } /* auto at(index_t row, index_t col) const */
+
+    /**
+     * Returns true if writing the result into destination while the expression is being
+     * evaluated could change elements that have not been read yet
+     * @param destination Matrix the result will be written into
+     */
+
+    template <class T>
+    bool aliases(const Mat<T>& destination) const {
+        return this->self()._aliases(destination);
+    } /* bool aliases(const Mat<T>& destination) const */
+
+    /**
+     * Evaluates the expression into a new matrix
+     */
+
+    auto eval() const {
+        return Mat<typename E::value_type>(*this);
+    } /* auto eval() const */
+
+    /**
+     * Writes the result into dense row-major storage.
+     * When every leaf is dense the loop reads the leaves directly through their storage,
+     * otherwise it goes through at()
+     * @param destination First element of the destination
+     * @param stride Number of elements between the starts of consecutive rows of destination
+     */
+
+    template <class T>
+    void _evalInto(T* destination, index_t stride) const {
+        const E& expr = this->self();
+        const index_t cols = expr.cols();
+        const bool dense = expr._isDense();
+        
+        /* Large expressions are evaluated in independent bands of rows */
+        
+        _parallelFor(0, expr.rows(), expr.rows() * cols, [&](index_t first, index_t last) {
+            index_t i,j;
+            if (dense) {
+                for (i = first; i < last; ++i) {
+                    T* row = destination + i * stride;
+                    for (j = 0; j < cols; ++j) {
+                        row[j] = expr._denseAt(i, j);
+                    }
+                }
+                return;
+            }
+            for (i = first; i < last; ++i) {
+                T* row = destination + i * stride;
+                for (j = 0; j < cols; ++j) {
+                    row[j] = expr.at(i, j);
+                }
+            }
+        });
+    } /* void _evalInto(T* destination, index_t stride) const */
+
+}; /* class MatExpr */
+
+/* _isMatExpr<T> is true for every matrix expression */
+
+template <class E>
+std::true_type _matExprTest(const MatExpr<E>*);
+
+std::false_type _matExprTest(const void*);
+
+template <class T>
+constexpr bool _isMatExpr = decltype(_matExprTest(std::declval<std::decay_t<T>*>()))::value;
+
+/* _isDynamicOperand<T> selects the operands handled by the expression operators */
+
+template <class T>
+constexpr bool _isDynamicOperand = _isDynamicMatrix<T> || _isMatExpr<T>;
+
+/* _isScalarOperand<T> selects the scalar side of the scaling operators */
+
+template <class T>
+constexpr bool _isScalarOperand = !_isMatrix<T> && !_isMatExpr<T> && !_matrixLike<std::decay_t<T>>::value;
+
+/**
+ * Returns true if two dense matrices have elements at overlapping addresses.
+ * Views over external buffers can share storage without sharing storage()
+ * @param a First matrix
+ * @param b Second matrix
+ */
+
+template <class T1, class T2>
+bool _overlaps(const Mat<T1>& a, const Mat<T2>& b) {
+    if (!a.isDense() || !b.isDense()) {
+        return false;
+    }
+    const char* aFirst = reinterpret_cast<const char*>(a.data());
+    const char* aLast = reinterpret_cast<const char*>(a.data() + (a.rows() - 1) * a.stride() + a.cols());
+    const char* bFirst = reinterpret_cast<const char*>(b.data());
+    const char* bLast = reinterpret_cast<const char*>(b.data() + (b.rows() - 1) * b.stride() + b.cols());
+    return (aFirst < bLast) && (bFirst < aLast);
+} /* bool _overlaps(const Mat<T1>& a, const Mat<T2>& b) */
+
+/**
+ * Leaf of a matrix expression
+ * @tparam Stored const reference to a named matrix or view, or a matrix type held by value
+ */
+
+template <class Stored>
+class _MatLeaf : public MatExpr<_MatLeaf<Stored>> {
+private:
+    using M = std::decay_t<Stored>;
+    Stored _m;  // The matrix read by this leaf
+public:
+    using value_type = _matrixElement_t<M>;
+
+    /**
+     * Constructs the leaf
+     * @param m Matrix to read from
+     */
+
+    explicit _MatLeaf(Stored m) : _m(std::forward<Stored>(m)) {
+    } /* explicit _MatLeaf(Stored m) */
+
+    index_t rows() const {
+        return this->_m.rows();
+    } /* index_t rows() const */
+
+    index_t cols() const {
+        return this->_m.cols();
+    } /* index_t cols() const */
+
+    value_type at(index_t row, index_t col) const {
+        return this->_m.at(row, col);
+    } /* value_type at(index_t row, index_t col) const */
+
+    value_type _denseAt(index_t row, index_t col) const {
+        return this->_m.data()[row * this->_m.stride() + col];
+    } /* value_type _denseAt(index_t row, index_t col) const */
+
+    bool _isDense() const {
+        return this->_m.isDense();
+    } /* bool _isDense() const */
+
+    /* Reading the destination itself element by element is safe. Reading it through a
+     * view that visits elements in a different order is not */
+
+    template <class T>
+    bool _aliases(const Mat<T>& destination) const {
+        const bool sameLayout = this->_m.isDense() && (static_cast<const void*>(this->_m.data()) == static_cast<const void*>(destination.data())) && (this->_m.stride() == destination.stride());
+        if (sameLayout) {
+            return false;
+        }
+        if ((destination.storage() != nullptr) && (this->_m.storage() == destination.storage())) {
+            return true;
+        }
+        return _overlaps(this->_m, destination);
+    } /* bool _aliases(const Mat<T>& destination) const */
+
+}; /* class _MatLeaf */
+
+/**
+ * Element-wise binary expression
+ * @tparam Op Operation applied to each pair of elements
+ * @tparam L left operand expression
+ * @tparam R right operand expression
+ */
+
+template <class Op, class L, class R>
+class _MatBinaryExpr : public MatExpr<_MatBinaryExpr<Op, L, R>> {
+private:
+    L _l;   // Left operand
+    R _r;   // Right operand
+public:
+    using value_type = decltype(Op::apply(std::declval<typename L::value_type>(), std::declval<typename R::value_type>()));
+
+    _MatBinaryExpr(L l, R r) : _l(std::move(l)), _r(std::move(r)) {
+    } /* _MatBinaryExpr(L l, R r) */
+
+    index_t rows() const {
+        return this->_l.rows();
+    } /* index_t rows() const */
+
+    index_t cols() const {
+        return this->_l.cols();
+    } /* index_t cols() const */
+
+    value_type at(index_t row, index_t col) const {
+        return Op::apply(this->_l.at(row, col), this->_r.at(row, col));
+    } /* value_type at(index_t row, index_t col) const */
+
+    value_type _denseAt(index_t row, index_t col) const {
+        return Op::apply(this->_l._denseAt(row, col), this->_r._denseAt(row, col));
+    } /* value_type _denseAt(index_t row, index_t col) const */
+
+    bool _isDense() const {
+        return this->_l._isDense() && this->_r._isDense();
+    } /* bool _isDense() const */
+
+    template <class T>
+    bool _aliases(const Mat<T>& destination) const {
+        return this->_l._aliases(destination) || this->_r._aliases(destination);
+    } /* bool _aliases(const Mat<T>& destination) const */
+
+}; /* class _MatBinaryExpr */
+
+/**
+ * Element-wise negation
+ * @tparam E operand expression
+ */
+
+template <class E>
+class _MatNegateExpr : public MatExpr<_MatNegateExpr<E>> {
+private:
+    E _e;   // Operand
+public:
+    using value_type = decltype(-std::declval<typename E::value_type>());
+
+    explicit _MatNegateExpr(E e) : _e(std::move(e)) {
+    } /* explicit _MatNegateExpr(E e) */
+
+    index_t rows() const {
+        return this->_e.rows();
+    } /* index_t rows() const */
+
+    index_t cols() const {
+        return this->_e.cols();
+    } /* index_t cols() const */
+
+    value_type at(index_t row, index_t col) const {
+        return -this->_e.at(row, col);
+    } /* value_type at(index_t row, index_t col) const */
+
+    value_type _denseAt(index_t row, index_t col) const {
+        return -this->_e._denseAt(row, col);
+    } /* value_type _denseAt(index_t row, index_t col) const */
+
+    bool _isDense() const {
+        return this->_e._isDense();
+    } /* bool _isDense() const */
+
+    template <class T>
+    bool _aliases(const Mat<T>& destination) const {
+        return this->_e._aliases(destination);
+    } /* bool _aliases(const Mat<T>& destination) const */
+
+}; /* class _MatNegateExpr */
+
+/* _scaledElement_t<S, V, ScalarLeft> is the element type of a scaled expression */
+
+template <class S, class V, bool ScalarLeft>
+struct _scaledElement {
+    using type = decltype(std::declval<S>() * std::declval<V>());
+}; /* struct _scaledElement */
+
+template <class S, class V>
+struct _scaledElement<S, V, false> {
+    using type = decltype(std::declval<V>() * std::declval<S>());
+}; /* struct _scaledElement<S, V, false> */
+
+template <class S, class V, bool ScalarLeft>
+using _scaledElement_t = typename _scaledElement<S, V, ScalarLeft>::type;
+
+/**
+ * Multiplication of every element by a scalar. The operand order is kept for
+ * element types where multiplication does not commute
+ * @tparam E matrix operand expression
+ * @tparam S scalar class
+ * @tparam ScalarLeft true if the scalar is the left operand
+ */
+
+template <class E, class S, bool ScalarLeft>
+class _MatScaleExpr : public MatExpr<_MatScaleExpr<E, S, ScalarLeft>> {
+private:
+    E _e;   // Matrix operand
+    S _s;   // Scalar operand
+
+    template <class V>
+    auto _scale(const V& value) const {
+        if constexpr (ScalarLeft) {
+            return this->_s * value;
+        } else {
+            return value * this->_s;
+        }
+    } /* auto _scale(const V& value) const */
+
+public:
+    using value_type = _scaledElement_t<S, typename E::value_type, ScalarLeft>;
+
+    _MatScaleExpr(E e, S s) : _e(std::move(e)), _s(s) {
+    } /* _MatScaleExpr(E e, S s) */
+
+    index_t rows() const {
+        return this->_e.rows();
+    } /* index_t rows() const */
+
+    index_t cols() const {
+        return this->_e.cols();
+    } /* index_t cols() const */
+
+    value_type at(index_t row, index_t col) const {
+        return this->_scale(this->_e.at(row, col));
+    } /* value_type at(index_t row, index_t col) const */
+
+    value_type _denseAt(index_t row, index_t col) const {
+        return this->_scale(this->_e._denseAt(row, col));
+    } /* value_type _denseAt(index_t row, index_t col) const */
+
+    bool _isDense() const {
+        return this->_e._isDense();
+    } /* bool _isDense() const */
+
+    template <class T>
+    bool _aliases(const Mat<T>& destination) const {
+        return this->_e._aliases(destination);
+    } /* bool _aliases(const Mat<T>& destination) const */
+
+}; /* class _MatScaleExpr */
+
+/* Element-wise operations used by _MatBinaryExpr */
+
+struct _MatAddOp {
+    template <class T1, class T2>
+    static auto apply(const T1& t1, const T2& t2) {
+        return t1 + t2;
+    }
+}; /* struct _MatAddOp */
+
+struct _MatSubtractOp {
+    template <class T1, class T2>
+    static auto apply(const T1& t1, const T2& t2) {
+        return t1 - t2;
+    }
+}; /* struct _MatSubtractOp */
+
+/* _matOperand_t<M> is the type an operand is stored as inside an expression.
+ * Expressions are stored by value, named matrices by reference and temporaries by value */
+
+template <class M>
+using _matOperand_t = std::conditional_t<_isMatExpr<M>, std::decay_t<M>,
+                      std::conditional_t<std::is_lvalue_reference<M>::value, _MatLeaf<const std::decay_t<M>&>, _MatLeaf<std::decay_t<M>>>>;
+
+/**
+ * Wraps an operand for storage inside an expression
+ * @param m matrix or expression
+ */
+
+template <class M>
+_matOperand_t<M> _matOperand(M&& m) {
+    return _matOperand_t<M>(std::forward<M>(m));
+} /* _matOperand_t<M> _matOperand(M&& m) */
+
+/**
+ * Checks that two operands of an element-wise operation have the same dimensions
+ * @param m1 left operand
+ * @param m2 right operand
+ */
+
+template <class L, class R>
+void _checkSameDimensions(const L& m1, const R& m2) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if ((m1.rows() != m2.rows()) || (m1.cols() != m2.cols())) {
+        throw ORCAExcept::BadDimensionsError(); // Operands had incompatible dimensions
+    }
+#endif
+} /* void _checkSameDimensions(const L& m1, const R& m2) */
+
+/* Below are the overloaded operators that build matrix expressions */
+
+/**
+ * Overloaded addition operator for 2 matricies or matrix expressions
+ * @param m1 left operand
+ * @param m2 right operand
+ */
+
+template <class L, class R, class = std::enable_if_t<_isDynamicOperand<L> && _isDynamicOperand<R>>>
+auto operator + (L&& m1, R&& m2) {
+    _checkSameDimensions(m1, m2);
+    return _MatBinaryExpr<_MatAddOp, _matOperand_t<L>, _matOperand_t<R>>(_matOperand(std::forward<L>(m1)), _matOperand(std::forward<R>(m2)));
+} /* auto operator + (L&& m1, R&& m2) */
+
+/**
+ * Overloaded subtraction operator for 2 matricies or matrix expressions
+ * @param m1 left operand
+ * @param m2 right operand
+ */
+
+template <class L, class R, class = std::enable_if_t<_isDynamicOperand<L> && _isDynamicOperand<R>>>
+auto operator - (L&& m1, R&& m2) {
+    _checkSameDimensions(m1, m2);
+    return _MatBinaryExpr<_MatSubtractOp, _matOperand_t<L>, _matOperand_t<R>>(_matOperand(std::forward<L>(m1)), _matOperand(std::forward<R>(m2)));
+} /* auto operator - (L&& m1, R&& m2) */
+
+/**
+ * Overloaded unary operator for a matrix or matrix expression
+ * @param m1 operand
+ */
+
+template <class E, class = std::enable_if_t<_isDynamicOperand<E>>>
+auto operator - (E&& m1) {
+    return _MatNegateExpr<_matOperand_t<E>>(_matOperand(std::forward<E>(m1)));
+} /* auto operator - (E&& m1) */
+
+/**
+ * Overloaded * operator for a matrix or matrix expression and a scalar
+ * @param m1 left operand
+ * @param t2 right value
+ */
+
+template <class E, class T2, class = std::enable_if_t<_isDynamicOperand<E> && _isScalarOperand<T2>>>
+auto operator * (E&& m1, T2 t2) {
+    return _MatScaleExpr<_matOperand_t<E>, T2, false>(_matOperand(std::forward<E>(m1)), t2);
+} /* auto operator * (E&& m1, T2 t2) */
+
+/**
+ * Overloaded * operator for a scalar and a matrix or matrix expression
+ * @param t1 left value
+ * @param m2 right operand
+ */
+
+template <class T1, class E, class = std::enable_if_t<_isScalarOperand<T1> && _isDynamicOperand<E>>>
+auto operator * (T1 t1, E&& m2) {
+    return _MatScaleExpr<_matOperand_t<E>, T1, true>(_matOperand(std::forward<E>(m2)), t1);
+} /* auto operator * (T1 t1, E&& m2) */
+
+/**
+ * Overloaded * operator where at least one side is a matrix expression.
+ * The expression operands are evaluated and the product is computed by the matrix kernel
+ * @param m1 left operand
+ * @param m2 right operand
+ */
+
+template <class L, class R, class = std::enable_if_t<_isDynamicOperand<L> && _isDynamicOperand<R> && (_isMatExpr<L> || _isMatExpr<R>)>>
+auto operator * (const L& m1, const R& m2) {
+    if constexpr (_isMatExpr<L> && _isMatExpr<R>) {
+        return m1.eval() * m2.eval();
+    } else if constexpr (_isMatExpr<L>) {
+        return m1.eval() * m2;
+    } else {
+        return m1 * m2.eval();
+    }
+} /* auto operator * (const L& m1, const R& m2) */
+
+/**
+ * Overloaded == operator where at least one side is a matrix expression
+ * @param m1 left operand
+ * @param m2 right operand
+ */
+
+template <class L, class R, class = std::enable_if_t<_isDynamicOperand<L> && _isDynamicOperand<R> && (_isMatExpr<L> || _isMatExpr<R>)>>
+bool operator == (const L& m1, const R& m2) {
+    if ((m1.rows() != m2.rows()) || (m1.cols() != m2.cols())) {
+        return false;
+    }
+    index_t i,j;
+    for (i = 0; i < m1.rows(); ++i) {
+        for (j = 0; j < m1.cols(); ++j) {
+            if (m1.at(i, j) != m2.at(i, j)) {
+                return false;
+            }
+        }
+    }
+    return true;
+} /* bool operator == (const L& m1, const R& m2) */
+
+/**
+ * Overloaded << operator for matrix expressions
+ * @param os output stream
+ * @param expr expression to evaluate and print
+ */
+
+template <class E>
+std::ostream& operator<<(std::ostream& os, const MatExpr<E>& expr) {
+    return (os << expr.eval());
+} /* std::ostream& operator<<(std::ostream& os, const MatExpr<E>& expr) */
+
+/* Below are the in-place operators of the Mat class, defined here since they need the expression classes */
+
+template <class T>
+template <class R, class Op>
+void Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>::_updateElements(R read, Op op) {
+    index_t i,j;
+    if (this->_owner) {
+        for (i = 0; i < this->_n_rows; ++i) {
+            T* row = this->_mat + i * this->_ld;
+            for (j = 0; j < this->_n_cols; ++j) {
+                op(row[j], read(i, j));
+            }
+        }
+        this->_touch();
+        return;
+    }
+    for (i = 0; i < this->_n_rows; ++i) {
+        for (j = 0; j < this->_n_cols; ++j) {
+            T elem = this->at(i, j);
+            op(elem, read(i, j));
+            this->set(i, j, elem);
+        }
+    }
+} /* void Mat<T>::_updateElements(R read, Op op) */
+
+template <class T>
+template <class T1, class Op>
+void Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>::_combine(const Mat<T1>& _other, Op op) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if ((_other.rows() != this->_n_rows) || (_other.cols() != this->_n_cols)) {
+        throw ORCAExcept::BadDimensionsError(); // Operands must have the same dimensions
+    }
+#endif
+    const bool shared = ((this->storage() != nullptr) && (_other.storage() == this->storage())) || _overlaps(_other, *this);
+    if (shared && (static_cast<const void*>(&_other) != static_cast<const void*>(this))) {
+        this->_combine(Mat<T1>(_other), op); // Source is a view of this matrix
+        return;
+    }
+    if (_other.isDense()) {
+        const T1* source = _other.data();
+        const index_t stride = _other.stride();
+        this->_updateElements([&](index_t row, index_t col) { return source[row * stride + col]; }, op);
+        return;
+    }
+    this->_updateElements([&](index_t row, index_t col) { return _other.at(row, col); }, op);
+} /* void Mat<T>::_combine(const Mat<T1>& _other, Op op) */
+
+template <class T>
+template <class E, class Op>
+void Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>::_combine(const MatExpr<E>& _expr, Op op) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if ((_expr.rows() != this->_n_rows) || (_expr.cols() != this->_n_cols)) {
+        throw ORCAExcept::BadDimensionsError(); // Operands must have the same dimensions
+    }
+#endif
+    if (!this->_owner || _expr.aliases(*this)) {
+        this->_combine(Mat<typename E::value_type>(_expr), op);
+        return;
+    }
+    const E& expr = _expr.self();
+    if (expr._isDense()) {
+        this->_updateElements([&](index_t row, index_t col) { return expr._denseAt(row, col); }, op);
+        return;
+    }
+    this->_updateElements([&](index_t row, index_t col) { return expr.at(row, col); }, op);
+} /* void Mat<T>::_combine(const MatExpr<E>& _expr, Op op) */
+
+template <class T>
+template <class T1>
+Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>& Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>::operator += (const Mat<T1>& _other) {
+    this->_combine(_other, [](T& elem, const auto& value) { elem += value; });
+    return *this;
+} /* Mat<T>& Mat<T>::operator += (const Mat<T1>& _other) */
+
+template <class T>
+template <class E>
+Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>& Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>::operator += (const MatExpr<E>& _expr) {
+    this->_combine(_expr, [](T& elem, const auto& value) { elem += value; });
+    return *this;
+} /* Mat<T>& Mat<T>::operator += (const MatExpr<E>& _expr) */
+
+template <class T>
+template <class T1>
+Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>& Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>::operator -= (const Mat<T1>& _other) {
+    this->_combine(_other, [](T& elem, const auto& value) { elem -= value; });
+    return *this;
+} /* Mat<T>& Mat<T>::operator -= (const Mat<T1>& _other) */
+
+template <class T>
+template <class E>
+Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>& Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>::operator -= (const MatExpr<E>& _expr) {
+    this->_combine(_expr, [](T& elem, const auto& value) { elem -= value; });
+    return *this;
+} /* Mat<T>& Mat<T>::operator -= (const MatExpr<E>& _expr) */
+
+template <class T>
+template <class T1>
+Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>& Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>::operator *= (const Mat<T1>& _other) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if ((_other.rows() != this->_n_cols) || (_other.cols() != this->_n_cols)) {
+        throw ORCAExcept::BadDimensionsError(); // The product must keep the dimensions of this matrix
+    }
+#endif
+    Mat<T> product(*this * _other);
+    this->_combine(product, [](T& elem, const T& value) { elem = value; });
+    return *this;
+} /* Mat<T>& Mat<T>::operator *= (const Mat<T1>& _other) */
+
+template <class T>
+Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>& Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>::operator *= (T scalar) {
+    this->_updateElements([&](index_t, index_t) { return scalar; }, [](T& elem, const T& value) { elem *= value; });
+    return *this;
+} /* Mat<T>& Mat<T>::operator *= (T scalar) */
+
+/* Below are the output parameter operations. They write into an existing destination of the
+ * right dimensions, such as a preallocated matrix or a block of one, and allocate nothing
+ * unless the destination overlaps an operand */
+
+/**
+ * Returns true if a and b read or write any of the same elements
+ * @param a first matrix
+ * @param b second matrix
+ */
+
+template <class T1, class T2>
+bool _sharesStorage(const Mat<T1>& a, const Mat<T2>& b) {
+    return ((a.storage() != nullptr) && (a.storage() == b.storage())) || _overlaps(a, b);
+} /* bool _sharesStorage(const Mat<T1>& a, const Mat<T2>& b) */
+
+/**
+ * Copies every element of source into out, which has the same dimensions and does not overlap it
+ * @param out Destination
+ * @param source Matrix to copy
+ */
+
+template <class T, class T1>
+void _store(Mat<T>& out, const Mat<T1>& source) {
+    index_t i,j;
+    if (out.isDense() && source.isDense()) {
+        T* destination = out.data();
+        const T1* elements = source.data();
+        for (i = 0; i < out.rows(); ++i) {
+            for (j = 0; j < out.cols(); ++j) {
+                destination[i * out.stride() + j] = elements[i * source.stride() + j];
+            }
+        }
+        return;
+    }
+    for (i = 0; i < out.rows(); ++i) {
+        for (j = 0; j < out.cols(); ++j) {
+            out.set(i, j, source.at(i, j));
+        }
+    }
+} /* void _store(Mat<T>& out, const Mat<T1>& source) */
+
+/**
+ * Evaluates an expression into out, which must have the dimensions of the result
+ * @param out Destination
+ * @param _expr Expression to evaluate
+ */
+
+template <class T, class E>
+Mat<T>& _evaluate(Mat<T>& out, const MatExpr<E>& _expr) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if ((out.rows() != _expr.rows()) || (out.cols() != _expr.cols())) {
+        throw ORCAExcept::BadDimensionsError(); // Destination has the wrong dimensions
+    }
+#endif
+    if (out.isDense() && !_expr.aliases(out)) {
+        _expr._evalInto(out.data(), out.stride());
+        return out;
+    }
+    _store(out, Mat<typename E::value_type>(_expr));
+    return out;
+} /* Mat<T>& _evaluate(Mat<T>& out, const MatExpr<E>& _expr) */
+
+/**
+ * Writes the product a * b into out, which must be a.rows() x b.cols()
+ * @param out Destination
+ * @param a left matrix
+ * @param b right matrix
+ * @return out
+ */
+
+template <class T, class T1, class T2>
+Mat<T>& multiply(Mat<T>& out, const Mat<T1>& a, const Mat<T2>& b) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if ((a.cols() != b.rows()) || (out.rows() != a.rows()) || (out.cols() != b.cols())) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions or destination do not match
+    }
+#endif
+    instrument::_Counted counted(instrument::Op::multiply, 2.0 * a.rows() * a.cols() * b.cols());
+    if (out.isDense() && !_sharesStorage(out, a) && !_sharesStorage(out, b)) {
+        _multiplyInto(a, b, out.data(), out.stride());
+        return out;
+    }
+    _store(out, a * b); // The product would overwrite elements it has not read yet
+    return out;
+} /* Mat<T>& multiply(Mat<T>& out, const Mat<T1>& a, const Mat<T2>& b) */
+
+/**
+ * Writes the sum a + b into out, which must have the dimensions of a and b
+ * @param out Destination
+ * @param a left matrix
+ * @param b right matrix
+ * @return out
+ */
+
+template <class T, class T1, class T2>
+Mat<T>& add(Mat<T>& out, const Mat<T1>& a, const Mat<T2>& b) {
+    return _evaluate(out, a + b);
+} /* Mat<T>& add(Mat<T>& out, const Mat<T1>& a, const Mat<T2>& b) */
+
+/**
+ * Writes the difference a - b into out, which must have the dimensions of a and b
+ * @param out Destination
+ * @param a left matrix
+ * @param b right matrix
+ * @return out
+ */
+
+template <class T, class T1, class T2>
+Mat<T>& subtract(Mat<T>& out, const Mat<T1>& a, const Mat<T2>& b) {
+    return _evaluate(out, a - b);
+} /* Mat<T>& subtract(Mat<T>& out, const Mat<T1>& a, const Mat<T2>& b) */
+
+/**
+ * Matrix-vector product with accumulation, out = alpha * A * x + beta * out.
+ * out is not read when beta is zero, so it may hold anything beforehand.
+ * The element type of out sets the type of alpha and beta
+ * @param out Destination with A.rows() rows and one column
+ * @param A Matrix
+ * @param x Vector with A.cols() rows and one column
+ * @param alpha Scale of the product
+ * @param beta Scale of the previous contents of out
+ * @return out
+ */
+
+template <class T, class T1, class T2>
+Mat<T>& gemv(Mat<T>& out, const Mat<T1>& A, const Mat<T2>& x, std::decay_t<T> alpha = T(1), std::decay_t<T> beta = T(0)) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if ((x.cols() != 1) || (A.cols() != x.rows()) || (out.cols() != 1) || (out.rows() != A.rows())) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions or destination do not match
+    }
+#endif
+    if (_sharesStorage(out, x) || _sharesStorage(out, A) || !out.isDense() || !A.isDense() || !x.isDense()) {
+        /* Views, and operands the result would overwrite, are copied into dense temporaries */
+        Mat<T> result = out;
+        gemv(result, Mat<T1>(A), Mat<T2>(x), alpha, beta);
+        _store(out, result);
+        return out;
+    }
+    T* y = out.data();
+    const index_t ys = out.stride();
+    const T1* a = A.data();
+    const index_t lda = A.stride();
+    const T2* v = x.data();
+    const index_t xs = x.stride();
+    const index_t n = A.cols();
+    const bool accumulate = !(beta == T(0));
+    _parallelFor(0, A.rows(), A.rows() * n, [&](index_t first, index_t last) {
+        index_t i, k;
+        for (i = first; i < last; ++i) {
+            const T1* aRow = a + i * lda;
+            T dot = T(0);
+            if (xs == 1) {
+                for (k = 0; k < n; ++k) {
+                    dot += aRow[k] * v[k];
+                }
+            } else {
+                for (k = 0; k < n; ++k) {
+                    dot += aRow[k] * v[k * xs];
+                }
+            }
+            y[i * ys] = accumulate ? (alpha * dot + beta * y[i * ys]) : (alpha * dot);
+        }
+    });
+    return out;
+} /* Mat<T>& gemv(Mat<T>& out, const Mat<T1>& A, const Mat<T2>& x, T alpha, T beta) */
+
+} /* namespace ORCA */
+
+#endif /* MatExpr_h */
@@ -0,0 +1,805 @@
+//
+//  MatView.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef MatView_h
+#define MatView_h
+
+/* Includes for MatView.h */
+
+#include "Except.h"     // Included for ORCA Exceptions
+#include "Mat.h"        // Included for Mat class
+#include "Vec.h"        // Included for ColVec class
+#include "MatExpr.h"    // Included for assignment from expressions
+#include <type_traits>  // Included for std::enable_if
+
+namespace ORCA {
+
+/**
+ * Non-owning, writable matrix over an external buffer, such as a driver or message buffer.
+ * Element (row, col) is data[row * rowStride + col * colStride]. Nothing is copied or freed.
+ * With a column stride of 1 the view is dense, so products and expressions read the buffer
+ * directly; other column strides (column-major buffers, interleaved channels) go through at().
+ * Copying a view makes another view of the same buffer. Assigning to a view writes the
+ * elements into the buffer, the dimensions must match; +=, -= and *= update it in place.
+ * Views returned by Mat::block() and Mat::row() write into the matrix and discard its cached results.
+ * The buffer must outlive the view and results are never cached, since the buffer may change
+ * @tparam T Element type
+ */
+
+template <class T>
+class MatView : public Mat<T> {
+    friend class Mat<T>;
+    
+protected:
+    /* Below are protected members of the MatView class */
+    T* _base;                   // Address of element (0, 0)
+    index_t _rowStride;         // Elements between consecutive rows
+    index_t _colStride;         // Elements between consecutive columns
+    Mat<T>* _parent = nullptr;  // Matrix owning the buffer, nullptr for external buffers
+    
+    /**
+     * Marks the contents of the view, and of the matrix owning the buffer, as changed
+     */
+    
+    void _changed() {
+        this->_touch();
+        if (this->_parent != nullptr) {
+            this->_parent->_touch();
+        }
+    } /* void _changed() */
+
+    /**
+     * Returns the matrix owning the buffer, nullptr for external buffers
+     */
+
+    virtual Mat<T>* _storageOwner() override {
+        return this->_parent;
+    } /* virtual Mat<T>* _storageOwner() override */
+
+    /**
+     * Returns the address of element (row, col)
+     */
+
+    T* _element(index_t row, index_t col) const {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if ((row < 0) || (row >= this->_n_rows) || (col < 0) || (col >= this->_n_cols)) {
+            throw ORCAExcept::OutOfBoundsError(); // Either negative indexing or over indexing
+        }
+#endif
+        return this->_base + row * this->_rowStride + col * this->_colStride;
+    } /* T* _element(index_t row, index_t col) const */
+
+    /**
+     * Combines every element of the buffer with the matching element read from the source
+     * @param read Function returning element (row, col) of the source
+     * @param op Function taking the buffer element by reference and the source element
+     */
+
+    template <class R, class Op>
+    void _apply(R read, Op op) {
+        index_t i, j;
+        for (i = 0; i < this->_n_rows; ++i) {
+            T* row = this->_base + i * this->_rowStride;
+            for (j = 0; j < this->_n_cols; ++j) {
+                op(row[j * this->_colStride], read(i, j));
+            }
+        }
+        this->_changed();
+    } /* void _apply(R read, Op op) */
+
+    /**
+     * Combines every element of the buffer with the matching element of _other.
+     * Sources sharing the buffer are copied first, dense sources are read through their storage
+     * @param _other Matrix of the same dimensions
+     * @param op Function taking the buffer element by reference and the source element
+     */
+
+    template <class T1, class Op>
+    void _update(const Mat<T1>& _other, Op op) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((_other.rows() != this->_n_rows) || (_other.cols() != this->_n_cols)) {
+            throw ORCAExcept::BadDimensionsError(); // Views cannot be resized
+        }
+#endif
+        if (((_other.storage() == this->storage()) || _overlaps(_other, *this)) && (static_cast<const void*>(&_other) != static_cast<const void*>(this))) {
+            this->_update(Mat<T1>(_other), op); // Source shares the buffer
+            return;
+        }
+        if (_other.isDense()) {
+            const T1* source = _other.data();
+            const index_t stride = _other.stride();
+            this->_apply([&](index_t row, index_t col) { return source[row * stride + col]; }, op);
+            return;
+        }
+        this->_apply([&](index_t row, index_t col) { return _other.at(row, col); }, op);
+    } /* void _update(const Mat<T1>& _other, Op op) */
+
+    /**
+     * Combines every element of the buffer with the matching element of an expression.
+     * Expressions reading the buffer out of order are evaluated into a temporary first
+     * @param _expr Expression of the same dimensions
+     * @param op Function taking the buffer element by reference and the source element
+     */
+
+    template <class E, class Op>
+    void _update(const MatExpr<E>& _expr, Op op) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((_expr.rows() != this->_n_rows) || (_expr.cols() != this->_n_cols)) {
+            throw ORCAExcept::BadDimensionsError(); // Views cannot be resized
+        }
+#endif
+        if (_expr.aliases(*this)) {
+            this->_update(Mat<typename E::value_type>(_expr), op);
+            return;
+        }
+        const E& expr = _expr.self();
+        if (expr._isDense()) {
+            this->_apply([&](index_t row, index_t col) { return expr._denseAt(row, col); }, op);
+            return;
+        }
+        this->_apply([&](index_t row, index_t col) { return expr.at(row, col); }, op);
+    } /* void _update(const MatExpr<E>& _expr, Op op) */
+
+    /**
+     * Writes every element of _other into the buffer
+     * @param _other Matrix or expression to copy
+     */
+
+    template <class S>
+    void _write(const S& _other) {
+        this->_update(_other, [](T& elem, const auto& value) { elem = value; });
+    } /* void _write(const S& _other) */
+
+public:
+
+    /* Below are public constructors for the MatView class */
+
+    /**
+     * Constructs a view of a dense row-major buffer
+     * @param data Address of element (0, 0)
+     * @param rows Number of rows
+     * @param cols Number of columns
+     */
+
+    MatView(T* data, index_t rows, index_t cols) : MatView(data, rows, cols, cols, 1) {
+    } /* MatView(T* data, index_t rows, index_t cols) */
+
+    /**
+     * Constructs a view of a strided buffer. A column-major buffer with leading dimension ld
+     * has rowStride 1 and colStride ld
+     * @param data Address of element (0, 0)
+     * @param rows Number of rows
+     * @param cols Number of columns
+     * @param rowStride Elements between consecutive rows
+     * @param colStride Elements between consecutive columns
+     */
+
+    MatView(T* data, index_t rows, index_t cols, index_t rowStride, index_t colStride) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((rows < 0) || (cols < 0)) {
+            throw ORCAExcept::BadDimensionsError(); // Negative dimensions
+        }
+#endif
+#ifndef ORCA_DISABLE_EMPTY_CHECKS
+        if ((rows == 0) || (cols == 0) || (data == nullptr)) {
+            throw ORCAExcept::EmptyElementError(); // Nothing to view
+        }
+#endif
+        this->_base = data;
+        this->_rowStride = rowStride;
+        this->_colStride = colStride;
+        this->_n_rows = rows;
+        this->_n_cols = cols;
+        if (colStride == 1) {
+            /* Rows are contiguous, the buffer is read directly like owned storage */
+            this->_mat = data;
+            this->_ld = rowStride;
+        }
+    } /* MatView(T* data, index_t rows, index_t cols, index_t rowStride, index_t colStride) */
+
+    /**
+     * Copy constructor. Views the same buffer, no elements are copied
+     * @param _other View to copy
+     */
+
+    MatView(const MatView& _other) : Mat<T>() {
+        this->_base = _other._base;
+        this->_rowStride = _other._rowStride;
+        this->_colStride = _other._colStride;
+        this->_n_rows = _other._n_rows;
+        this->_n_cols = _other._n_cols;
+        this->_mat = _other._mat;
+        this->_ld = _other._ld;
+        this->_parent = _other._parent;
+    } /* MatView(const MatView& _other) */
+
+    /* Below are public operators for the MatView class */
+
+    /**
+     * Writes the elements of _other into the buffer
+     * @param _other View to copy
+     */
+
+    MatView& operator = (const MatView& _other) {
+        this->_write(_other);
+        return *this;
+    } /* MatView& operator = (const MatView& _other) */
+
+    /**
+     * Writes the elements of _other into the buffer
+     * @param _other Matrix to copy
+     */
+
+    template <class T1>
+    MatView& operator = (const Mat<T1>& _other) {
+        this->_write(_other);
+        return *this;
+    } /* MatView& operator = (const Mat<T1>& _other) */
+
+    /**
+     * Evaluates an expression into the buffer. Dense views that the expression does not read
+     * out of order are written directly, otherwise the expression is evaluated into a temporary first
+     * @param _expr Expression to evaluate
+     */
+
+    template <class E>
+    MatView& operator = (const MatExpr<E>& _expr) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((_expr.rows() != this->_n_rows) || (_expr.cols() != this->_n_cols)) {
+            throw ORCAExcept::BadDimensionsError(); // Views cannot be resized
+        }
+#endif
+        if (this->isDense() && !_expr.aliases(*this)) {
+            _expr._evalInto(this->_mat, this->_ld);
+            this->_changed();
+            return *this;
+        }
+        this->_write(_expr);
+        return *this;
+    } /* MatView& operator = (const MatExpr<E>& _expr) */
+
+    /**
+     * Adds the elements of _other to the buffer in place
+     * @param _other Matrix of the same dimensions
+     */
+
+    template <class T1>
+    MatView& operator += (const Mat<T1>& _other) {
+        this->_update(_other, [](T& elem, const auto& value) { elem += value; });
+        return *this;
+    } /* MatView& operator += (const Mat<T1>& _other) */
+
+    /**
+     * Adds an expression to the buffer in place, without evaluating it into a temporary
+     * @param _expr Expression of the same dimensions
+     */
+
+    template <class E>
+    MatView& operator += (const MatExpr<E>& _expr) {
+        this->_update(_expr, [](T& elem, const auto& value) { elem += value; });
+        return *this;
+    } /* MatView& operator += (const MatExpr<E>& _expr) */
+
+    /**
+     * Subtracts the elements of _other from the buffer in place
+     * @param _other Matrix of the same dimensions
+     */
+
+    template <class T1>
+    MatView& operator -= (const Mat<T1>& _other) {
+        this->_update(_other, [](T& elem, const auto& value) { elem -= value; });
+        return *this;
+    } /* MatView& operator -= (const Mat<T1>& _other) */
+
+    /**
+     * Subtracts an expression from the buffer in place, without evaluating it into a temporary
+     * @param _expr Expression of the same dimensions
+     */
+
+    template <class E>
+    MatView& operator -= (const MatExpr<E>& _expr) {
+        this->_update(_expr, [](T& elem, const auto& value) { elem -= value; });
+        return *this;
+    } /* MatView& operator -= (const MatExpr<E>& _expr) */
+
+    /**
+     * Scales every element of the buffer in place
+     * @param scalar Scale factor
+     */
+
+    template <class T1, class = std::enable_if_t<_isScalarOperand<T1>>>
+    MatView& operator *= (T1 scalar) {
+        this->_apply([&](index_t, index_t) { return scalar; }, [](T& elem, const T1& value) { elem *= value; });
+        return *this;
+    } /* MatView& operator *= (T1 scalar) */
+
+    /**
+     * Multiplies the view by a square matrix from the right. The product is formed in a temporary first
+     * @param _other Square matrix with as many rows as the view has columns
+     */
+
+    template <class T1>
+    MatView& operator *= (const Mat<T1>& _other) {
+        this->_write(Mat<T>(*this * _other));
+        return *this;
+    } /* MatView& operator *= (const Mat<T1>& _other) */
+
+    /* Below are public getters and setters for the MatView class */
+
+    /**
+     * Assigns an element at the specified index
+     * @param row Element Row Index
+     * @param col Element Column Index
+     * @param elem Element Value
+     */
+
+    virtual void set(index_t row, index_t col, T elem) override {
+        *this->_element(row, col) = elem;
+        this->_changed();
+    } /* virtual void set(index_t row, index_t col, T elem) override */
+
+    /**
+     * Returns element at the specified index
+     * @param row Element Row Index
+     * @param col Element Column Index
+     */
+
+    virtual T at(index_t row, index_t col) const override {
+        return *this->_element(row, col);
+    } /* virtual T at(index_t row, index_t col) const override */
+
+    using Mat<T>::data;
+
+    /**
+     * Returns a pointer to element (0, 0) for dense views, nullptr otherwise.
+     * The matrix owning the buffer discards its cached results
+     */
+
+    virtual T* data() override {
+        this->_changed();
+        return this->_mat;
+    } /* virtual T* data() override */
+
+    /**
+     * Returns the buffer the view reads its elements from
+     */
+
+    virtual const void* storage() const override {
+        return this->_base;
+    } /* virtual const void* storage() const override */
+
+    /**
+     * Describes the buffer, so kernels read strided views in place
+     */
+
+    virtual bool _layout(const T*& base, index_t& rowStride, index_t& colStride) const override {
+        base = this->_base;
+        rowStride = this->_rowStride;
+        colStride = this->_colStride;
+        return true;
+    } /* virtual bool _layout(const T*& base, index_t& rowStride, index_t& colStride) const override */
+
+    /**
+     * Returns the number of elements between consecutive rows of the buffer
+     */
+
+    index_t rowStride() const {
+        return this->_rowStride;
+    } /* index_t rowStride() const */
+
+    /**
+     * Returns the number of elements between consecutive columns of the buffer
+     */
+
+    index_t colStride() const {
+        return this->_colStride;
+    } /* index_t colStride() const */
+
+    /* Below are public member functions of the MatView class */
+
+    /**
+     * Returns a writable view of the rows row1 to row2 and columns col1 to col2 of this view, inclusive
+     * @param row1 row start index
+     * @param row2 row end index
+     * @param col1 column start index
+     * @param col2 column end index
+     */
+
+    MatView block(index_t row1, index_t row2, index_t col1, index_t col2) {
+        this->_element(row1, col1);
+        this->_element(row2, col2); // Both corners must lie in the view
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((row2 < row1) || (col2 < col1)) {
+            throw ORCAExcept::BadDimensionsError(); // Attempting to view negative dimensions
+        }
+#endif
+        MatView result(this->_base + row1 * this->_rowStride + col1 * this->_colStride, row2 - row1 + 1, col2 - col1 + 1, this->_rowStride, this->_colStride);
+        result._parent = this->_parent;
+        return result;
+    } /* MatView block(index_t row1, index_t row2, index_t col1, index_t col2) */
+
+    /**
+     * Returns a writable 1 x n view of the specified row of this view
+     * @param row row number
+     */
+
+    MatView row(index_t row) {
+        return this->block(row, row, 0, this->_n_cols - 1);
+    } /* MatView row(index_t row) */
+
+    /**
+     * Returns a writable view of the specified column of this view
+     * @param col column number
+     */
+
+    VecView<T> col(index_t col);
+
+}; /* class MatView : public Mat<T> */
+
+/**
+ * Non-owning, writable column vector over an external buffer.
+ * Element i is data[i * stride]. The view is always dense, so it is read directly by every
+ * operator. Copying a view makes another view of the same buffer, assigning to it writes
+ * the elements into the buffer
+ * @tparam T Element type
+ */
+
+template <class T>
+class VecView : public ColVec<T> {
+    friend class Mat<T>;
+    friend class MatView<T>;
+    
+protected:
+    /* Below are protected members of the VecView class */
+    Mat<T>* _parent = nullptr;  // Matrix owning the buffer, nullptr for external buffers
+    
+    /**
+     * Marks the contents of the view, and of the matrix owning the buffer, as changed
+     */
+    
+    void _changed() {
+        this->_touch();
+        if (this->_parent != nullptr) {
+            this->_parent->_touch();
+        }
+    } /* void _changed() */
+
+    /**
+     * Returns the matrix owning the buffer, nullptr for external buffers
+     */
+
+    virtual Mat<T>* _storageOwner() override {
+        return this->_parent;
+    } /* virtual Mat<T>* _storageOwner() override */
+
+    /**
+     * Returns the address of the requested element
+     * @param elem Index of element
+     */
+
+    virtual T* _address(index_t elem) const override {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if ((elem < 0) || (elem >= this->_n_elems)) {
+            throw ORCAExcept::OutOfBoundsError(); // Attempting to index out of bounds
+        }
+#endif
+        return this->_mat + elem * this->_ld;
+    } /* virtual T* _address(index_t elem) const override */
+
+    /**
+     * Combines every element of the buffer with the matching element read from the source
+     * @param read Function returning element i of the source
+     * @param op Function taking the buffer element by reference and the source element
+     */
+
+    template <class R, class Op>
+    void _apply(R read, Op op) {
+        index_t i;
+        for (i = 0; i < this->_n_rows; ++i) {
+            op(this->_mat[i * this->_ld], read(i));
+        }
+        this->_changed();
+    } /* void _apply(R read, Op op) */
+
+    /**
+     * Combines every element of the buffer with the matching element of _other.
+     * Sources overlapping the buffer are copied first, dense sources are read through their storage
+     * @param _other Column vector or n x 1 matrix
+     * @param op Function taking the buffer element by reference and the source element
+     */
+
+    template <class T1, class Op>
+    void _update(const Mat<T1>& _other, Op op) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((_other.rows() != this->_n_rows) || (_other.cols() != 1)) {
+            throw ORCAExcept::BadDimensionsError(); // Views cannot be resized
+        }
+#endif
+        if (_overlaps(_other, *this) && (static_cast<const void*>(&_other) != static_cast<const void*>(this))) {
+            this->_update(Mat<T1>(_other), op); // Source shares the buffer
+            return;
+        }
+        if (_other.isDense()) {
+            const T1* source = _other.data();
+            const index_t stride = _other.stride();
+            this->_apply([&](index_t elem) { return source[elem * stride]; }, op);
+            return;
+        }
+        this->_apply([&](index_t elem) { return _other.at(elem, 0); }, op);
+    } /* void _update(const Mat<T1>& _other, Op op) */
+
+    /**
+     * Combines every element of the buffer with the matching element of an expression.
+     * Expressions reading the buffer out of order are evaluated into a temporary first
+     * @param _expr Expression with one column
+     * @param op Function taking the buffer element by reference and the source element
+     */
+
+    template <class E, class Op>
+    void _update(const MatExpr<E>& _expr, Op op) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((_expr.rows() != this->_n_rows) || (_expr.cols() != 1)) {
+            throw ORCAExcept::BadDimensionsError(); // Views cannot be resized
+        }
+#endif
+        if (_expr.aliases(*this)) {
+            this->_update(Mat<typename E::value_type>(_expr), op);
+            return;
+        }
+        const E& expr = _expr.self();
+        if (expr._isDense()) {
+            this->_apply([&](index_t elem) { return expr._denseAt(elem, 0); }, op);
+            return;
+        }
+        this->_apply([&](index_t elem) { return expr.at(elem, 0); }, op);
+    } /* void _update(const MatExpr<E>& _expr, Op op) */
+
+    /**
+     * Writes every element of _other into the buffer
+     * @param _other Matrix or expression to copy
+     */
+
+    template <class S>
+    void _write(const S& _other) {
+        this->_update(_other, [](T& elem, const auto& value) { elem = value; });
+    } /* void _write(const S& _other) */
+
+public:
+
+    /* Below are public constructors for the VecView class */
+
+    /**
+     * Constructs a view of n elements spaced stride elements apart
+     * @param data Address of element 0
+     * @param n Number of elements
+     * @param stride Elements between consecutive elements of the vector
+     */
+
+    VecView(T* data, index_t n, index_t stride = 1) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (n < 0) {
+            throw ORCAExcept::BadDimensionsError(); // Negative length
+        }
+#endif
+#ifndef ORCA_DISABLE_EMPTY_CHECKS
+        if ((n == 0) || (data == nullptr)) {
+            throw ORCAExcept::EmptyElementError(); // Nothing to view
+        }
+#endif
+        this->_mat = data;
+        this->_ld = stride;
+        this->_n_elems = n;
+        this->_n_rows = n;
+        this->_n_cols = 1;
+    } /* VecView(T* data, index_t n, index_t stride) */
+
+    /**
+     * Copy constructor. Views the same buffer, no elements are copied
+     * @param _other View to copy
+     */
+
+    VecView(const VecView& _other) : VecView(_other._mat, _other._n_elems, _other._ld) {
+        this->_parent = _other._parent;
+    } /* VecView(const VecView& _other) */
+
+    /* Below are public operators for the VecView class */
+
+    /**
+     * Writes the elements of _other into the buffer
+     * @param _other View to copy
+     */
+
+    VecView& operator = (const VecView& _other) {
+        this->_write(_other);
+        return *this;
+    } /* VecView& operator = (const VecView& _other) */
+
+    /**
+     * Writes the elements of _other into the buffer
+     * @param _other Column vector or n x 1 matrix to copy
+     */
+
+    template <class T1>
+    VecView& operator = (const Mat<T1>& _other) {
+        this->_write(_other);
+        return *this;
+    } /* VecView& operator = (const Mat<T1>& _other) */
+
+    /**
+     * Evaluates an expression into the buffer
+     * @param _expr Expression to evaluate
+     */
+
+    template <class E>
+    VecView& operator = (const MatExpr<E>& _expr) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((_expr.rows() != this->_n_rows) || (_expr.cols() != 1)) {
+            throw ORCAExcept::BadDimensionsError(); // Views cannot be resized
+        }
+#endif
+        if (!_expr.aliases(*this)) {
+            _expr._evalInto(this->_mat, this->_ld);
+            this->_changed();
+            return *this;
+        }
+        this->_write(_expr);
+        return *this;
+    } /* VecView& operator = (const MatExpr<E>& _expr) */
+
+    /**
+     * Adds the elements of _other to the buffer in place
+     * @param _other Column vector or n x 1 matrix
+     */
+
+    template <class T1>
+    VecView& operator += (const Mat<T1>& _other) {
+        this->_update(_other, [](T& elem, const auto& value) { elem += value; });
+        return *this;
+    } /* VecView& operator += (const Mat<T1>& _other) */
+
+    /**
+     * Adds an expression to the buffer in place, without evaluating it into a temporary
+     * @param _expr Expression with one column
+     */
+
+    template <class E>
+    VecView& operator += (const MatExpr<E>& _expr) {
+        this->_update(_expr, [](T& elem, const auto& value) { elem += value; });
+        return *this;
+    } /* VecView& operator += (const MatExpr<E>& _expr) */
+
+    /**
+     * Subtracts the elements of _other from the buffer in place
+     * @param _other Column vector or n x 1 matrix
+     */
+
+    template <class T1>
+    VecView& operator -= (const Mat<T1>& _other) {
+        this->_update(_other, [](T& elem, const auto& value) { elem -= value; });
+        return *this;
+    } /* VecView& operator -= (const Mat<T1>& _other) */
+
+    /**
+     * Subtracts an expression from the buffer in place, without evaluating it into a temporary
+     * @param _expr Expression with one column
+     */
+
+    template <class E>
+    VecView& operator -= (const MatExpr<E>& _expr) {
+        this->_update(_expr, [](T& elem, const auto& value) { elem -= value; });
+        return *this;
+    } /* VecView& operator -= (const MatExpr<E>& _expr) */
+
+    /**
+     * Scales every element of the buffer in place
+     * @param scalar Scale factor
+     */
+
+    template <class T1, class = std::enable_if_t<_isScalarOperand<T1>>>
+    VecView& operator *= (T1 scalar) {
+        this->_apply([&](index_t) { return scalar; }, [](T& elem, const T1& value) { elem *= value; });
+        return *this;
+    } /* VecView& operator *= (T1 scalar) */
+
+    /* Below are public setters for the VecView class */
+
+    /**
+     * Assigns an element at the specified index
+     * @param index Element Index
+     * @param elem Element Value
+     */
+
+    virtual void set(index_t index, T elem) override {
+        *this->_address(index) = elem;
+        this->_changed();
+    } /* virtual void set(index_t index, T elem) override */
+
+    /**
+     * Assigns an element at the specified index
+     * @param row Element Row Index
+     * @param col Element Column Index
+     * @param elem Element Value
+     */
+
+    virtual void set(index_t row, index_t col, T elem) override {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if (col != 0) {
+            throw ORCAExcept::OutOfBoundsError(); // Indexed past first column of vector
+        }
+#endif
+        *this->_address(row) = elem;
+        this->_changed();
+    } /* virtual void set(index_t row, index_t col, T elem) override */
+
+    using ColVec<T>::data;
+
+    /**
+     * Returns a pointer to element 0. The matrix owning the buffer discards its cached results
+     */
+
+    virtual T* data() override {
+        this->_changed();
+        return this->_mat;
+    } /* virtual T* data() override */
+
+    /**
+     * Returns the number of elements between consecutive elements of the buffer
+     */
+
+    index_t elemStride() const {
+        return this->_ld;
+    } /* index_t elemStride() const */
+
+}; /* class VecView : public ColVec<T> */
+
+/* Below are the writable views of Mat and MatView, defined here since they need the view classes */
+
+template <class T>
+VecView<T> MatView<T>::col(index_t col) {
+    this->_element(0, col); // Column must lie in the view
+    VecView<T> result(this->_base + col * this->_colStride, this->_n_rows, this->_rowStride);
+    result._parent = this->_parent;
+    return result;
+} /* VecView<T> MatView<T>::col(index_t col) */
+
+template <class T>
+MatView<T> Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>::block(index_t row1, index_t row2, index_t col1, index_t col2) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if ((row2 < row1) || (col2 < col1)) {
+        throw ORCAExcept::BadDimensionsError(); // Attempting to view negative dimensions
+    }
+#endif
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+    if ((row1 < 0) || (col1 < 0) || (row2 >= this->_n_rows) || (col2 >= this->_n_cols)) {
+        throw ORCAExcept::OutOfBoundsError(); // Block extends outside the matrix
+    }
+#endif
+#ifndef ORCA_DISABLE_EMPTY_CHECKS
+    if (!this->isDense()) {
+        throw ORCAExcept::EmptyElementError(); // Lazy views have no storage to write into
+    }
+#endif
+    MatView<T> result(this->_mat + row1 * this->_ld + col1, row2 - row1 + 1, col2 - col1 + 1, this->_ld, 1);
+    result._parent = this->_storageOwner(); // Blocks of views write into the matrix the view was taken from
+    return result;
+} /* MatView<T> Mat<T>::block(index_t row1, index_t row2, index_t col1, index_t col2) */
+
+template <class T>
+MatView<T> Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>::row(index_t row) {
+    return this->block(row, row, 0, this->_n_cols - 1);
+} /* MatView<T> Mat<T>::row(index_t row) */
+
+template <class T>
+VecView<T> Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>::col(index_t col) {
+    return this->block(0, this->_n_rows - 1, col, col).col(0);
+} /* VecView<T> Mat<T>::col(index_t col) */
+
+} /* namespace ORCA */
+
+#endif /* MatView_h */
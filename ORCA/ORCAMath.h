@@ -15,6 +15,10 @@ namespace ORCA {
 typedef long long index_t;
 }
 
+/* Dimension value for matrices sized at runtime */
+
+#define ORCA_DYNAMIC (-1)
+
 /* Error Code Definitions */
 
 #define ORCA_SUCCESS (0x1)
@@ -23,37 +27,63 @@ typedef long long index_t;
 #define ORCA_EMPTY_ELEMENT (0x4)
 #define ORCA_BAD_DIMENSIONS (0x5)
 #define ORCA_UNKNOWN_FILL_TYPE (0x6)
+#define ORCA_SINGULAR_MATRIX (0x7)
+#define ORCA_NOT_POSITIVE_DEFINITE (0x8)
+#define ORCA_FILE_ERROR (0x9)
+#define ORCA_BAD_FORMAT (0xA)
+#define ORCA_READ_ONLY (0xB)
 
 /* Error Checking Definitions Setup
- * Disable all error checking if ORCA_DISABLE_ERROR_CHECK is defined.
+ * Disable all error checking if ORCA_DISABLE_ERROR_CHECKS is defined. Define ORCA_WARN_DISABLED_CHECKS
+ * to have every translation unit that disables them report it.
+ * Individual loops skip bounds checks through unchecked_at() and unchecked_set() instead.
  */
 
+/* Earlier spelling of the dimension checks macro */
+
+#ifdef ORCA_DISABLE_DIMENSION_CHECKS
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+#define ORCA_DISABLE_DIMENSIONS_CHECKS
+#endif
+#endif
+
 #ifdef ORCA_DISABLE_ERROR_CHECKS
-#ifndef ORCA_DISABLE_ERROR_WARNING
+#ifdef ORCA_WARN_DISABLED_CHECKS
 #warning ORCA: Error Checking has been disabled. This can cause crashing in some cases
 #endif
 #define ORCA_DISABLE_BOUNDS_CHECKS
 #define ORCA_DISABLE_NULL_CHECKS
 #define ORCA_DISABLE_DIMENSIONS_CHECKS
 #define ORCA_DISABLE_EMPTY_CHECKS
+#define ORCA_DISABLE_READ_ONLY_CHECKS
 #endif /* ORCA_DISABLE_ERROR_CHECKS */
 
-/* Sticky compute mask definitions */
-
-
-#ifndef ORCA_DISABLE_STICKY_COMPUTE
-#define ORCA_STICKY_COMPUTE_DIAG_MASK (1 << 0)
-#define ORCA_STICKY_COMPUTE_DET_MASK (1 << 1)
-#define ORCA_STICKY_COMPUTE_INV_MASK (1 << 2)
-#endif
-
-
 #include "Constants.h"
 #include "Real.h"
 #include "Complex.h"
 #include "Quaternion.h"
 #include "Mat.h"
 #include "Vec.h"
+#include "MatExpr.h"
+#include "MatView.h"
+#include "LU.h"
+#include "Cholesky.h"
+#include "SparseMat.h"
+#include "Iterative.h"
+#include "DiagMat.h"
+#include "TriMat.h"
+#include "SymMat.h"
+#include "BandMat.h"
+#include "QuaternionBatch.h"
+#include "MatBatch.h"
+#include "ComplexVec.h"
+#include "FFT.h"
+#include "QuaternionSpline.h"
+#include "FixedMat.h"
+#include "Rotation.h"
+#include "Spatial.h"
+#include "Serialize.h"
+#include "Instrument.h"
 #include "Fill.h"
 #include "Except.h"
 
@@ -0,0 +1,367 @@
+//
+//  Parallel.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef Parallel_h
+#define Parallel_h
+
+/* Includes for Parallel.h */
+
+#include <atomic>               // Included for chunk counters
+#include <condition_variable>   // Included for worker wake up
+#include <exception>            // Included for forwarding exceptions to the caller
+#include <functional>           // Included for std::function
+#include <mutex>                // Included for std::mutex
+#include <thread>               // Included for std::thread
+#include <vector>               // Included for the worker list
+
+/* Operations with less estimated work than this (roughly multiply-adds) always run
+ * on the calling thread, so small matrices never pay for threading */
+
+#ifndef ORCA_PARALLEL_MIN_WORK
+#define ORCA_PARALLEL_MIN_WORK (1 << 17)
+#endif
+
+namespace ORCA {
+
+/**
+ * Fixed set of worker threads that execute parallel loops.
+ * The calling thread always takes part, so a pool of size n uses n - 1 workers.
+ * Loops started from inside a running loop execute serially on the calling thread
+ */
+
+class ThreadPool {
+private:
+    /* Below are private members of the ThreadPool class */
+    std::vector<std::thread> _workers;          // Worker threads
+    std::mutex _lock;                           // Protects the job and generation
+    std::mutex _runLock;                        // Serializes concurrent callers of run()
+    std::condition_variable _wake;              // Signals a new job or shutdown
+    std::condition_variable _finished;          // Signals that all chunks are done
+    const std::function<void(index_t)>* _job = nullptr;    // Current job, called with a chunk index
+    index_t _chunks = 0;                        // Number of chunks in the current job
+    std::atomic<index_t> _nextChunk{0};         // Next chunk to process
+    index_t _pending = 0;                       // Chunks not finished yet
+    index_t _active = 0;                        // Workers currently processing the job
+    unsigned long long _generation = 0;         // Incremented for every new job
+    bool _stop = false;                         // Set when the pool shuts down
+    std::exception_ptr _error;                  // First exception thrown by a chunk
+
+    /**
+     * Returns the flag marking threads that are currently running a chunk
+     */
+
+    static bool& _insideLoop() {
+        static thread_local bool insideLoop = false;
+        return insideLoop;
+    } /* static bool& _insideLoop() */
+
+    /**
+     * Processes chunks of the current job until none are left
+     */
+
+    void _drain() {
+        index_t chunk;
+        index_t completed = 0;
+        bool& insideLoop = ThreadPool::_insideLoop();
+        insideLoop = true;
+        while ((chunk = this->_nextChunk.fetch_add(1)) < this->_chunks) {
+            try {
+                (*this->_job)(chunk);
+            } catch (...) {
+                std::lock_guard<std::mutex> guard(this->_lock);
+                if (!this->_error) {
+                    this->_error = std::current_exception();
+                }
+            }
+            ++completed;
+        }
+        insideLoop = false;
+        if (completed > 0) {
+            std::lock_guard<std::mutex> guard(this->_lock);
+            this->_pending -= completed;
+        }
+    } /* void _drain() */
+
+    /**
+     * Worker thread main loop
+     */
+
+    void _work() {
+        unsigned long long seen = 0;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> guard(this->_lock);
+                this->_wake.wait(guard, [&] { return this->_stop || (this->_generation != seen); });
+                if (this->_stop) {
+                    return;
+                }
+                seen = this->_generation;
+                if (this->_job == nullptr) {
+                    continue; // Woke up after the job already finished
+                }
+                ++this->_active;
+            }
+            this->_drain();
+            {
+                std::lock_guard<std::mutex> guard(this->_lock);
+                --this->_active;
+                if ((this->_active == 0) && (this->_pending == 0)) {
+                    this->_finished.notify_all();
+                }
+            }
+        }
+    } /* void _work() */
+
+public:
+
+    /* Below are public constructors for the ThreadPool class */
+
+    /**
+     * Constructs a pool that runs loops on the given number of threads, including the caller
+     * @param threads Number of threads, values below 1 are treated as 1
+     */
+
+    explicit ThreadPool(index_t threads) {
+        index_t i;
+        for (i = 1; i < threads; ++i) {
+            this->_workers.emplace_back([this] { this->_work(); });
+        }
+    } /* explicit ThreadPool(index_t threads) */
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator = (const ThreadPool&) = delete;
+
+    /**
+     * Stops and joins every worker
+     */
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> guard(this->_lock);
+            this->_stop = true;
+        }
+        this->_wake.notify_all();
+        for (std::thread& worker : this->_workers) {
+            worker.join();
+        }
+    } /* ~ThreadPool() */
+
+    /* Below are public getters for the ThreadPool class */
+
+    /**
+     * Returns the number of threads the pool runs loops on, including the caller
+     */
+
+    index_t size() const {
+        return static_cast<index_t>(this->_workers.size()) + 1;
+    } /* index_t size() const */
+
+    /**
+     * Returns true if the calling thread is currently executing a chunk of a parallel loop
+     */
+
+    static bool insideLoop() {
+        return ThreadPool::_insideLoop();
+    } /* static bool insideLoop() */
+
+    /* Below are public member functions of the ThreadPool class */
+
+    /**
+     * Calls body(chunk) for every chunk in [0, chunks) and returns when all of them are done.
+     * The first exception thrown by a chunk is rethrown on the calling thread
+     * @param chunks Number of chunks
+     * @param body Function called with each chunk index
+     */
+
+    void run(index_t chunks, const std::function<void(index_t)>& body) {
+        index_t chunk;
+        if ((chunks <= 1) || this->_workers.empty() || ThreadPool::insideLoop()) {
+            for (chunk = 0; chunk < chunks; ++chunk) {
+                body(chunk);
+            }
+            return;
+        }
+        std::lock_guard<std::mutex> runGuard(this->_runLock);
+        {
+            std::lock_guard<std::mutex> guard(this->_lock);
+            this->_job = &body;
+            this->_chunks = chunks;
+            this->_pending = chunks;
+            this->_nextChunk.store(0);
+            this->_error = nullptr;
+            ++this->_generation;
+        }
+        this->_wake.notify_all();
+        this->_drain();
+        std::exception_ptr error;
+        {
+            std::unique_lock<std::mutex> guard(this->_lock);
+            /* No worker may still be inside _drain() when the next job is set up */
+            this->_finished.wait(guard, [&] { return (this->_pending == 0) && (this->_active == 0); });
+            this->_job = nullptr;
+            this->_chunks = 0;
+            error = this->_error;
+            this->_error = nullptr;
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    } /* void run(index_t chunks, const std::function<void(index_t)>& body) */
+
+}; /* class ThreadPool */
+
+/* Global threading configuration.
+ * ORCA is single threaded unless parallel::setThreads() is called with a value above 1.
+ * parallel::Scope overrides the setting for the current thread until it leaves scope */
+
+namespace parallel {
+
+/**
+ * Returns the process wide setting storage
+ */
+
+inline index_t& _globalThreads() {
+    static index_t threads = 1;
+    return threads;
+} /* inline index_t& _globalThreads() */
+
+inline index_t& _globalMinWork() {
+    static index_t minWork = ORCA_PARALLEL_MIN_WORK;
+    return minWork;
+} /* inline index_t& _globalMinWork() */
+
+inline index_t& _scopedThreads() {
+    static thread_local index_t threads = 0;
+    return threads;
+} /* inline index_t& _scopedThreads() */
+
+/**
+ * Sets the number of threads used by matrix operations. 1 disables threading
+ * @param threads Number of threads, 0 selects the number of hardware threads
+ */
+
+inline void setThreads(index_t threads) {
+    if (threads <= 0) {
+        threads = static_cast<index_t>(std::thread::hardware_concurrency());
+    }
+    _globalThreads() = (threads < 1) ? 1 : threads;
+} /* inline void setThreads(index_t threads) */
+
+/**
+ * Sets the minimum estimated work for an operation to be split across threads
+ * @param minWork Work threshold
+ */
+
+inline void setMinWork(index_t minWork) {
+    _globalMinWork() = minWork;
+} /* inline void setMinWork(index_t minWork) */
+
+/**
+ * Returns the number of threads matrix operations on this thread will use
+ */
+
+inline index_t threads() {
+    return (_scopedThreads() > 0) ? _scopedThreads() : _globalThreads();
+} /* inline index_t threads() */
+
+/**
+ * Returns the minimum estimated work for an operation to be split across threads
+ */
+
+inline index_t minWork() {
+    return _globalMinWork();
+} /* inline index_t minWork() */
+
+/**
+ * Overrides the number of threads for operations started on this thread while in scope
+ */
+
+class Scope {
+private:
+    index_t _previous;  // Setting restored on destruction
+public:
+    /**
+     * @param threads Number of threads to use, 0 selects the number of hardware threads
+     */
+
+    explicit Scope(index_t threads) {
+        this->_previous = _scopedThreads();
+        if (threads <= 0) {
+            threads = static_cast<index_t>(std::thread::hardware_concurrency());
+        }
+        _scopedThreads() = (threads < 1) ? 1 : threads;
+    } /* explicit Scope(index_t threads) */
+
+    Scope(const Scope&) = delete;
+    Scope& operator = (const Scope&) = delete;
+
+    ~Scope() {
+        _scopedThreads() = this->_previous;
+    } /* ~Scope() */
+}; /* class Scope */
+
+/**
+ * Returns the shared pool, grown to at least the requested number of threads.
+ * The pool is never shrunk, smaller requests simply use fewer chunks
+ * @param threads Number of threads required
+ */
+
+inline ThreadPool& _pool(index_t threads) {
+    static std::mutex lock;
+    static ThreadPool* pool = nullptr;
+    static std::vector<ThreadPool*> retired;    // Replaced pools may still be running a loop
+    std::lock_guard<std::mutex> guard(lock);
+    if ((pool == nullptr) || (pool->size() < threads)) {
+        if (pool != nullptr) {
+            retired.push_back(pool);
+        }
+        pool = new ThreadPool(threads);
+    }
+    return *pool;
+} /* inline ThreadPool& _pool(index_t threads) */
+
+} /* namespace parallel */
+
+/**
+ * Splits [begin, end) into contiguous ranges and calls body(rangeBegin, rangeEnd) for each.
+ * Runs on the calling thread when threading is disabled, the work estimate is below the
+ * threshold, or the call is made from inside another parallel loop
+ * @param begin First index
+ * @param end One past the last index
+ * @param work Estimated total work, roughly in multiply-adds
+ * @param body Function called with each range
+ */
+
+template <class F>
+void _parallelFor(index_t begin, index_t end, index_t work, F&& body) {
+    if (end <= begin) {
+        return;
+    }
+#ifndef ORCA_DISABLE_PARALLEL
+    const index_t threads = parallel::threads();
+    if ((threads > 1) && (work >= parallel::minWork()) && !ThreadPool::insideLoop()) {
+        const index_t length = end - begin;
+        const index_t chunks = (length < threads) ? length : threads;
+        const index_t chunkSize = (length + chunks - 1) / chunks;
+        parallel::_pool(threads).run(chunks, [&](index_t chunk) {
+            const index_t lo = begin + chunk * chunkSize;
+            const index_t hi = (lo + chunkSize < end) ? (lo + chunkSize) : end;
+            if (lo < hi) {
+                body(lo, hi);
+            }
+        });
+        return;
+    }
+#endif /* ORCA_DISABLE_PARALLEL */
+    body(begin, end);
+} /* void _parallelFor(index_t begin, index_t end, index_t work, F&& body) */
+
+} /* namespace ORCA */
+
+#endif /* Parallel_h */
@@ -13,6 +13,7 @@
 /* Includes for Quaternionq1.re()*q2.re() - q1.i()*q2.i() - q1.j()*q2.j() - q1.k()*q2.k().h */
 #include "Except.h" // Included for throwing ORCA exceptions
 #include "Complex.h" // Included for complex casting
+#include <cmath>     // Included for the interpolation functions
 
 /* ORCA Print Unit */
 
@@ -31,6 +32,14 @@
 
 namespace ORCA {
 
+/* Matrix types used by the rotation functions, which are defined in Rotation.h */
+
+template <class T, index_t R, index_t C>
+class Mat;
+
+template <class T, index_t N>
+class ColVec;
+
 template <class T>
 class Quaternion {
 protected:
@@ -274,6 +283,39 @@ public:
         return std::sqrt((this->re() * this->re()) + (this->i() * this->i()) + (this->j() * this->j()) + (this->k() * this->k()));
     }
     
+    /* Below are rotation functions for the Quaternion class, defined in Rotation.h */
+    
+    /**
+     * Returns the rotation matrix of the quaternion. The quaternion does not need to be normalized
+     */
+    
+    Mat<T, 3, 3> toRotationMatrix() const;
+    
+    /**
+     * Returns the unit quaternion of a rotation matrix
+     * @param m Proper orthogonal matrix
+     */
+    
+    static Quaternion<T> fromRotationMatrix(const Mat<T, 3, 3>& m);
+    
+    /**
+     * Rotates a vector by a unit quaternion without forming q * v * conj(q)
+     * @param v Vector
+     * @return Rotated vector
+     */
+    
+    ColVec<T, 3> rotate(const ColVec<T, 3>& v) const;
+    
+    ColVec<T, ORCA_DYNAMIC> rotate(const ColVec<T, ORCA_DYNAMIC>& v) const;
+    
+    /**
+     * Rotates every column of a 3 x N matrix by a unit quaternion
+     * @param points Points, one per column
+     * @return Rotated points
+     */
+    
+    Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC> rotate(const Mat<T, ORCA_DYNAMIC, ORCA_DYNAMIC>& points) const;
+    
 };
 
 /* Below are the overloaded math operators for the quaternion class */
@@ -773,6 +815,112 @@ auto norm(Quaternion<T> _quat) {
     return _quat.norm();
 }
 
+/* Below are interpolation functions for the Quaternion class */
+
+/* Cosine of the angle between two unit quaternions above which slerp falls back to nlerp.
+ * sin(theta) is then too small to divide by accurately, and the two paths agree to O(theta^2) */
+
+#ifndef ORCA_SLERP_NLERP_THRESHOLD
+#define ORCA_SLERP_NLERP_THRESHOLD (0.9995)
+#endif
+
+/**
+ * Returns the four dimensional dot product of two quaternions
+ */
+
+template <class T>
+T _quaternionDot(const Quaternion<T>& q1, const Quaternion<T>& q2) {
+    return (q1.re() * q2.re()) + (q1.i() * q2.i()) + (q1.j() * q2.j()) + (q1.k() * q2.k());
+} /* T _quaternionDot(const Quaternion<T>& q1, const Quaternion<T>& q2) */
+
+/**
+ * Returns sin(x) / x, accurate for small x
+ */
+
+template <class T>
+T _sinc(T x) {
+    using std::sin;
+    if ((x * x) < T(1e-8)) {
+        return T(1) - (x * x) / T(6);
+    }
+    return sin(x) / x;
+} /* T _sinc(T x) */
+
+/**
+ * Normalized linear interpolation between two unit quaternions along the shorter arc.
+ * Follows the same path as slerp but not at constant angular velocity
+ * @param q1 Start, returned at t = 0
+ * @param q2 End, returned at t = 1
+ * @param t Interpolation parameter
+ */
+
+template <class T>
+Quaternion<T> nlerp(const Quaternion<T>& q1, const Quaternion<T>& q2, T t) {
+    const T sign = (_quaternionDot(q1, q2) < T(0)) ? T(-1) : T(1);
+    const T s1 = T(1) - t;
+    const T s2 = sign * t;
+    Quaternion<T> result((s1 * q1.re()) + (s2 * q2.re()), (s1 * q1.i()) + (s2 * q2.i()), (s1 * q1.j()) + (s2 * q2.j()), (s1 * q1.k()) + (s2 * q2.k()));
+    return result / result.norm();
+} /* Quaternion<T> nlerp(const Quaternion<T>& q1, const Quaternion<T>& q2, T t) */
+
+/**
+ * Spherical linear interpolation between two unit quaternions along the shorter arc, at constant angular velocity.
+ * Falls back to nlerp when the quaternions are within acos(ORCA_SLERP_NLERP_THRESHOLD) of each other
+ * @param q1 Start, returned at t = 0
+ * @param q2 End, returned at t = 1
+ * @param t Interpolation parameter
+ */
+
+template <class T>
+Quaternion<T> slerp(const Quaternion<T>& q1, const Quaternion<T>& q2, T t) {
+    using std::acos;
+    using std::sin;
+    T cosTheta = _quaternionDot(q1, q2);
+    const T sign = (cosTheta < T(0)) ? T(-1) : T(1);
+    cosTheta = sign * cosTheta;
+    if (cosTheta > T(ORCA_SLERP_NLERP_THRESHOLD)) {
+        return nlerp(q1, q2, t);
+    }
+    const T theta = acos(cosTheta);
+    const T sinTheta = sin(theta);
+    const T s1 = sin((T(1) - t) * theta) / sinTheta;
+    const T s2 = sign * sin(t * theta) / sinTheta;
+    return Quaternion<T>((s1 * q1.re()) + (s2 * q2.re()), (s1 * q1.i()) + (s2 * q2.i()), (s1 * q1.j()) + (s2 * q2.j()), (s1 * q1.k()) + (s2 * q2.k()));
+} /* Quaternion<T> slerp(const Quaternion<T>& q1, const Quaternion<T>& q2, T t) */
+
+/**
+ * Quaternion exponential, e^w (cos|v| + v sin|v| / |v|)
+ * @param _quat Quaternion w + v
+ */
+
+template <class T>
+Quaternion<T> exp(Quaternion<T> _quat) {
+    using std::cos;
+    using std::exp;
+    using std::sqrt;
+    const T angle = sqrt((_quat.i() * _quat.i()) + (_quat.j() * _quat.j()) + (_quat.k() * _quat.k()));
+    const T scale = exp(_quat.re());
+    const T vectorScale = scale * _sinc(angle);
+    return Quaternion<T>(scale * cos(angle), vectorScale * _quat.i(), vectorScale * _quat.j(), vectorScale * _quat.k());
+} /* Quaternion<T> exp(Quaternion<T> _quat) */
+
+/**
+ * Quaternion logarithm, ln|q| + v atan2(|v|, w) / |v|. The inverse of exp for rotations of less than 2 pi
+ * @param _quat Quaternion w + v
+ */
+
+template <class T>
+Quaternion<T> log(Quaternion<T> _quat) {
+    using std::atan2;
+    using std::log;
+    using std::sqrt;
+    const T vectorNorm = sqrt((_quat.i() * _quat.i()) + (_quat.j() * _quat.j()) + (_quat.k() * _quat.k()));
+    const T norm = _quat.norm();
+    const T angle = atan2(vectorNorm, _quat.re());
+    const T vectorScale = (vectorNorm > T(0)) ? (angle / vectorNorm) : (T(1) / norm);
+    return Quaternion<T>(log(norm), vectorScale * _quat.i(), vectorScale * _quat.j(), vectorScale * _quat.k());
+} /* Quaternion<T> log(Quaternion<T> _quat) */
+
 }
 
 #endif /* Quaternion_h */
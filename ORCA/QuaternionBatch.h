@@ -0,0 +1,518 @@
+//
+//  QuaternionBatch.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef QuaternionBatch_h
+#define QuaternionBatch_h
+
+/* Includes for QuaternionBatch.h */
+
+#include "Except.h"     // Included for ORCA Exceptions
+#include "Quaternion.h" // Included for single Quaternion values
+#include "Gemm.h"       // Included for the SIMD vector operations
+#include "Parallel.h"   // Included for threaded batch loops
+#include "Mat.h"        // Included for Mat class
+#include "Arena.h"      // Included for aligned storage allocation
+#include <utility>      // Included for std::swap
+
+namespace ORCA {
+
+/**
+ * Calls body(ops, i) for every vector of elements in [0, n).
+ * ops is _SimdOps<T> for full vectors starting at i and _ScalarOps<T> for the remaining elements.
+ * Threads are handed whole vectors, so every element takes the same path, and gets the same
+ * rounding, whatever the number of threads
+ * @param n Number of elements
+ * @param work Estimated work per element, used to decide whether to split the loop across threads
+ * @param body Kernel, called with an operations tag and the first element index
+ */
+
+template <class T, class F>
+void _batchLoop(index_t n, index_t work, F&& body) {
+    using simd = _SimdOps<T>;
+    const index_t vectors = (n + simd::width - 1) / simd::width;
+    _parallelFor(0, vectors, n * work, [&](index_t firstVector, index_t lastVector) {
+        const index_t last = (lastVector * simd::width < n) ? lastVector * simd::width : n;
+        index_t i = firstVector * simd::width;
+        for (; i + simd::width <= last; i += simd::width) {
+            body(simd(), i);
+        }
+        for (; i < last; ++i) {
+            body(_ScalarOps<T>(), i);
+        }
+    });
+} /* void _batchLoop(index_t n, index_t work, F&& body) */
+
+/**
+ * Hamilton product of one vector of quaternions, component by component
+ * @tparam O Vector operations
+ */
+
+template <class O, class V>
+void _hamilton(V aw, V ax, V ay, V az, V bw, V bx, V by, V bz, V& w, V& x, V& y, V& z) {
+    w = O::fnma(az, bz, O::fnma(ay, by, O::fnma(ax, bx, O::mul(aw, bw))));
+    x = O::fnma(az, by, O::fma(ay, bz, O::fma(ax, bw, O::mul(aw, bx))));
+    y = O::fma(az, bx, O::fnma(ax, bz, O::fma(ay, bw, O::mul(aw, by))));
+    z = O::fma(az, bw, O::fnma(ay, bx, O::fma(ax, by, O::mul(aw, bz))));
+} /* void _hamilton(...) */
+
+/**
+ * Batch of N quaternions stored as structure of arrays.
+ * Each component has its own contiguous array, so the batch kernels process one SIMD vector
+ * of quaternions per step: w (real), x (i), y (j) and z (k)
+ * @tparam T Element type
+ */
+
+template <class T>
+class QuaternionBatch {
+private:
+    /* Below are private members of the QuaternionBatch class */
+    T* _data = nullptr;     // Component arrays, one after another
+    index_t _n = 0;         // Number of quaternions
+
+    /**
+     * Allocates storage for n quaternions. Contents are left uninitialized
+     * @param n Number of quaternions
+     */
+
+    void _allocate(index_t n) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (n < 0) {
+            throw ORCAExcept::BadDimensionsError(); // Attempting to allocate a negative number of quaternions
+        }
+#endif
+        this->_n = n;
+        if (n > 0) {
+            this->_data = static_cast<T*>(_allocateStorage(sizeof(T) * 4 * static_cast<std::size_t>(n)));
+        }
+    } /* void _allocate(index_t n) */
+
+    /**
+     * Frees the storage of the batch
+     */
+
+    void _release() {
+        if (this->_data != nullptr) {
+            _freeStorage(this->_data);
+        }
+        this->_data = nullptr;
+        this->_n = 0;
+    } /* void _release() */
+
+public:
+
+    /* Below are public constructors for the QuaternionBatch class */
+
+    /**
+     * Default constructor. The batch is empty
+     */
+
+    QuaternionBatch() {}
+
+    /**
+     * Constructs a batch of n quaternions with every component set to zero
+     * @param n Number of quaternions
+     */
+
+    explicit QuaternionBatch(index_t n) : QuaternionBatch(n, Quaternion<T>()) {}
+
+    /**
+     * Constructs a batch of n copies of value
+     * @param n Number of quaternions
+     * @param value Quaternion to copy
+     */
+
+    QuaternionBatch(index_t n, const Quaternion<T>& value) {
+        this->_allocate(n);
+        const T elements[4] = {value.re(), value.i(), value.j(), value.k()};
+        index_t i;
+        short c;
+        for (c = 0; c < 4; ++c) {
+            T* component = this->component(c);
+            for (i = 0; i < n; ++i) {
+                component[i] = elements[c];
+            }
+        }
+    } /* QuaternionBatch(index_t n, const Quaternion<T>& value) */
+
+    /**
+     * Copy constructor. Performs a deep copy of _other
+     * @param _other Batch to copy
+     */
+
+    QuaternionBatch(const QuaternionBatch& _other) {
+        this->_allocate(_other._n);
+        index_t i;
+        for (i = 0; i < 4 * this->_n; ++i) {
+            this->_data[i] = _other._data[i];
+        }
+    } /* QuaternionBatch(const QuaternionBatch& _other) */
+
+    /**
+     * Move constructor. Takes the storage of _other and leaves it empty
+     * @param _other Batch to move from
+     */
+
+    QuaternionBatch(QuaternionBatch&& _other) noexcept {
+        std::swap(this->_data, _other._data);
+        std::swap(this->_n, _other._n);
+    } /* QuaternionBatch(QuaternionBatch&& _other) */
+
+    ~QuaternionBatch() {
+        this->_release();
+    } /* ~QuaternionBatch() */
+
+    /* Below are public operators for the QuaternionBatch class */
+
+    /**
+     * Copy assignment operator. Storage is reused when both batches have the same size
+     * @param _other Batch to copy
+     */
+
+    QuaternionBatch& operator = (const QuaternionBatch& _other) {
+        if (this == &_other) {
+            return *this;
+        }
+        if (this->_n != _other._n) {
+            arena::_HeapOnly heapOnly(!_isArenaStorage(this->_data)); // Storage on the heap stays there
+            this->_release();
+            this->_allocate(_other._n);
+        }
+        index_t i;
+        for (i = 0; i < 4 * this->_n; ++i) {
+            this->_data[i] = _other._data[i];
+        }
+        return *this;
+    } /* QuaternionBatch& operator = (const QuaternionBatch& _other) */
+
+    /**
+     * Move assignment operator. Takes the storage of _other. A batch on the heap, or without
+     * storage, copies arena storage instead of taking it, so that it keeps its contents after
+     * the arena scope ends
+     * @param _other Batch to move from
+     */
+
+    QuaternionBatch& operator = (QuaternionBatch&& _other) {
+        if (!_isArenaStorage(this->_data) && _isArenaStorage(_other._data)) {
+            return (*this = static_cast<const QuaternionBatch&>(_other));
+        }
+        std::swap(this->_data, _other._data);
+        std::swap(this->_n, _other._n);
+        return *this;
+    } /* QuaternionBatch& operator = (QuaternionBatch&& _other) */
+
+    /* Below are public getters and setters for the QuaternionBatch class */
+
+    /**
+     * Returns the number of quaternions in the batch
+     */
+
+    index_t size() const {
+        return this->_n;
+    } /* index_t size() const */
+
+    /**
+     * Returns the array holding one component of every quaternion
+     * @param index Component, 0 for the real part and 1, 2, 3 for i, j, k
+     */
+
+    T* component(short index) {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if ((index < 0) || (index > 3)) {
+            throw ORCAExcept::OutOfBoundsError(); // Indexed outside quaternion components
+        }
+#endif
+        return this->_data + index * this->_n;
+    } /* T* component(short index) */
+
+    const T* component(short index) const {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if ((index < 0) || (index > 3)) {
+            throw ORCAExcept::OutOfBoundsError(); // Indexed outside quaternion components
+        }
+#endif
+        return this->_data + index * this->_n;
+    } /* const T* component(short index) const */
+
+    /**
+     * Returns the quaternion at the specified index
+     * @param index Index
+     */
+
+    Quaternion<T> at(index_t index) const {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if ((index < 0) || (index >= this->_n)) {
+            throw ORCAExcept::OutOfBoundsError(); // Indexed outside the batch
+        }
+#endif
+        const T* d = this->_data + index;
+        const index_t n = this->_n;
+        return Quaternion<T>(d[0], d[n], d[2 * n], d[3 * n]);
+    } /* Quaternion<T> at(index_t index) const */
+
+    /**
+     * Sets the quaternion at the specified index
+     * @param index Index
+     * @param value Quaternion
+     */
+
+    void set(index_t index, const Quaternion<T>& value) {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if ((index < 0) || (index >= this->_n)) {
+            throw ORCAExcept::OutOfBoundsError(); // Indexed outside the batch
+        }
+#endif
+        T* d = this->_data + index;
+        const index_t n = this->_n;
+        d[0] = value.re();
+        d[n] = value.i();
+        d[2 * n] = value.j();
+        d[3 * n] = value.k();
+    } /* void set(index_t index, const Quaternion<T>& value) */
+
+    /* Below are public member functions of the QuaternionBatch class */
+
+    /**
+     * Returns the conjugate of every quaternion
+     */
+
+    QuaternionBatch conj() const {
+        QuaternionBatch result(*this);
+        index_t i;
+        for (i = this->_n; i < 4 * this->_n; ++i) {
+            result._data[i] = -result._data[i];
+        }
+        return result;
+    } /* QuaternionBatch conj() const */
+
+    /**
+     * Scales every quaternion to unit norm
+     */
+
+    void normalize() {
+        T* w = this->component(0);
+        T* x = this->component(1);
+        T* y = this->component(2);
+        T* z = this->component(3);
+        _batchLoop<T>(this->_n, 12, [&](auto ops, index_t i) {
+            using O = decltype(ops);
+            auto vw = O::load(w + i);
+            auto vx = O::load(x + i);
+            auto vy = O::load(y + i);
+            auto vz = O::load(z + i);
+            auto norm = O::sqrt(O::fma(vz, vz, O::fma(vy, vy, O::fma(vx, vx, O::mul(vw, vw)))));
+            O::store(w + i, O::div(vw, norm));
+            O::store(x + i, O::div(vx, norm));
+            O::store(y + i, O::div(vy, norm));
+            O::store(z + i, O::div(vz, norm));
+        });
+    } /* void normalize() */
+
+    /**
+     * Returns a copy of the batch with every quaternion scaled to unit norm
+     */
+
+    QuaternionBatch normalized() const {
+        QuaternionBatch result(*this);
+        result.normalize();
+        return result;
+    } /* QuaternionBatch normalized() const */
+
+    /**
+     * Rotates vector i by unit quaternion i for every i, using v' = v + w t + u x t with t = 2 u x v.
+     * The component arrays may be the same as the output arrays
+     * @param x, y, z Components of the vectors, one per quaternion
+     * @param outX, outY, outZ Components of the rotated vectors
+     */
+
+    void rotate(const T* x, const T* y, const T* z, T* outX, T* outY, T* outZ) const {
+        const T* qw = this->component(0);
+        const T* qx = this->component(1);
+        const T* qy = this->component(2);
+        const T* qz = this->component(3);
+        _batchLoop<T>(this->_n, 18, [&](auto ops, index_t i) {
+            using O = decltype(ops);
+            auto w = O::load(qw + i);
+            auto ux = O::load(qx + i);
+            auto uy = O::load(qy + i);
+            auto uz = O::load(qz + i);
+            auto vx = O::load(x + i);
+            auto vy = O::load(y + i);
+            auto vz = O::load(z + i);
+            auto two = O::broadcast(T(2));
+            auto tx = O::mul(two, O::fnma(uz, vy, O::mul(uy, vz)));
+            auto ty = O::mul(two, O::fnma(ux, vz, O::mul(uz, vx)));
+            auto tz = O::mul(two, O::fnma(uy, vx, O::mul(ux, vy)));
+            O::store(outX + i, O::add(O::fma(w, tx, vx), O::fnma(uz, ty, O::mul(uy, tz))));
+            O::store(outY + i, O::add(O::fma(w, ty, vy), O::fnma(ux, tz, O::mul(uz, tx))));
+            O::store(outZ + i, O::add(O::fma(w, tz, vz), O::fnma(uy, tx, O::mul(ux, ty))));
+        });
+    } /* void rotate(...) const */
+
+    /**
+     * Rotates the columns of a 3 x N matrix, column i by unit quaternion i
+     * @param vectors Vectors to rotate, one per column
+     * @return Rotated vectors
+     */
+
+    Mat<T> rotate(const Mat<T>& vectors) const {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((vectors.rows() != 3) || (vectors.cols() != this->_n)) {
+            throw ORCAExcept::BadDimensionsError(); // Needs one 3D vector per quaternion
+        }
+#endif
+        if (!vectors.isDense()) {
+            return this->rotate(Mat<T>(vectors)); // Views are materialized first
+        }
+        Mat<T> result(3, this->_n);
+        const T* v = vectors.data();
+        T* r = result.data();
+        this->rotate(v, v + vectors.stride(), v + 2 * vectors.stride(), r, r + result.stride(), r + 2 * result.stride());
+        return result;
+    } /* Mat<T> rotate(const Mat<T>& vectors) const */
+
+}; /* class QuaternionBatch */
+
+/* Below are the overloaded math operators for the QuaternionBatch class */
+
+/**
+ * Computes the Hamilton product of every pair of quaternions into out, without allocating
+ * when out already has the right size. out may be a or b
+ * @param a Left quaternions
+ * @param b Right quaternions
+ * @param out Products
+ */
+
+template <class T>
+void multiply(const QuaternionBatch<T>& a, const QuaternionBatch<T>& b, QuaternionBatch<T>& out) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (a.size() != b.size()) {
+        throw ORCAExcept::BadDimensionsError(); // Batches must have the same size
+    }
+#endif
+    if (out.size() != a.size()) {
+        out = QuaternionBatch<T>(a.size());
+    }
+    const T* aw = a.component(0); const T* ax = a.component(1); const T* ay = a.component(2); const T* az = a.component(3);
+    const T* bw = b.component(0); const T* bx = b.component(1); const T* by = b.component(2); const T* bz = b.component(3);
+    T* ow = out.component(0); T* ox = out.component(1); T* oy = out.component(2); T* oz = out.component(3);
+    _batchLoop<T>(a.size(), 16, [&](auto ops, index_t i) {
+        using O = decltype(ops);
+        typename O::vec w, x, y, z;
+        _hamilton<O>(O::load(aw + i), O::load(ax + i), O::load(ay + i), O::load(az + i),
+                     O::load(bw + i), O::load(bx + i), O::load(by + i), O::load(bz + i), w, x, y, z);
+        O::store(ow + i, w);
+        O::store(ox + i, x);
+        O::store(oy + i, y);
+        O::store(oz + i, z);
+    });
+} /* void multiply(const QuaternionBatch<T>& a, const QuaternionBatch<T>& b, QuaternionBatch<T>& out) */
+
+/**
+ * Computes the product of every quaternion in a with q (right == true) or q with every quaternion in a
+ * @param a Quaternions
+ * @param q Single quaternion
+ * @param right True for a * q, false for q * a
+ * @param out Products, may be a
+ */
+
+template <class T>
+void _multiplyBroadcast(const QuaternionBatch<T>& a, const Quaternion<T>& q, bool right, QuaternionBatch<T>& out) {
+    if (out.size() != a.size()) {
+        out = QuaternionBatch<T>(a.size());
+    }
+    const T* aw = a.component(0); const T* ax = a.component(1); const T* ay = a.component(2); const T* az = a.component(3);
+    T* ow = out.component(0); T* ox = out.component(1); T* oy = out.component(2); T* oz = out.component(3);
+    _batchLoop<T>(a.size(), 16, [&](auto ops, index_t i) {
+        using O = decltype(ops);
+        typename O::vec w, x, y, z;
+        auto qw = O::broadcast(q.re());
+        auto qx = O::broadcast(q.i());
+        auto qy = O::broadcast(q.j());
+        auto qz = O::broadcast(q.k());
+        if (right) {
+            _hamilton<O>(O::load(aw + i), O::load(ax + i), O::load(ay + i), O::load(az + i), qw, qx, qy, qz, w, x, y, z);
+        } else {
+            _hamilton<O>(qw, qx, qy, qz, O::load(aw + i), O::load(ax + i), O::load(ay + i), O::load(az + i), w, x, y, z);
+        }
+        O::store(ow + i, w);
+        O::store(ox + i, x);
+        O::store(oy + i, y);
+        O::store(oz + i, z);
+    });
+} /* void _multiplyBroadcast(...) */
+
+/**
+ * Multiplication operator for 2 quaternion batches, element by element
+ * @param a Left quaternions
+ * @param b Right quaternions
+ * @return Products
+ */
+
+template <class T>
+QuaternionBatch<T> operator * (const QuaternionBatch<T>& a, const QuaternionBatch<T>& b) {
+    QuaternionBatch<T> result;
+    multiply(a, b, result);
+    return result;
+} /* QuaternionBatch<T> operator * (const QuaternionBatch<T>& a, const QuaternionBatch<T>& b) */
+
+/**
+ * Multiplication operator for a quaternion batch and a single quaternion
+ * @param a Left quaternions
+ * @param q Right quaternion
+ * @return Products
+ */
+
+template <class T>
+QuaternionBatch<T> operator * (const QuaternionBatch<T>& a, const Quaternion<T>& q) {
+    QuaternionBatch<T> result;
+    _multiplyBroadcast(a, q, true, result);
+    return result;
+} /* QuaternionBatch<T> operator * (const QuaternionBatch<T>& a, const Quaternion<T>& q) */
+
+/**
+ * Multiplication operator for a single quaternion and a quaternion batch
+ * @param q Left quaternion
+ * @param a Right quaternions
+ * @return Products
+ */
+
+template <class T>
+QuaternionBatch<T> operator * (const Quaternion<T>& q, const QuaternionBatch<T>& a) {
+    QuaternionBatch<T> result;
+    _multiplyBroadcast(a, q, false, result);
+    return result;
+} /* QuaternionBatch<T> operator * (const Quaternion<T>& q, const QuaternionBatch<T>& a) */
+
+/**
+ * In place multiplication operator for 2 quaternion batches
+ * @param a Left quaternions, overwritten with the products
+ * @param b Right quaternions
+ */
+
+template <class T>
+QuaternionBatch<T>& operator *= (QuaternionBatch<T>& a, const QuaternionBatch<T>& b) {
+    multiply(a, b, a);
+    return a;
+} /* QuaternionBatch<T>& operator *= (QuaternionBatch<T>& a, const QuaternionBatch<T>& b) */
+
+/**
+ * In place multiplication operator for a quaternion batch and a single quaternion
+ * @param a Left quaternions, overwritten with the products
+ * @param q Right quaternion
+ */
+
+template <class T>
+QuaternionBatch<T>& operator *= (QuaternionBatch<T>& a, const Quaternion<T>& q) {
+    _multiplyBroadcast(a, q, true, a);
+    return a;
+} /* QuaternionBatch<T>& operator *= (QuaternionBatch<T>& a, const Quaternion<T>& q) */
+
+} /* namespace ORCA */
+
+#endif /* QuaternionBatch_h */
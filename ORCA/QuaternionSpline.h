@@ -0,0 +1,279 @@
+//
+//  QuaternionSpline.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef QuaternionSpline_h
+#define QuaternionSpline_h
+
+/* Includes for QuaternionSpline.h */
+
+#include "Except.h"             // Included for ORCA Exceptions
+#include "Quaternion.h"         // Included for Quaternion class and slerp
+#include "QuaternionBatch.h"    // Included for batched samples
+#include <algorithm>            // Included for std::upper_bound
+#include <cmath>                // Included for std::sin and std::cos
+#include <vector>               // Included for keyframe storage
+
+/* Uniform sampling advances the angle of a segment with a rotation recurrence instead of
+ * calling sin and cos. The recurrence is restarted exactly every this many samples to bound drift */
+
+#ifndef ORCA_SPLINE_RESEED
+#define ORCA_SPLINE_RESEED (256)
+#endif
+
+namespace ORCA {
+
+/**
+ * Orientation trajectory through timed keyframes.
+ * Consecutive keyframes are joined by slerp (shorter arc, constant angular velocity), written
+ * per segment as q(u) = a cos(u theta) + b sin(u theta) with u in [0, 1]. a, b and theta are
+ * computed once in the constructor, so a sample costs one sin/cos pair and 8 multiply-adds,
+ * and uniformly spaced samples only a few multiply-adds each.
+ * Segments closer than the nlerp threshold use q(u) = normalize(a + u b) instead.
+ * Times outside the keyframes are clamped to the first or last keyframe
+ * @tparam T Element type
+ */
+
+template <class T>
+class QuaternionSpline {
+private:
+
+    /* Precomputed constants of one segment */
+
+    struct _Segment {
+        T start;            // Time of the first keyframe
+        T inverseDuration;  // 1 / (end - start)
+        T theta;            // Angle of the segment, 0 for nlerp segments
+        T a[4];             // Start keyframe
+        T b[4];             // Orthogonal direction for slerp, end minus start for nlerp
+    }; /* struct _Segment */
+
+    /* Below are private members of the QuaternionSpline class */
+    std::vector<T> _times;              // Keyframe times
+    std::vector<_Segment> _segments;    // One per pair of consecutive keyframes
+
+    /**
+     * Returns the index of the segment containing time t, after clamping
+     */
+
+    index_t _segmentAt(T t) const {
+        const index_t last = static_cast<index_t>(this->_segments.size()) - 1;
+        const index_t index = static_cast<index_t>(std::upper_bound(this->_times.begin(), this->_times.end(), t) - this->_times.begin()) - 1;
+        return (index < 0) ? 0 : ((index > last) ? last : index);
+    } /* index_t _segmentAt(T t) const */
+
+    /**
+     * Returns the segment parameter of time t, clamped to [0, 1]
+     */
+
+    static T _parameter(const _Segment& segment, T t) {
+        const T u = (t - segment.start) * segment.inverseDuration;
+        return (u < T(0)) ? T(0) : ((u > T(1)) ? T(1) : u);
+    } /* static T _parameter(const _Segment& segment, T t) */
+
+    /**
+     * Writes a cos + b sin, or normalize(a + u b) for nlerp segments, to out[0..3] with the given stride
+     */
+
+    static void _evaluate(const _Segment& segment, T u, T c, T s, T* out, index_t stride) {
+        short i;
+        if (segment.theta == T(0)) {
+            T q[4];
+            T norm2 = 0;
+            for (i = 0; i < 4; ++i) {
+                q[i] = segment.a[i] + (u * segment.b[i]);
+                norm2 = norm2 + (q[i] * q[i]);
+            }
+            using std::sqrt;
+            const T inverseNorm = T(1) / sqrt(norm2);
+            for (i = 0; i < 4; ++i) {
+                out[i * stride] = q[i] * inverseNorm;
+            }
+            return;
+        }
+        for (i = 0; i < 4; ++i) {
+            out[i * stride] = (segment.a[i] * c) + (segment.b[i] * s);
+        }
+    } /* static void _evaluate(const _Segment& segment, T u, T c, T s, T* out, index_t stride) */
+
+    /**
+     * Evaluates the spline at time t into out[0..3] with the given stride
+     */
+
+    void _sample(T t, T* out, index_t stride) const {
+        using std::cos;
+        using std::sin;
+        const _Segment& segment = this->_segments[this->_segmentAt(t)];
+        const T u = QuaternionSpline::_parameter(segment, t);
+        const T angle = u * segment.theta;
+        QuaternionSpline::_evaluate(segment, u, cos(angle), sin(angle), out, stride);
+    } /* void _sample(T t, T* out, index_t stride) const */
+
+public:
+
+    /* Below are public constructors for the QuaternionSpline class */
+
+    /**
+     * Builds the spline and precomputes the constants of every segment.
+     * Keyframes are normalized. An ORCA_BAD_DIMENSIONS exception is thrown should the lists differ
+     * in length, hold fewer than 2 keyframes, or the times not be strictly increasing
+     * @param times Keyframe times
+     * @param keyframes Keyframe orientations
+     */
+
+    QuaternionSpline(const std::vector<T>& times, const std::vector<Quaternion<T>>& keyframes) : _times(times) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((times.size() != keyframes.size()) || (times.size() < 2)) {
+            throw ORCAExcept::BadDimensionsError(); // Needs one time per keyframe and at least one segment
+        }
+#endif
+        using std::acos;
+        using std::sin;
+        std::size_t k;
+        this->_segments.resize(times.size() - 1);
+        Quaternion<T> previous = keyframes[0] / keyframes[0].norm();
+        for (k = 0; k + 1 < times.size(); ++k) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+            if (!(times[k] < times[k + 1])) {
+                throw ORCAExcept::BadDimensionsError(); // Keyframe times must be strictly increasing
+            }
+#endif
+            Quaternion<T> next = keyframes[k + 1] / keyframes[k + 1].norm();
+            T cosTheta = _quaternionDot(previous, next);
+            if (cosTheta < T(0)) {
+                next = -next;   // Take the shorter arc, q and -q are the same rotation
+                cosTheta = -cosTheta;
+            }
+            _Segment& segment = this->_segments[k];
+            segment.start = times[k];
+            segment.inverseDuration = T(1) / (times[k + 1] - times[k]);
+            const T a[4] = {previous.re(), previous.i(), previous.j(), previous.k()};
+            const T b[4] = {next.re(), next.i(), next.j(), next.k()};
+            short i;
+            if (cosTheta > T(ORCA_SLERP_NLERP_THRESHOLD)) {
+                segment.theta = T(0);
+                for (i = 0; i < 4; ++i) {
+                    segment.a[i] = a[i];
+                    segment.b[i] = b[i] - a[i];
+                }
+            } else {
+                segment.theta = acos(cosTheta);
+                const T inverseSin = T(1) / sin(segment.theta);
+                for (i = 0; i < 4; ++i) {
+                    segment.a[i] = a[i];
+                    segment.b[i] = (b[i] - (a[i] * cosTheta)) * inverseSin;
+                }
+            }
+            previous = next;
+        }
+    } /* QuaternionSpline(const std::vector<T>& times, const std::vector<Quaternion<T>>& keyframes) */
+
+    /* Below are public getters for the QuaternionSpline class */
+
+    /**
+     * Returns the number of segments
+     */
+
+    index_t segments() const {
+        return static_cast<index_t>(this->_segments.size());
+    } /* index_t segments() const */
+
+    /**
+     * Returns the time of the first keyframe
+     */
+
+    T startTime() const {
+        return this->_times.front();
+    } /* T startTime() const */
+
+    /**
+     * Returns the time of the last keyframe
+     */
+
+    T endTime() const {
+        return this->_times.back();
+    } /* T endTime() const */
+
+    /* Below are public member functions of the QuaternionSpline class */
+
+    /**
+     * Returns the orientation at time t
+     * @param t Time
+     */
+
+    Quaternion<T> at(T t) const {
+        T q[4];
+        this->_sample(t, q, 1);
+        return Quaternion<T>(q[0], q[1], q[2], q[3]);
+    } /* Quaternion<T> at(T t) const */
+
+    /**
+     * Returns the orientation at each of the given times, in any order
+     * @param times Sample times
+     */
+
+    QuaternionBatch<T> sample(const std::vector<T>& times) const {
+        const index_t n = static_cast<index_t>(times.size());
+        QuaternionBatch<T> result(n);
+        T* out = result.component(0);
+        index_t i;
+        for (i = 0; i < n; ++i) {
+            this->_sample(times[i], out + i, n);
+        }
+        return result;
+    } /* QuaternionBatch<T> sample(const std::vector<T>& times) const */
+
+    /**
+     * Returns the orientation at times start, start + step, ..., start + (count - 1) * step.
+     * Within a segment the angle is advanced with the rotation recurrence
+     * cos(x + d) = cos x cos d - sin x sin d, sin(x + d) = sin x cos d + cos x sin d
+     * @param start First sample time
+     * @param step Time between samples
+     * @param count Number of samples
+     */
+
+    QuaternionBatch<T> sample(T start, T step, index_t count) const {
+        using std::cos;
+        using std::sin;
+        QuaternionBatch<T> result(count);
+        T* out = result.component(0);
+        index_t i = 0;
+        while (i < count) {
+            /* Restart the recurrence exactly at the current sample */
+            const T t = start + (T(i) * step);
+            const _Segment& segment = this->_segments[this->_segmentAt(t)];
+            T u = (t - segment.start) * segment.inverseDuration;
+            if ((u < T(0)) || (u > T(1))) {
+                this->_sample(t, out + i, count); // Clamped to the first or last keyframe
+                ++i;
+                continue;
+            }
+            T c = cos(u * segment.theta);
+            T s = sin(u * segment.theta);
+            const T du = step * segment.inverseDuration;
+            const T cd = cos(du * segment.theta);
+            const T sd = sin(du * segment.theta);
+            index_t run = 0;
+            do {
+                QuaternionSpline::_evaluate(segment, u, c, s, out + i, count);
+                const T nextC = (c * cd) - (s * sd);
+                s = (s * cd) + (c * sd);
+                c = nextC;
+                u = u + du;
+                ++i;
+                ++run;
+            } while ((i < count) && (run < ORCA_SPLINE_RESEED) && (u >= T(0)) && (u < T(1)));
+        }
+        return result;
+    } /* QuaternionBatch<T> sample(T start, T step, index_t count) const */
+
+}; /* class QuaternionSpline */
+
+} /* namespace ORCA */
+
+#endif /* QuaternionSpline_h */
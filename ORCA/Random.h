@@ -0,0 +1,466 @@
+//
+//  Random.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef Random_h
+#define Random_h
+
+/* Includes for Random.h */
+
+#include <atomic>       // Included for the thread stream counter
+#include <chrono>       // Included for the default process seed
+#include <cmath>        // Included for std::log, std::sqrt, std::cos and std::sin
+#include <cstdint>      // Included for std::uint64_t
+#include <cstring>      // Included for std::memcpy
+#include <limits>       // Included for std::numeric_limits
+#include <type_traits>  // Included for std::is_integral and std::is_same
+
+#ifndef ORCA_DISABLE_SIMD
+#if defined(__AVX2__) && defined(__FMA__)
+#include <immintrin.h>
+#endif
+#endif /* ORCA_DISABLE_SIMD */
+
+namespace ORCA {
+
+/**
+ * Seedable random number generator for matrix fills and sampling.
+ * Runs eight xoshiro256++ generators side by side, so bulk fills advance them together in SIMD
+ * registers; outputs are handed out one generator after the other. The eight generators
+ * are 2^128 steps apart and stream(k) hands out generators 2^192 steps apart, so streams never overlap.
+ * A generator is cheap to copy and satisfies UniformRandomBitGenerator, so it also works
+ * with the std distributions
+ */
+
+class Rng {
+private:
+    /* Below are private members of the Rng class */
+    static constexpr int _lanes = 8;    // Generators advanced together
+    std::uint64_t _s0[_lanes];          // First state word of each generator
+    std::uint64_t _s1[_lanes];          // Second state word of each generator
+    std::uint64_t _s2[_lanes];          // Third state word of each generator
+    std::uint64_t _s3[_lanes];          // Fourth state word of each generator
+    std::uint64_t _buffer[_lanes];      // Outputs of the last step
+    int _next = _lanes;                 // Next unused output in _buffer
+    double _spare = 0;                  // Second value of the last normal pair
+    bool _hasSpare = false;             // True if _spare has not been handed out
+
+    /* Below are private member functions of the Rng class */
+
+    static std::uint64_t _rotate(std::uint64_t x, int k) {
+        return (x << k) | (x >> (64 - k));
+    } /* static std::uint64_t _rotate(std::uint64_t x, int k) */
+
+    /**
+     * Advances every generator of a state once and stores their outputs
+     * @param s0 First state words
+     * @param s1 Second state words
+     * @param s2 Third state words
+     * @param s3 Fourth state words
+     * @param out Destination of one output per generator
+     */
+
+    static void _advance(std::uint64_t* s0, std::uint64_t* s1, std::uint64_t* s2, std::uint64_t* s3, std::uint64_t* out) {
+        int l;
+        for (l = 0; l < _lanes; ++l) {
+            out[l] = _rotate(s0[l] + s3[l], 23) + s0[l];
+            const std::uint64_t t = s1[l] << 17;
+            s2[l] ^= s0[l];
+            s3[l] ^= s1[l];
+            s1[l] ^= s2[l];
+            s0[l] ^= s3[l];
+            s2[l] ^= t;
+            s3[l] = _rotate(s3[l], 45);
+        }
+    } /* static void _advance(std::uint64_t* s0, std::uint64_t* s1, std::uint64_t* s2, std::uint64_t* s3, std::uint64_t* out) */
+
+    /**
+     * Advances every generator once and stores their outputs
+     * @param out Destination of one output per generator
+     */
+
+    void _step(std::uint64_t* out) {
+        _advance(this->_s0, this->_s1, this->_s2, this->_s3, out);
+    } /* void _step(std::uint64_t* out) */
+
+    /**
+     * Advances one generator by the polynomial in table, 2^128 steps for the jump table
+     * and 2^192 steps for the long jump table
+     * @param lane Generator to advance
+     * @param table Jump polynomial
+     */
+
+    void _jumpLane(int lane, const std::uint64_t* table) {
+        std::uint64_t j0 = 0, j1 = 0, j2 = 0, j3 = 0;
+        int i, b;
+        for (i = 0; i < 4; ++i) {
+            for (b = 0; b < 64; ++b) {
+                if (table[i] & (static_cast<std::uint64_t>(1) << b)) {
+                    j0 ^= this->_s0[lane];
+                    j1 ^= this->_s1[lane];
+                    j2 ^= this->_s2[lane];
+                    j3 ^= this->_s3[lane];
+                }
+                const std::uint64_t t = this->_s1[lane] << 17;
+                this->_s2[lane] ^= this->_s0[lane];
+                this->_s3[lane] ^= this->_s1[lane];
+                this->_s1[lane] ^= this->_s2[lane];
+                this->_s0[lane] ^= this->_s3[lane];
+                this->_s2[lane] ^= t;
+                this->_s3[lane] = _rotate(this->_s3[lane], 45);
+            }
+        }
+        this->_s0[lane] = j0;
+        this->_s1[lane] = j1;
+        this->_s2[lane] = j2;
+        this->_s3[lane] = j3;
+    } /* void _jumpLane(int lane, const std::uint64_t* table) */
+
+    /**
+     * Returns the next output of splitmix64, used to expand a seed into generator state
+     * @param x Splitmix state, advanced
+     */
+
+    static std::uint64_t _splitmix(std::uint64_t& x) {
+        std::uint64_t z = (x += 0x9e3779b97f4a7c15ULL);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    } /* static std::uint64_t _splitmix(std::uint64_t& x) */
+
+    /**
+     * Converts an output to a double uniform in [0, 1) by placing its top 52 bits in the mantissa of [1, 2)
+     */
+
+    static double _unit(std::uint64_t x) {
+        const std::uint64_t bits = (x >> 12) | 0x3ff0000000000000ULL;
+        double unit;
+        std::memcpy(&unit, &bits, sizeof(unit));
+        return unit - 1.0;
+    } /* static double _unit(std::uint64_t x) */
+
+    /**
+     * Converts an output to a value uniform in [lowerBound, upperBound), or [lowerBound, upperBound]
+     * for integral types. Floating point values are scaled with a single rounding so the bulk and
+     * scalar paths agree on every platform
+     */
+
+    template <class T>
+    static T _uniform(std::uint64_t x, T lowerBound, T upperBound) {
+        if constexpr (std::is_integral<T>::value) {
+            const std::uint64_t range = static_cast<std::uint64_t>(upperBound) - static_cast<std::uint64_t>(lowerBound) + 1;
+            /* A range of 0 means the bounds cover every value of a 64 bit type */
+            return static_cast<T>(static_cast<std::uint64_t>(lowerBound) + ((range == 0) ? x : x % range));
+        } else if constexpr (std::is_same<T, float>::value) {
+            return std::fma(upperBound - lowerBound, static_cast<float>(x >> 40) * 0x1.0p-24f, lowerBound);
+        } else if constexpr (std::is_same<T, double>::value) {
+            return std::fma(upperBound - lowerBound, _unit(x), lowerBound);
+        } else {
+            return lowerBound + (upperBound - lowerBound) * static_cast<T>(_unit(x));
+        }
+    } /* static T _uniform(std::uint64_t x, T lowerBound, T upperBound) */
+
+#ifndef ORCA_DISABLE_SIMD
+#if defined(__AVX2__) && defined(__FMA__)
+    static __m256i _rotate(__m256i x, int k) {
+        return _mm256_or_si256(_mm256_slli_epi64(x, k), _mm256_srli_epi64(x, 64 - k));
+    } /* static __m256i _rotate(__m256i x, int k) */
+
+    static void _advance(__m256i& s0, __m256i& s1, __m256i& s2, __m256i& s3, __m256i& out) {
+        out = _mm256_add_epi64(_rotate(_mm256_add_epi64(s0, s3), 23), s0);
+        const __m256i t = _mm256_slli_epi64(s1, 17);
+        s2 = _mm256_xor_si256(s2, s0);
+        s3 = _mm256_xor_si256(s3, s1);
+        s1 = _mm256_xor_si256(s1, s2);
+        s0 = _mm256_xor_si256(s0, s3);
+        s2 = _mm256_xor_si256(s2, t);
+        s3 = _rotate(s3, 45);
+    } /* static void _advance(__m256i& s0, __m256i& s1, __m256i& s2, __m256i& s3, __m256i& out) */
+
+    /**
+     * Writes whole steps of uniform doubles with the generators held in AVX2 registers,
+     * four generators per register. Computes the same values as _uniform
+     * @param out Destination
+     * @param n Number of values, whole steps of which are written
+     * @param lowerBound Lower Bound
+     * @param upperBound Upper Bound
+     * @return Number of values written
+     */
+
+    index_t _uniformSimd(double* out, index_t n, double lowerBound, double upperBound) {
+        __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(this->_s0));
+        __m256i a1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(this->_s1));
+        __m256i a2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(this->_s2));
+        __m256i a3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(this->_s3));
+        __m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(this->_s0 + 4));
+        __m256i b1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(this->_s1 + 4));
+        __m256i b2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(this->_s2 + 4));
+        __m256i b3 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(this->_s3 + 4));
+        const __m256i exponent = _mm256_set1_epi64x(0x3ff0000000000000LL);
+        const __m256d one = _mm256_set1_pd(1.0);
+        const __m256d lower = _mm256_set1_pd(lowerBound);
+        const __m256d range = _mm256_set1_pd(upperBound - lowerBound);
+        __m256i x, y;
+        index_t i;
+        for (i = 0; i + _lanes <= n; i += _lanes) {
+            _advance(a0, a1, a2, a3, x);
+            _advance(b0, b1, b2, b3, y);
+            const __m256d ux = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(x, 12), exponent)), one);
+            const __m256d uy = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(y, 12), exponent)), one);
+            _mm256_storeu_pd(out + i, _mm256_fmadd_pd(range, ux, lower));
+            _mm256_storeu_pd(out + i + 4, _mm256_fmadd_pd(range, uy, lower));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(this->_s0), a0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(this->_s1), a1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(this->_s2), a2);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(this->_s3), a3);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(this->_s0 + 4), b0);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(this->_s1 + 4), b1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(this->_s2 + 4), b2);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(this->_s3 + 4), b3);
+        return i;
+    } /* index_t _uniformSimd(double* out, index_t n, double lowerBound, double upperBound) */
+#endif
+#endif /* ORCA_DISABLE_SIMD */
+
+    /**
+     * Draws a pair of standard normal values with the Box-Muller transform
+     */
+
+    void _normalPair(double& first, double& second) {
+        const double u1 = 1.0 - _unit(this->next()); // In (0, 1] so the logarithm is finite
+        const double u2 = _unit(this->next());
+        const double radius = std::sqrt(-2.0 * std::log(u1));
+        const double angle = 6.283185307179586476925286766559 * u2;
+        first = radius * std::cos(angle);
+        second = radius * std::sin(angle);
+    } /* void _normalPair(double& first, double& second) */
+
+public:
+
+    typedef std::uint64_t result_type;
+
+    /* Below are public constructors for the Rng class */
+
+    /**
+     * Constructs a generator from a seed. Equal seeds give equal sequences on every platform
+     * @param seed Seed
+     */
+
+    explicit Rng(std::uint64_t seed = 0) {
+        this->seed(seed);
+    } /* explicit Rng(std::uint64_t seed) */
+
+    /* Below are public member functions of the Rng class */
+
+    /**
+     * Restarts the generator from a seed
+     * @param seed Seed
+     */
+
+    void seed(std::uint64_t seed) {
+        static const std::uint64_t jumpTable[4] = {0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL};
+        this->_s0[0] = _splitmix(seed);
+        this->_s1[0] = _splitmix(seed);
+        this->_s2[0] = _splitmix(seed);
+        this->_s3[0] = _splitmix(seed);
+        int l;
+        for (l = 1; l < _lanes; ++l) {
+            this->_s0[l] = this->_s0[l - 1];
+            this->_s1[l] = this->_s1[l - 1];
+            this->_s2[l] = this->_s2[l - 1];
+            this->_s3[l] = this->_s3[l - 1];
+            this->_jumpLane(l, jumpTable);
+        }
+        this->_next = _lanes;
+        this->_hasSpare = false;
+    } /* void seed(std::uint64_t seed) */
+
+    /**
+     * Returns an independent generator for worker k, 2^192 steps from this one for each k.
+     * The same generator and k always give the same stream
+     * @param k Stream index
+     */
+
+    Rng stream(std::uint64_t k) const {
+        static const std::uint64_t longJumpTable[4] = {0x76e15d3efefdcbbfULL, 0xc5004e441c522fb3ULL, 0x77710069854ee241ULL, 0x39109bb02acbe635ULL};
+        Rng result = *this;
+        std::uint64_t i;
+        int l;
+        for (i = 0; i < k; ++i) {
+            for (l = 0; l < _lanes; ++l) {
+                result._jumpLane(l, longJumpTable);
+            }
+        }
+        result._next = _lanes;
+        result._hasSpare = false;
+        return result;
+    } /* Rng stream(std::uint64_t k) const */
+
+    /**
+     * Returns the next 64 random bits
+     */
+
+    std::uint64_t next() {
+        if (this->_next == _lanes) {
+            this->_step(this->_buffer);
+            this->_next = 0;
+        }
+        return this->_buffer[this->_next++];
+    } /* std::uint64_t next() */
+
+    std::uint64_t operator () () {
+        return this->next();
+    } /* std::uint64_t operator () () */
+
+    static constexpr std::uint64_t min() {
+        return 0;
+    } /* static constexpr std::uint64_t min() */
+
+    static constexpr std::uint64_t max() {
+        return std::numeric_limits<std::uint64_t>::max();
+    } /* static constexpr std::uint64_t max() */
+
+    /**
+     * Returns a value uniform in [lowerBound, upperBound), or [lowerBound, upperBound] for integral types
+     * @param lowerBound Lower Bound
+     * @param upperBound Upper Bound
+     */
+
+    template <class T>
+    T uniform(T lowerBound = 0, T upperBound = 1) {
+        return _uniform(this->next(), lowerBound, upperBound);
+    } /* T uniform(T lowerBound, T upperBound) */
+
+    /**
+     * Fills a buffer with values uniform in [lowerBound, upperBound).
+     * Produces the same values as n calls to uniform
+     * @param out Destination
+     * @param n Number of values
+     * @param lowerBound Lower Bound
+     * @param upperBound Upper Bound
+     */
+
+    template <class T>
+    void uniform(T* out, index_t n, T lowerBound, T upperBound) {
+        index_t i = 0;
+        while ((i < n) && (this->_next < _lanes)) {
+            out[i++] = _uniform(this->_buffer[this->_next++], lowerBound, upperBound);
+        }
+#ifndef ORCA_DISABLE_SIMD
+#if defined(__AVX2__) && defined(__FMA__)
+        if constexpr (std::is_same<T, double>::value) {
+            i += this->_uniformSimd(out + i, n - i, lowerBound, upperBound);
+        }
+#endif
+#endif /* ORCA_DISABLE_SIMD */
+        std::uint64_t block[_lanes];
+        int l;
+        for (; i + _lanes <= n; i += _lanes) {
+            this->_step(block);
+            for (l = 0; l < _lanes; ++l) {
+                out[i + l] = _uniform(block[l], lowerBound, upperBound);
+            }
+        }
+        for (; i < n; ++i) {
+            out[i] = _uniform(this->next(), lowerBound, upperBound);
+        }
+    } /* void uniform(T* out, index_t n, T lowerBound, T upperBound) */
+
+    /**
+     * Returns a normally distributed value
+     * @param mean Mean
+     * @param stddev Standard deviation
+     */
+
+    template <class T>
+    T normal(T mean = 0, T stddev = 1) {
+        double z;
+        if (this->_hasSpare) {
+            z = this->_spare;
+            this->_hasSpare = false;
+        } else {
+            this->_normalPair(z, this->_spare);
+            this->_hasSpare = true;
+        }
+        return mean + stddev * static_cast<T>(z);
+    } /* T normal(T mean, T stddev) */
+
+    /**
+     * Fills a buffer with normally distributed values.
+     * Produces the same values as n calls to normal
+     * @param out Destination
+     * @param n Number of values
+     * @param mean Mean
+     * @param stddev Standard deviation
+     */
+
+    template <class T>
+    void normal(T* out, index_t n, T mean, T stddev) {
+        index_t i = 0;
+        if ((n > 0) && this->_hasSpare) {
+            out[i++] = mean + stddev * static_cast<T>(this->_spare);
+            this->_hasSpare = false;
+        }
+        double first, second;
+        for (; i + 2 <= n; i += 2) {
+            this->_normalPair(first, second);
+            out[i] = mean + stddev * static_cast<T>(first);
+            out[i + 1] = mean + stddev * static_cast<T>(second);
+        }
+        if (i < n) {
+            out[i] = this->normal(mean, stddev);
+        }
+    } /* void normal(T* out, index_t n, T mean, T stddev) */
+
+}; /* class Rng */
+
+namespace rng {
+
+/**
+ * Returns the seed that thread generators are derived from, taken from the clock unless set
+ */
+
+inline std::atomic<std::uint64_t>& _processSeed() {
+    static std::atomic<std::uint64_t> processSeed(static_cast<std::uint64_t>(std::chrono::system_clock::now().time_since_epoch().count()));
+    return processSeed;
+} /* inline std::atomic<std::uint64_t>& _processSeed() */
+
+/**
+ * Returns the counter that hands each thread its own stream
+ */
+
+inline std::atomic<std::uint64_t>& _threadCount() {
+    static std::atomic<std::uint64_t> threadCount(0);
+    return threadCount;
+} /* inline std::atomic<std::uint64_t>& _threadCount() */
+
+/**
+ * Returns the generator of this thread, used by fill::rand and fill::randn when none is given.
+ * Each thread gets its own stream of the process seed, created on first use
+ */
+
+inline Rng& local() {
+    static thread_local Rng generator = Rng(_processSeed().load()).stream(_threadCount().fetch_add(1));
+    return generator;
+} /* inline Rng& local() */
+
+/**
+ * Reseeds the generator of this thread. Default fills on this thread are then reproducible
+ * @param seed Seed
+ */
+
+inline void seed(std::uint64_t seed) {
+    local().seed(seed);
+} /* inline void seed(std::uint64_t seed) */
+
+} /* namespace rng */
+
+} /* namespace ORCA */
+
+#endif /* Random_h */
@@ -10,60 +10,132 @@
 #ifndef Real_h
 #define Real_h
 
+/* Includes for Real.h */
+
+#include "Constants.h"  // Included for ORCA_EQUALITY_THRESHOLD
+#include <cmath>        // Included for std::sqrt
+#include <ostream>      // Included for std::ostream
+#include <type_traits>  // Included for std::enable_if and std::is_arithmetic
+
 namespace ORCA {
+
+/**
+ * Default tolerance policy of Real, two values are equal when they differ by less than ORCA_EQUALITY_THRESHOLD
+ */
+
+struct DefaultTolerance {
+    template <class T>
+    static constexpr T value() {
+        return static_cast<T>(ORCA_EQUALITY_THRESHOLD);
+    }
+}; /* struct DefaultTolerance */
+
+/**
+ * Tolerance policy of Num / Den, for example Tolerance<1, 1000000000> for 1e-9
+ * @tparam Num numerator of the tolerance
+ * @tparam Den denominator of the tolerance
+ */
+
+template <long long Num, long long Den = 1>
+struct Tolerance {
+    template <class T>
+    static constexpr T value() {
+        return static_cast<T>(Num) / static_cast<T>(Den);
+    }
+}; /* struct Tolerance */
+
 /**
  * Real class
  * This class serves as a wrapper for decimal operations
- * with the added stability of working == and != operators
+ * with the added stability of working == and != operators.
+ * It is trivially copyable and has the size and alignment of T, so arrays of Real<T>
+ * can be read as arrays of T and every operator compiles down to the operation on T.
+ * The tolerance is a compile time policy, values with different policies do not mix
+ * @tparam T wrapped type
+ * @tparam Policy tolerance policy, a class with a static constexpr value<T>()
  */
 
-template <class T>
+template <class T, class Policy = DefaultTolerance>
 class Real {
     T _val;
 public:
-    
+
+    typedef T value_type;
+    typedef Policy policy_type;
+
     /* Below are the public constructors of the real class */
-    
+
     /**
      * Default constructor. This wrapper is intended to behave like the type itself so no initialization is done
      */
-    
-    Real() {
-    }
-    
+
+    Real() = default;
+
     /**
      * Copy constructor from another Real class
      * @param _cast casted value
      */
-    
+
     template <class T1>
-    Real(Real<T1> _cast) {
-        this->_val = static_cast<T>(_cast.get());
+    constexpr Real(Real<T1, Policy> _cast) : _val(static_cast<T>(_cast.get())) {
     }
-    
+
     /**
      * Copy constructor from another class
      * @param _cast casted value
      */
-    
-    template <class T1>
-    Real(T1 _cast) {
-        this->_val = static_cast<T>(_cast);
+
+    template <class T1, class = std::enable_if_t<std::is_arithmetic<T1>::value>>
+    constexpr Real(T1 _cast) : _val(static_cast<T>(_cast)) {
     }
-    
-    
-    
+
     /* Below are the public getters for the Real class */
     /**
      * Retuns the value of the real
      * @return value of real
      */
-    T get() const {
+    constexpr T get() const {
         return this->_val;
     }
-    
+
+    /**
+     * Returns the tolerance used by the comparison operators
+     */
+
+    static constexpr T tolerance() {
+        return Policy::template value<T>();
+    }
+
 };
 
+static_assert(std::is_trivially_copyable<Real<double>>::value && std::is_trivially_default_constructible<Real<double>>::value, "Real must be usable as raw storage");
+static_assert((sizeof(Real<double>) == sizeof(double)) && (alignof(Real<double>) == alignof(double)), "Real must have the layout of the wrapped type");
+
+/**
+ * Type whose storage dense kernels may use for an element type. Real<T> is read as T
+ * @tparam T element type
+ */
+
+template <class T>
+struct _storageType {
+    typedef T type;
+}; /* struct _storageType */
+
+template <class T, class Policy>
+struct _storageType<Real<T, Policy>> {
+    typedef T type;
+}; /* struct _storageType<Real<T, Policy>> */
+
+template <class T>
+using _storage_t = typename _storageType<T>::type;
+
+/**
+ * True for the plain types a Real can be combined with
+ */
+
+template <class T>
+using _isRealOperand = std::enable_if_t<std::is_arithmetic<T>::value, bool>;
+
 /* Below are overloaded math operators for the Real type */
 
 /**
@@ -75,9 +147,9 @@ public:
  * @return sum of two numbers
  */
 
-template<class T1, class T2>
-auto operator + (Real<T1> r1, Real<T2> r2) {
-    return Real<decltype(r1.get() + r2.get())>(r1.get() + r2.get());
+template<class T1, class T2, class P>
+constexpr auto operator + (Real<T1, P> r1, Real<T2, P> r2) {
+    return Real<decltype(r1.get() + r2.get()), P>(r1.get() + r2.get());
 }
 
 /**
@@ -89,9 +161,9 @@ auto operator + (Real<T1> r1, Real<T2> r2) {
  * @return sum of two numbers
  */
 
-template<class T1, class T2>
-auto operator + (Real<T1> r1, T2 r2) {
-    return r1 + Real<T2>(r2);
+template<class T1, class T2, class P, _isRealOperand<T2> = true>
+constexpr auto operator + (Real<T1, P> r1, T2 r2) {
+    return r1 + Real<T2, P>(r2);
 }
 
 /**
@@ -103,9 +175,9 @@ auto operator + (Real<T1> r1, T2 r2) {
  * @return sum of two numbers
  */
 
-template<class T1, class T2>
-auto operator + (T1 r1, Real<T2> r2) {
-    return Real<T1>(r1) + r2;
+template<class T1, class T2, class P, _isRealOperand<T1> = true>
+constexpr auto operator + (T1 r1, Real<T2, P> r2) {
+    return Real<T1, P>(r1) + r2;
 }
 
 /**
@@ -117,9 +189,9 @@ auto operator + (T1 r1, Real<T2> r2) {
  * @return sum of two numbers
  */
 
-template<class T1, class T2>
-auto operator += (Real<T1>& r1, Real<T2> r2) {
-    r1 = Real<decltype(r1.get() + r2.get())>(r1.get() + r2.get());
+template<class T1, class T2, class P>
+constexpr auto operator += (Real<T1, P>& r1, Real<T2, P> r2) {
+    r1 = Real<T1, P>(r1.get() + r2.get());
     return r1;
 }
 
@@ -132,9 +204,9 @@ auto operator += (Real<T1>& r1, Real<T2> r2) {
  * @return sum of two numbers
  */
 
-template<class T1, class T2>
-auto operator += (Real<T1>& r1, T2 r2) {
-    r1 = r1 + Real<T2>(r2);
+template<class T1, class T2, class P, _isRealOperand<T2> = true>
+constexpr auto operator += (Real<T1, P>& r1, T2 r2) {
+    r1 = Real<T1, P>(r1.get() + r2);
     return r1;
 }
 
@@ -147,9 +219,9 @@ auto operator += (Real<T1>& r1, T2 r2) {
  * @return sum of two numbers
  */
 
-template<class T1, class T2>
-auto operator += (T1& r1, Real<T2> r2) {
-    r1 = Real<T1>(r1) + r2;
+template<class T1, class T2, class P, _isRealOperand<T1> = true>
+constexpr auto operator += (T1& r1, Real<T2, P> r2) {
+    r1 = static_cast<T1>(r1 + r2.get());
     return r1;
 }
 
@@ -160,9 +232,9 @@ auto operator += (T1& r1, Real<T2> r2) {
  * @return negative value
  */
 
-template<class T1>
-Real<T1> operator - (Real<T1> r1) {
-    return Real<T1>(-r1.get());
+template<class T1, class P>
+constexpr Real<T1, P> operator - (Real<T1, P> r1) {
+    return Real<T1, P>(-r1.get());
 }
 
 /**
@@ -171,12 +243,12 @@ Real<T1> operator - (Real<T1> r1) {
  * @tparam T2 class of right type
  * @param r1 left  type
  * @param r2 right type
- * @return sum of two numbers
+ * @return difference of two numbers
  */
 
-template<class T1, class T2>
-auto operator - (Real<T1> r1, Real<T2> r2) {
-    return Real<decltype(r1.get() - r2.get())>(r1.get() - r2.get());
+template<class T1, class T2, class P>
+constexpr auto operator - (Real<T1, P> r1, Real<T2, P> r2) {
+    return Real<decltype(r1.get() - r2.get()), P>(r1.get() - r2.get());
 }
 
 /**
@@ -185,12 +257,12 @@ auto operator - (Real<T1> r1, Real<T2> r2) {
  * @tparam T2 class type
  * @param r1 left  type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return difference of two numbers
  */
 
-template<class T1, class T2>
-auto operator - (Real<T1> r1, T2 r2) {
-    return r1 - Real<T2>(r2);
+template<class T1, class T2, class P, _isRealOperand<T2> = true>
+constexpr auto operator - (Real<T1, P> r1, T2 r2) {
+    return r1 - Real<T2, P>(r2);
 }
 
 /**
@@ -199,12 +271,12 @@ auto operator - (Real<T1> r1, T2 r2) {
  * @tparam T2 class complex type
  * @param r1 left type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return difference of two numbers
  */
 
-template<class T1, class T2>
-auto operator - (T1 r1, Real<T2> r2) {
-    return Real<T1>(r1) - r2;
+template<class T1, class T2, class P, _isRealOperand<T1> = true>
+constexpr auto operator - (T1 r1, Real<T2, P> r2) {
+    return Real<T1, P>(r1) - r2;
 }
 
 /**
@@ -213,12 +285,12 @@ auto operator - (T1 r1, Real<T2> r2) {
  * @tparam T2 class of right type
  * @param r1 left  type
  * @param r2 right type
- * @return sum of two numbers
+ * @return difference of two numbers
  */
 
-template<class T1, class T2>
-auto operator -= (Real<T1>& r1, Real<T2> r2) {
-    r1 = Real<decltype(r1.get() - r2.get())>(r1.get() - r2.get());
+template<class T1, class T2, class P>
+constexpr auto operator -= (Real<T1, P>& r1, Real<T2, P> r2) {
+    r1 = Real<T1, P>(r1.get() - r2.get());
     return r1;
 }
 
@@ -228,12 +300,12 @@ auto operator -= (Real<T1>& r1, Real<T2> r2) {
  * @tparam T2 class type
  * @param r1 left  type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return difference of two numbers
  */
 
-template<class T1, class T2>
-auto operator -= (Real<T1>& r1, T2 r2) {
-    r1 = r1 - Real<T2>(r2);
+template<class T1, class T2, class P, _isRealOperand<T2> = true>
+constexpr auto operator -= (Real<T1, P>& r1, T2 r2) {
+    r1 = Real<T1, P>(r1.get() - r2);
     return r1;
 }
 
@@ -243,12 +315,12 @@ auto operator -= (Real<T1>& r1, T2 r2) {
  * @tparam T2 class complex type
  * @param r1 left type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return difference of two numbers
  */
 
-template<class T1, class T2>
-auto operator -= (T1& r1, Real<T2> r2) {
-    r1 = Real<T1>(r1) - r2;
+template<class T1, class T2, class P, _isRealOperand<T1> = true>
+constexpr auto operator -= (T1& r1, Real<T2, P> r2) {
+    r1 = static_cast<T1>(r1 - r2.get());
     return r1;
 }
 
@@ -258,12 +330,12 @@ auto operator -= (T1& r1, Real<T2> r2) {
  * @tparam T2 class of right type
  * @param r1 left  type
  * @param r2 right type
- * @return sum of two numbers
+ * @return product of two numbers
  */
 
-template<class T1, class T2>
-auto operator * (Real<T1> r1, Real<T2> r2) {
-    return Real<decltype(r1.get() * r2.get())>(r1.get() * r2.get());
+template<class T1, class T2, class P>
+constexpr auto operator * (Real<T1, P> r1, Real<T2, P> r2) {
+    return Real<decltype(r1.get() * r2.get()), P>(r1.get() * r2.get());
 }
 
 /**
@@ -272,12 +344,12 @@ auto operator * (Real<T1> r1, Real<T2> r2) {
  * @tparam T2 class type
  * @param r1 left  type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return product of two numbers
  */
 
-template<class T1, class T2>
-auto operator * (Real<T1> r1, T2 r2) {
-    return r1 * Real<T2>(r2);
+template<class T1, class T2, class P, _isRealOperand<T2> = true>
+constexpr auto operator * (Real<T1, P> r1, T2 r2) {
+    return r1 * Real<T2, P>(r2);
 }
 
 /**
@@ -286,12 +358,12 @@ auto operator * (Real<T1> r1, T2 r2) {
  * @tparam T2 class complex type
  * @param r1 left type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return product of two numbers
  */
 
-template<class T1, class T2>
-auto operator * (T1 r1, Real<T2> r2) {
-    return Real<T1>(r1) * r2;
+template<class T1, class T2, class P, _isRealOperand<T1> = true>
+constexpr auto operator * (T1 r1, Real<T2, P> r2) {
+    return Real<T1, P>(r1) * r2;
 }
 
 /**
@@ -300,12 +372,12 @@ auto operator * (T1 r1, Real<T2> r2) {
  * @tparam T2 class of right type
  * @param r1 left  type
  * @param r2 right type
- * @return sum of two numbers
+ * @return product of two numbers
  */
 
-template<class T1, class T2>
-auto operator *= (Real<T1>& r1, Real<T2> r2) {
-    r1 = Real<decltype(r1.get() * r2.get())>(r1.get() * r2.get());
+template<class T1, class T2, class P>
+constexpr auto operator *= (Real<T1, P>& r1, Real<T2, P> r2) {
+    r1 = Real<T1, P>(r1.get() * r2.get());
     return r1;
 }
 
@@ -315,12 +387,12 @@ auto operator *= (Real<T1>& r1, Real<T2> r2) {
  * @tparam T2 class type
  * @param r1 left  type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return product of two numbers
  */
 
-template<class T1, class T2>
-auto operator *= (Real<T1>& r1, T2 r2) {
-    r1 = r1 * Real<T2>(r2);
+template<class T1, class T2, class P, _isRealOperand<T2> = true>
+constexpr auto operator *= (Real<T1, P>& r1, T2 r2) {
+    r1 = Real<T1, P>(r1.get() * r2);
     return r1;
 }
 
@@ -330,12 +402,12 @@ auto operator *= (Real<T1>& r1, T2 r2) {
  * @tparam T2 class complex type
  * @param r1 left type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return product of two numbers
  */
 
-template<class T1, class T2>
-auto operator *= (T1& r1, Real<T2> r2) {
-    r1 = Real<T1>(r1) * r2;
+template<class T1, class T2, class P, _isRealOperand<T1> = true>
+constexpr auto operator *= (T1& r1, Real<T2, P> r2) {
+    r1 = static_cast<T1>(r1 * r2.get());
     return r1;
 }
 
@@ -345,12 +417,12 @@ auto operator *= (T1& r1, Real<T2> r2) {
  * @tparam T2 class of right type
  * @param r1 left  type
  * @param r2 right type
- * @return sum of two numbers
+ * @return quotient of two numbers
  */
 
-template<class T1, class T2>
-auto operator / (Real<T1> r1, Real<T2> r2) {
-    return Real<decltype(r1.get() / r2.get())>(r1.get() / r2.get());
+template<class T1, class T2, class P>
+constexpr auto operator / (Real<T1, P> r1, Real<T2, P> r2) {
+    return Real<decltype(r1.get() / r2.get()), P>(r1.get() / r2.get());
 }
 
 /**
@@ -359,12 +431,12 @@ auto operator / (Real<T1> r1, Real<T2> r2) {
  * @tparam T2 class type
  * @param r1 left  type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return quotient of two numbers
  */
 
-template<class T1, class T2>
-auto operator / (Real<T1> r1, T2 r2) {
-    return r1 / Real<T2>(r2);
+template<class T1, class T2, class P, _isRealOperand<T2> = true>
+constexpr auto operator / (Real<T1, P> r1, T2 r2) {
+    return r1 / Real<T2, P>(r2);
 }
 
 /**
@@ -373,12 +445,12 @@ auto operator / (Real<T1> r1, T2 r2) {
  * @tparam T2 class complex type
  * @param r1 left type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return quotient of two numbers
  */
 
-template<class T1, class T2>
-auto operator / (T1 r1, Real<T2> r2) {
-    return Real<T1>(r1) / r2;
+template<class T1, class T2, class P, _isRealOperand<T1> = true>
+constexpr auto operator / (T1 r1, Real<T2, P> r2) {
+    return Real<T1, P>(r1) / r2;
 }
 
 /**
@@ -387,12 +459,12 @@ auto operator / (T1 r1, Real<T2> r2) {
  * @tparam T2 class of right type
  * @param r1 left  type
  * @param r2 right type
- * @return sum of two numbers
+ * @return quotient of two numbers
  */
 
-template<class T1, class T2>
-auto operator /= (Real<T1>& r1, Real<T2> r2) {
-    r1 = Real<decltype(r1.get() / r2.get())>(r1.get() / r2.get());
+template<class T1, class T2, class P>
+constexpr auto operator /= (Real<T1, P>& r1, Real<T2, P> r2) {
+    r1 = Real<T1, P>(r1.get() / r2.get());
     return r1;
 }
 
@@ -402,12 +474,12 @@ auto operator /= (Real<T1>& r1, Real<T2> r2) {
  * @tparam T2 class type
  * @param r1 left  type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return quotient of two numbers
  */
 
-template<class T1, class T2>
-auto operator /= (Real<T1>& r1, T2 r2) {
-    r1 = r1 / Real<T2>(r2);
+template<class T1, class T2, class P, _isRealOperand<T2> = true>
+constexpr auto operator /= (Real<T1, P>& r1, T2 r2) {
+    r1 = Real<T1, P>(r1.get() / r2);
     return r1;
 }
 
@@ -417,28 +489,28 @@ auto operator /= (Real<T1>& r1, T2 r2) {
  * @tparam T2 class complex type
  * @param r1 left type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return quotient of two numbers
  */
 
-template<class T1, class T2>
-auto operator /= (T1& r1, Real<T2> r2) {
-    r1 = Real<T1>(r1) / r2;
+template<class T1, class T2, class P, _isRealOperand<T1> = true>
+constexpr auto operator /= (T1& r1, Real<T2, P> r2) {
+    r1 = static_cast<T1>(r1 / r2.get());
     return r1;
 }
 
 /**
- * Equality operator for 2 real types
+ * Equality operator for 2 real types. True if the values differ by less than the tolerance of the policy
  * @tparam T1 class of left  type
  * @tparam T2 class of right type
  * @param r1 left  type
  * @param r2 right type
- * @return equality of two numbers
+ * @return whether the two numbers are equal
  */
 
-template<class T1, class T2>
-auto operator == (Real<T1> r1, Real<T2> r2) {
+template<class T1, class T2, class P>
+constexpr bool operator == (Real<T1, P> r1, Real<T2, P> r2) {
     auto diff = r1.get() - r2.get();
-    return (diff < 0 ? -(diff) : (diff)) < static_cast<decltype(diff)>(ORCA_EQUALITY_THRESHOLD);
+    return (diff < 0 ? -(diff) : (diff)) < P::template value<decltype(diff)>();
 }
 
 /**
@@ -447,12 +519,12 @@ auto operator == (Real<T1> r1, Real<T2> r2) {
  * @tparam T2 class type
  * @param r1 left  type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return whether the two numbers are equal
  */
 
-template<class T1, class T2>
-auto operator == (Real<T1> r1, T2 r2) {
-    return r1 == Real<T2>(r2);
+template<class T1, class T2, class P, _isRealOperand<T2> = true>
+constexpr bool operator == (Real<T1, P> r1, T2 r2) {
+    return r1 == Real<T2, P>(r2);
 }
 
 /**
@@ -461,55 +533,54 @@ auto operator == (Real<T1> r1, T2 r2) {
  * @tparam T2 class complex type
  * @param r1 left type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return whether the two numbers are equal
  */
 
-template<class T1, class T2>
-auto operator == (T1 r1, Real<T2> r2) {
-    return Real<T1>(r1) == r2;
+template<class T1, class T2, class P, _isRealOperand<T1> = true>
+constexpr bool operator == (T1 r1, Real<T2, P> r2) {
+    return Real<T1, P>(r1) == r2;
 }
 
 /**
- * Equality operator for 2 real types
+ * Inequality operator for 2 real types, the negation of ==
  * @tparam T1 class of left  type
  * @tparam T2 class of right type
  * @param r1 left  type
  * @param r2 right type
- * @return equality of two numbers
+ * @return whether the two numbers differ
  */
 
-template<class T1, class T2>
-auto operator != (Real<T1> r1, Real<T2> r2) {
-    auto diff = r1.get() - r2.get();
-    return (diff < 0 ? -(diff) : (diff)) > static_cast<decltype(diff)>(ORCA_EQUALITY_THRESHOLD);
+template<class T1, class T2, class P>
+constexpr bool operator != (Real<T1, P> r1, Real<T2, P> r2) {
+    return !(r1 == r2);
 }
 
 /**
- * Equality operator for a real and non real type
+ * Inequality operator for a real and non real type
  * @tparam T1 class of left real type
  * @tparam T2 class type
  * @param r1 left  type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return whether the two numbers differ
  */
 
-template<class T1, class T2>
-auto operator != (Real<T1> r1, T2 r2) {
-    return r1 != Real<T2>(r2);
+template<class T1, class T2, class P, _isRealOperand<T2> = true>
+constexpr bool operator != (Real<T1, P> r1, T2 r2) {
+    return r1 != Real<T2, P>(r2);
 }
 
 /**
- * Equality operator for a non real and real type
+ * Inequality operator for a non real and real type
  * @tparam T1 class of  type
  * @tparam T2 class complex type
  * @param r1 left type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return whether the two numbers differ
  */
 
-template<class T1, class T2>
-auto operator != (T1 r1, Real<T2> r2) {
-    return Real<T1>(r1) != r2;
+template<class T1, class T2, class P, _isRealOperand<T1> = true>
+constexpr bool operator != (T1 r1, Real<T2, P> r2) {
+    return Real<T1, P>(r1) != r2;
 }
 
 /**
@@ -518,11 +589,11 @@ auto operator != (T1 r1, Real<T2> r2) {
  * @tparam T2 class of right type
  * @param r1 left  type
  * @param r2 right type
- * @return equality of two numbers
+ * @return whether r1 is less than r2
  */
 
-template<class T1, class T2>
-auto operator < (Real<T1> r1, Real<T2> r2) {
+template<class T1, class T2, class P>
+constexpr bool operator < (Real<T1, P> r1, Real<T2, P> r2) {
     return r1.get() < r2.get();
 }
 
@@ -532,12 +603,12 @@ auto operator < (Real<T1> r1, Real<T2> r2) {
  * @tparam T2 class type
  * @param r1 left  type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return whether r1 is less than r2
  */
 
-template<class T1, class T2>
-auto operator < (Real<T1> r1, T2 r2) {
-    return r1 < Real<T2>(r2);
+template<class T1, class T2, class P, _isRealOperand<T2> = true>
+constexpr bool operator < (Real<T1, P> r1, T2 r2) {
+    return r1 < Real<T2, P>(r2);
 }
 
 /**
@@ -546,12 +617,12 @@ auto operator < (Real<T1> r1, T2 r2) {
  * @tparam T2 class complex type
  * @param r1 left type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return whether r1 is less than r2
  */
 
-template<class T1, class T2>
-auto operator < (T1 r1, Real<T2> r2) {
-    return Real<T1>(r1) < r2;
+template<class T1, class T2, class P, _isRealOperand<T1> = true>
+constexpr bool operator < (T1 r1, Real<T2, P> r2) {
+    return Real<T1, P>(r1) < r2;
 }
 
 /**
@@ -560,12 +631,12 @@ auto operator < (T1 r1, Real<T2> r2) {
  * @tparam T2 class of right type
  * @param r1 left  type
  * @param r2 right type
- * @return equality of two numbers
+ * @return whether r1 is greater than r2
  */
 
-template<class T1, class T2>
-auto operator > (Real<T1> r1, Real<T2> r2) {
-    return r1.get() < r2.get();
+template<class T1, class T2, class P>
+constexpr bool operator > (Real<T1, P> r1, Real<T2, P> r2) {
+    return r2.get() < r1.get();
 }
 
 /**
@@ -574,12 +645,12 @@ auto operator > (Real<T1> r1, Real<T2> r2) {
  * @tparam T2 class type
  * @param r1 left  type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return whether r1 is greater than r2
  */
 
-template<class T1, class T2>
-auto operator > (Real<T1> r1, T2 r2) {
-    return r1 < Real<T2>(r2);
+template<class T1, class T2, class P, _isRealOperand<T2> = true>
+constexpr bool operator > (Real<T1, P> r1, T2 r2) {
+    return r1 > Real<T2, P>(r2);
 }
 
 /**
@@ -588,116 +659,112 @@ auto operator > (Real<T1> r1, T2 r2) {
  * @tparam T2 class complex type
  * @param r1 left type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return whether r1 is greater than r2
  */
 
-template<class T1, class T2>
-auto operator > (T1 r1, Real<T2> r2) {
-    return Real<T1>(r1) < r2;
+template<class T1, class T2, class P, _isRealOperand<T1> = true>
+constexpr bool operator > (T1 r1, Real<T2, P> r2) {
+    return Real<T1, P>(r1) > r2;
 }
 
 /**
- * Less than  operator for 2 real types
+ * Less than or equal operator for 2 real types, equality within the tolerance
  * @tparam T1 class of left  type
  * @tparam T2 class of right type
  * @param r1 left  type
  * @param r2 right type
- * @return equality of two numbers
+ * @return whether r1 is less than or equal to r2
  */
 
-template<class T1, class T2>
-auto operator <= (Real<T1> r1, Real<T2> r2) {
+template<class T1, class T2, class P>
+constexpr bool operator <= (Real<T1, P> r1, Real<T2, P> r2) {
     return (r1 < r2) || (r1 == r2);
 }
 
 /**
- * Less than for a real and non real type
+ * Less than or equal for a real and non real type
  * @tparam T1 class of left real type
  * @tparam T2 class type
  * @param r1 left  type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return whether r1 is less than or equal to r2
  */
 
-template<class T1, class T2>
-auto operator <= (Real<T1> r1, T2 r2) {
-    return r1 <= Real<T2>(r2);
+template<class T1, class T2, class P, _isRealOperand<T2> = true>
+constexpr bool operator <= (Real<T1, P> r1, T2 r2) {
+    return r1 <= Real<T2, P>(r2);
 }
 
 /**
- * Less than for a non real and real type
+ * Less than or equal for a non real and real type
  * @tparam T1 class of  type
  * @tparam T2 class complex type
  * @param r1 left type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return whether r1 is less than or equal to r2
  */
 
-template<class T1, class T2>
-auto operator <= (T1 r1, Real<T2> r2) {
-    return Real<T1>(r1) <= r2;
+template<class T1, class T2, class P, _isRealOperand<T1> = true>
+constexpr bool operator <= (T1 r1, Real<T2, P> r2) {
+    return Real<T1, P>(r1) <= r2;
 }
 
 /**
- * Greater than  operator for 2 real types
+ * Greater than or equal operator for 2 real types, equality within the tolerance
  * @tparam T1 class of left  type
  * @tparam T2 class of right type
  * @param r1 left  type
  * @param r2 right type
- * @return equality of two numbers
+ * @return whether r1 is greater than or equal to r2
  */
 
-template<class T1, class T2>
-auto operator >= (Real<T1> r1, Real<T2> r2) {
-    return (r1 < r2) || (r1 == r2);
+template<class T1, class T2, class P>
+constexpr bool operator >= (Real<T1, P> r1, Real<T2, P> r2) {
+    return (r1 > r2) || (r1 == r2);
 }
 
 /**
- * Greater than for a real and non real type
+ * Greater than or equal for a real and non real type
  * @tparam T1 class of left real type
  * @tparam T2 class type
  * @param r1 left  type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return whether r1 is greater than or equal to r2
  */
 
-template<class T1, class T2>
-auto operator >= (Real<T1> r1, T2 r2) {
-    return r1 <= Real<T2>(r2);
+template<class T1, class T2, class P, _isRealOperand<T2> = true>
+constexpr bool operator >= (Real<T1, P> r1, T2 r2) {
+    return r1 >= Real<T2, P>(r2);
 }
 
 /**
- * Greater than for a non real and real type
+ * Greater than or equal for a non real and real type
  * @tparam T1 class of  type
  * @tparam T2 class complex type
  * @param r1 left type
  * @param r2 right  type
- * @return sum of two numbers
+ * @return whether r1 is greater than or equal to r2
  */
 
-template<class T1, class T2>
-auto operator >= (T1 r1, Real<T2> r2) {
-    return Real<T1>(r1) < r2;
+template<class T1, class T2, class P, _isRealOperand<T1> = true>
+constexpr bool operator >= (T1 r1, Real<T2, P> r2) {
+    return Real<T1, P>(r1) >= r2;
 }
 
-
-
-
-
-/* Below are other overloaded operators for the Complex class */
+/* Below are other overloaded operators for the Real class */
 
 /** Overloaded stream by reference */
 
-template <class T>
-std::ostream& operator<<(std::ostream& os, const Real<T>& c) {
+template <class T, class P>
+std::ostream& operator<<(std::ostream& os, const Real<T, P>& c) {
     os << c.get();
     return os;
 }
 
 /** Overloaded stream by pointer */
 
-template <class T>
-std::ostream& operator<<(std::ostream& os, const Real<T>* c) {
+template <class T, class P>
+std::ostream& operator<<(std::ostream& os, const Real<T, P>* c) {
     os << *c;
     return os;
 }
@@ -706,21 +773,19 @@ std::ostream& operator<<(std::ostream& os, const Real<T>* c) {
 
 /**
  * Square root function
- * @return Square root of complex number
  */
 
-template <class T>
-auto sqrt(Real<T> _real) {
-    return sqrt(_real.get);
+template <class T, class P>
+auto sqrt(Real<T, P> _real) {
+    return Real<decltype(std::sqrt(_real.get())), P>(std::sqrt(_real.get()));
 }
 
 /**
  * Absolute value function
- * @return Magnitude  complex number
  */
 
-template <class T>
-auto abs(Real<T> _real) {
+template <class T, class P>
+constexpr auto abs(Real<T, P> _real) {
     return (_real.get() < 0 ? -_real.get() : _real.get());
 }
 
@@ -0,0 +1,212 @@
+//
+//  Rotation.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef Rotation_h
+#define Rotation_h
+
+/* Includes for Rotation.h */
+
+#include "Except.h"     // Included for ORCA Exceptions
+#include "Quaternion.h" // Included for Quaternion class
+#include "Mat.h"        // Included for Mat class
+#include "Vec.h"        // Included for ColVec class
+#include "FixedMat.h"   // Included for fixed-size rotation matrices
+#include "Parallel.h"   // Included for threaded point transforms
+#include <cmath>        // Included for std::sqrt
+
+namespace ORCA {
+
+/* Conversions between quaternions and rotation matrices, and direct vector rotation.
+ * Rotating with the matrix or with rotate() gives the same result as q * v * conj(q) for a
+ * unit quaternion, at about half the multiplies and without quaternion temporaries */
+
+/**
+ * Returns the rotation matrix of the quaternion. Non-unit quaternions are scaled by 2 / |q|^2,
+ * so the result is the rotation of the normalized quaternion
+ * @return Proper orthogonal 3x3 matrix
+ */
+
+template <class T>
+Mat<T, 3, 3> Quaternion<T>::toRotationMatrix() const {
+    const T w = this->re(), x = this->i(), y = this->j(), z = this->k();
+    const T s = T(2) / ((w * w) + (x * x) + (y * y) + (z * z));
+    const T xs = x * s, ys = y * s, zs = z * s;
+    const T wx = w * xs, wy = w * ys, wz = w * zs;
+    const T xx = x * xs, xy = x * ys, xz = x * zs;
+    const T yy = y * ys, yz = y * zs, zz = z * zs;
+    Mat<T, 3, 3> result;
+    T* r = result.data();
+    r[0] = T(1) - (yy + zz); r[1] = xy - wz;            r[2] = xz + wy;
+    r[3] = xy + wz;          r[4] = T(1) - (xx + zz);   r[5] = yz - wx;
+    r[6] = xz - wy;          r[7] = yz + wx;            r[8] = T(1) - (xx + yy);
+    return result;
+} /* Mat<T, 3, 3> Quaternion<T>::toRotationMatrix() const */
+
+/**
+ * Returns the unit quaternion of a rotation matrix, with a non-negative real part.
+ * Uses the largest of the four possible pivots, so the result is accurate for every rotation
+ * @param m Proper orthogonal matrix
+ */
+
+template <class T>
+Quaternion<T> Quaternion<T>::fromRotationMatrix(const Mat<T, 3, 3>& m) {
+    using std::sqrt;
+    const T* r = m.data();
+    const T trace = r[0] + r[4] + r[8];
+    T w, x, y, z;
+    if ((trace >= r[0]) && (trace >= r[4]) && (trace >= r[8])) {
+        const T s = sqrt(T(1) + trace) * T(2);   // 4w
+        w = s / T(4);
+        x = (r[7] - r[5]) / s;
+        y = (r[2] - r[6]) / s;
+        z = (r[3] - r[1]) / s;
+    } else if ((r[0] >= r[4]) && (r[0] >= r[8])) {
+        const T s = sqrt(T(1) + r[0] - r[4] - r[8]) * T(2);   // 4x
+        w = (r[7] - r[5]) / s;
+        x = s / T(4);
+        y = (r[1] + r[3]) / s;
+        z = (r[2] + r[6]) / s;
+    } else if (r[4] >= r[8]) {
+        const T s = sqrt(T(1) + r[4] - r[0] - r[8]) * T(2);   // 4y
+        w = (r[2] - r[6]) / s;
+        x = (r[1] + r[3]) / s;
+        y = s / T(4);
+        z = (r[5] + r[7]) / s;
+    } else {
+        const T s = sqrt(T(1) + r[8] - r[0] - r[4]) * T(2);   // 4z
+        w = (r[3] - r[1]) / s;
+        x = (r[2] + r[6]) / s;
+        y = (r[5] + r[7]) / s;
+        z = s / T(4);
+    }
+    if (w < T(0)) {
+        return Quaternion<T>(-w, -x, -y, -z);
+    }
+    return Quaternion<T>(w, x, y, z);
+} /* Quaternion<T> Quaternion<T>::fromRotationMatrix(const Mat<T, 3, 3>& m) */
+
+/**
+ * Rotates (x, y, z) in place by the unit quaternion (w, ux, uy, uz),
+ * using v' = v + w t + u x t with t = 2 u x v
+ */
+
+template <class T>
+inline void _rotateVector(T w, T ux, T uy, T uz, T& x, T& y, T& z) {
+    const T tx = T(2) * ((uy * z) - (uz * y));
+    const T ty = T(2) * ((uz * x) - (ux * z));
+    const T tz = T(2) * ((ux * y) - (uy * x));
+    x = x + (w * tx) + ((uy * tz) - (uz * ty));
+    y = y + (w * ty) + ((uz * tx) - (ux * tz));
+    z = z + (w * tz) + ((ux * ty) - (uy * tx));
+} /* inline void _rotateVector(T w, T ux, T uy, T uz, T& x, T& y, T& z) */
+
+/**
+ * Rotates a vector by a unit quaternion
+ * @param v Vector
+ * @return Rotated vector
+ */
+
+template <class T>
+ColVec<T, 3> Quaternion<T>::rotate(const ColVec<T, 3>& v) const {
+    ColVec<T, 3> result(v);
+    T* r = result.data();
+    _rotateVector(this->re(), this->i(), this->j(), this->k(), r[0], r[1], r[2]);
+    return result;
+} /* ColVec<T, 3> Quaternion<T>::rotate(const ColVec<T, 3>& v) const */
+
+/**
+ * Rotates a vector by a unit quaternion.
+ * An ORCA_BAD_DIMENSIONS exception is thrown should the vector not have 3 elements
+ * @param v Vector
+ * @return Rotated vector
+ */
+
+template <class T>
+ColVec<T> Quaternion<T>::rotate(const ColVec<T>& v) const {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (v.length() != 3) {
+        throw ORCAExcept::BadDimensionsError(); // Only 3D vectors can be rotated
+    }
+#endif
+    T x = v.at(0), y = v.at(1), z = v.at(2);
+    _rotateVector(this->re(), this->i(), this->j(), this->k(), x, y, z);
+    ColVec<T> result(3);
+    result.set(0, x);
+    result.set(1, y);
+    result.set(2, z);
+    return result;
+} /* ColVec<T> Quaternion<T>::rotate(const ColVec<T>& v) const */
+
+/**
+ * Rotates every column of a 3 x N matrix by a unit quaternion.
+ * The quaternion is converted to a rotation matrix once, so each point costs 9 multiply-adds.
+ * An ORCA_BAD_DIMENSIONS exception is thrown should the matrix not have 3 rows
+ * @param points Points, one per column
+ * @return Rotated points
+ */
+
+template <class T>
+Mat<T> Quaternion<T>::rotate(const Mat<T>& points) const {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (points.rows() != 3) {
+        throw ORCAExcept::BadDimensionsError(); // Points must be stored one per column
+    }
+#endif
+    if (!points.isDense()) {
+        return this->rotate(Mat<T>(points)); // Views are materialized first
+    }
+    const Mat<T, 3, 3> rotation = this->toRotationMatrix();
+    const T* m = rotation.data();
+    const T m0 = m[0], m1 = m[1], m2 = m[2], m3 = m[3], m4 = m[4], m5 = m[5], m6 = m[6], m7 = m[7], m8 = m[8];
+    const index_t n = points.cols();
+    Mat<T> result(3, n);
+    const T* x = points.data();
+    const T* y = x + points.stride();
+    const T* z = y + points.stride();
+    T* out = result.data();
+    T* outX = out;
+    T* outY = out + result.stride();
+    T* outZ = outY + result.stride();
+    _parallelFor(0, n, 9 * n, [&](index_t first, index_t last) {
+        index_t i;
+        for (i = first; i < last; ++i) {
+            const T px = x[i], py = y[i], pz = z[i];
+            outX[i] = (m0 * px) + (m1 * py) + (m2 * pz);
+            outY[i] = (m3 * px) + (m4 * py) + (m5 * pz);
+            outZ[i] = (m6 * px) + (m7 * py) + (m8 * pz);
+        }
+    });
+    return result;
+} /* Mat<T> Quaternion<T>::rotate(const Mat<T>& points) const */
+
+/* Below are nonmember functions for rotations */
+
+/**
+ * Returns the rotation matrix of a quaternion
+ * @param q Quaternion
+ */
+
+template <class T>
+Mat<T, 3, 3> toRotationMatrix(const Quaternion<T>& q) {
+    return q.toRotationMatrix();
+} /* Mat<T, 3, 3> toRotationMatrix(const Quaternion<T>& q) */
+
+/**
+ * Returns the unit quaternion of a rotation matrix
+ * @param m Proper orthogonal matrix
+ */
+
+template <class T>
+Quaternion<T> fromRotationMatrix(const Mat<T, 3, 3>& m) {
+    return Quaternion<T>::fromRotationMatrix(m);
+} /* Quaternion<T> fromRotationMatrix(const Mat<T, 3, 3>& m) */
+
+} /* namespace ORCA */
+
+#endif /* Rotation_h */
@@ -0,0 +1,758 @@
+//
+//  Serialize.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef Serialize_h
+#define Serialize_h
+
+/* Includes for Serialize.h */
+
+#include "Except.h"     // Included for ORCA Exceptions
+#include "Mat.h"        // Included for Mat class
+#include "FixedMat.h"   // Included for fixed size Mat class
+#include "MatView.h"    // Included for views of mapped files
+#include <cstddef>      // Included for offsetof
+#include <cstdint>      // Included for fixed width header fields
+#include <cstdio>       // Included for std::FILE
+#include <cstring>      // Included for std::memcmp
+#include <new>          // Included for aligned operator new
+#include <string>       // Included for file paths
+#include <type_traits>  // Included for std::enable_if
+#include <utility>      // Included for std::swap
+#include <vector>       // Included for row buffers
+
+#if !defined(ORCA_DISABLE_MMAP) && (defined(__unix__) || defined(__APPLE__))
+#define ORCA_HAS_MMAP
+#include <fcntl.h>      // Included for open
+#include <sys/mman.h>   // Included for mmap
+#include <sys/stat.h>   // Included for fstat
+#include <unistd.h>     // Included for close
+#endif
+
+namespace ORCA {
+
+/*
+ * ORCA matrix files hold one or more records of the same element type and shape. A 128 byte
+ * header is followed by the records, each starting on a 64 byte boundary. Element (row, col)
+ * of record k is the element at dataOffset + (k * recordStride + row * rowStride + col * colStride)
+ * elements. Files are written in the byte order of the machine writing them, and readers refuse
+ * files written with another byte order
+ */
+
+/* Element type codes stored in the header. Types without a code cannot be written */
+
+template <class T> struct _fileType { static constexpr uint32_t code = 0; };
+template <> struct _fileType<float> { static constexpr uint32_t code = 1; };
+template <> struct _fileType<double> { static constexpr uint32_t code = 2; };
+template <> struct _fileType<int> { static constexpr uint32_t code = 3; };
+template <> struct _fileType<long long> { static constexpr uint32_t code = 4; };
+
+constexpr uint32_t _fileVersion = 1;            // Format version written by this header
+constexpr uint32_t _fileByteOrder = 0x01020304; // Reads back differently on a machine of the other byte order
+constexpr int64_t _fileAlignment = 64;          // Byte alignment of every record
+
+/**
+ * Header at the start of every ORCA matrix file
+ */
+
+struct _FileHeader {
+    char magic[8];          // "ORCAMAT" and a terminating null
+    uint32_t version;       // Format version
+    uint32_t byteOrder;     // _fileByteOrder in the byte order of the writer
+    uint32_t type;          // Element type code
+    uint32_t elementSize;   // Bytes per element
+    int64_t rows;           // Rows of each record
+    int64_t cols;           // Columns of each record
+    int64_t rowStride;      // Elements between consecutive rows of a record
+    int64_t colStride;      // Elements between consecutive columns of a record
+    int64_t recordStride;   // Elements between the starts of consecutive records
+    int64_t count;          // Number of complete records
+    int64_t dataOffset;     // Bytes from the start of the file to the first record
+    int64_t alignment;      // Byte alignment of the first record and of the record stride
+    uint8_t reserved[40];   // Zero, pads the header to 128 bytes
+};
+
+static_assert(sizeof(_FileHeader) == 128, "ORCA matrix file headers are 128 bytes");
+
+/**
+ * Returns the header of a file of dense rows x cols records of type T, holding no records yet
+ * @param rows Rows of each record
+ * @param cols Columns of each record
+ */
+
+template <class T>
+_FileHeader _fileHeader(index_t rows, index_t cols) {
+    static_assert(_fileType<T>::code != 0, "ORCA matrix files hold float, double, int or long long elements");
+    static_assert(_fileAlignment % sizeof(T) == 0, "Records must stay aligned to whole elements");
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if ((rows < 0) || (cols < 0)) {
+        throw ORCAExcept::BadDimensionsError(); // Negative dimensions
+    }
+#endif
+#ifndef ORCA_DISABLE_EMPTY_CHECKS
+    if ((rows == 0) || (cols == 0)) {
+        throw ORCAExcept::EmptyElementError(); // Records must hold elements
+    }
+#endif
+    _FileHeader header = {};
+    std::memcpy(header.magic, "ORCAMAT", 8);
+    header.version = _fileVersion;
+    header.byteOrder = _fileByteOrder;
+    header.type = _fileType<T>::code;
+    header.elementSize = sizeof(T);
+    header.rows = rows;
+    header.cols = cols;
+    header.rowStride = cols;
+    header.colStride = 1;
+    const int64_t recordBytes = rows * cols * static_cast<int64_t>(sizeof(T));
+    header.recordStride = ((recordBytes + _fileAlignment - 1) / _fileAlignment) * _fileAlignment / static_cast<int64_t>(sizeof(T));
+    header.count = 0;
+    header.dataOffset = sizeof(_FileHeader);
+    header.alignment = _fileAlignment;
+    return header;
+} /* _FileHeader _fileHeader(index_t rows, index_t cols) */
+
+/**
+ * Returns the number of elements spanned by one record, from its first element to its last
+ * @param header Header of the file
+ */
+
+inline int64_t _recordExtent(const _FileHeader& header) {
+    return (header.rows - 1) * header.rowStride + (header.cols - 1) * header.colStride + 1;
+} /* inline int64_t _recordExtent(const _FileHeader& header) */
+
+/**
+ * Checks that a header describes records of type T lying inside a file of the given size.
+ * Throws BadFormatError otherwise
+ * @param header Header read from the start of the file
+ * @param fileBytes Size of the file in bytes
+ */
+
+template <class T>
+void _checkHeader(const _FileHeader& header, int64_t fileBytes) {
+    static_assert(_fileType<T>::code != 0, "ORCA matrix files hold float, double, int or long long elements");
+    const int64_t size = sizeof(T);
+    if ((std::memcmp(header.magic, "ORCAMAT", 8) != 0) || (header.version != _fileVersion) || (header.byteOrder != _fileByteOrder)) {
+        throw ORCAExcept::BadFormatError(); // Not an ORCA matrix file, or written on a machine of the other byte order
+    }
+    if ((header.type != _fileType<T>::code) || (header.elementSize != size)) {
+        throw ORCAExcept::BadFormatError(); // Records hold another element type
+    }
+    if ((header.rows <= 0) || (header.cols <= 0) || (header.rowStride < 0) || (header.colStride < 0) || (header.count < 0)) {
+        throw ORCAExcept::BadFormatError(); // Corrupt shape
+    }
+    if ((header.dataOffset < static_cast<int64_t>(sizeof(_FileHeader))) || (header.dataOffset % size != 0) || (header.recordStride < _recordExtent(header))) {
+        throw ORCAExcept::BadFormatError(); // Records overlap the header or each other
+    }
+    if ((header.count > 0) && (header.dataOffset + ((header.count - 1) * header.recordStride + _recordExtent(header)) * size > fileBytes)) {
+        throw ORCAExcept::BadFormatError(); // File is shorter than its records
+    }
+} /* void _checkHeader(const _FileHeader& header, int64_t fileBytes) */
+
+/**
+ * Writes bytes to a file, throwing FileError when they cannot all be written
+ * @param file Open file
+ * @param data Bytes to write
+ * @param bytes Number of bytes
+ */
+
+inline void _writeBytes(std::FILE* file, const void* data, std::size_t bytes) {
+    if (std::fwrite(data, 1, bytes, file) != bytes) {
+        throw ORCAExcept::FileError(); // Disk full or file closed
+    }
+} /* inline void _writeBytes(std::FILE* file, const void* data, std::size_t bytes) */
+
+/**
+ * Reads bytes from a file, throwing BadFormatError when the file ends first
+ * @param file Open file
+ * @param data Receives the bytes
+ * @param bytes Number of bytes
+ */
+
+inline void _readBytes(std::FILE* file, void* data, std::size_t bytes) {
+    if (std::fread(data, 1, bytes, file) != bytes) {
+        throw ORCAExcept::BadFormatError(); // File is shorter than its header says
+    }
+} /* inline void _readBytes(std::FILE* file, void* data, std::size_t bytes) */
+
+/**
+ * Moves to a byte offset of a file, throwing FileError when it cannot
+ * @param file Open file
+ * @param offset Bytes from the start of the file
+ */
+
+inline void _seekFile(std::FILE* file, int64_t offset) {
+    if (std::fseek(file, static_cast<long>(offset), SEEK_SET) != 0) {
+        throw ORCAExcept::FileError(); // Offset outside the file
+    }
+} /* inline void _seekFile(std::FILE* file, int64_t offset) */
+
+/**
+ * Opens a file and reads its header, checking it describes records of type T.
+ * The file is left positioned after the header
+ * @param path Path of the file
+ * @param mode Mode for std::fopen
+ * @param header Receives the header
+ */
+
+template <class T>
+std::FILE* _openMatFile(const std::string& path, const char* mode, _FileHeader& header) {
+    std::FILE* file = std::fopen(path.c_str(), mode);
+    if (file == nullptr) {
+        throw ORCAExcept::FileError(); // Missing or unreadable file
+    }
+    try {
+        _seekFile(file, 0);
+        std::fseek(file, 0, SEEK_END);
+        const int64_t fileBytes = std::ftell(file);
+        _seekFile(file, 0);
+        _readBytes(file, &header, sizeof(_FileHeader));
+        _checkHeader<T>(header, fileBytes);
+    } catch (...) {
+        std::fclose(file);
+        throw;
+    }
+    return file;
+} /* std::FILE* _openMatFile(const std::string& path, const char* mode, _FileHeader& header) */
+
+/**
+ * Streams records of one shape to an ORCA matrix file, for logging a time series of matrices.
+ * Records are appended as they arrive. The record count in the header is rewritten by flush()
+ * and close(), so readers and mappings see the records written up to the last flush, and a log
+ * cut short by a crash still loads up to that point
+ * @tparam T Element type, one of float, double, int or long long
+ */
+
+template <class T>
+class MatWriter {
+protected:
+    /* Below are protected members of the MatWriter class */
+    std::FILE* _file = nullptr;     // Open file, nullptr once closed
+    _FileHeader _header;            // Header of the file, count includes records not yet flushed
+    std::vector<T> _buffer;         // Gathers rows that are not contiguous in memory
+
+    /**
+     * Writes the elements of one record and the padding up to the next record
+     * @param read Function returning element (row, col) of the record
+     * @param rowData Function returning the address of a contiguous row, or nullptr
+     */
+
+    template <class R, class D>
+    void _writeRecord(R read, D rowData) {
+        const index_t rows = this->_header.rows;
+        const index_t cols = this->_header.cols;
+        index_t i, j;
+        for (i = 0; i < rows; ++i) {
+            const T* row = rowData(i);
+            if (row == nullptr) {
+                this->_buffer.resize(cols);
+                for (j = 0; j < cols; ++j) {
+                    this->_buffer[j] = read(i, j);
+                }
+                row = this->_buffer.data();
+            }
+            _writeBytes(this->_file, row, sizeof(T) * cols);
+        }
+        static const unsigned char padding[_fileAlignment] = {};
+        _writeBytes(this->_file, padding, sizeof(T) * (this->_header.recordStride - rows * cols));
+        ++this->_header.count;
+    } /* void _writeRecord(R read, D rowData) */
+
+    /**
+     * Checks that the writer is open and that a record has the shape of the file
+     * @param rows Rows of the record
+     * @param cols Columns of the record
+     */
+
+    void _checkRecord(index_t rows, index_t cols) const {
+        if (this->_file == nullptr) {
+            throw ORCAExcept::FileError(); // Writer already closed
+        }
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((rows != this->_header.rows) || (cols != this->_header.cols)) {
+            throw ORCAExcept::BadDimensionsError(); // Every record of a file has the same shape
+        }
+#endif
+    } /* void _checkRecord(index_t rows, index_t cols) const */
+
+    /**
+     * Closes the file without reporting errors
+     */
+
+    void _release() noexcept {
+        try {
+            this->close();
+        } catch (...) {
+            this->_file = nullptr;
+        }
+    } /* void _release() noexcept */
+
+public:
+
+    /* Below are public constructors for the MatWriter class */
+
+    /**
+     * Creates a file for rows x cols records, replacing any file at the path
+     * @param path Path of the file
+     * @param rows Rows of each record
+     * @param cols Columns of each record
+     */
+
+    MatWriter(const std::string& path, index_t rows, index_t cols) {
+        this->_header = _fileHeader<T>(rows, cols);
+        this->_file = std::fopen(path.c_str(), "wb");
+        if (this->_file == nullptr) {
+            throw ORCAExcept::FileError(); // Directory missing or not writable
+        }
+        try {
+            _writeBytes(this->_file, &this->_header, sizeof(_FileHeader));
+        } catch (...) {
+            std::fclose(this->_file);
+            throw;
+        }
+    } /* MatWriter(const std::string& path, index_t rows, index_t cols) */
+
+    /**
+     * Opens an existing file to append more records of the same shape. Anything after the
+     * last flushed record is overwritten
+     * @param path Path of the file
+     */
+
+    explicit MatWriter(const std::string& path) {
+        this->_file = _openMatFile<T>(path, "r+b", this->_header);
+        try {
+            _seekFile(this->_file, this->_header.dataOffset + this->_header.count * this->_header.recordStride * static_cast<int64_t>(sizeof(T)));
+        } catch (...) {
+            std::fclose(this->_file);
+            throw;
+        }
+    } /* explicit MatWriter(const std::string& path) */
+
+    MatWriter(const MatWriter&) = delete;
+    MatWriter& operator = (const MatWriter&) = delete;
+
+    /**
+     * Move constructor. _other no longer refers to the file
+     * @param _other Writer to move from
+     */
+
+    MatWriter(MatWriter&& _other) noexcept : _file(_other._file), _header(_other._header), _buffer(std::move(_other._buffer)) {
+        _other._file = nullptr;
+    } /* MatWriter(MatWriter&& _other) noexcept */
+
+    /**
+     * Move assignment. Closes the file of this writer first
+     * @param _other Writer to move from
+     */
+
+    MatWriter& operator = (MatWriter&& _other) noexcept {
+        if (this != &_other) {
+            this->_release();
+            std::swap(this->_file, _other._file);
+            this->_header = _other._header;
+            this->_buffer = std::move(_other._buffer);
+        }
+        return *this;
+    } /* MatWriter& operator = (MatWriter&& _other) noexcept */
+
+    /**
+     * Destructor. Records the final count and closes the file, ignoring errors.
+     * Call close() to be told of them
+     */
+
+    ~MatWriter() {
+        this->_release();
+    } /* ~MatWriter() */
+
+    /* Below are public member functions of the MatWriter class */
+
+    /**
+     * Appends a record. Dense rows are written straight from storage
+     * @param mat Matrix with the shape of the file
+     */
+
+    void append(const Mat<T>& mat) {
+        this->_checkRecord(mat.rows(), mat.cols());
+        const T* base = nullptr;
+        index_t rowStride = 0, colStride = 0;
+        const bool stored = mat._layout(base, rowStride, colStride);
+        this->_writeRecord([&](index_t row, index_t col) {
+            return stored ? base[row * rowStride + col * colStride] : mat.at(row, col);
+        }, [&](index_t row) {
+            return (stored && (colStride == 1)) ? base + row * rowStride : nullptr;
+        });
+    } /* void append(const Mat<T>& mat) */
+
+    /**
+     * Appends a fixed size record
+     * @param mat Matrix with the shape of the file
+     */
+
+    template <index_t R, index_t C, class = std::enable_if_t<(R != ORCA_DYNAMIC) && (C != ORCA_DYNAMIC)>>
+    void append(const Mat<T, R, C>& mat) {
+        this->_checkRecord(R, C);
+        const T* data = mat.data();
+        this->_writeRecord([&](index_t row, index_t col) { return data[row * C + col]; }, [&](index_t row) { return data + row * C; });
+    } /* void append(const Mat<T, R, C>& mat) */
+
+    /**
+     * Appends a record from a dense row-major buffer
+     * @param data Address of element (0, 0), rows() * cols() elements
+     */
+
+    void append(const T* data) {
+        this->_checkRecord(this->_header.rows, this->_header.cols);
+        const index_t cols = this->_header.cols;
+        this->_writeRecord([&](index_t row, index_t col) { return data[row * cols + col]; }, [&](index_t row) { return data + row * cols; });
+    } /* void append(const T* data) */
+
+    /**
+     * Rewrites the record count in the header and flushes the file, so readers see every
+     * record appended so far
+     */
+
+    void flush() {
+        if (this->_file == nullptr) {
+            throw ORCAExcept::FileError(); // Writer already closed
+        }
+        const int64_t end = this->_header.dataOffset + this->_header.count * this->_header.recordStride * static_cast<int64_t>(sizeof(T));
+        _seekFile(this->_file, offsetof(_FileHeader, count));
+        _writeBytes(this->_file, &this->_header.count, sizeof(this->_header.count));
+        _seekFile(this->_file, end);
+        if (std::fflush(this->_file) != 0) {
+            throw ORCAExcept::FileError(); // Disk full
+        }
+    } /* void flush() */
+
+    /**
+     * Flushes and closes the file. The writer cannot append afterwards
+     */
+
+    void close() {
+        if (this->_file == nullptr) {
+            return;
+        }
+        try {
+            this->flush();
+        } catch (...) {
+            std::fclose(this->_file);
+            this->_file = nullptr;
+            throw;
+        }
+        const int status = std::fclose(this->_file);
+        this->_file = nullptr;
+        if (status != 0) {
+            throw ORCAExcept::FileError(); // Final write failed
+        }
+    } /* void close() */
+
+    /**
+     * Returns the number of records appended, including those not flushed yet
+     */
+
+    index_t count() const {
+        return this->_header.count;
+    } /* index_t count() const */
+
+    /**
+     * Returns the number of rows of each record
+     */
+
+    index_t rows() const {
+        return this->_header.rows;
+    } /* index_t rows() const */
+
+    /**
+     * Returns the number of columns of each record
+     */
+
+    index_t cols() const {
+        return this->_header.cols;
+    } /* index_t cols() const */
+
+}; /* class MatWriter */
+
+/**
+ * Read-only mapping of an ORCA matrix file. Records are returned as views of the mapped pages,
+ * so opening a file costs the same however large it is, and elements are paged in from the
+ * file cache as they are first read. Every record starts on a 64 byte boundary.
+ * The file is mapped copy-on-write: writing through a view changes the memory of this mapping
+ * only, never the file. Views must not outlive the mapping.
+ * Where mmap is unavailable, or ORCA_DISABLE_MMAP is defined, the file is read into memory instead
+ * @tparam T Element type, one of float, double, int or long long
+ */
+
+template <class T>
+class MappedMat {
+protected:
+    /* Below are protected members of the MappedMat class */
+    void* _memory = nullptr;    // Start of the mapped or loaded file
+    std::size_t _bytes = 0;     // Size of the file
+    _FileHeader _header;        // Header of the file
+    T* _records = nullptr;      // Address of the first element of the first record
+
+    /**
+     * Unmaps or frees the file
+     */
+
+    void _release() noexcept {
+        if (this->_memory == nullptr) {
+            return;
+        }
+#ifdef ORCA_HAS_MMAP
+        munmap(this->_memory, this->_bytes);
+#else
+        ::operator delete(this->_memory, std::align_val_t(_fileAlignment));
+#endif
+        this->_memory = nullptr;
+        this->_records = nullptr;
+    } /* void _release() noexcept */
+
+public:
+
+    /* Below are public constructors for the MappedMat class */
+
+    /**
+     * Maps a file. Only the header is read
+     * @param path Path of the file
+     */
+
+    explicit MappedMat(const std::string& path) {
+#ifdef ORCA_HAS_MMAP
+        const int descriptor = open(path.c_str(), O_RDONLY);
+        if (descriptor < 0) {
+            throw ORCAExcept::FileError(); // Missing or unreadable file
+        }
+        struct stat info;
+        if (fstat(descriptor, &info) != 0) {
+            ::close(descriptor);
+            throw ORCAExcept::FileError(); // Unreadable file
+        }
+        if (info.st_size < static_cast<off_t>(sizeof(_FileHeader))) {
+            ::close(descriptor);
+            throw ORCAExcept::BadFormatError(); // Too short to hold a header
+        }
+        this->_bytes = static_cast<std::size_t>(info.st_size);
+        void* memory = mmap(nullptr, this->_bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, descriptor, 0);
+        ::close(descriptor); // The mapping keeps the file open
+        if (memory == MAP_FAILED) {
+            throw ORCAExcept::FileError(); // Not a regular file, or out of address space
+        }
+        this->_memory = memory;
+#else
+        std::FILE* file = std::fopen(path.c_str(), "rb");
+        if (file == nullptr) {
+            throw ORCAExcept::FileError(); // Missing or unreadable file
+        }
+        std::fseek(file, 0, SEEK_END);
+        const long size = std::ftell(file);
+        if (size < static_cast<long>(sizeof(_FileHeader))) {
+            std::fclose(file);
+            throw ORCAExcept::BadFormatError(); // Too short to hold a header
+        }
+        this->_bytes = static_cast<std::size_t>(size);
+        this->_memory = ::operator new(this->_bytes, std::align_val_t(_fileAlignment));
+        std::fseek(file, 0, SEEK_SET);
+        const std::size_t read = std::fread(this->_memory, 1, this->_bytes, file);
+        std::fclose(file);
+        if (read != this->_bytes) {
+            this->_release();
+            throw ORCAExcept::FileError(); // File changed while reading
+        }
+#endif
+        std::memcpy(&this->_header, this->_memory, sizeof(_FileHeader));
+        try {
+            _checkHeader<T>(this->_header, static_cast<int64_t>(this->_bytes));
+        } catch (...) {
+            this->_release();
+            throw;
+        }
+        this->_records = reinterpret_cast<T*>(static_cast<unsigned char*>(this->_memory) + this->_header.dataOffset);
+    } /* explicit MappedMat(const std::string& path) */
+
+    MappedMat(const MappedMat&) = delete;
+    MappedMat& operator = (const MappedMat&) = delete;
+
+    /**
+     * Move constructor. Views of _other stay valid and now belong to this mapping
+     * @param _other Mapping to move from
+     */
+
+    MappedMat(MappedMat&& _other) noexcept : _memory(_other._memory), _bytes(_other._bytes), _header(_other._header), _records(_other._records) {
+        _other._memory = nullptr;
+        _other._records = nullptr;
+    } /* MappedMat(MappedMat&& _other) noexcept */
+
+    /**
+     * Move assignment. Unmaps the file of this mapping first
+     * @param _other Mapping to move from
+     */
+
+    MappedMat& operator = (MappedMat&& _other) noexcept {
+        if (this != &_other) {
+            this->_release();
+            std::swap(this->_memory, _other._memory);
+            std::swap(this->_records, _other._records);
+            this->_bytes = _other._bytes;
+            this->_header = _other._header;
+        }
+        return *this;
+    } /* MappedMat& operator = (MappedMat&& _other) noexcept */
+
+    /**
+     * Destructor. Unmaps the file, invalidating every view
+     */
+
+    ~MappedMat() {
+        this->_release();
+    } /* ~MappedMat() */
+
+    /* Below are public member functions of the MappedMat class */
+
+    /**
+     * Returns a view of one record, reading the mapped file directly
+     * @param record Record index
+     */
+
+    MatView<T> view(index_t record) const {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if ((record < 0) || (record >= this->_header.count)) {
+            throw ORCAExcept::OutOfBoundsError(); // Past the last flushed record
+        }
+#endif
+        return MatView<T>(this->_records + record * this->_header.recordStride, this->_header.rows, this->_header.cols, this->_header.rowStride, this->_header.colStride);
+    } /* MatView<T> view(index_t record) const */
+
+    /**
+     * Returns a view of one record, reading the mapped file directly
+     * @param record Record index
+     */
+
+    MatView<T> operator [] (index_t record) const {
+        return this->view(record);
+    } /* MatView<T> operator [] (index_t record) const */
+
+    /**
+     * Returns a count() x (rows() * cols()) view holding each record flattened into one row,
+     * such as the history of a logged vector. Records must be stored with contiguous rows
+     */
+
+    MatView<T> series() const {
+#ifndef ORCA_DISABLE_EMPTY_CHECKS
+        if (this->_header.count == 0) {
+            throw ORCAExcept::EmptyElementError(); // No records to view
+        }
+#endif
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((this->_header.colStride != 1) || ((this->_header.rows > 1) && (this->_header.rowStride != this->_header.cols))) {
+            throw ORCAExcept::BadDimensionsError(); // Records cannot be flattened in place
+        }
+#endif
+        return MatView<T>(this->_records, this->_header.count, this->_header.rows * this->_header.cols, this->_header.recordStride, 1);
+    } /* MatView<T> series() const */
+
+    /**
+     * Returns the number of records in the file
+     */
+
+    index_t count() const {
+        return this->_header.count;
+    } /* index_t count() const */
+
+    /**
+     * Returns the number of rows of each record
+     */
+
+    index_t rows() const {
+        return this->_header.rows;
+    } /* index_t rows() const */
+
+    /**
+     * Returns the number of columns of each record
+     */
+
+    index_t cols() const {
+        return this->_header.cols;
+    } /* index_t cols() const */
+
+}; /* class MappedMat */
+
+/* Below are functions for saving and loading single matrices */
+
+/**
+ * Writes a matrix to a new ORCA matrix file, replacing any file at the path.
+ * Elements are stored in binary, so loading gives back exactly the same values
+ * @param path Path of the file
+ * @param mat Matrix to write, views are written by their elements
+ */
+
+template <class T>
+void save(const std::string& path, const Mat<T>& mat) {
+    MatWriter<T> writer(path, mat.rows(), mat.cols());
+    writer.append(mat);
+    writer.close();
+} /* void save(const std::string& path, const Mat<T>& mat) */
+
+/**
+ * Writes a fixed size matrix to a new ORCA matrix file, replacing any file at the path
+ * @param path Path of the file
+ * @param mat Matrix to write
+ */
+
+template <class T, index_t R, index_t C, class = std::enable_if_t<(R != ORCA_DYNAMIC) && (C != ORCA_DYNAMIC)>>
+void save(const std::string& path, const Mat<T, R, C>& mat) {
+    MatWriter<T> writer(path, R, C);
+    writer.append(mat);
+    writer.close();
+} /* void save(const std::string& path, const Mat<T, R, C>& mat) */
+
+/**
+ * Reads one record of an ORCA matrix file into a new matrix. Use MappedMat to read large
+ * files without copying them
+ * @tparam T Element type stored in the file
+ * @param path Path of the file
+ * @param record Record index, the first record by default
+ */
+
+template <class T>
+Mat<T> load(const std::string& path, index_t record = 0) {
+    _FileHeader header;
+    std::FILE* file = _openMatFile<T>(path, "rb", header);
+    try {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if ((record < 0) || (record >= header.count)) {
+            throw ORCAExcept::OutOfBoundsError(); // Past the last flushed record
+        }
+#endif
+        _seekFile(file, header.dataOffset + record * header.recordStride * static_cast<int64_t>(sizeof(T)));
+        Mat<T> result(header.rows, header.cols);
+        T* data = result.data();
+        const index_t stride = result.stride();
+        if ((header.colStride == 1) && (header.rowStride == header.cols) && (stride == header.cols)) {
+            _readBytes(file, data, sizeof(T) * header.rows * header.cols); // Dense rows read in one call
+        } else {
+            std::vector<T> buffer(_recordExtent(header));
+            _readBytes(file, buffer.data(), sizeof(T) * buffer.size());
+            index_t i, j;
+            for (i = 0; i < header.rows; ++i) {
+                for (j = 0; j < header.cols; ++j) {
+                    data[i * stride + j] = buffer[i * header.rowStride + j * header.colStride];
+                }
+            }
+        }
+        std::fclose(file);
+        return result;
+    } catch (...) {
+        std::fclose(file);
+        throw;
+    }
+} /* Mat<T> load(const std::string& path, index_t record = 0) */
+
+} /* namespace ORCA */
+
+#endif /* Serialize_h */
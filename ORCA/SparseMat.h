@@ -0,0 +1,534 @@
+//
+//  SparseMat.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef SparseMat_h
+#define SparseMat_h
+
+/* Includes for SparseMat.h */
+
+#include "Except.h"     // Included for ORCA Exceptions
+#include "Fill.h"       // Included for Fill types
+#include "Mat.h"        // Included for Mat class
+#include "Vec.h"        // Included for ColVec class
+#include "Parallel.h"   // Included for threaded sparse products
+#include <algorithm>    // Included for std::sort and std::lower_bound
+#include <vector>       // Included for compressed storage
+
+namespace ORCA {
+
+/**
+ * One entry of a sparse matrix, used to build a SparseMat
+ * @tparam T Element type
+ */
+
+template <class T>
+struct Triplet {
+    index_t row;    // Row of the entry
+    index_t col;    // Column of the entry
+    T value;        // Value of the entry
+}; /* struct Triplet */
+
+template <class T>
+class SparseTr;
+
+/**
+ * Sparse matrix in compressed sparse row (CSR) format.
+ * Row i holds the entries _values[_rowStart[i] .. _rowStart[i + 1]) in columns _colIndex[...],
+ * sorted by column. Products with dense matrices and vectors cost O(nonZeros) per column of
+ * the dense operand. t() returns a transposed view, which reads the same arrays in compressed
+ * sparse column order, so A.t() * x never materializes the transpose
+ * @tparam T Element type
+ */
+
+template <class T>
+class SparseMat {
+private:
+    /* Below are private members of the SparseMat class */
+    index_t _n_rows = 0;                // Number of rows
+    index_t _n_cols = 0;                // Number of columns
+    std::vector<index_t> _rowStart;     // Offset of the first entry of each row, plus the total at the end
+    std::vector<index_t> _colIndex;     // Column of each entry
+    std::vector<T> _values;             // Value of each entry
+
+    /**
+     * Checks and stores the dimensions and sets every row empty
+     */
+
+    void _initialize(index_t rows, index_t cols) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if ((rows < 0) || (cols < 0)) {
+            throw ORCAExcept::BadDimensionsError(); // Negative dimensions
+        }
+#endif
+#ifndef ORCA_DISABLE_EMPTY_CHECKS
+        if ((rows == 0) || (cols == 0)) {
+            throw ORCAExcept::EmptyElementError(); // Zero rows or columns
+        }
+#endif
+        this->_n_rows = rows;
+        this->_n_cols = cols;
+        this->_rowStart.assign(static_cast<std::size_t>(rows) + 1, 0);
+    } /* void _initialize(index_t rows, index_t cols) */
+
+public:
+
+    /* Below are public constructors for the SparseMat class */
+
+    /**
+     * Constructs a matrix of the given size from a list of entries.
+     * Entries may be in any order; entries at the same position are summed.
+     * An ORCA_OUT_OF_BOUNDS exception is thrown should an entry lie outside the matrix
+     * @param rows Number of rows
+     * @param cols Number of columns
+     * @param entries Entries of the matrix
+     */
+
+    SparseMat(index_t rows, index_t cols, const std::vector<Triplet<T>>& entries) {
+        this->_initialize(rows, cols);
+        std::vector<Triplet<T>> sorted(entries);
+        for (const Triplet<T>& entry : sorted) {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+            if ((entry.row < 0) || (entry.row >= rows) || (entry.col < 0) || (entry.col >= cols)) {
+                throw ORCAExcept::OutOfBoundsError(); // Entry outside the matrix
+            }
+#endif
+        }
+        std::sort(sorted.begin(), sorted.end(), [](const Triplet<T>& a, const Triplet<T>& b) {
+            return (a.row < b.row) || ((a.row == b.row) && (a.col < b.col));
+        });
+        this->_colIndex.reserve(sorted.size());
+        this->_values.reserve(sorted.size());
+        index_t last = -1;
+        for (const Triplet<T>& entry : sorted) {
+            const index_t position = entry.row * cols + entry.col;
+            if (position == last) {
+                this->_values.back() = this->_values.back() + entry.value; // Duplicate entry
+                continue;
+            }
+            last = position;
+            this->_colIndex.push_back(entry.col);
+            this->_values.push_back(entry.value);
+            ++this->_rowStart[entry.row + 1];
+        }
+        index_t i;
+        for (i = 0; i < rows; ++i) {
+            this->_rowStart[i + 1] += this->_rowStart[i];
+        }
+    } /* SparseMat(index_t rows, index_t cols, const std::vector<Triplet<T>>& entries) */
+
+    /**
+     * Constructs a sparse copy of a dense matrix, dropping entries whose magnitude is at most tolerance
+     * @param dense Dense matrix
+     * @param tolerance Largest magnitude treated as zero
+     */
+
+    explicit SparseMat(const Mat<T>& dense, T tolerance = T(0)) {
+        this->_initialize(dense.rows(), dense.cols());
+        index_t i, j;
+        for (i = 0; i < this->_n_rows; ++i) {
+            for (j = 0; j < this->_n_cols; ++j) {
+                const T value = dense.at(i, j);
+                if ((value > tolerance) || (-value > tolerance)) {
+                    this->_colIndex.push_back(j);
+                    this->_values.push_back(value);
+                }
+            }
+            this->_rowStart[i + 1] = static_cast<index_t>(this->_values.size());
+        }
+    } /* explicit SparseMat(const Mat<T>& dense, T tolerance) */
+
+    /* Below are public getters for the SparseMat class */
+
+    /**
+     * Returns the number of rows in the matrix
+     */
+
+    index_t rows() const {
+        return this->_n_rows;
+    } /* index_t rows() const */
+
+    /**
+     * Returns the number of columns in the matrix
+     */
+
+    index_t cols() const {
+        return this->_n_cols;
+    } /* index_t cols() const */
+
+    /**
+     * Returns the number of stored entries
+     */
+
+    index_t nonZeros() const {
+        return static_cast<index_t>(this->_values.size());
+    } /* index_t nonZeros() const */
+
+    /**
+     * Returns the element at the specified index, zero if it is not stored
+     * @param row Element Row Index
+     * @param col Element Column Index
+     */
+
+    T at(index_t row, index_t col) const {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if ((row < 0) || (row >= this->_n_rows) || (col < 0) || (col >= this->_n_cols)) {
+            throw ORCAExcept::OutOfBoundsError(); // Either negative indexing or over indexing
+        }
+#endif
+        const index_t* first = this->_colIndex.data() + this->_rowStart[row];
+        const index_t* last = this->_colIndex.data() + this->_rowStart[row + 1];
+        const index_t* found = std::lower_bound(first, last, col);
+        if ((found == last) || (*found != col)) {
+            return T(0);
+        }
+        return this->_values[found - this->_colIndex.data()];
+    } /* T at(index_t row, index_t col) const */
+
+    /**
+     * Returns the row offsets of the compressed storage, rows() + 1 entries
+     */
+
+    const index_t* rowStart() const {
+        return this->_rowStart.data();
+    } /* const index_t* rowStart() const */
+
+    /**
+     * Returns the column of every stored entry
+     */
+
+    const index_t* colIndex() const {
+        return this->_colIndex.data();
+    } /* const index_t* colIndex() const */
+
+    /**
+     * Returns the value of every stored entry
+     */
+
+    const T* values() const {
+        return this->_values.data();
+    } /* const T* values() const */
+
+    /* Below are public member functions of the SparseMat class */
+
+    /**
+     * Returns a transposed view of the matrix. No entries are copied
+     */
+
+    SparseTr<T> t() const {
+        return SparseTr<T>(this);
+    } /* SparseTr<T> t() const */
+
+    /**
+     * Returns a dense copy of the matrix
+     */
+
+    Mat<T> dense() const {
+        Mat<T> result(this->_n_rows, this->_n_cols, fill::zeros);
+        T* c = result.data();
+        const index_t ldc = result.stride();
+        index_t i, e;
+        for (i = 0; i < this->_n_rows; ++i) {
+            for (e = this->_rowStart[i]; e < this->_rowStart[i + 1]; ++e) {
+                c[i * ldc + this->_colIndex[e]] = this->_values[e];
+            }
+        }
+        return result;
+    } /* Mat<T> dense() const */
+
+    /* Below are the product kernels used by the SparseMat operators */
+
+    /**
+     * Computes C = A * B for a dense row-major B (p columns) into a dense row-major C.
+     * Rows of C are independent and are split across threads
+     */
+
+    void _multiply(const T* b, index_t ldb, index_t p, T* c, index_t ldc) const {
+        _parallelFor(0, this->_n_rows, this->nonZeros() * p, [&](index_t first, index_t last) {
+            index_t i, e, j;
+            if (p == 1) {
+                /* Vector products accumulate each row in a register */
+                for (i = first; i < last; ++i) {
+                    T sum = T(0);
+                    for (e = this->_rowStart[i]; e < this->_rowStart[i + 1]; ++e) {
+                        sum = sum + this->_values[e] * b[this->_colIndex[e] * ldb];
+                    }
+                    c[i * ldc] = sum;
+                }
+                return;
+            }
+            for (i = first; i < last; ++i) {
+                T* row = c + i * ldc;
+                for (j = 0; j < p; ++j) {
+                    row[j] = T(0);
+                }
+                for (e = this->_rowStart[i]; e < this->_rowStart[i + 1]; ++e) {
+                    const T value = this->_values[e];
+                    const T* source = b + this->_colIndex[e] * ldb;
+                    for (j = 0; j < p; ++j) {
+                        row[j] = row[j] + value * source[j];
+                    }
+                }
+            }
+        });
+    } /* void _multiply(const T* b, index_t ldb, index_t p, T* c, index_t ldc) const */
+
+    /**
+     * Computes C = At * B for a dense row-major B (p columns) into a dense row-major C.
+     * Each row of A is scattered into the rows of C it contributes to, so the transpose is never formed
+     */
+
+    void _multiplyTransposed(const T* b, index_t ldb, index_t p, T* c, index_t ldc) const {
+        index_t i, e, j;
+        for (i = 0; i < this->_n_cols; ++i) {
+            T* row = c + i * ldc;
+            for (j = 0; j < p; ++j) {
+                row[j] = T(0);
+            }
+        }
+        for (i = 0; i < this->_n_rows; ++i) {
+            const T* source = b + i * ldb;
+            for (e = this->_rowStart[i]; e < this->_rowStart[i + 1]; ++e) {
+                const T value = this->_values[e];
+                T* row = c + this->_colIndex[e] * ldc;
+                for (j = 0; j < p; ++j) {
+                    row[j] = row[j] + value * source[j];
+                }
+            }
+        }
+    } /* void _multiplyTransposed(const T* b, index_t ldb, index_t p, T* c, index_t ldc) const */
+
+    /**
+     * Computes C = B * A for a dense row-major B (m rows) into a dense row-major C.
+     * Each element of B scales one sparse row of A; rows of C are split across threads
+     */
+
+    void _multiplyLeft(const T* b, index_t ldb, index_t m, T* c, index_t ldc) const {
+        _parallelFor(0, m, this->nonZeros() * m, [&](index_t first, index_t last) {
+            index_t i, k, e, j;
+            for (i = first; i < last; ++i) {
+                T* row = c + i * ldc;
+                for (j = 0; j < this->_n_cols; ++j) {
+                    row[j] = T(0);
+                }
+                const T* source = b + i * ldb;
+                for (k = 0; k < this->_n_rows; ++k) {
+                    const T scale = source[k];
+                    for (e = this->_rowStart[k]; e < this->_rowStart[k + 1]; ++e) {
+                        row[this->_colIndex[e]] = row[this->_colIndex[e]] + scale * this->_values[e];
+                    }
+                }
+            }
+        });
+    } /* void _multiplyLeft(const T* b, index_t ldb, index_t m, T* c, index_t ldc) const */
+
+}; /* class SparseMat */
+
+/**
+ * Transposed view of a sparse matrix. Holds a pointer to the matrix, which must outlive the view
+ * @tparam T Element type
+ */
+
+template <class T>
+class SparseTr {
+private:
+    const SparseMat<T>* _matrix;    // Matrix this is the transpose of
+public:
+
+    /**
+     * Constructor from pointer to matrix
+     * @param matrix Address of matrix
+     */
+
+    explicit SparseTr(const SparseMat<T>* matrix) : _matrix(matrix) {}
+
+    /**
+     * Returns the number of rows of the transpose
+     */
+
+    index_t rows() const {
+        return this->_matrix->cols();
+    } /* index_t rows() const */
+
+    /**
+     * Returns the number of columns of the transpose
+     */
+
+    index_t cols() const {
+        return this->_matrix->rows();
+    } /* index_t cols() const */
+
+    /**
+     * Returns the element at the specified index of the transpose
+     */
+
+    T at(index_t row, index_t col) const {
+        return this->_matrix->at(col, row);
+    } /* T at(index_t row, index_t col) const */
+
+    /**
+     * Returns the matrix this is the transpose of
+     */
+
+    const SparseMat<T>& t() const {
+        return *this->_matrix;
+    } /* const SparseMat<T>& t() const */
+
+    /**
+     * Returns a dense copy of the transpose
+     */
+
+    Mat<T> dense() const {
+        return Mat<T>(this->_matrix->dense().t());
+    } /* Mat<T> dense() const */
+
+}; /* class SparseTr */
+
+/* Sparse matrices are not scalars to the element-wise operators of Mat */
+
+template <class T>
+struct _matrixLike<SparseMat<T>> : std::true_type {};
+
+template <class T>
+struct _matrixLike<SparseTr<T>> : std::true_type {};
+
+/* Below are the overloaded math operators for the SparseMat class */
+
+/**
+ * Sparse matrix times dense matrix
+ * @param a Sparse matrix
+ * @param b Dense matrix
+ * @return Dense product
+ */
+
+template <class T>
+Mat<T> operator * (const SparseMat<T>& a, const Mat<T>& b) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (a.cols() != b.rows()) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions do not agree
+    }
+#endif
+    if (!b.isDense()) {
+        return a * Mat<T>(b); // Views are materialized first
+    }
+    Mat<T> result(a.rows(), b.cols());
+    a._multiply(b.data(), b.stride(), b.cols(), result.data(), result.stride());
+    return result;
+} /* Mat<T> operator * (const SparseMat<T>& a, const Mat<T>& b) */
+
+/**
+ * Sparse matrix times dense column vector
+ * @param a Sparse matrix
+ * @param x Dense vector
+ * @return Dense product
+ */
+
+template <class T>
+ColVec<T> operator * (const SparseMat<T>& a, const ColVec<T>& x) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (a.cols() != x.rows()) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions do not agree
+    }
+#endif
+    if (!x.isDense()) {
+        return a * ColVec<T>(x); // Views are materialized first
+    }
+    ColVec<T> result(static_cast<int>(a.rows()));
+    a._multiply(x.data(), x.stride(), 1, result.data(), result.stride());
+    return result;
+} /* ColVec<T> operator * (const SparseMat<T>& a, const ColVec<T>& x) */
+
+/**
+ * Transposed sparse matrix times dense matrix, computed without forming the transpose
+ * @param a Transposed sparse matrix
+ * @param b Dense matrix
+ * @return Dense product
+ */
+
+template <class T>
+Mat<T> operator * (const SparseTr<T>& a, const Mat<T>& b) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (a.cols() != b.rows()) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions do not agree
+    }
+#endif
+    if (!b.isDense()) {
+        return a * Mat<T>(b); // Views are materialized first
+    }
+    Mat<T> result(a.rows(), b.cols());
+    a.t()._multiplyTransposed(b.data(), b.stride(), b.cols(), result.data(), result.stride());
+    return result;
+} /* Mat<T> operator * (const SparseTr<T>& a, const Mat<T>& b) */
+
+/**
+ * Transposed sparse matrix times dense column vector, computed without forming the transpose
+ * @param a Transposed sparse matrix
+ * @param x Dense vector
+ * @return Dense product
+ */
+
+template <class T>
+ColVec<T> operator * (const SparseTr<T>& a, const ColVec<T>& x) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (a.cols() != x.rows()) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions do not agree
+    }
+#endif
+    if (!x.isDense()) {
+        return a * ColVec<T>(x); // Views are materialized first
+    }
+    ColVec<T> result(static_cast<int>(a.rows()));
+    a.t()._multiplyTransposed(x.data(), x.stride(), 1, result.data(), result.stride());
+    return result;
+} /* ColVec<T> operator * (const SparseTr<T>& a, const ColVec<T>& x) */
+
+/**
+ * Dense matrix times sparse matrix
+ * @param b Dense matrix
+ * @param a Sparse matrix
+ * @return Dense product
+ */
+
+template <class T>
+Mat<T> operator * (const Mat<T>& b, const SparseMat<T>& a) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (b.cols() != a.rows()) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions do not agree
+    }
+#endif
+    if (!b.isDense()) {
+        return Mat<T>(b) * a; // Views are materialized first
+    }
+    Mat<T> result(b.rows(), a.cols());
+    a._multiplyLeft(b.data(), b.stride(), b.rows(), result.data(), result.stride());
+    return result;
+} /* Mat<T> operator * (const Mat<T>& b, const SparseMat<T>& a) */
+
+/* Below are nonmember functions for the SparseMat class */
+
+/**
+ * Returns a dense copy of a sparse matrix
+ * @param _m1 Sparse matrix
+ */
+
+template <class T>
+Mat<T> dense(const SparseMat<T>& _m1) {
+    return _m1.dense();
+} /* Mat<T> dense(const SparseMat<T>& _m1) */
+
+/* Below are overloaded stream operators for the SparseMat class */
+
+template <class T>
+std::ostream& operator<<(std::ostream& os, const SparseMat<T>& m) {
+    os << m.dense();
+    return os;
+} /* std::ostream& operator<<(std::ostream& os, const SparseMat<T>& m) */
+
+} /* namespace ORCA */
+
+#endif /* SparseMat_h */
@@ -0,0 +1,834 @@
+//
+//  Spatial.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef Spatial_h
+#define Spatial_h
+
+/* Includes for Spatial.h */
+
+#include "Except.h"     // Included for ORCA Exceptions
+#include "Checks.h"     // Included for check policies
+#include "Quaternion.h" // Included for orientations
+#include "FixedMat.h"   // Included for fixed-size storage
+#include "Rotation.h"   // Included for quaternion rotation matrices
+#include <ostream>      // Included for stream operators
+#include <type_traits>  // Included for std::enable_if
+
+namespace ORCA {
+
+/* Spatial (6D) algebra for rigid-body dynamics in Plucker coordinates, following Featherstone.
+ * Motion vectors are [angular velocity; linear velocity] and force vectors are [moment; force],
+ * both about the origin of the frame they are expressed in. Every operation is written out on
+ * the 3D parts, so applying a transform costs 24 multiplies and a cross product 18, against 36
+ * for the equivalent 6x6 matrix times a vector and 216 to build that matrix by a 6x6 product.
+ * Everything lives on the stack */
+
+/**
+ * Returns the cross product of two 3D vectors
+ * @param a left vector
+ * @param b right vector
+ */
+
+template <class T>
+inline ColVec<T, 3> _spatialCross(const ColVec<T, 3>& a, const ColVec<T, 3>& b) {
+    const T* x = a.data();
+    const T* y = b.data();
+    return ColVec<T, 3>({(x[1] * y[2]) - (x[2] * y[1]),
+                         (x[2] * y[0]) - (x[0] * y[2]),
+                         (x[0] * y[1]) - (x[1] * y[0])});
+} /* inline ColVec<T, 3> _spatialCross(const ColVec<T, 3>& a, const ColVec<T, 3>& b) */
+
+/**
+ * Returns the matrix of the cross product with r, so that _spatialSkew(r) * v = r x v
+ * @param r vector
+ */
+
+template <class T>
+inline Mat<T, 3, 3> _spatialSkew(const ColVec<T, 3>& r) {
+    const T* x = r.data();
+    return Mat<T, 3, 3>({{0, -x[2], x[1]},
+                         {x[2], 0, -x[0]},
+                         {-x[1], x[0], 0}});
+} /* inline Mat<T, 3, 3> _spatialSkew(const ColVec<T, 3>& r) */
+
+/**
+ * Returns the 6x6 matrix with blocks [a b; c d]
+ */
+
+template <class T>
+inline Mat<T, 6, 6> _spatialBlocks(const Mat<T, 3, 3>& a, const Mat<T, 3, 3>& b,
+                                   const Mat<T, 3, 3>& c, const Mat<T, 3, 3>& d) {
+    Mat<T, 6, 6> result;
+    T* r = result.data();
+    index_t i,j;
+    for (i = 0; i < 3; ++i) {
+        for (j = 0; j < 3; ++j) {
+            r[i * 6 + j] = a.data()[i * 3 + j];
+            r[i * 6 + j + 3] = b.data()[i * 3 + j];
+            r[(i + 3) * 6 + j] = c.data()[i * 3 + j];
+            r[(i + 3) * 6 + j + 3] = d.data()[i * 3 + j];
+        }
+    }
+    return result;
+} /* inline Mat<T, 6, 6> _spatialBlocks(...) */
+
+/**
+ * Storage and element access shared by motion and force vectors.
+ * The two are kept as separate types because they transform differently
+ * @tparam T Element type
+ */
+
+template <class T>
+class _SpatialVector {
+protected:
+
+    /* Below are protected variables of the _SpatialVector class */
+
+    ColVec<T, 3> _angular;  // Angular velocity or moment
+    ColVec<T, 3> _linear;   // Linear velocity or force
+
+public:
+
+    /* Below are public constructors for the _SpatialVector class */
+
+    /**
+     * Default constructor, the zero vector
+     */
+
+    _SpatialVector() : _angular(fill::zeros), _linear(fill::zeros) {
+
+    } /* _SpatialVector() */
+
+    /**
+     * Construct from the angular and linear parts
+     * @param angular Angular part
+     * @param linear Linear part
+     */
+
+    _SpatialVector(const ColVec<T, 3>& angular, const ColVec<T, 3>& linear) : _angular(angular), _linear(linear) {
+
+    } /* _SpatialVector(const ColVec<T, 3>& angular, const ColVec<T, 3>& linear) */
+
+    /**
+     * Construct from the six coordinates, angular first
+     */
+
+    _SpatialVector(T ax, T ay, T az, T lx, T ly, T lz) : _angular({ax, ay, az}), _linear({lx, ly, lz}) {
+
+    } /* _SpatialVector(T ax, T ay, T az, T lx, T ly, T lz) */
+
+    /**
+     * Construct from a 6 element vector, angular first
+     * @param v Coordinates
+     */
+
+    explicit _SpatialVector(const ColVec<T, 6>& v) {
+        index_t i;
+        for (i = 0; i < 3; ++i) {
+            this->_angular.unchecked_set(i, v.unchecked_at(i));
+            this->_linear.unchecked_set(i, v.unchecked_at(i + 3));
+        }
+    } /* explicit _SpatialVector(const ColVec<T, 6>& v) */
+
+    /* Below are public member functions of the _SpatialVector class */
+
+    /**
+     * Returns the angular part
+     */
+
+    ColVec<T, 3>& angular() {
+        return this->_angular;
+    } /* ColVec<T, 3>& angular() */
+
+    const ColVec<T, 3>& angular() const {
+        return this->_angular;
+    } /* const ColVec<T, 3>& angular() const */
+
+    /**
+     * Returns the linear part
+     */
+
+    ColVec<T, 3>& linear() {
+        return this->_linear;
+    } /* ColVec<T, 3>& linear() */
+
+    const ColVec<T, 3>& linear() const {
+        return this->_linear;
+    } /* const ColVec<T, 3>& linear() const */
+
+    /**
+     * Returns the coordinate at the specified index, angular coordinates first
+     * @param index index of coordinate
+     */
+
+    T at(index_t index) const {
+        _checkIndex<checks::Default>(index, 6);
+        return (index < 3) ? this->_angular.unchecked_at(index) : this->_linear.unchecked_at(index - 3);
+    } /* T at(index_t index) const */
+
+    /**
+     * Sets the coordinate at the specified index, angular coordinates first
+     * @param index index of coordinate
+     * @param elem Element to set
+     */
+
+    void set(index_t index, T elem) {
+        _checkIndex<checks::Default>(index, 6);
+        if (index < 3) {
+            this->_angular.unchecked_set(index, elem);
+        }
+        else {
+            this->_linear.unchecked_set(index - 3, elem);
+        }
+    } /* void set(index_t index, T elem) */
+
+    /**
+     * Returns the six coordinates, angular first
+     */
+
+    ColVec<T, 6> toVec() const {
+        ColVec<T, 6> result;
+        index_t i;
+        for (i = 0; i < 3; ++i) {
+            result.unchecked_set(i, this->_angular.unchecked_at(i));
+            result.unchecked_set(i + 3, this->_linear.unchecked_at(i));
+        }
+        return result;
+    } /* ColVec<T, 6> toVec() const */
+
+}; /* class _SpatialVector */
+
+template <class T>
+class SpatialForce;
+
+/**
+ * Spatial motion vector [angular velocity; linear velocity of the point at the origin]
+ * @tparam T Element type
+ */
+
+template <class T>
+class SpatialMotion : public _SpatialVector<T> {
+public:
+
+    /* Below are public constructors for the SpatialMotion class */
+
+    using _SpatialVector<T>::_SpatialVector;
+
+    /* Below are public member functions of the SpatialMotion class */
+
+    /**
+     * Returns the motion cross product this x m, the rate of change of m moving with this velocity
+     * @param m Motion vector
+     */
+
+    SpatialMotion<T> cross(const SpatialMotion<T>& m) const {
+        return SpatialMotion<T>(_spatialCross(this->_angular, m.angular()),
+                                _spatialCross(this->_angular, m.linear()) + _spatialCross(this->_linear, m.angular()));
+    } /* SpatialMotion<T> cross(const SpatialMotion<T>& m) const */
+
+    /**
+     * Returns the force cross product this x* f, the rate of change of f moving with this velocity
+     * @param f Force vector
+     */
+
+    SpatialForce<T> cross(const SpatialForce<T>& f) const;
+
+    /**
+     * Returns the 6x6 matrix of cross(m) for motion vectors m
+     */
+
+    Mat<T, 6, 6> crossMat() const {
+        const Mat<T, 3, 3> w = _spatialSkew(this->_angular);
+        return _spatialBlocks(w, Mat<T, 3, 3>(fill::zeros), _spatialSkew(this->_linear), w);
+    } /* Mat<T, 6, 6> crossMat() const */
+
+    /**
+     * Returns the 6x6 matrix of cross(f) for force vectors f
+     */
+
+    Mat<T, 6, 6> crossForceMat() const {
+        const Mat<T, 3, 3> w = _spatialSkew(this->_angular);
+        return _spatialBlocks(w, _spatialSkew(this->_linear), Mat<T, 3, 3>(fill::zeros), w);
+    } /* Mat<T, 6, 6> crossForceMat() const */
+
+}; /* class SpatialMotion */
+
+/**
+ * Spatial force vector [moment about the origin; force]
+ * @tparam T Element type
+ */
+
+template <class T>
+class SpatialForce : public _SpatialVector<T> {
+public:
+
+    /* Below are public constructors for the SpatialForce class */
+
+    using _SpatialVector<T>::_SpatialVector;
+
+}; /* class SpatialForce */
+
+template <class T>
+SpatialForce<T> SpatialMotion<T>::cross(const SpatialForce<T>& f) const {
+    return SpatialForce<T>(_spatialCross(this->_angular, f.angular()) + _spatialCross(this->_linear, f.linear()),
+                           _spatialCross(this->_angular, f.linear()));
+} /* SpatialForce<T> SpatialMotion<T>::cross(const SpatialForce<T>& f) const */
+
+/* Below are overloaded operators shared by motion and force vectors */
+
+template <class S>
+struct _isSpatialVector : std::false_type {};
+
+template <class T>
+struct _isSpatialVector<SpatialMotion<T>> : std::true_type {};
+
+template <class T>
+struct _isSpatialVector<SpatialForce<T>> : std::true_type {};
+
+/** Overloaded stream by reference, angular coordinates first */
+
+template <class S>
+std::enable_if_t<_isSpatialVector<S>::value, std::ostream&> operator<<(std::ostream& os, const S& s) {
+    os << s.at(0);
+    index_t i;
+    for (i = 1; i < 6; ++i) {
+        os << " " << s.at(i);
+    }
+    return os;
+} /* std::ostream& operator<<(std::ostream& os, const S& s) */
+
+/**
+ * Overloaded comparison operator for 2 spatial vectors of the same kind
+ */
+
+template <class S>
+std::enable_if_t<_isSpatialVector<S>::value, bool> operator == (const S& s1, const S& s2) {
+    return (s1.angular() == s2.angular()) && (s1.linear() == s2.linear());
+} /* bool operator == (const S& s1, const S& s2) */
+
+/**
+ * Overloaded addition operator for 2 spatial vectors of the same kind
+ */
+
+template <class S>
+std::enable_if_t<_isSpatialVector<S>::value, S> operator + (const S& s1, const S& s2) {
+    return S(s1.angular() + s2.angular(), s1.linear() + s2.linear());
+} /* S operator + (const S& s1, const S& s2) */
+
+/**
+ * Overloaded subtraction operator for 2 spatial vectors of the same kind
+ */
+
+template <class S>
+std::enable_if_t<_isSpatialVector<S>::value, S> operator - (const S& s1, const S& s2) {
+    return S(s1.angular() - s2.angular(), s1.linear() - s2.linear());
+} /* S operator - (const S& s1, const S& s2) */
+
+/**
+ * Overloaded negation operator for a spatial vector
+ */
+
+template <class S>
+std::enable_if_t<_isSpatialVector<S>::value, S> operator - (const S& s1) {
+    return S(-s1.angular(), -s1.linear());
+} /* S operator - (const S& s1) */
+
+/**
+ * Overloaded multiplication operator for a spatial vector and a scalar
+ */
+
+template <class S, class T>
+std::enable_if_t<_isSpatialVector<S>::value && std::is_arithmetic<T>::value, S> operator * (const S& s1, T t) {
+    return S(s1.angular() * t, s1.linear() * t);
+} /* S operator * (const S& s1, T t) */
+
+template <class S, class T>
+std::enable_if_t<_isSpatialVector<S>::value && std::is_arithmetic<T>::value, S> operator * (T t, const S& s1) {
+    return S(s1.angular() * t, s1.linear() * t);
+} /* S operator * (T t, const S& s1) */
+
+/**
+ * Overloaded in place addition operator for 2 spatial vectors of the same kind
+ */
+
+template <class S>
+std::enable_if_t<_isSpatialVector<S>::value, S&> operator += (S& s1, const S& s2) {
+    s1.angular() += s2.angular();
+    s1.linear() += s2.linear();
+    return s1;
+} /* S& operator += (S& s1, const S& s2) */
+
+/**
+ * Overloaded in place subtraction operator for 2 spatial vectors of the same kind
+ */
+
+template <class S>
+std::enable_if_t<_isSpatialVector<S>::value, S&> operator -= (S& s1, const S& s2) {
+    s1.angular() -= s2.angular();
+    s1.linear() -= s2.linear();
+    return s1;
+} /* S& operator -= (S& s1, const S& s2) */
+
+/**
+ * Returns the power of a force acting on a motion, the scalar product of the two
+ * @param m Motion vector
+ * @param f Force vector
+ */
+
+template <class T>
+T dot(const SpatialMotion<T>& m, const SpatialForce<T>& f) {
+    const T* a = m.angular().data();
+    const T* b = f.angular().data();
+    const T* c = m.linear().data();
+    const T* d = f.linear().data();
+    return (a[0] * b[0]) + (a[1] * b[1]) + (a[2] * b[2]) + (c[0] * d[0]) + (c[1] * d[1]) + (c[2] * d[2]);
+} /* T dot(const SpatialMotion<T>& m, const SpatialForce<T>& f) */
+
+template <class T>
+T dot(const SpatialForce<T>& f, const SpatialMotion<T>& m) {
+    return dot(m, f);
+} /* T dot(const SpatialForce<T>& f, const SpatialMotion<T>& m) */
+
+/**
+ * Returns the motion cross product m1 x m2
+ */
+
+template <class T>
+SpatialMotion<T> cross(const SpatialMotion<T>& m1, const SpatialMotion<T>& m2) {
+    return m1.cross(m2);
+} /* SpatialMotion<T> cross(const SpatialMotion<T>& m1, const SpatialMotion<T>& m2) */
+
+/**
+ * Returns the force cross product m x* f
+ */
+
+template <class T>
+SpatialForce<T> cross(const SpatialMotion<T>& m, const SpatialForce<T>& f) {
+    return m.cross(f);
+} /* SpatialForce<T> cross(const SpatialMotion<T>& m, const SpatialForce<T>& f) */
+
+/**
+ * Returns an articulated-body inertia, or any other 6x6 motion to force map, applied to a motion.
+ * Articulated-body inertias are general symmetric 6x6 matrices, so they are kept as Mat<T, 6, 6>
+ * @param inertia 6x6 inertia
+ * @param m Motion vector
+ */
+
+template <class T>
+SpatialForce<T> operator * (const Mat<T, 6, 6>& inertia, const SpatialMotion<T>& m) {
+    return SpatialForce<T>(inertia * m.toVec());
+} /* SpatialForce<T> operator * (const Mat<T, 6, 6>& inertia, const SpatialMotion<T>& m) */
+
+/**
+ * Spatial inertia of a rigid body, stored as its mass, first moment of mass h = m c and
+ * rotational inertia about the origin. As a 6x6 matrix it is [I h x; -h x m 1]
+ * @tparam T Element type
+ */
+
+template <class T>
+class SpatialInertia {
+private:
+
+    /* Below are private variables of the SpatialInertia class */
+
+    T _mass;                // Mass
+    ColVec<T, 3> _moment;   // First moment of mass, mass times the center of mass
+    Mat<T, 3, 3> _inertia;  // Rotational inertia about the origin
+
+public:
+
+    /* Below are public constructors for the SpatialInertia class */
+
+    /**
+     * Default constructor, the inertia of no body
+     */
+
+    SpatialInertia() : _mass(0), _moment(fill::zeros), _inertia(fill::zeros) {
+
+    } /* SpatialInertia() */
+
+    /**
+     * Construct from the mass properties of a body
+     * @param mass Mass
+     * @param centerOfMass Center of mass
+     * @param centralInertia Rotational inertia about the center of mass
+     */
+
+    SpatialInertia(T mass, const ColVec<T, 3>& centerOfMass, const Mat<T, 3, 3>& centralInertia) : _mass(mass), _moment(centerOfMass * mass) {
+        /* Parallel axis theorem, I = Ic + m (|c|^2 1 - c c^T) */
+        const T* c = centerOfMass.data();
+        const T squared = (c[0] * c[0]) + (c[1] * c[1]) + (c[2] * c[2]);
+        index_t i,j;
+        for (i = 0; i < 3; ++i) {
+            for (j = 0; j < 3; ++j) {
+                this->_inertia.unchecked_set(i, j, centralInertia.unchecked_at(i, j) + mass * (((i == j) ? squared : 0) - c[i] * c[j]));
+            }
+        }
+    } /* SpatialInertia(T mass, const ColVec<T, 3>& centerOfMass, const Mat<T, 3, 3>& centralInertia) */
+
+    /**
+     * Construct from the mass, first moment of mass and rotational inertia about the origin
+     * @param mass Mass
+     * @param moment First moment of mass
+     * @param inertia Rotational inertia about the origin
+     */
+
+    static SpatialInertia<T> fromMoments(T mass, const ColVec<T, 3>& moment, const Mat<T, 3, 3>& inertia) {
+        SpatialInertia<T> result;
+        result._mass = mass;
+        result._moment = moment;
+        result._inertia = inertia;
+        return result;
+    } /* static SpatialInertia<T> fromMoments(T mass, const ColVec<T, 3>& moment, const Mat<T, 3, 3>& inertia) */
+
+    /* Below are public member functions of the SpatialInertia class */
+
+    /**
+     * Returns the mass
+     */
+
+    T mass() const {
+        return this->_mass;
+    } /* T mass() const */
+
+    /**
+     * Returns the first moment of mass, mass times the center of mass
+     */
+
+    const ColVec<T, 3>& moment() const {
+        return this->_moment;
+    } /* const ColVec<T, 3>& moment() const */
+
+    /**
+     * Returns the rotational inertia about the origin
+     */
+
+    const Mat<T, 3, 3>& inertia() const {
+        return this->_inertia;
+    } /* const Mat<T, 3, 3>& inertia() const */
+
+    /**
+     * Returns the center of mass
+     */
+
+    ColVec<T, 3> centerOfMass() const {
+        return this->_moment * (T(1) / this->_mass);
+    } /* ColVec<T, 3> centerOfMass() const */
+
+    /**
+     * Returns the 6x6 matrix of the inertia
+     */
+
+    Mat<T, 6, 6> toMat() const {
+        const Mat<T, 3, 3> h = _spatialSkew(this->_moment);
+        return _spatialBlocks(this->_inertia, h, -h, Mat<T, 3, 3>(fill::eye) * this->_mass);
+    } /* Mat<T, 6, 6> toMat() const */
+
+    /**
+     * Returns the momentum of the body moving with velocity m
+     * @param m Motion vector
+     */
+
+    SpatialForce<T> operator * (const SpatialMotion<T>& m) const {
+        return SpatialForce<T>((this->_inertia * m.angular()) + _spatialCross(this->_moment, m.linear()),
+                               (m.linear() * this->_mass) - _spatialCross(this->_moment, m.angular()));
+    } /* SpatialForce<T> operator * (const SpatialMotion<T>& m) const */
+
+    /**
+     * Adds the inertia of a second body expressed in the same frame
+     * @param other Inertia to add
+     */
+
+    SpatialInertia<T>& operator += (const SpatialInertia<T>& other) {
+        this->_mass += other._mass;
+        this->_moment += other._moment;
+        this->_inertia += other._inertia;
+        return *this;
+    } /* SpatialInertia<T>& operator += (const SpatialInertia<T>& other) */
+
+    SpatialInertia<T> operator + (const SpatialInertia<T>& other) const {
+        SpatialInertia<T> result(*this);
+        result += other;
+        return result;
+    } /* SpatialInertia<T> operator + (const SpatialInertia<T>& other) const */
+
+}; /* class SpatialInertia */
+
+/**
+ * Plucker coordinate transform from frame A to frame B, X = rot(E) xlt(r), where E rotates
+ * coordinates of A into coordinates of B and r is the origin of B in coordinates of A.
+ * Stored as E and r, so composing and inverting transforms never forms a 6x6 matrix
+ * @tparam T Element type
+ */
+
+template <class T>
+class SpatialTransform {
+private:
+
+    /* Below are private variables of the SpatialTransform class */
+
+    Mat<T, 3, 3> _rotation;     // E, from coordinates of A to coordinates of B
+    ColVec<T, 3> _translation;  // r, origin of B in coordinates of A
+
+public:
+
+    /* Below are public constructors for the SpatialTransform class */
+
+    /**
+     * Default constructor, the identity transform
+     */
+
+    SpatialTransform() : _rotation(fill::eye), _translation(fill::zeros) {
+
+    } /* SpatialTransform() */
+
+    /**
+     * Construct from the coordinate rotation and the translation
+     * @param rotation E, from coordinates of A to coordinates of B
+     * @param translation r, origin of B in coordinates of A
+     */
+
+    SpatialTransform(const Mat<T, 3, 3>& rotation, const ColVec<T, 3>& translation) : _rotation(rotation), _translation(translation) {
+
+    } /* SpatialTransform(const Mat<T, 3, 3>& rotation, const ColVec<T, 3>& translation) */
+
+    /**
+     * Construct from the orientation and position of B relative to A.
+     * The quaternion rotates vectors of B into A, so E is the transpose of its rotation matrix
+     * @param orientation Orientation of B in A
+     * @param translation Origin of B in coordinates of A
+     */
+
+    SpatialTransform(const Quaternion<T>& orientation, const ColVec<T, 3>& translation) : _rotation(orientation.toRotationMatrix().t()), _translation(translation) {
+
+    } /* SpatialTransform(const Quaternion<T>& orientation, const ColVec<T, 3>& translation) */
+
+    /**
+     * Returns the transform to a frame rotated by angle about the x, y or z axis
+     * @param angle Angle in radians
+     */
+
+    static SpatialTransform<T> rotX(T angle) {
+        const T c = std::cos(angle), s = std::sin(angle);
+        return SpatialTransform<T>(Mat<T, 3, 3>({{1, 0, 0}, {0, c, s}, {0, -s, c}}), ColVec<T, 3>(fill::zeros));
+    } /* static SpatialTransform<T> rotX(T angle) */
+
+    static SpatialTransform<T> rotY(T angle) {
+        const T c = std::cos(angle), s = std::sin(angle);
+        return SpatialTransform<T>(Mat<T, 3, 3>({{c, 0, -s}, {0, 1, 0}, {s, 0, c}}), ColVec<T, 3>(fill::zeros));
+    } /* static SpatialTransform<T> rotY(T angle) */
+
+    static SpatialTransform<T> rotZ(T angle) {
+        const T c = std::cos(angle), s = std::sin(angle);
+        return SpatialTransform<T>(Mat<T, 3, 3>({{c, s, 0}, {-s, c, 0}, {0, 0, 1}}), ColVec<T, 3>(fill::zeros));
+    } /* static SpatialTransform<T> rotZ(T angle) */
+
+    /**
+     * Returns the transform to a frame translated by r
+     * @param translation Origin of the new frame
+     */
+
+    static SpatialTransform<T> fromTranslation(const ColVec<T, 3>& translation) {
+        return SpatialTransform<T>(Mat<T, 3, 3>(fill::eye), translation);
+    } /* static SpatialTransform<T> fromTranslation(const ColVec<T, 3>& translation) */
+
+    /* Below are public member functions of the SpatialTransform class */
+
+    /**
+     * Returns E, the rotation from coordinates of A to coordinates of B
+     */
+
+    const Mat<T, 3, 3>& rotation() const {
+        return this->_rotation;
+    } /* const Mat<T, 3, 3>& rotation() const */
+
+    /**
+     * Returns r, the origin of B in coordinates of A
+     */
+
+    const ColVec<T, 3>& translation() const {
+        return this->_translation;
+    } /* const ColVec<T, 3>& translation() const */
+
+    /**
+     * Returns the inverse transform, from B to A
+     */
+
+    SpatialTransform<T> inverse() const {
+        return SpatialTransform<T>(this->_rotation.t(), -(this->_rotation * this->_translation));
+    } /* SpatialTransform<T> inverse() const */
+
+    /**
+     * Returns a motion vector of A in coordinates of B, [E w; E (v - r x w)]
+     * @param m Motion vector
+     */
+
+    SpatialMotion<T> apply(const SpatialMotion<T>& m) const {
+        return SpatialMotion<T>(this->_rotation * m.angular(),
+                                this->_rotation * (m.linear() - _spatialCross(this->_translation, m.angular())));
+    } /* SpatialMotion<T> apply(const SpatialMotion<T>& m) const */
+
+    /**
+     * Returns a force vector of A in coordinates of B, [E (n - r x f); E f]
+     * @param f Force vector
+     */
+
+    SpatialForce<T> apply(const SpatialForce<T>& f) const {
+        return SpatialForce<T>(this->_rotation * (f.angular() - _spatialCross(this->_translation, f.linear())),
+                               this->_rotation * f.linear());
+    } /* SpatialForce<T> apply(const SpatialForce<T>& f) const */
+
+    /**
+     * Returns the inertia of a rigid body of A in coordinates of B
+     * @param inertia Spatial inertia
+     */
+
+    SpatialInertia<T> apply(const SpatialInertia<T>& inertia) const {
+        /* I' = E (I + r x h x + (h - m r) x r x) E^T with (a x)(b x) = b a^T - (a . b) 1 */
+        const T mass = inertia.mass();
+        const ColVec<T, 3>& h = inertia.moment();
+        const ColVec<T, 3>& r = this->_translation;
+        const ColVec<T, 3> g = h - (r * mass);
+        const T* hp = h.data();
+        const T* gp = g.data();
+        const T* rp = r.data();
+        const T diagonal = (rp[0] * (hp[0] + gp[0])) + (rp[1] * (hp[1] + gp[1])) + (rp[2] * (hp[2] + gp[2]));
+        Mat<T, 3, 3> shifted;
+        index_t i,j;
+        for (i = 0; i < 3; ++i) {
+            for (j = 0; j < 3; ++j) {
+                shifted.unchecked_set(i, j, inertia.inertia().unchecked_at(i, j) + (hp[i] * rp[j]) + (rp[i] * gp[j]) - ((i == j) ? diagonal : 0));
+            }
+        }
+        return SpatialInertia<T>::fromMoments(mass, this->_rotation * g, this->_rotation * shifted * this->_rotation.t());
+    } /* SpatialInertia<T> apply(const SpatialInertia<T>& inertia) const */
+
+    /**
+     * Returns an articulated-body inertia of A in coordinates of B, X* I X^-1
+     * @param inertia Symmetric 6x6 inertia
+     */
+
+    Mat<T, 6, 6> apply(const Mat<T, 6, 6>& inertia) const {
+        return this->inverse().applyInverse(inertia);
+    } /* Mat<T, 6, 6> apply(const Mat<T, 6, 6>& inertia) const */
+
+    /**
+     * Returns a motion vector of B in coordinates of A, [E^T w; E^T v + r x E^T w]
+     * @param m Motion vector
+     */
+
+    SpatialMotion<T> applyInverse(const SpatialMotion<T>& m) const {
+        const Mat<T, 3, 3> rotationT = this->_rotation.t();
+        const ColVec<T, 3> angular = rotationT * m.angular();
+        return SpatialMotion<T>(angular, (rotationT * m.linear()) + _spatialCross(this->_translation, angular));
+    } /* SpatialMotion<T> applyInverse(const SpatialMotion<T>& m) const */
+
+    /**
+     * Returns a force vector of B in coordinates of A, X^T f = [E^T n + r x E^T f; E^T f]
+     * @param f Force vector
+     */
+
+    SpatialForce<T> applyInverse(const SpatialForce<T>& f) const {
+        const Mat<T, 3, 3> rotationT = this->_rotation.t();
+        const ColVec<T, 3> linear = rotationT * f.linear();
+        return SpatialForce<T>((rotationT * f.angular()) + _spatialCross(this->_translation, linear), linear);
+    } /* SpatialForce<T> applyInverse(const SpatialForce<T>& f) const */
+
+    /**
+     * Returns the inertia of a rigid body of B in coordinates of A
+     * @param inertia Spatial inertia
+     */
+
+    SpatialInertia<T> applyInverse(const SpatialInertia<T>& inertia) const {
+        return this->inverse().apply(inertia);
+    } /* SpatialInertia<T> applyInverse(const SpatialInertia<T>& inertia) const */
+
+    /**
+     * Returns an articulated-body inertia of B in coordinates of A, X^T I X.
+     * With I = [A B; B^T C] and each block rotated to A' = E^T A E, the result is
+     * [A' - B' r x + r x B'^T - r x C' r x, B' + r x C'; (B' + r x C')^T, C']
+     * @param inertia Symmetric 6x6 inertia
+     */
+
+    Mat<T, 6, 6> applyInverse(const Mat<T, 6, 6>& inertia) const {
+        Mat<T, 3, 3> a, b, c;
+        index_t i,j;
+        for (i = 0; i < 3; ++i) {
+            for (j = 0; j < 3; ++j) {
+                a.unchecked_set(i, j, inertia.unchecked_at(i, j));
+                b.unchecked_set(i, j, inertia.unchecked_at(i, j + 3));
+                c.unchecked_set(i, j, inertia.unchecked_at(i + 3, j + 3));
+            }
+        }
+        const Mat<T, 3, 3> rotationT = this->_rotation.t();
+        const Mat<T, 3, 3> rx = _spatialSkew(this->_translation);
+        a = rotationT * a * this->_rotation;
+        b = rotationT * b * this->_rotation;
+        c = rotationT * c * this->_rotation;
+        const Mat<T, 3, 3> upper = b + (rx * c);
+        const Mat<T, 3, 3> bRx = b * rx;
+        a = a - bRx - bRx.t() - (rx * c * rx);
+        return _spatialBlocks(a, upper, upper.t(), c);
+    } /* Mat<T, 6, 6> applyInverse(const Mat<T, 6, 6>& inertia) const */
+
+    /**
+     * Returns the 6x6 matrix of the transform applied to motion vectors, [E 0; -E r x E]
+     */
+
+    Mat<T, 6, 6> toMat() const {
+        return _spatialBlocks(this->_rotation, Mat<T, 3, 3>(fill::zeros), -(this->_rotation * _spatialSkew(this->_translation)), this->_rotation);
+    } /* Mat<T, 6, 6> toMat() const */
+
+    /**
+     * Returns the 6x6 matrix of the transform applied to force vectors, [E -E r x; 0 E]
+     */
+
+    Mat<T, 6, 6> toForceMat() const {
+        return _spatialBlocks(this->_rotation, -(this->_rotation * _spatialSkew(this->_translation)), Mat<T, 3, 3>(fill::zeros), this->_rotation);
+    } /* Mat<T, 6, 6> toForceMat() const */
+
+}; /* class SpatialTransform */
+
+/**
+ * Returns the composition applying x2 first, then x1
+ * @param x1 Transform from B to C
+ * @param x2 Transform from A to B
+ * @return Transform from A to C
+ */
+
+template <class T>
+SpatialTransform<T> operator * (const SpatialTransform<T>& x1, const SpatialTransform<T>& x2) {
+    /* rot(E1) xlt(r1) rot(E2) xlt(r2) = rot(E1 E2) xlt(E2^T r1 + r2) */
+    const Mat<T, 3, 3>& e2 = x2.rotation();
+    const T* r1 = x1.translation().data();
+    ColVec<T, 3> translation(x2.translation());
+    index_t i;
+    for (i = 0; i < 3; ++i) {
+        translation.unchecked_set(i, translation.unchecked_at(i) + (e2.unchecked_at(0, i) * r1[0]) + (e2.unchecked_at(1, i) * r1[1]) + (e2.unchecked_at(2, i) * r1[2]));
+    }
+    return SpatialTransform<T>(x1.rotation() * e2, translation);
+} /* SpatialTransform<T> operator * (const SpatialTransform<T>& x1, const SpatialTransform<T>& x2) */
+
+/**
+ * Overloaded multiplication operators applying a transform
+ */
+
+template <class T>
+SpatialMotion<T> operator * (const SpatialTransform<T>& x, const SpatialMotion<T>& m) {
+    return x.apply(m);
+} /* SpatialMotion<T> operator * (const SpatialTransform<T>& x, const SpatialMotion<T>& m) */
+
+template <class T>
+SpatialForce<T> operator * (const SpatialTransform<T>& x, const SpatialForce<T>& f) {
+    return x.apply(f);
+} /* SpatialForce<T> operator * (const SpatialTransform<T>& x, const SpatialForce<T>& f) */
+
+} /* namespace ORCA */
+
+#endif /* Spatial_h */
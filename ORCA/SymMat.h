@@ -0,0 +1,395 @@
+//
+//  SymMat.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef SymMat_h
+#define SymMat_h
+
+/* Includes for SymMat.h */
+
+#include "Except.h"     // Included for ORCA Exceptions
+#include "Fill.h"       // Included for Fill types
+#include "Mat.h"        // Included for Mat class
+#include "Vec.h"        // Included for ColVec class
+#include "Cholesky.h"   // Included for LDLT factorization
+#include "Parallel.h"   // Included for threaded products
+#include <vector>       // Included for packed storage
+
+namespace ORCA {
+
+/**
+ * Square symmetric matrix in packed storage. Only the upper triangle is stored, row i holding
+ * columns i..n-1, so n(n+1)/2 elements are kept and every stored element serves both (i, j) and (j, i).
+ * det(), solve() and inv() go through an LDLT factorization, which needs no pivoting for the
+ * well conditioned symmetric systems this type is meant for
+ * @tparam T Element type
+ */
+
+template <class T>
+class SymMat {
+private:
+    /* Below are private members of the SymMat class */
+    index_t _n = 0;         // Number of rows and columns
+    std::vector<T> _packed; // Rows of the upper triangle, one after another
+
+    /**
+     * Returns the address of element (row, col) with row <= col
+     */
+
+    T* _element(index_t row, index_t col) {
+        return this->_packed.data() + (row * this->_n - (row * (row - 1)) / 2) + (col - row);
+    } /* T* _element(index_t row, index_t col) */
+
+    const T* _element(index_t row, index_t col) const {
+        return this->_packed.data() + (row * this->_n - (row * (row - 1)) / 2) + (col - row);
+    } /* const T* _element(index_t row, index_t col) const */
+
+public:
+
+    /* Below are public constructors for the SymMat class */
+
+    /**
+     * Constructs an n x n symmetric matrix of zeros
+     * @param n Number of rows and columns
+     */
+
+    explicit SymMat(index_t n) : _n(n) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (n < 0) {
+            throw ORCAExcept::BadDimensionsError(); // Negative dimensions
+        }
+#endif
+#ifndef ORCA_DISABLE_EMPTY_CHECKS
+        if (n == 0) {
+            throw ORCAExcept::EmptyElementError(); // Zero rows or columns
+        }
+#endif
+        this->_packed.assign(static_cast<std::size_t>((n * (n + 1)) / 2), T(0));
+    } /* explicit SymMat(index_t n) */
+
+    /**
+     * Constructs a symmetric matrix from the upper triangle of a square dense matrix.
+     * Elements below the diagonal are ignored
+     * @param dense Square dense matrix
+     */
+
+    explicit SymMat(const Mat<T>& dense) : SymMat(dense.rows()) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (dense.rows() != dense.cols()) {
+            throw ORCAExcept::BadDimensionsError(); // Symmetric matrices are square
+        }
+#endif
+        index_t i, j;
+        for (i = 0; i < this->_n; ++i) {
+            T* row = this->_element(i, i);
+            for (j = i; j < this->_n; ++j) {
+                row[j - i] = dense.at(i, j);
+            }
+        }
+    } /* explicit SymMat(const Mat<T>& dense) */
+
+    /* Below are public getters and setters for the SymMat class */
+
+    /**
+     * Returns the number of rows in the matrix
+     */
+
+    index_t rows() const {
+        return this->_n;
+    } /* index_t rows() const */
+
+    /**
+     * Returns the number of columns in the matrix
+     */
+
+    index_t cols() const {
+        return this->_n;
+    } /* index_t cols() const */
+
+    /**
+     * Returns the element at the specified index
+     * @param row Element Row Index
+     * @param col Element Column Index
+     */
+
+    T at(index_t row, index_t col) const {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if ((row < 0) || (row >= this->_n) || (col < 0) || (col >= this->_n)) {
+            throw ORCAExcept::OutOfBoundsError(); // Either negative indexing or over indexing
+        }
+#endif
+        return (row <= col) ? *this->_element(row, col) : *this->_element(col, row);
+    } /* T at(index_t row, index_t col) const */
+
+    /**
+     * Sets the element at the specified index and its mirror across the diagonal
+     * @param row Element Row Index
+     * @param col Element Column Index
+     * @param elem Element Value
+     */
+
+    void set(index_t row, index_t col, T elem) {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if ((row < 0) || (row >= this->_n) || (col < 0) || (col >= this->_n)) {
+            throw ORCAExcept::OutOfBoundsError(); // Either negative indexing or over indexing
+        }
+#endif
+        if (row <= col) {
+            *this->_element(row, col) = elem;
+        } else {
+            *this->_element(col, row) = elem;
+        }
+    } /* void set(index_t row, index_t col, T elem) */
+
+    /**
+     * Returns the packed upper triangle, n(n+1)/2 entries
+     */
+
+    const T* data() const {
+        return this->_packed.data();
+    } /* const T* data() const */
+
+    /* Below are public member functions of the SymMat class */
+
+    /**
+     * Returns a dense copy of the matrix
+     */
+
+    Mat<T> dense() const {
+        Mat<T> result(this->_n, this->_n);
+        T* c = result.data();
+        const index_t ldc = result.stride();
+        index_t i, j;
+        for (i = 0; i < this->_n; ++i) {
+            const T* row = this->_element(i, i);
+            for (j = i; j < this->_n; ++j) {
+                c[i * ldc + j] = row[j - i];
+                c[j * ldc + i] = row[j - i];
+            }
+        }
+        return result;
+    } /* Mat<T> dense() const */
+
+    /**
+     * Returns the LDLT factorization of the matrix
+     */
+
+    LDLT<T> ldlt() const {
+        return LDLT<T>(this->dense());
+    } /* LDLT<T> ldlt() const */
+
+    /**
+     * Returns the determinant, the product of the LDLT pivots
+     */
+
+    T det() const {
+        return this->ldlt().det();
+    } /* T det() const */
+
+    /**
+     * Returns the inverse, which is symmetric and packed the same way
+     */
+
+    SymMat<T> inv() const {
+        return SymMat<T>(this->ldlt().inv());
+    } /* SymMat<T> inv() const */
+
+    /**
+     * Solves A * x = b for every column of b
+     * @param b Right hand sides
+     */
+
+    Mat<T> solve(const Mat<T>& b) const {
+        return this->ldlt().solve(b);
+    } /* Mat<T> solve(const Mat<T>& b) const */
+
+    /**
+     * Solves A * x = b
+     * @param b Right hand side
+     */
+
+    ColVec<T> solve(const ColVec<T>& b) const {
+        return this->ldlt().solve(b);
+    } /* ColVec<T> solve(const ColVec<T>& b) const */
+
+    /**
+     * Computes C = A * B for a dense row-major B (p columns) into a dense row-major C.
+     * Each stored element a_ij contributes to row i through b_j and to row j through b_i
+     */
+
+    void _multiply(const T* b, index_t ldb, index_t p, T* c, index_t ldc) const {
+        index_t i, k, j;
+        for (i = 0; i < this->_n; ++i) {
+            for (j = 0; j < p; ++j) {
+                c[i * ldc + j] = T(0);
+            }
+        }
+        for (i = 0; i < this->_n; ++i) {
+            const T* row = this->_element(i, i);
+            T* out = c + i * ldc;
+            const T* source = b + i * ldb;
+            for (j = 0; j < p; ++j) {
+                out[j] = out[j] + row[0] * source[j];
+            }
+            for (k = i + 1; k < this->_n; ++k) {
+                const T value = row[k - i];
+                T* mirror = c + k * ldc;
+                const T* other = b + k * ldb;
+                for (j = 0; j < p; ++j) {
+                    out[j] = out[j] + value * other[j];
+                    mirror[j] = mirror[j] + value * source[j];
+                }
+            }
+        }
+    } /* void _multiply(const T* b, index_t ldb, index_t p, T* c, index_t ldc) const */
+
+    /**
+     * Computes C = B * A for a dense row-major B (m rows) into a dense row-major C.
+     * Rows of C are independent and are split across threads
+     */
+
+    void _multiplyLeft(const T* b, index_t ldb, index_t m, T* c, index_t ldc) const {
+        _parallelFor(0, m, this->_n * this->_n * m, [&](index_t first, index_t last) {
+            index_t i, k, j;
+            for (i = first; i < last; ++i) {
+                const T* source = b + i * ldb;
+                T* out = c + i * ldc;
+                for (j = 0; j < this->_n; ++j) {
+                    out[j] = T(0);
+                }
+                for (k = 0; k < this->_n; ++k) {
+                    const T* row = this->_element(k, k);
+                    T sum = out[k] + source[k] * row[0];
+                    for (j = k + 1; j < this->_n; ++j) {
+                        out[j] = out[j] + source[k] * row[j - k];
+                        sum = sum + source[j] * row[j - k];
+                    }
+                    out[k] = sum;
+                }
+            }
+        });
+    } /* void _multiplyLeft(const T* b, index_t ldb, index_t m, T* c, index_t ldc) const */
+
+}; /* class SymMat */
+
+/* Symmetric matrices are not scalars to the element-wise operators of Mat */
+
+template <class T>
+struct _matrixLike<SymMat<T>> : std::true_type {};
+
+/* Below are the overloaded math operators for the SymMat class */
+
+/**
+ * Symmetric matrix times dense matrix
+ * @param a Symmetric matrix
+ * @param b Dense matrix
+ * @return Dense product
+ */
+
+template <class T>
+Mat<T> operator * (const SymMat<T>& a, const Mat<T>& b) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (a.cols() != b.rows()) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions do not agree
+    }
+#endif
+    if (!b.isDense()) {
+        return a * Mat<T>(b); // Views are materialized first
+    }
+    Mat<T> result(a.rows(), b.cols());
+    a._multiply(b.data(), b.stride(), b.cols(), result.data(), result.stride());
+    return result;
+} /* Mat<T> operator * (const SymMat<T>& a, const Mat<T>& b) */
+
+/**
+ * Symmetric matrix times dense column vector
+ * @param a Symmetric matrix
+ * @param x Dense vector
+ * @return Dense product
+ */
+
+template <class T>
+ColVec<T> operator * (const SymMat<T>& a, const ColVec<T>& x) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (a.cols() != x.rows()) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions do not agree
+    }
+#endif
+    if (!x.isDense()) {
+        return a * ColVec<T>(x); // Views are materialized first
+    }
+    ColVec<T> result(static_cast<int>(a.rows()));
+    a._multiply(x.data(), x.stride(), 1, result.data(), result.stride());
+    return result;
+} /* ColVec<T> operator * (const SymMat<T>& a, const ColVec<T>& x) */
+
+/**
+ * Dense matrix times symmetric matrix
+ * @param b Dense matrix
+ * @param a Symmetric matrix
+ * @return Dense product
+ */
+
+template <class T>
+Mat<T> operator * (const Mat<T>& b, const SymMat<T>& a) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (b.cols() != a.rows()) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions do not agree
+    }
+#endif
+    if (!b.isDense()) {
+        return Mat<T>(b) * a; // Views are materialized first
+    }
+    Mat<T> result(b.rows(), a.cols());
+    a._multiplyLeft(b.data(), b.stride(), b.rows(), result.data(), result.stride());
+    return result;
+} /* Mat<T> operator * (const Mat<T>& b, const SymMat<T>& a) */
+
+/* Below are nonmember functions for the SymMat class */
+
+/**
+ * Returns the determinant of a symmetric matrix
+ * @param _m1 Symmetric matrix
+ */
+
+template <class T>
+T det(const SymMat<T>& _m1) {
+    return _m1.det();
+} /* T det(const SymMat<T>& _m1) */
+
+/**
+ * Returns the inverse of a symmetric matrix
+ * @param _m1 Symmetric matrix
+ */
+
+template <class T>
+SymMat<T> inv(const SymMat<T>& _m1) {
+    return _m1.inv();
+} /* SymMat<T> inv(const SymMat<T>& _m1) */
+
+/**
+ * Returns a dense copy of a symmetric matrix
+ * @param _m1 Symmetric matrix
+ */
+
+template <class T>
+Mat<T> dense(const SymMat<T>& _m1) {
+    return _m1.dense();
+} /* Mat<T> dense(const SymMat<T>& _m1) */
+
+/* Below are overloaded stream operators for the SymMat class */
+
+template <class T>
+std::ostream& operator<<(std::ostream& os, const SymMat<T>& m) {
+    os << m.dense();
+    return os;
+} /* std::ostream& operator<<(std::ostream& os, const SymMat<T>& m) */
+
+} /* namespace ORCA */
+
+#endif /* SymMat_h */
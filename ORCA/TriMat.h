@@ -0,0 +1,529 @@
+//
+//  TriMat.h
+//  ORCAMath
+//
+//  Created by Daniel Pietz on 10/14/26.
+//  Copyright © 2026 Daniel Pietz. All rights reserved.
+//  Version 1.0 Updated October 14, 2026
+//
+
+#ifndef TriMat_h
+#define TriMat_h
+
+/* Includes for TriMat.h */
+
+#include "Except.h"     // Included for ORCA Exceptions
+#include "Fill.h"       // Included for Fill types
+#include "Mat.h"        // Included for Mat class
+#include "Vec.h"        // Included for ColVec class
+#include "Parallel.h"   // Included for threaded products
+#include <vector>       // Included for packed storage
+
+/** Triangle Definitions for triangular matrices **/
+
+namespace triangle {
+    typedef const int triangleType;
+    triangleType upper = 0x0;
+    triangleType lower = 0x1;
+}
+
+namespace ORCA {
+
+/**
+ * Square upper or lower triangular matrix in packed row storage.
+ * Row i of an upper matrix holds columns i..n-1, row i of a lower matrix columns 0..i, so only
+ * n(n+1)/2 elements are stored. Products skip the zero triangle, det() is the product of the
+ * diagonal, solve() is a single substitution pass and inv() stays triangular
+ * @tparam T Element type
+ */
+
+template <class T>
+class TriMat {
+private:
+    /* Below are private members of the TriMat class */
+    index_t _n = 0;         // Number of rows and columns
+    bool _upper = true;     // True for upper triangular, false for lower
+    std::vector<T> _packed; // Rows of the stored triangle, one after another
+
+    /**
+     * Returns the first stored column of a row
+     */
+
+    index_t _rowFirst(index_t row) const {
+        return this->_upper ? row : 0;
+    } /* index_t _rowFirst(index_t row) const */
+
+    /**
+     * Returns one past the last stored column of a row
+     */
+
+    index_t _rowLast(index_t row) const {
+        return this->_upper ? this->_n : row + 1;
+    } /* index_t _rowLast(index_t row) const */
+
+    /**
+     * Returns the offset of the first stored element of a row
+     */
+
+    index_t _rowOffset(index_t row) const {
+        return this->_upper ? (row * this->_n - (row * (row - 1)) / 2) : ((row * (row + 1)) / 2);
+    } /* index_t _rowOffset(index_t row) const */
+
+    /**
+     * Returns the address of element (row, col), which must lie in the stored triangle
+     */
+
+    T* _element(index_t row, index_t col) {
+        return this->_packed.data() + this->_rowOffset(row) + (col - this->_rowFirst(row));
+    } /* T* _element(index_t row, index_t col) */
+
+    const T* _element(index_t row, index_t col) const {
+        return this->_packed.data() + this->_rowOffset(row) + (col - this->_rowFirst(row));
+    } /* const T* _element(index_t row, index_t col) const */
+
+    /**
+     * Returns true if element (row, col) lies in the stored triangle
+     */
+
+    bool _stored(index_t row, index_t col) const {
+        return this->_upper ? (col >= row) : (col <= row);
+    } /* bool _stored(index_t row, index_t col) const */
+
+public:
+
+    /* Below are public constructors for the TriMat class */
+
+    /**
+     * Constructs an n x n triangular matrix of zeros
+     * @param n Number of rows and columns
+     * @param type triangle::upper or triangle::lower
+     */
+
+    TriMat(index_t n, triangle::triangleType type) : _n(n), _upper(type == triangle::upper) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (n < 0) {
+            throw ORCAExcept::BadDimensionsError(); // Negative dimensions
+        }
+#endif
+#ifndef ORCA_DISABLE_EMPTY_CHECKS
+        if (n == 0) {
+            throw ORCAExcept::EmptyElementError(); // Zero rows or columns
+        }
+#endif
+        this->_packed.assign(static_cast<std::size_t>((n * (n + 1)) / 2), T(0));
+    } /* TriMat(index_t n, triangle::triangleType type) */
+
+    /**
+     * Constructs a triangular matrix from the given triangle of a square dense matrix.
+     * Elements of the other triangle are ignored
+     * @param dense Square dense matrix
+     * @param type triangle::upper or triangle::lower
+     */
+
+    TriMat(const Mat<T>& dense, triangle::triangleType type) : TriMat(dense.rows(), type) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (dense.rows() != dense.cols()) {
+            throw ORCAExcept::BadDimensionsError(); // Triangular matrices are square
+        }
+#endif
+        index_t i, j;
+        for (i = 0; i < this->_n; ++i) {
+            T* row = this->_element(i, this->_rowFirst(i));
+            for (j = this->_rowFirst(i); j < this->_rowLast(i); ++j) {
+                row[j - this->_rowFirst(i)] = dense.at(i, j);
+            }
+        }
+    } /* TriMat(const Mat<T>& dense, triangle::triangleType type) */
+
+    /* Below are public getters and setters for the TriMat class */
+
+    /**
+     * Returns the number of rows in the matrix
+     */
+
+    index_t rows() const {
+        return this->_n;
+    } /* index_t rows() const */
+
+    /**
+     * Returns the number of columns in the matrix
+     */
+
+    index_t cols() const {
+        return this->_n;
+    } /* index_t cols() const */
+
+    /**
+     * Returns true for an upper triangular matrix
+     */
+
+    bool isUpper() const {
+        return this->_upper;
+    } /* bool isUpper() const */
+
+    /**
+     * Returns true for a lower triangular matrix
+     */
+
+    bool isLower() const {
+        return !this->_upper;
+    } /* bool isLower() const */
+
+    /**
+     * Returns the element at the specified index, zero outside the stored triangle
+     * @param row Element Row Index
+     * @param col Element Column Index
+     */
+
+    T at(index_t row, index_t col) const {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if ((row < 0) || (row >= this->_n) || (col < 0) || (col >= this->_n)) {
+            throw ORCAExcept::OutOfBoundsError(); // Either negative indexing or over indexing
+        }
+#endif
+        return this->_stored(row, col) ? *this->_element(row, col) : T(0);
+    } /* T at(index_t row, index_t col) const */
+
+    /**
+     * Sets the element at the specified index.
+     * An ORCA_OUT_OF_BOUNDS exception is thrown should the index lie outside the stored triangle
+     * @param row Element Row Index
+     * @param col Element Column Index
+     * @param elem Element Value
+     */
+
+    void set(index_t row, index_t col, T elem) {
+#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+        if ((row < 0) || (row >= this->_n) || (col < 0) || (col >= this->_n) || !this->_stored(row, col)) {
+            throw ORCAExcept::OutOfBoundsError(); // Outside the matrix or its triangle
+        }
+#endif
+        *this->_element(row, col) = elem;
+    } /* void set(index_t row, index_t col, T elem) */
+
+    /**
+     * Returns the packed elements, n(n+1)/2 entries
+     */
+
+    const T* data() const {
+        return this->_packed.data();
+    } /* const T* data() const */
+
+    /* Below are public member functions of the TriMat class */
+
+    /**
+     * Returns a dense copy of the matrix
+     */
+
+    Mat<T> dense() const {
+        Mat<T> result(this->_n, this->_n, fill::zeros);
+        T* c = result.data();
+        index_t i, j;
+        for (i = 0; i < this->_n; ++i) {
+            const T* row = this->_element(i, this->_rowFirst(i));
+            for (j = this->_rowFirst(i); j < this->_rowLast(i); ++j) {
+                c[i * result.stride() + j] = row[j - this->_rowFirst(i)];
+            }
+        }
+        return result;
+    } /* Mat<T> dense() const */
+
+    /**
+     * Returns the transpose, which is triangular of the other kind
+     */
+
+    TriMat<T> t() const {
+        TriMat<T> result(this->_n, this->_upper ? triangle::lower : triangle::upper);
+        index_t i, j;
+        for (i = 0; i < this->_n; ++i) {
+            for (j = this->_rowFirst(i); j < this->_rowLast(i); ++j) {
+                *result._element(j, i) = *this->_element(i, j);
+            }
+        }
+        return result;
+    } /* TriMat<T> t() const */
+
+    /**
+     * Returns the determinant, the product of the diagonal
+     */
+
+    T det() const {
+        T result = T(1);
+        index_t i;
+        for (i = 0; i < this->_n; ++i) {
+            result = result * (*this->_element(i, i));
+        }
+        return result;
+    } /* T det() const */
+
+    /**
+     * Returns the inverse, which is triangular of the same kind. Row i of the inverse is
+     * -(1 / a_ii) times the sum of a_ik times row k of the inverse over the stored k != i.
+     * An ORCA_SINGULAR_MATRIX exception is thrown should a diagonal element be zero
+     */
+
+    TriMat<T> inv() const {
+        TriMat<T> result(this->_n, this->_upper ? triangle::upper : triangle::lower);
+        index_t step, i, k, j;
+        for (step = 0; step < this->_n; ++step) {
+            /* Rows that the current row depends on are computed first */
+            i = this->_upper ? (this->_n - 1 - step) : step;
+            const T pivot = *this->_element(i, i);
+            if (pivot == T(0)) {
+                throw ORCAExcept::SingularMatrixError(); // No inverse
+            }
+            const T pivotInverse = T(1) / pivot;
+            T* out = result._element(i, result._rowFirst(i));
+            const index_t outFirst = result._rowFirst(i);
+            for (k = this->_rowFirst(i); k < this->_rowLast(i); ++k) {
+                if (k == i) {
+                    continue;
+                }
+                const T scale = -(*this->_element(i, k)) * pivotInverse;
+                const T* source = result._element(k, result._rowFirst(k));
+                for (j = result._rowFirst(k); j < result._rowLast(k); ++j) {
+                    out[j - outFirst] = out[j - outFirst] + scale * source[j - result._rowFirst(k)];
+                }
+            }
+            *result._element(i, i) = pivotInverse;
+        }
+        return result;
+    } /* TriMat<T> inv() const */
+
+    /**
+     * Overwrites x (n x p, row-major) with the solution of A * x = x by substitution.
+     * An ORCA_SINGULAR_MATRIX exception is thrown should a diagonal element be zero
+     */
+
+    void _substitute(T* x, index_t ldx, index_t p) const {
+        index_t step, i, k, j;
+        for (step = 0; step < this->_n; ++step) {
+            i = this->_upper ? (this->_n - 1 - step) : step;
+            const T pivot = *this->_element(i, i);
+            if (pivot == T(0)) {
+                throw ORCAExcept::SingularMatrixError(); // No unique solution
+            }
+            T* target = x + i * ldx;
+            for (k = this->_rowFirst(i); k < this->_rowLast(i); ++k) {
+                if (k == i) {
+                    continue;
+                }
+                const T scale = *this->_element(i, k);
+                const T* source = x + k * ldx;
+                for (j = 0; j < p; ++j) {
+                    target[j] = target[j] - scale * source[j];
+                }
+            }
+            const T pivotInverse = T(1) / pivot;
+            for (j = 0; j < p; ++j) {
+                target[j] = target[j] * pivotInverse;
+            }
+        }
+    } /* void _substitute(T* x, index_t ldx, index_t p) const */
+
+    /**
+     * Solves A * x = b in O(n^2) per right hand side
+     * @param b Right hand sides
+     */
+
+    Mat<T> solve(const Mat<T>& b) const {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (b.rows() != this->_n) {
+            throw ORCAExcept::BadDimensionsError(); // Right hand side does not match
+        }
+#endif
+        Mat<T> x(b);
+        this->_substitute(x.data(), x.stride(), x.cols());
+        return x;
+    } /* Mat<T> solve(const Mat<T>& b) const */
+
+    /**
+     * Solves A * x = b in O(n^2)
+     * @param b Right hand side
+     */
+
+    ColVec<T> solve(const ColVec<T>& b) const {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (b.rows() != this->_n) {
+            throw ORCAExcept::BadDimensionsError(); // Right hand side does not match
+        }
+#endif
+        ColVec<T> x(b);
+        this->_substitute(x.data(), x.stride(), 1);
+        return x;
+    } /* ColVec<T> solve(const ColVec<T>& b) const */
+
+    /**
+     * Computes C = A * B for a dense row-major B (p columns) into a dense row-major C
+     */
+
+    void _multiply(const T* b, index_t ldb, index_t p, T* c, index_t ldc) const {
+        _parallelFor(0, this->_n, ((this->_n * (this->_n + 1)) / 2) * p, [&](index_t first, index_t last) {
+            index_t i, k, j;
+            for (i = first; i < last; ++i) {
+                const T* row = this->_element(i, this->_rowFirst(i));
+                T* out = c + i * ldc;
+                if (p == 1) {
+                    /* Vector products accumulate each row in a register */
+                    T sum = T(0);
+                    for (k = this->_rowFirst(i); k < this->_rowLast(i); ++k) {
+                        sum = sum + row[k - this->_rowFirst(i)] * b[k * ldb];
+                    }
+                    out[0] = sum;
+                    continue;
+                }
+                for (j = 0; j < p; ++j) {
+                    out[j] = T(0);
+                }
+                for (k = this->_rowFirst(i); k < this->_rowLast(i); ++k) {
+                    const T scale = row[k - this->_rowFirst(i)];
+                    const T* source = b + k * ldb;
+                    for (j = 0; j < p; ++j) {
+                        out[j] = out[j] + scale * source[j];
+                    }
+                }
+            }
+        });
+    } /* void _multiply(const T* b, index_t ldb, index_t p, T* c, index_t ldc) const */
+
+    /**
+     * Computes C = B * A for a dense row-major B (m rows) into a dense row-major C
+     */
+
+    void _multiplyLeft(const T* b, index_t ldb, index_t m, T* c, index_t ldc) const {
+        _parallelFor(0, m, ((this->_n * (this->_n + 1)) / 2) * m, [&](index_t first, index_t last) {
+            index_t i, k, j;
+            for (i = first; i < last; ++i) {
+                T* out = c + i * ldc;
+                for (j = 0; j < this->_n; ++j) {
+                    out[j] = T(0);
+                }
+                for (k = 0; k < this->_n; ++k) {
+                    const T scale = b[i * ldb + k];
+                    const T* row = this->_element(k, this->_rowFirst(k));
+                    for (j = this->_rowFirst(k); j < this->_rowLast(k); ++j) {
+                        out[j] = out[j] + scale * row[j - this->_rowFirst(k)];
+                    }
+                }
+            }
+        });
+    } /* void _multiplyLeft(const T* b, index_t ldb, index_t m, T* c, index_t ldc) const */
+
+}; /* class TriMat */
+
+/* Triangular matrices are not scalars to the element-wise operators of Mat */
+
+template <class T>
+struct _matrixLike<TriMat<T>> : std::true_type {};
+
+/* Below are the overloaded math operators for the TriMat class */
+
+/**
+ * Triangular matrix times dense matrix
+ * @param a Triangular matrix
+ * @param b Dense matrix
+ * @return Dense product
+ */
+
+template <class T>
+Mat<T> operator * (const TriMat<T>& a, const Mat<T>& b) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (a.cols() != b.rows()) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions do not agree
+    }
+#endif
+    if (!b.isDense()) {
+        return a * Mat<T>(b); // Views are materialized first
+    }
+    Mat<T> result(a.rows(), b.cols());
+    a._multiply(b.data(), b.stride(), b.cols(), result.data(), result.stride());
+    return result;
+} /* Mat<T> operator * (const TriMat<T>& a, const Mat<T>& b) */
+
+/**
+ * Triangular matrix times dense column vector
+ * @param a Triangular matrix
+ * @param x Dense vector
+ * @return Dense product
+ */
+
+template <class T>
+ColVec<T> operator * (const TriMat<T>& a, const ColVec<T>& x) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (a.cols() != x.rows()) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions do not agree
+    }
+#endif
+    if (!x.isDense()) {
+        return a * ColVec<T>(x); // Views are materialized first
+    }
+    ColVec<T> result(static_cast<int>(a.rows()));
+    a._multiply(x.data(), x.stride(), 1, result.data(), result.stride());
+    return result;
+} /* ColVec<T> operator * (const TriMat<T>& a, const ColVec<T>& x) */
+
+/**
+ * Dense matrix times triangular matrix
+ * @param b Dense matrix
+ * @param a Triangular matrix
+ * @return Dense product
+ */
+
+template <class T>
+Mat<T> operator * (const Mat<T>& b, const TriMat<T>& a) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+    if (b.cols() != a.rows()) {
+        throw ORCAExcept::BadDimensionsError(); // Inner dimensions do not agree
+    }
+#endif
+    if (!b.isDense()) {
+        return Mat<T>(b) * a; // Views are materialized first
+    }
+    Mat<T> result(b.rows(), a.cols());
+    a._multiplyLeft(b.data(), b.stride(), b.rows(), result.data(), result.stride());
+    return result;
+} /* Mat<T> operator * (const Mat<T>& b, const TriMat<T>& a) */
+
+/* Below are nonmember functions for the TriMat class */
+
+/**
+ * Returns the determinant of a triangular matrix
+ * @param _m1 Triangular matrix
+ */
+
+template <class T>
+T det(const TriMat<T>& _m1) {
+    return _m1.det();
+} /* T det(const TriMat<T>& _m1) */
+
+/**
+ * Returns the inverse of a triangular matrix
+ * @param _m1 Triangular matrix
+ */
+
+template <class T>
+TriMat<T> inv(const TriMat<T>& _m1) {
+    return _m1.inv();
+} /* TriMat<T> inv(const TriMat<T>& _m1) */
+
+/**
+ * Returns a dense copy of a triangular matrix
+ * @param _m1 Triangular matrix
+ */
+
+template <class T>
+Mat<T> dense(const TriMat<T>& _m1) {
+    return _m1.dense();
+} /* Mat<T> dense(const TriMat<T>& _m1) */
+
+/* Below are overloaded stream operators for the TriMat class */
+
+template <class T>
+std::ostream& operator<<(std::ostream& os, const TriMat<T>& m) {
+    os << m.dense();
+    return os;
+} /* std::ostream& operator<<(std::ostream& os, const TriMat<T>& m) */
+
+} /* namespace ORCA */
+
+#endif /* TriMat_h */
@@ -14,6 +14,7 @@
 
 #include "Except.h" // Included for ORCA Exceptions
 #include "Mat.h"    // Included for Matrix subclassing
+#include <utility>  // Included for std::move
 
 namespace ORCA {
 
@@ -49,11 +50,13 @@ protected:
     
     virtual void _allocate(index_t n_elems) {
 #ifndef ORCA_DISABLE_EMPTY_CHECKS
-        if (_n_elems < 0) {
+        if (n_elems < 0) {
             throw ORCAExcept::EmptyElementError(); // Attempting to allocate an empty vector
         }
 #endif
-        this->_mat = static_cast<T*>(malloc(sizeof(T) * n_elems));
+        this->_mat = static_cast<T*>(_allocateStorage(sizeof(T) * n_elems));
+        this->_owner = true;
+        this->_ld = n_elems;
         this->_n_elems = n_elems;
         this->_n_cols = n_elems;
         this->_n_rows = 1;
@@ -65,11 +68,7 @@ protected:
      */
     
     virtual T* _address(index_t elem) const {
-#ifndef ORCA_DISABLE_BOUNDS_CHECKS
-        if ((elem < 0) || (elem > this->length())) {
-            throw ORCAExcept::OutOfBoundsError(); // Attempting to index out of bounds
-        }
-#endif
+        _checkIndex<checks::Default>(elem, this->length());
         return this->_mat + elem;
     } /* virtual T* _address(index_t elem) const */
     
@@ -77,6 +76,25 @@ public:
     
     /* Below are public constructors for the Vec class */
     
+    /**
+     * Copy constructor. Performs a deep copy of _other
+     * @param _other vector to copy
+     */
+    
+    Vec(const Vec<T>& _other) : Mat<T>(_other) {
+        this->_n_elems = _other._n_elems;
+    } /* Vec(const Vec<T>& _other) */
+    
+    /**
+     * Move constructor. Takes ownership of the storage of _other, leaving it empty
+     * @param _other vector to move
+     */
+    
+    Vec(Vec<T>&& _other) : Mat<T>(std::move(_other)) {
+        this->_n_elems = _other._n_elems;
+        _other._n_elems = 0;
+    } /* Vec(Vec<T>&& _other) */
+    
     /**
      * Casted constructor from another vector
      * @tparam T1 class of other vector
@@ -87,7 +105,7 @@ public:
         this->_allocate(_casted.length());
         index_t i;
         for (i = 0; i < _casted.length(); ++i) {
-            this->set(i, _casted.at(i));
+            this->unchecked_set(i, _casted.unchecked_at(i));
         }
     }
     
@@ -110,7 +128,7 @@ public:
      * @param elements number of elements in vector
      */
     
-    Vec(index_t elements) : Mat<T>(1, elements) {
+    Vec(index_t elements) {
         this->_allocate(elements);
     } /* Vec(index_t elements) */
     
@@ -123,10 +141,38 @@ public:
         this->_allocate(_casted_values.size());
         index_t i;
         for (i = 0; i < this->_n_elems; ++i) {
-            this->set(i, *(_casted_values.begin() + i));
+            this->unchecked_set(i, *(_casted_values.begin() + i));
         }
     } /* Vec(std::initializer_list<T> _casted_values) */
     
+    /* Below are public operators for the Vec class */
+    
+    /**
+     * Copy assignment operator. Performs a deep copy of _other
+     * @param _other vector to copy
+     */
+    
+    Vec<T>& operator = (const Vec<T>& _other) {
+        Mat<T>::operator=(_other);
+        this->_n_elems = _other._n_elems;
+        return *this;
+    } /* Vec<T>& operator = (const Vec<T>& _other) */
+    
+    /**
+     * Move assignment operator. Takes ownership of the storage of _other, leaving it empty
+     * @param _other vector to move
+     */
+    
+    Vec<T>& operator = (Vec<T>&& _other) {
+        index_t n_elems = _other._n_elems;
+        Mat<T>::operator=(std::move(_other));
+        this->_n_elems = n_elems;
+        if ((this != &_other) && !_other._owner) {
+            _other._n_elems = 0;
+        }
+        return *this;
+    } /* Vec<T>& operator = (Vec<T>&& _other) */
+    
     /* Below are public setters for the Vec class */
     
     /**
@@ -139,9 +185,7 @@ public:
         /* Assign Element */
         *(this->_address(index)) = elem;
         /* Reset Sticky Compute Mask */
-#ifndef ORCA_DISABLE_STICKY_COMPUTE
-        this->_stickyComputeMask = 0;
-#endif
+        this->_touch();
     } /* virtual void set(index_t index, T elem) */
     
     /**
@@ -152,18 +196,16 @@ public:
      */
     
     virtual void set(index_t row, index_t col, T elem) override {
-#ifndef ORCA_DISABLE_BOUNDS_CHECKS
-        /* Check for out of bounds indexing */
-        if (row != 0) {
-            throw ORCAExcept::OutOfBoundsError(); // Indexed past first row of vector
+        if constexpr (checks::Default::bounds) {
+            /* Check for out of bounds indexing */
+            if (row != 0) {
+                throw ORCAExcept::OutOfBoundsError(); // Indexed past first row of vector
+            }
         }
-#endif
         /* Assign Element */
         *(this->_address(col)) = elem;
         /* Reset Sticky Compute Mask */
-#ifndef ORCA_DISABLE_STICKY_COMPUTE
-        this->_stickyComputeMask = 0;
-#endif
+        this->_touch();
     } /* virtual void set(index_t row, index_t col, T elem) override */
     
     /* Below are public getters for the Vec class */
@@ -178,6 +220,39 @@ public:
         return *(this->_address(index)); //Index the matrix
     } /* virtual T at(index_t index) const */
     
+    using Mat<T>::unchecked_at;
+    using Mat<T>::unchecked_set;
+    
+    /**
+     * Returns the element at the specified index without bounds checks, for inner loops whose
+     * indices are already known to be valid. Vectors owning their storage are read directly
+     * @param index Element  Index
+     * @return element at index
+     */
+    
+    T unchecked_at(index_t index) const {
+        if (this->_owner) {
+            return this->_mat[index];
+        }
+        return this->at(index);
+    } /* T unchecked_at(index_t index) const */
+    
+    /**
+     * Assigns an element without bounds checks, for inner loops whose indices are already known
+     * to be valid. Vectors owning their storage are written directly
+     * @param index Element  Index
+     * @param elem Element
+     */
+    
+    void unchecked_set(index_t index, T elem) {
+        if (this->_owner) {
+            this->_mat[index] = elem;
+            this->_touch();
+            return;
+        }
+        this->set(index, elem);
+    } /* void unchecked_set(index_t index, T elem) */
+    
     /**
      * Returns element at the specified index
      * @param row Element Row Index
@@ -186,12 +261,12 @@ public:
      */
     
     virtual T at(index_t row, index_t col) const override {
-#ifndef ORCA_DISABLE_BOUNDS_CHECKS
-        /* Check for out of bounds indexing */
-        if (row != 0) {
-            throw ORCAExcept::OutOfBoundsError(); // Indexed past first row of vector
+        if constexpr (checks::Default::bounds) {
+            /* Check for out of bounds indexing */
+            if (row != 0) {
+                throw ORCAExcept::OutOfBoundsError(); // Indexed past first row of vector
+            }
         }
-#endif
         return *(this->_address(col)); //Index the matrix
     } /* virtual T at(index_t row, index_t col) const override */
     
@@ -208,7 +283,7 @@ public:
         index_t i;
         T result = 0;
         for (i = 0; i < this->length(); ++i) {
-            result += this->at(i);
+            result += this->unchecked_at(i);
         }
         return result;
     } /* T sum() const */
@@ -222,7 +297,7 @@ public:
         index_t i;
         T result = 1;
         for (i = 0; i < this->length(); ++i) {
-            result *= this->at(i);
+            result *= this->unchecked_at(i);
         }
         return result;
     } /* T sum() const */
@@ -280,6 +355,22 @@ public:
         this->_allocate(elements);
     } /* RowVec(int elements) */
     
+    /**
+     * Copy constructor. Performs a deep copy of _other
+     * @param _other vector to copy
+     */
+    
+    RowVec(const RowVec<T>& _other) : Vec<T>(_other) {
+    } /* RowVec(const RowVec<T>& _other) */
+    
+    /**
+     * Move constructor. Takes ownership of the storage of _other, leaving it empty
+     * @param _other vector to move
+     */
+    
+    RowVec(RowVec<T>&& _other) : Vec<T>(std::move(_other)) {
+    } /* RowVec(RowVec<T>&& _other) */
+    
     /**
      * Constructs a vector from an initializer list
      * @param _casted_values values to cast to vector
@@ -298,7 +389,7 @@ public:
         this->_allocate(_casted.length());
         index_t i;
         for (i = 0; i < _casted.length(); ++i) {
-            this->set(i, _casted.at(i));
+            this->unchecked_set(i, _casted.unchecked_at(i));
         }
     }
     
@@ -326,10 +417,31 @@ public:
         this->_allocate(_casted.length());
         index_t i;
         for (i = 0; i < _casted.length(); ++i) {
-            this->set(i, _casted.at(i));
+            this->unchecked_set(i, _casted.unchecked_at(i));
         }
     }
     
+    /* Below are the public operators for the RowVec class */
+    
+    /**
+     * Copy assignment operator. Performs a deep copy of _other
+     * @param _other vector to copy
+     */
+    
+    RowVec<T>& operator = (const RowVec<T>& _other) {
+        Vec<T>::operator=(_other);
+        return *this;
+    } /* RowVec<T>& operator = (const RowVec<T>& _other) */
+    
+    /**
+     * Move assignment operator. Takes ownership of the storage of _other, leaving it empty
+     * @param _other vector to move
+     */
+    
+    RowVec<T>& operator = (RowVec<T>&& _other) {
+        Vec<T>::operator=(std::move(_other));
+        return *this;
+    } /* RowVec<T>& operator = (RowVec<T>&& _other) */
     
 };
 
@@ -338,7 +450,7 @@ public:
  */
 
 template <class T>
-class ColVec : public Vec<T> {
+class ColVec<T, ORCA_DYNAMIC> : public Vec<T> {
 protected:
     
     /* Below are protected member functions for the ColVec class */
@@ -354,10 +466,12 @@ protected:
             throw ORCAExcept::EmptyElementError(); // Attempting to allocate an empty vector
         }
 #endif
-        this->_mat = static_cast<T*>(malloc(sizeof(T) * _n_elems));
+        this->_mat = static_cast<T*>(_allocateStorage(sizeof(T) * _n_elems));
+        this->_owner = true;
         this->_n_elems = _n_elems;
         this->_n_cols = 1;
         this->_n_rows = _n_elems;
+        this->_ld = 1;
     } /* virtual void _allocate(index_t _n_elems) */
     
     /* Below are the protected constructors for the RowVec class */
@@ -368,13 +482,6 @@ protected:
     
 public:
     
-    /* Below are the public destructors for the RowVec class */
-    
-    ~ColVec() {
-        //TODO: Pointer being freed was not allocated error
-        //delete this->_vec;
-    } /* ~RowVec() */
-    
     /* Below are the public constructors for the RowVec class */
     
     /**
@@ -386,12 +493,33 @@ public:
         this->_allocate(elements);
     } /* RowVec(int elements) */
     
+    /**
+     * Copy constructor. Performs a deep copy of _other
+     * @param _other vector to copy
+     */
+    
+    ColVec(const ColVec<T>& _other) : Vec<T>(_other) {
+    } /* ColVec(const ColVec<T>& _other) */
+    
+    /**
+     * Move constructor. Takes ownership of the storage of _other, leaving it empty
+     * @param _other vector to move
+     */
+    
+    ColVec(ColVec<T>&& _other) : Vec<T>(std::move(_other)) {
+    } /* ColVec(ColVec<T>&& _other) */
+    
     /**
      * Constructs a vector from an initializer list
      * @param _casted_values values to cast to vector
      */
     
-    ColVec(std::initializer_list<T> _casted_values) : Vec<T>(_casted_values){
+    ColVec(std::initializer_list<T> _casted_values) {
+        this->_allocate(_casted_values.size());
+        index_t i;
+        for (i = 0; i < this->_n_elems; ++i) {
+            this->unchecked_set(i, *(_casted_values.begin() + i));
+        }
     } /* ColVec(std::initializer_list<T> _casted_values) */
     
     /**
@@ -404,7 +532,7 @@ public:
         this->_allocate(_casted.length());
         index_t i;
         for (i = 0; i < _casted.length(); ++i) {
-            this->set(i, _casted.at(i));
+            this->unchecked_set(i, _casted.unchecked_at(i));
         }
     }
     
@@ -422,6 +550,63 @@ public:
         }
     }
     
+    /**
+     * Constructor from a matrix expression with a single column
+     * @tparam E class of the expression
+     * @param _expr Expression to evaluate
+     */
+    
+    template <class E>
+    ColVec(const MatExpr<E>& _expr) {
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
+        if (_expr.cols() != 1) {
+            throw ORCAExcept::BadDimensionsError(); // Expression is not a column
+        }
+#endif
+        this->_allocate(_expr.rows());
+        _expr._evalInto(this->_mat, this->_ld);
+    } /* ColVec(const MatExpr<E>& _expr) */
+    
+    /* Below are the public operators for the ColVec class */
+    
+    /**
+     * Copy assignment operator. Performs a deep copy of _other
+     * @param _other vector to copy
+     */
+    
+    ColVec<T>& operator = (const ColVec<T>& _other) {
+        Vec<T>::operator=(_other);
+        return *this;
+    } /* ColVec<T>& operator = (const ColVec<T>& _other) */
+    
+    /**
+     * Move assignment operator. Takes ownership of the storage of _other, leaving it empty
+     * @param _other vector to move
+     */
+    
+    ColVec<T>& operator = (ColVec<T>&& _other) {
+        Vec<T>::operator=(std::move(_other));
+        return *this;
+    } /* ColVec<T>& operator = (ColVec<T>&& _other) */
+    
+    /**
+     * Assignment from a matrix expression with a single column.
+     * Evaluates in place when the length matches and the expression does not alias this vector
+     * @tparam E class of the expression
+     * @param _expr Expression to evaluate
+     */
+    
+    template <class E>
+    ColVec<T>& operator = (const MatExpr<E>& _expr) {
+        if (this->_owner && (this->_n_rows == _expr.rows()) && (_expr.cols() == 1) && !_expr.aliases(*this)) {
+            _expr._evalInto(this->_mat, this->_ld);
+            this->_touch();
+            return *this;
+        }
+        ColVec<T> temp(_expr);
+        return (*this = std::move(temp));
+    } /* ColVec<T>& operator = (const MatExpr<E>& _expr) */
+    
     /* Below are the public setters for the ColVec class */
     
     /**
@@ -434,9 +619,7 @@ public:
         /* Assign Element */
         *(this->_address(index)) = elem;
         /* Reset Sticky Compute Mask */
-#ifndef ORCA_DISABLE_STICKY_COMPUTE
-        this->_stickyComputeMask = 0;
-#endif
+        this->_touch();
     } /* virtual void set(index_t index, T elem) */
     
     
@@ -448,18 +631,16 @@ public:
      */
     
     virtual void set(index_t row, index_t col, T elem) override {
-#ifndef ORCA_DISABLE_BOUNDS_CHECKS
-        /* Check for out of bounds indexing */
-        if (col != 0) {
-            throw ORCAExcept::OutOfBoundsError(); // Indexed past first row of vector
+        if constexpr (checks::Default::bounds) {
+            /* Check for out of bounds indexing */
+            if (col != 0) {
+                throw ORCAExcept::OutOfBoundsError(); // Indexed past first row of vector
+            }
         }
-#endif
         /* Assign Element */
         *(this->_address(row)) = elem;
         /* Reset Sticky Compute Mask */
-#ifndef ORCA_DISABLE_STICKY_COMPUTE
-        this->_stickyComputeMask = 0;
-#endif
+        this->_touch();
     } /* virtual void set(index_t row, index_t col, T elem) override */
     
     /* Below are the public getters for the ColVec class */
@@ -489,12 +670,12 @@ public:
      */
     
     virtual T at(index_t row, index_t col) const override {
-#ifndef ORCA_DISABLE_BOUNDS_CHECKS
-        /* Check for out of bounds indexing */
-        if (col != 0) {
-            throw ORCAExcept::OutOfBoundsError(); // Indexed past first row of vector
+        if constexpr (checks::Default::bounds) {
+            /* Check for out of bounds indexing */
+            if (col != 0) {
+                throw ORCAExcept::OutOfBoundsError(); // Indexed past first row of vector
+            }
         }
-#endif
         return *(this->_address(row)); //Index the matrix
     } /* virtual T at(index_t row, index_t col) const override */
     
@@ -510,7 +691,7 @@ auto dot(Vec<T1> v1, Vec<T2> v2) {
     }
 #endif
     
-#ifndef ORCA_DISABLE_BOUNDS_CHECKS
+#ifndef ORCA_DISABLE_DIMENSIONS_CHECKS
     if (v1.length() != v2.length()) {
         throw ORCAExcept::BadDimensionsError(); // Attempting to dot 2 vectors with incompatible dimensions
     }
@@ -518,7 +699,7 @@ auto dot(Vec<T1> v1, Vec<T2> v2) {
     auto result = v1.at(0) * v2.at(0);
     index_t i;
     for (i = 1; i < v1.length(); ++i) {
-        result += v1.at(i) * v2.at(i);
+        result += v1.unchecked_at(i) * v2.unchecked_at(i);
     }
     return result;
 } /* auto dot(Vec<T1> v1, Vec<T2> v2) */
@@ -532,6 +713,22 @@ class Mat<T>::MatRow : public RowVec<T> {
     /* Below are the private member variables for the MatRow class */
     Mat<T>* _matrix;        // Stores a pointer to the matrix the row belongs to
     index_t _row;               // Stores the row number in _matrix
+    
+    /**
+     * Points this container at the same parent row as _other
+     * @param _other Row container to copy
+     */
+    
+    void _rebind(const MatRow& _other) {
+        this->_matrix = _other._matrix;
+        this->_row = _other._row;
+        this->_mat = _other._mat;
+        this->_ld = _other._ld;
+        this->_n_elems = _other._n_elems;
+        this->_n_cols = _other._n_cols;
+        this->_n_rows = 1;
+    }
+    
 public:
     
     /* Below are all public constructors for the MatRow class */
@@ -542,12 +739,7 @@ public:
      * @param row Row number
      */
     
-    MatRow(Mat<T> matrix, index_t row) {
-        this->_matrix = &matrix;
-        this->_row = row;
-        this->_n_elems = matrix.cols();
-        this->_n_cols = matrix.cols();
-        this->_n_rows = 1;
+    MatRow(Mat<T>& matrix, index_t row) : MatRow(&matrix, row) {
     }
     
     /**
@@ -562,7 +754,34 @@ public:
         this->_n_elems = matrix->cols();
         this->_n_cols = matrix->cols();
         this->_n_rows = 1;
+        if (matrix->isDense()) {
+            /* Rows of dense matrices are read directly from the parent storage */
+            this->_mat = matrix->_mat + row * matrix->_ld;
+            this->_ld = matrix->_ld;
+        }
+    }
+    
+    /**
+     * Copy constructor. Copies the reference to the parent matrix, no elements are copied
+     * @param _other Row container to copy
+     */
+    
+    MatRow(const MatRow& _other) {
+        this->_rebind(_other);
+    }
+    
+    /* Below are public operators for the MatRow class */
+    
+    /**
+     * Assignment operator. Rebinds the container to the parent row of _other
+     * @param _other Row container to copy
+     */
+    
+    MatRow& operator = (const MatRow& _other) {
+        this->_rebind(_other);
+        return *this;
     }
+    
     /* Below are public getters for the MatRow class */
     
     /**
@@ -584,6 +803,52 @@ public:
         return this->_matrix->at(this->_row, col); //Index the matrix
     }
     
+    /**
+     * Assigns an element of the row in the parent matrix
+     * @param index Element Index
+     * @param elem Element Value
+     */
+    
+    virtual void set(index_t index, T elem) override {
+        this->_matrix->set(this->_row, index, elem);
+    }
+    
+    /**
+     * Assigns an element of the row in the parent matrix
+     * @param row Element Row Index
+     * @param col Element Column Index
+     * @param elem Element Value
+     */
+    
+    virtual void set(index_t row, index_t col, T elem) override {
+        if constexpr (checks::Default::bounds) {
+            if (row != 0) {
+                throw ORCAExcept::OutOfBoundsError(); // Indexed outside row bounds
+            }
+        }
+        this->_matrix->set(this->_row, col, elem);
+    }
+    
+    using Mat<T>::data;
+    
+    /**
+     * Returns a pointer to the first element of the row in the parent storage, nullptr for lazy
+     * parents. The parent matrix discards its cached results
+     */
+    
+    virtual T* data() override {
+        this->_matrix->_touch();
+        return this->_mat;
+    }
+    
+    /**
+     * Returns the storage of the matrix the row belongs to
+     */
+    
+    virtual const void* storage() const override {
+        return this->_matrix->storage();
+    } /* virtual const void* storage() const override */
+    
 };
 
 /* MatCol Class: Vector that points to a specific column in a matrix */
@@ -593,6 +858,22 @@ class Mat<T>::MatCol : public ColVec<T> {
     /* Below are the private member variables for the MatRow class */
     Mat<T>* _matrix;        // Stores a pointer to the matrix the row belongs to
     index_t _col;               // Stores the col number in _matrix
+    
+    /**
+     * Points this container at the same parent column as _other
+     * @param _other Column container to copy
+     */
+    
+    void _rebind(const MatCol& _other) {
+        this->_matrix = _other._matrix;
+        this->_col = _other._col;
+        this->_mat = _other._mat;
+        this->_ld = _other._ld;
+        this->_n_elems = _other._n_elems;
+        this->_n_cols = 1;
+        this->_n_rows = _other._n_rows;
+    }
+    
 public:
     
     /* Below are all public constructors for the MatCol class */
@@ -603,12 +884,7 @@ public:
      * @param col Column number
      */
     
-    MatCol(Mat<T> matrix, index_t col) {
-        this->_matrix = &matrix;
-        this->_col = col;
-        this->_n_elems = matrix.rows();
-        this->_n_cols = 1;
-        this->_n_rows = matrix.cols();
+    MatCol(Mat<T>& matrix, index_t col) : MatCol(&matrix, col) {
     }
     
     /**
@@ -623,6 +899,32 @@ public:
         this->_n_elems = matrix->rows();
         this->_n_cols = 1;
         this->_n_rows = matrix->rows();
+        if (matrix->isDense()) {
+            /* Columns of dense matrices are read directly from the parent storage, one row stride apart */
+            this->_mat = matrix->_mat + col;
+            this->_ld = matrix->_ld;
+        }
+    }
+    
+    /**
+     * Copy constructor. Copies the reference to the parent matrix, no elements are copied
+     * @param _other Column container to copy
+     */
+    
+    MatCol(const MatCol& _other) {
+        this->_rebind(_other);
+    }
+    
+    /* Below are public operators for the MatCol class */
+    
+    /**
+     * Assignment operator. Rebinds the container to the parent column of _other
+     * @param _other Column container to copy
+     */
+    
+    MatCol& operator = (const MatCol& _other) {
+        this->_rebind(_other);
+        return *this;
     }
     
     /**
@@ -641,14 +943,60 @@ public:
      */
     
     virtual T at(index_t row, index_t col) const override {
-#ifndef ORCA_DISABLE_BOUNDS_CHECKS
-        if (col != this->_col) {
-            throw ORCAExcept::OutOfBoundsError(); // Indexed outside col bounds
+        if constexpr (checks::Default::bounds) {
+            if (col != 0) {
+                throw ORCAExcept::OutOfBoundsError(); // Indexed outside col bounds
+            }
         }
-#endif
-        return this->_matrix->at(this->_col, row); //Index the matrix
+        return this->_matrix->at(row, this->_col); //Index the matrix
     }
     
+    /**
+     * Assigns an element of the column in the parent matrix
+     * @param index Element Index
+     * @param elem Element Value
+     */
+    
+    virtual void set(index_t index, T elem) override {
+        this->_matrix->set(index, this->_col, elem);
+    }
+    
+    /**
+     * Assigns an element of the column in the parent matrix
+     * @param row Element Row Index
+     * @param col Element Column Index
+     * @param elem Element Value
+     */
+    
+    virtual void set(index_t row, index_t col, T elem) override {
+        if constexpr (checks::Default::bounds) {
+            if (col != 0) {
+                throw ORCAExcept::OutOfBoundsError(); // Indexed outside col bounds
+            }
+        }
+        this->_matrix->set(row, this->_col, elem);
+    }
+    
+    using Mat<T>::data;
+    
+    /**
+     * Returns a pointer to the first element of the column in the parent storage, nullptr for lazy
+     * parents. The parent matrix discards its cached results
+     */
+    
+    virtual T* data() override {
+        this->_matrix->_touch();
+        return this->_mat;
+    }
+    
+    /**
+     * Returns the storage of the matrix the column belongs to
+     */
+    
+    virtual const void* storage() const override {
+        return this->_matrix->storage();
+    } /* virtual const void* storage() const override */
+    
 };
 
 }
@@ -1,4 +1,6 @@
 #include <iostream>
+#include <cassert>
+#include <chrono>
 #include <random>
 #include "ORCAMath/ORCAMath.h"
 
@@ -95,7 +97,105 @@ int main(int argc, const char * argv[]) {
 
     assert(realOnly == e);
     assert(e == realOnly);
+    assert(!(realOnly != e));
+    assert(math1 != Complex<float>(a, b + 1));
 
+    /* Square root and exponential */
+
+    Complex<double> root = sqrt(Complex<double>(-3, -4));
+    assert((std::abs(root.re() - 1) < 1e-15) && (std::abs(root.im() + 2) < 1e-15));
+    Complex<double> rotation = exp(Complex<double>(0, 3.14159265358979323846 / 2));
+    assert((std::abs(rotation.re()) < 1e-15) && (std::abs(rotation.im() - 1) < 1e-15));
+
+    /* Arrays of complex numbers match the single value operations */
+
+    const index_t arrayLength = 37;
+    ComplexVec<double> u(arrayLength);
+    ComplexVec<double> v(arrayLength);
+    index_t k;
+    for (k = 0; k < arrayLength; ++k) {
+        u.set(k, Complex<double>(k % 7 - 3.5, k % 5 - 2.0));
+        v.set(k, Complex<double>(0.25 * k - 4, 1.5 - 0.125 * k));
+    }
+    ComplexVec<double> products = u * v;
+    ComplexVec<double> scaled = u * Complex<double>(0, 2);
+    ComplexVec<double> conjugates = conj(u);
+    ComplexVec<double> roots = sqrt(u);
+    ComplexVec<double> exponentials = exp(v);
+    ColVec<double> magnitudes = abs(u);
+    for (k = 0; k < arrayLength; ++k) {
+        Complex<double> expected = u.at(k) * v.at(k);
+        assert(std::abs(products.at(k).re() - expected.re()) < 1e-12);
+        assert(std::abs(products.at(k).im() - expected.im()) < 1e-12);
+        assert((scaled.at(k).re() == -2 * u.at(k).im()) && (scaled.at(k).im() == 2 * u.at(k).re()));
+        assert(conjugates.at(k) == u.at(k).conj());
+        Complex<double> expectedRoot = sqrt(u.at(k));
+        assert(std::abs(roots.at(k).re() - expectedRoot.re()) < 1e-12);
+        assert(std::abs(roots.at(k).im() - expectedRoot.im()) < 1e-12);
+        Complex<double> expectedExp = exp(v.at(k));
+        assert(std::abs(exponentials.at(k).re() - expectedExp.re()) < 1e-12);
+        assert(std::abs(exponentials.at(k).im() - expectedExp.im()) < 1e-12);
+        assert(std::abs(magnitudes.at(k) - abs(u.at(k))) < 1e-12);
+    }
+    ComplexVec<double> inPlace(u);
+    inPlace *= v;
+    assert(inPlace.at(arrayLength - 1) == products.at(arrayLength - 1));
+    ComplexVec<double> fromVector(u.toColVec());
+    assert((fromVector.size() == arrayLength) && (fromVector.at(5) == u.at(5)));
+
+    try {
+        ComplexVec<double> mismatched = u * ComplexVec<double>(3);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    /* Complex matrix products use the real kernels */
+
+    const index_t matSize = 40;
+    Mat<Complex<double>> left(matSize, matSize);
+    Mat<Complex<double>> right(matSize, matSize);
+    index_t i, j;
+    for (i = 0; i < matSize; ++i) {
+        for (j = 0; j < matSize; ++j) {
+            left.set(i, j, Complex<double>((i * 7 + j * 3) % 11 - 5.0, (i + 2 * j) % 5 - 2.0));
+            right.set(i, j, Complex<double>((i * 5 + j) % 9 - 4.0, (3 * i + j) % 7 - 3.0));
+        }
+    }
+    Mat<Complex<double>> matProduct = left * right;
+    Mat<Complex<double>> transposedProduct = left.t() * right;
+    for (i = 0; i < matSize; ++i) {
+        for (j = 0; j < matSize; ++j) {
+            Complex<double> expected;
+            Complex<double> expectedTransposed;
+            for (k = 0; k < matSize; ++k) {
+                expected = expected + left.at(i, k) * right.at(k, j);
+                expectedTransposed = expectedTransposed + left.at(k, i) * right.at(k, j);
+            }
+            assert(matProduct.at(i, j) == expected);
+            assert(transposedProduct.at(i, j) == expectedTransposed);
+        }
+    }
+
+    /* Results assigned to arrays created before an arena scope outlive it */
+
+    Arena workspace(1 << 16);
+    ComplexVec<double> assigned;
+    ComplexVec<double> resized(3);
+    {
+        arena::Scope scope(workspace);
+        assigned = u * v;
+        resized = u * v;
+    }
+    {
+        arena::Scope scope(workspace);
+        ComplexVec<double> scribble(4 * arrayLength);
+        assert(scribble.at(0) == Complex<double>());
+    }
+    assert((assigned.size() == arrayLength) && (resized.size() == arrayLength));
+    for (k = 0; k < arrayLength; ++k) {
+        assert((assigned.at(k) == products.at(k)) && (resized.at(k) == products.at(k)));
+    }
 
     /* Printing */
 
@@ -0,0 +1,155 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include "ORCAMath/ORCAMath.h"
+
+using namespace ORCA;
+
+/* Direct O(n^2) transform to check the plans against */
+
+static ComplexVec<double> directDFT(const ComplexVec<double>& x) {
+    const index_t n = x.size();
+    const double tau = 6.283185307179586476925286766559;
+    ComplexVec<double> result(n);
+    index_t j, k;
+    for (k = 0; k < n; ++k) {
+        double sumR = 0, sumI = 0;
+        for (j = 0; j < n; ++j) {
+            const double angle = -tau * static_cast<double>((j * k) % n) / n;
+            sumR += x.real()[j] * std::cos(angle) - x.imag()[j] * std::sin(angle);
+            sumI += x.real()[j] * std::sin(angle) + x.imag()[j] * std::cos(angle);
+        }
+        result.set(k, Complex<double>(sumR, sumI));
+    }
+    return result;
+}
+
+static double maxError(const ComplexVec<double>& a, const ComplexVec<double>& b) {
+    assert(a.size() == b.size());
+    double error = 0;
+    index_t i;
+    for (i = 0; i < a.size(); ++i) {
+        error = std::fmax(error, std::fabs(a.real()[i] - b.real()[i]));
+        error = std::fmax(error, std::fabs(a.imag()[i] - b.imag()[i]));
+    }
+    return error;
+}
+
+int main(int argc, const char * argv[]) {
+
+    Rng rng(2026);
+
+    /* Complex transforms match the direct transform for radix 2, 4, 3, other primes and mixed sizes */
+
+    const index_t sizes[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 12, 15, 16, 30, 49, 64, 97, 100, 128, 210, 1000, 1024};
+    for (index_t n : sizes) {
+        ComplexVec<double> x(n);
+        rng.uniform(x.real(), 2 * n, -1.0, 1.0);
+        ComplexVec<double> spectrum = fft(x);
+        assert(maxError(spectrum, directDFT(x)) < 1e-9 * n);
+        assert(maxError(ifft(spectrum), x) < 1e-12 * n);
+    }
+
+    /* Plans transform in place and are cached per size */
+
+    FFTPlan<double>& plan = FFTPlan<double>::cached(12);
+    assert(&plan == &FFTPlan<double>::cached(12));
+    assert(&plan != &FFTPlan<double>::cached(16));
+    assert(plan.size() == 12);
+    ComplexVec<double> impulse(12);
+    impulse.set(1, Complex<double>(1, 0));
+    plan.forward(impulse);
+    index_t k;
+    for (k = 0; k < 12; ++k) {
+        const double angle = -6.283185307179586 * k / 12;
+        assert(std::fabs(impulse.at(k).re() - std::cos(angle)) < 1e-15);
+        assert(std::fabs(impulse.at(k).im() - std::sin(angle)) < 1e-15);
+    }
+    plan.inverse(impulse);
+    assert(std::fabs(impulse.at(1).re() - 1) < 1e-15);
+    assert(std::fabs(impulse.at(0).re()) < 1e-15);
+
+    try {
+        ComplexVec<double> wrongSize(5);
+        plan.forward(wrongSize);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    /* Real transforms return the non-negative bins of the complex transform */
+
+    const index_t realSizes[] = {1, 2, 3, 8, 9, 10, 15, 64, 100, 1024};
+    for (index_t n : realSizes) {
+        ColVec<double> signal(n);
+        rng.uniform(signal.data(), n, -1.0, 1.0);
+        ComplexVec<double> bins = rfft(signal);
+        ComplexVec<double> full = fft(ComplexVec<double>(signal.data(), nullptr, n));
+        assert(bins.size() == n / 2 + 1);
+        for (k = 0; k < bins.size(); ++k) {
+            assert(std::fabs(bins.real()[k] - full.real()[k]) < 1e-12 * n);
+            assert(std::fabs(bins.imag()[k] - full.imag()[k]) < 1e-12 * n);
+        }
+        ColVec<double> recovered = irfft(bins, n);
+        for (k = 0; k < n; ++k) {
+            assert(std::fabs(recovered.at(k) - signal.at(k)) < 1e-12 * n);
+        }
+    }
+
+    /* A sampled sine has its energy in a single bin */
+
+    RowVec<double> tone(256);
+    for (k = 0; k < 256; ++k) {
+        tone.set(k, std::sin(6.283185307179586 * 10 * k / 256));
+    }
+    ComplexVec<double> toneBins = rfft(tone);
+    assert(std::fabs(toneBins.at(10).im() + 128) < 1e-9);
+    assert(std::fabs(abs(toneBins).at(11)) < 1e-9);
+
+    /* Batched transforms match one transform per signal */
+
+    const index_t count = 9;
+    const index_t length = 48;
+    Mat<double> signals(count, length);
+    for (k = 0; k < count; ++k) {
+        rng.uniform(signals.data() + k * signals.stride(), length, -1.0, 1.0);
+    }
+    Mat<Complex<double>> spectra = rfftRows(signals);
+    assert((spectra.rows() == count) && (spectra.cols() == length / 2 + 1));
+    Mat<Complex<double>> complexSignals(count, length);
+    index_t i;
+    for (k = 0; k < count; ++k) {
+        for (i = 0; i < length; ++i) {
+            complexSignals.set(k, i, Complex<double>(signals.at(k, i), 0));
+        }
+    }
+    Mat<Complex<double>> complexSpectra = fftRows(complexSignals);
+    for (k = 0; k < count; ++k) {
+        ComplexVec<double> single = rfft(signals.row(k));
+        for (i = 0; i <= length / 2; ++i) {
+            assert(spectra.at(k, i) == single.at(i));
+            assert(std::fabs(complexSpectra.at(k, i).re() - single.at(i).re()) < 1e-12);
+            assert(std::fabs(complexSpectra.at(k, i).im() - single.at(i).im()) < 1e-12);
+        }
+    }
+
+    RealFFTPlan<double>& realPlan = RealFFTPlan<double>::cached(length);
+    ComplexVec<double> planes(count * realPlan.bins());
+    Mat<double> roundTrip(count, length);
+    realPlan.forward(signals.data(), signals.stride(), planes.real(), planes.imag(), realPlan.bins(), count);
+    realPlan.inverse(planes.real(), planes.imag(), realPlan.bins(), roundTrip.data(), roundTrip.stride(), count);
+    for (k = 0; k < count; ++k) {
+        for (i = 0; i < length; ++i) {
+            assert(std::fabs(roundTrip.at(k, i) - signals.at(k, i)) < 1e-12);
+        }
+    }
+
+    /* Single precision */
+
+    ComplexVec<float> xf(60, Complex<float>(1, 0));
+    ComplexVec<float> spectrumF = fft(xf);
+    assert(std::fabs(spectrumF.at(0).re() - 60) < 1e-4);
+    assert(std::fabs(spectrumF.at(7).re()) < 1e-4);
+
+    return 0;
+}
@@ -0,0 +1,119 @@
+#define ORCA_ENABLE_INSTRUMENTATION
+
+#include <cassert>
+#include <sstream>
+#include <thread>
+#include "ORCAMath/ORCAMath.h"
+
+using namespace ORCA;
+
+int main(int argc, const char * argv[]) {
+
+    Rng rng(2026);
+    assert(instrument::enabled);
+
+    /* Allocations and copies */
+
+    instrument::Scope scope;
+    Mat<double> a(4, 5, fill::rand, rng);
+    instrument::Counters counted = scope.counters();
+    assert((counted.allocations == 1) && (counted.heapAllocations == 1));
+    assert(counted.bytesAllocated == 4 * 5 * sizeof(double));
+    assert(counted.copies == 0);
+
+    scope.restart();
+    Mat<double> copy = a;
+    Mat<float> cast = a;
+    Mat<double> moved = std::move(copy);
+    counted = scope.counters();
+    assert((counted.allocations == 2) && (counted.copies == 2));
+    assert(counted.bytesCopied == 4 * 5 * (sizeof(double) + sizeof(float)));
+
+    /* Products count their flops once, including the in-place and output forms */
+
+    Mat<double> b(5, 3, fill::rand, rng);
+    scope.restart();
+    Mat<double> product = a * b;
+    Mat<double> out(4, 3);
+    multiply(out, a, b);
+    counted = scope.counters();
+    assert(counted.calls(instrument::Op::multiply) == 2);
+    assert(counted.flops(instrument::Op::multiply) == 2 * 2 * 4 * 5 * 3);
+
+    /* The factorization inside det() and inv() is not counted again, cached results cost nothing */
+
+    Mat<double> square(6, 6, fill::rand, rng);
+    scope.restart();
+    square.det();
+    square.det();
+    counted = scope.counters();
+    assert(counted.calls(instrument::Op::det) == 2);
+    assert(counted.flops(instrument::Op::det) == 2 * 216 / 3);
+    assert(counted.calls(instrument::Op::lu) == 0);
+
+    scope.restart();
+    square.inv();
+    LU<double> factors(square);
+    counted = scope.counters();
+    assert((counted.calls(instrument::Op::inv) == 1) && (counted.flops(instrument::Op::inv) == 2 * 216));
+    assert((counted.calls(instrument::Op::lu) == 1) && (counted.flops(instrument::Op::lu) == 2 * 216 / 3));
+    assert(counted.totalFlops() == 2 * 216 + 2 * 216 / 3);
+
+    scope.restart();
+    square.rref();
+    Mat<double> spd = square * square.t() + Mat<double>(6, 6, fill::eye);
+    Chol<double> chol(spd);
+    counted = scope.counters();
+    assert((counted.calls(instrument::Op::rref) == 1) && (counted.flops(instrument::Op::rref) == 2 * 6 * 5 * 6));
+    assert((counted.calls(instrument::Op::cholesky) == 1) && (counted.flops(instrument::Op::cholesky) == 72));
+
+    /* Arena allocations are counted but do not reach the heap */
+
+    {
+        Arena arena(1 << 16);
+        arena::Scope inArena(arena);
+        scope.restart();
+        Mat<double> temporary = a * b;
+        counted = scope.counters();
+        assert((counted.allocations == 1) && (counted.heapAllocations == 0));
+        Mat<double> large(40, 40, fill::rand, rng);
+        scope.restart();
+        Mat<double> packed = large * large;
+        counted = scope.counters();
+        assert((counted.allocations == 3) && (counted.heapAllocations == 0)); // Packing buffers come from the arena too
+    }
+
+    /* Counters are per thread */
+
+    scope.restart();
+    instrument::Counters worker;
+    std::thread thread([&] {
+        instrument::Scope workerScope;
+        Mat<double> remote = a * b;
+        worker = workerScope.counters();
+    });
+    thread.join();
+    assert(scope.counters().calls(instrument::Op::multiply) == 0);
+    assert((worker.calls(instrument::Op::multiply) == 1) && (worker.allocations == 1));
+
+    /* Nested scopes and export */
+
+    instrument::Scope outer;
+    Mat<double> first = a * b;
+    {
+        instrument::Scope inner;
+        Mat<double> second = a * b;
+        assert(inner.counters().calls(instrument::Op::multiply) == 1);
+    }
+    assert(outer.counters().calls(instrument::Op::multiply) == 2);
+
+    std::ostringstream exported;
+    exported << outer.counters();
+    assert(exported.str().find("\"multiply\": {\"calls\": 2, \"flops\": 240}") != std::string::npos);
+    assert(exported.str().front() == '{');
+
+    instrument::reset();
+    assert(instrument::snapshot().allocations == 0);
+
+    return 0;
+}
@@ -0,0 +1,497 @@
+#include <iostream>
+#include <cassert>
+#include <utility>
+#include "ORCAMath/ORCAMath.h"
+
+using namespace ORCA;
+
+int main(int argc, const char * argv[]) {
+
+    Mat<double> a = {{1,2},{3,4}};
+
+    /* Copy construction performs a deep copy */
+
+    Mat<double> copyConstructor = a;
+    copyConstructor.set(0, 0, 10);
+    assert(a.at(0,0) == 1);
+    assert(copyConstructor.at(0,0) == 10);
+
+    /* Move construction takes the storage and leaves the source empty */
+
+    Mat<double> moveSource = a;
+    Mat<double> moveConstructor = std::move(moveSource);
+    assert((moveConstructor.rows() == 2) && (moveConstructor.cols() == 2));
+    assert((moveSource.rows() == 0) && (moveSource.cols() == 0));
+    assert(moveConstructor == a);
+
+    /* Copy and move assignment */
+
+    Mat<double> assigned(3, 3, fill::zeros);
+    assigned = a;
+    assert(assigned == a);
+    assigned.set(1, 1, -1);
+    assert(a.at(1,1) == 4);
+
+    Mat<double> moveAssigned(2, 2, fill::ones);
+    moveAssigned = a + a;
+    assert(moveAssigned.at(1,0) == 6);
+
+    /* Views stay non-owning, copying them materializes the data */
+
+    Mat<double> transposed = a.t();
+    assert((transposed.at(0,1) == 3) && (transposed.at(1,0) == 2));
+
+    Mat<double> column = a.getCol(1);
+    assert((column.rows() == 2) && (column.cols() == 1));
+    assert((column.at(0,0) == 2) && (column.at(1,0) == 4));
+
+    Mat<double> subMatrix = a.range(1, 1, 0, 1);
+    assert((subMatrix.at(0,0) == 3) && (subMatrix.at(0,1) == 4));
+
+    /* Assigning a view of a matrix to itself */
+
+    Mat<double> selfAssigned = a;
+    selfAssigned = selfAssigned.t();
+    assert(selfAssigned == transposed);
+
+    /* Vectors */
+
+    ColVec<double> v = {1,2};
+    ColVec<double> vCopy = v;
+    ColVec<double> vMoved = std::move(vCopy);
+    assert((vMoved.length() == 2) && (vCopy.length() == 0));
+    assert((vMoved.at(0) == 1) && (vMoved.at(1) == 2));
+
+    Mat<double> product = a * v;
+    assert((product.at(0,0) == 5) && (product.at(1,0) == 11));
+
+    /* Dense kernels and lazy views agree */
+
+    Mat<double> b = {{0,1,2},{1,0,3}};
+    Mat<double> denseProduct = a * b;
+    Mat<double> viewProduct = a * b.t().t();
+    assert(denseProduct == viewProduct);
+    assert((denseProduct.at(0,2) == 8) && (denseProduct.at(1,2) == 18));
+    assert((a.stride() == 2) && a.isDense() && !a.t().isDense());
+    assert(det(a) == -2);
+    assert((a - a + (-a)).at(1,1) == -4);
+
+    /* Blocked kernel agrees with the generic path, including partial edge tiles */
+
+    Mat<double> largeA(45, 70);
+    Mat<double> largeB(70, 53);
+    index_t i, j;
+    for (i = 0; i < 70; ++i) {
+        for (j = 0; j < 70; ++j) {
+            if (i < 45) {
+                largeA.set(i, j, (i * 7 + j * 3) % 11);
+            }
+            if (j < 53) {
+                largeB.set(i, j, (i * 5 + j * 2) % 13);
+            }
+        }
+    }
+    Mat<double> serialProduct = largeA * largeB;
+    assert(serialProduct == (largeA.t().t() * largeB));
+
+    /* Transposes are copied tile by tile and multiplied without copying */
+
+    Mat<double> largeAt = largeA.t();
+    for (i = 0; i < 70; ++i) {
+        for (j = 0; j < 45; ++j) {
+            assert(largeAt.at(i, j) == largeA.at(j, i));
+        }
+    }
+    assert((largeA.t() * largeA) == (largeAt * largeA));
+    assert((largeB.t().range(10, 40, 0, 69) * largeAt) == (Mat<double>(largeB.t().range(10, 40, 0, 69)) * largeAt));
+    assert((largeA * largeA.t()) == (largeA * largeAt));
+    assert((a.t() * b) == (transposed * b));
+    assert((b * b.t()) == (b * Mat<double>(b.t())));
+
+    Mat<double> inPlace = largeA * largeAt;
+    Mat<double> inPlaceExpected = inPlace.t();
+    inPlace.transposeInPlace();
+    assert(inPlace == inPlaceExpected);
+    Mat<double> wideInPlace = largeA;
+    wideInPlace.transposeInPlace();
+    assert((wideInPlace.rows() == 70) && (wideInPlace == largeAt));
+
+    /* Threaded evaluation gives the same results */
+
+    {
+        parallel::Scope threaded(4);
+        assert(parallel::threads() == 4);
+        assert((largeA * largeB) == serialProduct);
+        Mat<double> threadedSum = serialProduct + serialProduct;
+        assert(threadedSum == serialProduct * 2.0);
+    }
+    assert(parallel::threads() == 1);
+
+    /* Expression templates */
+
+    Mat<double> c = {{1,1},{1,1}};
+    Mat<double> fused = 2.0 * a + a * 3.0 - c;
+    assert((fused.at(0,0) == 4) && (fused.at(1,1) == 19));
+    assert((a + a.t()) == Mat<double>({{2,5},{5,8}}));
+    assert((a.range(0, 1, 1, 1) - column).at(1,0) == 0);
+
+    ColVec<double> w = {1,1};
+    ColVec<double> stateUpdate = a * v + c * w - v;
+    assert((stateUpdate.length() == 2) && (stateUpdate.at(0) == 6) && (stateUpdate.at(1) == 11));
+    stateUpdate = stateUpdate + w;
+    assert(stateUpdate.at(1) == 12);
+
+    Mat<double> aliased = a;
+    aliased = aliased.t() + aliased;
+    assert((aliased.at(0,1) == 5) && (aliased.at(1,0) == 5));
+
+    auto ownsTemporary = (a * b) + (a * b);
+    assert(ownsTemporary.eval().at(1,2) == 36);
+    assert(((a + c) * (a - c)).at(0,0) == 6);
+
+    RowVec<double> r = {1,2,3};
+    RowVec<double> rCopy(4);
+    rCopy = r;
+    assert((rCopy.length() == 3) && (rCopy.at(2) == 3));
+
+    /* In-place operators keep the storage of the destination */
+
+    Mat<double> accumulator = {{1, 2}, {3, 4}};
+    const double* storage = accumulator.data();
+    accumulator += a;
+    accumulator -= c;
+    assert(accumulator == Mat<double>({{1, 3}, {5, 7}}));
+    accumulator += a + a.t();
+    assert(accumulator.at(0, 1) == 8);
+    accumulator *= 0.5;
+    assert(accumulator.at(1, 1) == 7.5);
+    accumulator *= Mat<double>({{0, 1}, {1, 0}});
+    assert((accumulator.at(0, 0) == 4) && (accumulator.at(0, 1) == 1.5));
+    accumulator -= accumulator.t();
+    assert((accumulator.at(0, 1) == -accumulator.at(1, 0)) && (accumulator.at(0, 0) == 0));
+    assert(accumulator.data() == storage);
+    accumulator.getRow(1) *= 2.0;
+    assert(accumulator.at(1, 0) == -2 * accumulator.at(0, 1));
+    ColVec<double> offset = {1, 1};
+    offset += v;
+    assert((offset.at(0) == 2) && (offset.at(1) == 3));
+
+    /* Output parameters write into preallocated destinations */
+
+    Mat<double> destination(2, 3);
+    const double* destinationStorage = destination.data();
+    multiply(destination, a, b);
+    assert(destination == denseProduct);
+    multiply(destination, a.t().t(), b);
+    assert(destination == denseProduct);
+    Mat<double> square(2, 2);
+    add(square, a, a.t());
+    assert(square == Mat<double>({{2, 5}, {5, 8}}));
+    subtract(square, square, a);
+    assert(square == a.t());
+    multiply(square, square, a);
+    assert(square == (a.t() * a));
+    assert(destination.data() == destinationStorage);
+
+    ColVec<double> gemvOut = {1, 1};
+    gemv(gemvOut, a, v);
+    assert((gemvOut.at(0) == 5) && (gemvOut.at(1) == 11));
+    gemv(gemvOut, a, v, 2.0, 1.0);
+    assert((gemvOut.at(0) == 15) && (gemvOut.at(1) == 33));
+    gemv(gemvOut, a.t(), gemvOut, 1.0, 0.0);
+    assert((gemvOut.at(0) == 114) && (gemvOut.at(1) == 162));
+
+    Mat<double> largeOut(45, 53);
+    multiply(largeOut, largeA, largeB);
+    assert(largeOut == serialProduct);
+    ColVec<double> largeX(70);
+    ColVec<double> largeY(45);
+    for (i = 0; i < 70; ++i) {
+        largeX.set(i, i % 5);
+    }
+    gemv(largeY, largeA, largeX);
+    assert(largeY == (largeA * largeX));
+
+    try {
+        multiply(square, a, b);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    try {
+        accumulator *= b;
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    /* Block matrices with blocks of different shapes */
+
+    Mat<double> wide = {{1, 2, 3}};
+    Mat<double> tall = {{4}};
+    Mat<double> blocks = {{wide, tall}, {Mat<double>(1, 3, fill::zeros), Mat<double>({{5}})}};
+    assert((blocks.rows() == 2) && (blocks.cols() == 4));
+    assert((blocks.at(0, 3) == 4) && (blocks.at(1, 3) == 5) && (blocks.at(1, 0) == 0));
+
+    /* Fixed-size matrices */
+
+    Mat<double, 3, 3> fixedA = {{2,0,1},{1,3,2},{1,1,3}};
+    ColVec<double, 3> fixedX = {1,2,3};
+    ColVec<double, 3> fixedY = fixedA * fixedX;
+    assert((fixedY.at(0) == 5) && (fixedY.at(1) == 13) && (fixedY.at(2) == 12));
+    assert(fixedA.trace() == 8);
+    assert(fixedA.det() == 12);
+    assert(Real<double>((fixedA * fixedA.inv()).trace()) == 3);
+    assert(sizeof(Mat<double, 3, 3>) == 9 * sizeof(double));
+
+    Mat<double> fixedToDynamic = fixedA;
+    assert((fixedToDynamic.rows() == 3) && (fixedToDynamic.at(2,2) == 3));
+    Mat<double, 3, 3> dynamicToFixed(fixedToDynamic);
+    assert(dynamicToFixed == fixedA);
+
+    try {
+        Mat<double, 2, 2> badConversion(fixedToDynamic);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    /* Singular fixed-size matrices throw like dynamic ones, for the closed forms and elimination */
+
+    Mat<double, 2, 2> fixedSingular2 = {{1, 2}, {2, 4}};
+    Mat<double, 3, 3> fixedSingular3 = {{1, 2, 3}, {2, 4, 6}, {1, 0, 1}};
+    Mat<double, 4, 4> fixedSingular4(fill::zeros);
+    Mat<double, 5, 5> fixedSingular5(fill::ones);
+    Mat<double, 1, 1> fixedSingular1(fill::zeros);
+    int singularCount = 0;
+    try { fixedSingular1.inv(); } catch (ORCAExcept::ORCAException exception) { singularCount += (exception == ORCA_SINGULAR_MATRIX); }
+    try { fixedSingular2.inv(); } catch (ORCAExcept::ORCAException exception) { singularCount += (exception == ORCA_SINGULAR_MATRIX); }
+    try { fixedSingular3.inv(); } catch (ORCAExcept::ORCAException exception) { singularCount += (exception == ORCA_SINGULAR_MATRIX); }
+    try { fixedSingular4.inv(); } catch (ORCAExcept::ORCAException exception) { singularCount += (exception == ORCA_SINGULAR_MATRIX); }
+    try { fixedSingular5.inv(); } catch (ORCAExcept::ORCAException exception) { singularCount += (exception == ORCA_SINGULAR_MATRIX); }
+    assert(singularCount == 5);
+    try {
+        Mat<double>({{1, 2}, {2, 4}}).inv();
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_SINGULAR_MATRIX);
+    }
+
+    /* Sticky compute */
+
+    Mat<double> cached = {{4,1},{2,3}};
+    assert(cached.det() == 10);
+    Mat<double> cachedInverse = cached.inv();
+    unsigned long long epoch = cached.epoch();
+    cached.set(0, 0, 6);
+    assert(cached.epoch() != epoch);
+    assert(std::abs(cached.det() - 16) < 1e-12);
+    assert(std::abs(cached.inv().at(0,0) - 3.0 / 16) < 1e-12);
+    assert(std::abs(cachedInverse.at(0,0) - 0.3) < 1e-12);
+
+    Mat<double> cachedCopy = cached;
+    cached.rowSwap(0, 1);
+    assert(std::abs(cached.det() + 16) < 1e-12);
+    assert(std::abs(cachedCopy.det() - 16) < 1e-12);
+    assert(cached.diag().at(0) == 2);
+    cached = {{1,1},{1,1}};
+    assert(cached.diag().at(1) == 1);
+    assert(cached.det() == 0);
+
+    std::size_t usage = sticky::usage();
+    std::size_t budget = sticky::budget();
+    sticky::setBudget(usage);
+    Mat<double> uncached = {{1,2},{3,5}};
+    assert(std::abs(uncached.inv().at(0,0) + 5) < 1e-12);
+    assert(sticky::usage() == usage);
+    sticky::setBudget(budget);
+
+    /* Arena allocation */
+
+    Arena workspace(1 << 16);
+    Mat<double> persistent(4, 4, fill::ones);
+    {
+        arena::Scope scope(workspace);
+        Mat<double> temporary = persistent * persistent;
+        ColVec<double> column = {1, 2, 3, 4};
+        assert(temporary.at(3, 3) == 4);
+        assert(reinterpret_cast<std::uintptr_t>(temporary.data()) % ORCA_STORAGE_ALIGNMENT == 0);
+        assert(workspace.used() >= sizeof(double) * 20);
+        {
+            arena::Scope inner(workspace);
+            std::size_t outerUsed = workspace.used();
+            Mat<double> nested(8, 8, fill::zeros);
+            assert(workspace.used() > outerUsed);
+        }
+        assert(workspace.used() >= sizeof(double) * 20);
+        assert(column.at(2) == 3);
+    }
+    assert(workspace.used() == 0);
+    assert(workspace.peak() > 0);
+    assert((persistent * persistent).at(0, 0) == 4);
+
+    Arena tiny(64);
+    {
+        arena::Scope scope(tiny);
+        Mat<double> spilled(16, 16, fill::ones);
+        assert(spilled.at(15, 15) == 1);
+        assert(tiny.overflows() == 1);
+    }
+
+    /* Results assigned to matrices created before a scope, and results cached inside one, outlive it */
+
+    Mat<double> gain = {{1, 2}, {3, 4}};
+    ColVec<double> state = {1, 1};
+    Mat<double> output(2, 1);
+    Mat<double> resized(3, 3);
+    ColVec<double> estimate = {0, 0};
+    Mat<double> system = {{4, 1}, {2, 3}};
+    {
+        arena::Scope scope(workspace);
+        output = gain * state;
+        resized = gain * gain;
+        estimate = ColVec<double>({5, 6});
+        assert(std::abs(system.inv().at(0, 0) - 0.3) < 1e-12);
+        assert(std::abs(system.lu().det() - 10) < 1e-12);
+        Mat<double> spd = Mat<double>(system * system.t());
+        assert(std::abs(spd.chol().L().at(0, 0) - std::sqrt(17.0)) < 1e-12);
+    }
+    Mat<double> overwrite(8, 8, fill::ones);
+    {
+        arena::Scope scope(workspace);
+        Mat<double> scribble(16, 16, fill::zeros);
+        assert(scribble.at(0, 0) == 0);
+    }
+    assert((output.at(0, 0) == 3) && (output.at(1, 0) == 7));
+    assert((resized.rows() == 2) && (resized.at(1, 1) == 22));
+    assert((estimate.at(0) == 5) && (estimate.at(1) == 6));
+    assert(std::abs(system.inv().at(0, 0) - 0.3) < 1e-12);
+    assert(std::abs(system.inv().at(1, 1) - 0.4) < 1e-12);
+    assert(std::abs(system.lu().det() - 10) < 1e-12);
+    assert(std::abs(system.lu().solve(ColVec<double>({5, 5})).at(0) - 1) < 1e-12);
+
+    /* Seeded random fills */
+
+    Rng first(42), second(42);
+    Mat<double> sample(33, 17, fill::rand, first);
+    assert(sample == Mat<double>(33, 17, fill::rand, second));
+    assert(!(sample == Mat<double>(33, 17, fill::rand, first)));
+    bool inRange = true;
+    for (i = 0; i < sample.rows(); ++i) {
+        for (j = 0; j < sample.cols(); ++j) {
+            inRange = inRange && (sample.at(i, j) >= 0) && (sample.at(i, j) < 1);
+        }
+    }
+    assert(inRange);
+    Mat<float> bounded(9, 9, fill::rand, -2.0f, -1.0f, first);
+    assert((bounded.at(4, 4) >= -2) && (bounded.at(4, 4) < -1));
+
+    Rng scalar(7), bulk(7);
+    double drawn[11];
+    scalar.next();
+    bulk.next();
+    bulk.uniform(drawn, 11, 0.0, 1.0);
+    bool matches = true;
+    for (i = 0; i < 11; ++i) {
+        matches = matches && (scalar.uniform(0.0, 1.0) == drawn[i]);
+    }
+    scalar.normal(0.0, 1.0);
+    bulk.normal(drawn, 1, 0.0, 1.0);
+    bulk.normal(drawn + 1, 4, 0.0, 1.0);
+    for (i = 1; i < 5; ++i) {
+        matches = matches && (scalar.normal(0.0, 1.0) == drawn[i]);
+    }
+    assert(matches && (scalar.next() == bulk.next()));
+
+    Rng normalGenerator(3);
+    Mat<double> normal(200, 200, fill::randn, 2.0, 0.5, normalGenerator);
+    double mean = 0;
+    for (i = 0; i < normal.rows(); ++i) {
+        for (j = 0; j < normal.cols(); ++j) {
+            mean += normal.at(i, j) / 40000;
+        }
+    }
+    double variance = 0;
+    for (i = 0; i < normal.rows(); ++i) {
+        for (j = 0; j < normal.cols(); ++j) {
+            variance += (normal.at(i, j) - mean) * (normal.at(i, j) - mean) / 40000;
+        }
+    }
+    assert(std::abs(mean - 2) < 0.01 && std::abs(variance - 0.25) < 0.01);
+
+    Rng base(11);
+    Rng worker0 = base.stream(0), worker1 = base.stream(1);
+    assert(worker0.next() == Rng(11).next());
+    assert(worker1.next() != base.stream(0).next() && base.stream(1).next() == Rng(11).stream(1).next());
+    assert(Rng(5).uniform(3, 3) == 3);
+
+    rng::seed(99);
+    Mat<double> seededDefault(4, 4, fill::rand);
+    rng::seed(99);
+    assert(seededDefault == Mat<double>(4, 4, fill::rand));
+
+    /* Checked and unchecked element access */
+
+    Mat<double> access(3, 4, fill::zeros);
+    access.unchecked_set(2, 3, 7);
+    assert((access.at(2, 3) == 7) && (access.unchecked_at(2, 3) == 7));
+    assert(access.t().unchecked_at(3, 2) == 7);
+    assert(access.block(1, 2, 1, 3).unchecked_at(1, 2) == 7);
+    access.block(1, 2, 1, 3).unchecked_set(0, 0, 5);
+    assert(access.at(1, 1) == 5);
+    ColVec<double> accessVector = {1, 2, 3};
+    accessVector.unchecked_set(1, 9);
+    assert((accessVector.unchecked_at(1) == 9) && (accessVector.unchecked_at(1, 0) == 9));
+    Mat<double, 2, 2> fixedAccess = {{1, 2}, {3, 4}};
+    fixedAccess.unchecked_set(1, 0, 8);
+    assert(fixedAccess.unchecked_at(1, 0) == 8);
+    static_assert(checks::Default::bounds, "bounds checks are enabled by default");
+
+    try {
+        access.at(3, 0);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_OUT_OF_BOUNDS);
+    }
+    try {
+        access.range(0, 1, 0, 1).at(2, 2);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_OUT_OF_BOUNDS);
+    }
+    try {
+        access.t().range(0, 1, 0, 1).at(0, 2);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_OUT_OF_BOUNDS);
+    }
+    try {
+        access.getRow(access.rows());
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_OUT_OF_BOUNDS);
+    }
+    try {
+        access.getCol(access.cols());
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_OUT_OF_BOUNDS);
+    }
+    try {
+        accessVector.at(3);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_OUT_OF_BOUNDS);
+    }
+    try {
+        Mat<double> mismatched = access * access;
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    std::cout << a << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,197 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include "ORCAMath/ORCAMath.h"
+
+using namespace ORCA;
+
+static bool near(double a, double b, double tolerance) {
+    return std::abs(a - b) <= tolerance * (1 + std::abs(b));
+}
+
+static bool near(const Mat<double>& a, const Mat<double>& b, double tolerance) {
+    if ((a.rows() != b.rows()) || (a.cols() != b.cols())) {
+        return false;
+    }
+    index_t i, j;
+    for (i = 0; i < a.rows(); ++i) {
+        for (j = 0; j < a.cols(); ++j) {
+            if (!near(a.at(i, j), b.at(i, j), tolerance)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static MatBatch<double> randomBatch(Rng& rng, index_t count, index_t rows, index_t cols) {
+    MatBatch<double> batch(count, rows, cols);
+    index_t i, j;
+    for (i = 0; i < rows; ++i) {
+        for (j = 0; j < cols; ++j) {
+            rng.uniform(batch.data(i, j), count, -1.0, 1.0);
+        }
+    }
+    return batch;
+}
+
+/* Every operation matches the same operation on each matrix by itself */
+
+static void checkBatch(Rng& rng, index_t count, index_t n) {
+    MatBatch<double> a = randomBatch(rng, count, n, n);
+    MatBatch<double> b = randomBatch(rng, count, n, 2);
+    MatBatch<double> c = randomBatch(rng, count, n, 3);
+
+    ColVec<double> determinants = det(a);
+    MatBatch<double> inverses = inv(a);
+    MatBatch<double> solutions = solve(a, b);
+    MatBatch<double> products = a * c;
+    MatBatchLU<double> factors = lu(a);
+    ColVec<double> factoredDeterminants = factors.det();
+    MatBatch<double> factoredSolutions = factors.solve(b);
+    assert((factors.count() == count) && (factors.size() == n) && !factors.isSingular());
+
+    index_t k;
+    for (k = 0; k < count; ++k) {
+        Mat<double> single = a.mat(k);
+        LU<double> reference(single);
+        assert(near(determinants.at(k), reference.det(), 1e-12));
+        assert(near(factoredDeterminants.at(k), reference.det(), 1e-12));
+        assert(near(inverses.mat(k), reference.inv(), 1e-9));
+        assert(near(solutions.mat(k), reference.solve(b.mat(k)), 1e-9));
+        assert(near(factoredSolutions.mat(k), reference.solve(b.mat(k)), 1e-9));
+        assert(near(products.mat(k), single * c.mat(k), 1e-12));
+    }
+}
+
+int main(int argc, const char * argv[]) {
+
+    Rng rng(2026);
+
+    /* Construction and element access */
+
+    MatBatch<double> zeros(5, 2, 3);
+    assert((zeros.count() == 5) && (zeros.rows() == 2) && (zeros.cols() == 3));
+    assert(zeros.at(4, 1, 2) == 0);
+    zeros.set(3, 1, 0, 7);
+    assert(zeros.at(3, 1, 0) == 7);
+    assert(zeros.data(1, 0)[3] == 7);
+    assert(zeros.stride() >= zeros.count());
+    assert(zeros.data()[(1 * 3 + 0) * zeros.stride() + 3] == 7);
+
+    Mat<double> value = {{1, 2}, {3, 4}};
+    MatBatch<double> copies(3, value);
+    assert(copies.mat(2) == value);
+    copies.setMat(1, Mat<double>({{5, 6}, {7, 8}}));
+    assert((copies.at(1, 1, 1) == 8) && (copies.at(0, 1, 1) == 4));
+    MatBatch<double> copied = copies;
+    copies.set(0, 0, 0, -1);
+    assert(copied.at(0, 0, 0) == 1);
+
+    try {
+        zeros.at(5, 0, 0);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_OUT_OF_BOUNDS);
+    }
+
+    try {
+        copies.setMat(0, Mat<double>(3, 3));
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    /* Batched operations, with batch sizes that leave partial SIMD vectors */
+
+    checkBatch(rng, 1, 3);
+    checkBatch(rng, 37, 3);
+    checkBatch(rng, 21, 4);
+    checkBatch(rng, 19, 6);
+    checkBatch(rng, 13, 12);
+
+    /* Pivoting picks a different row in different problems */
+
+    MatBatch<double> permuted(2, 2, 2);
+    permuted.setMat(0, Mat<double>({{0, 1}, {1, 0}}));
+    permuted.setMat(1, Mat<double>({{1, 0}, {0, 1}}));
+    ColVec<double> signs = det(permuted);
+    assert((signs.at(0) == -1) && (signs.at(1) == 1));
+    assert(inv(permuted).mat(0) == Mat<double>({{0, 1}, {1, 0}}));
+
+    /* Singular matrices give a zero determinant and cannot be inverted */
+
+    MatBatch<double> singular = randomBatch(rng, 9, 3, 3);
+    singular.setMat(4, Mat<double>({{1, 2, 3}, {2, 4, 6}, {1, 0, 1}}));
+    ColVec<double> singularDeterminants = det(singular);
+    assert(singularDeterminants.at(4) == 0);
+    assert(singularDeterminants.at(3) != 0);
+    assert(lu(singular).isSingular());
+    assert(lu(singular).det().at(4) == 0);
+
+    try {
+        inv(singular);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_SINGULAR_MATRIX);
+    }
+
+    try {
+        randomBatch(rng, 4, 2, 3).det();
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    try {
+        MatBatch<double> mismatched = randomBatch(rng, 4, 3, 3) * randomBatch(rng, 5, 3, 3);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    /* Threaded batches give the same results */
+
+    MatBatch<double> large = randomBatch(rng, 2000, 6, 6);
+    MatBatch<double> serialInverses = inv(large);
+    {
+        parallel::Scope threaded(4);
+        MatBatch<double> threadedInverses = inv(large);
+        index_t i, r, c;
+        for (r = 0; r < 6; ++r) {
+            for (c = 0; c < 6; ++c) {
+                for (i = 0; i < 2000; ++i) {
+                    assert(threadedInverses.data(r, c)[i] == serialInverses.data(r, c)[i]);
+                }
+            }
+        }
+    }
+
+    /* Single precision */
+
+    MatBatch<float> floats(17, Mat<float>({{4, 1, 0}, {1, 3, 1}, {0, 1, 2}}));
+    ColVec<float> floatDeterminants = det(floats);
+    assert(std::abs(floatDeterminants.at(16) - 18) < 1e-4);
+    assert(std::abs((floats * inv(floats)).at(12, 1, 1) - 1) < 1e-5);
+
+    /* Results assigned to batches created before an arena scope outlive it */
+
+    Arena workspace(1 << 16);
+    MatBatch<double> twos(8, Mat<double>({{2, 0}, {0, 2}}));
+    MatBatch<double> product;
+    MatBatch<double> resized(3, 3, 3);
+    {
+        arena::Scope scope(workspace);
+        product = twos * twos;
+        resized = twos * twos;
+    }
+    {
+        arena::Scope scope(workspace);
+        MatBatch<double> scribble(64, Mat<double>(2, 2, fill::zeros));
+        assert(scribble.at(0, 0, 0) == 0);
+    }
+    assert((product.count() == 8) && (product.at(0, 1, 1) == 4) && (product.at(7, 0, 1) == 0));
+    assert((resized.count() == 8) && (resized.at(3, 0, 0) == 4));
+
+    return 0;
+}
@@ -0,0 +1,232 @@
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include "ORCAMath/ORCAMath.h"
+
+using namespace ORCA;
+
+static bool near(double a, double b) {
+    return std::abs(a - b) < 1e-12;
+}
+
+int main(int argc, const char * argv[]) {
+
+    /* Row-major buffers are read in place */
+
+    double buffer[6] = {1, 2, 3, 4, 5, 6};
+    MatView<double> view(buffer, 2, 3);
+    assert(view.isDense());
+    assert(view.data() == buffer);
+    assert(view.at(1, 2) == 6);
+    Mat<double> copy = view;
+    buffer[0] = 10;
+    assert(copy.at(0, 0) == 1);
+    assert(view.at(0, 0) == 10);
+    buffer[0] = 1;
+
+    /* Views are operands of every operator */
+
+    Mat<double> b = {{1, 0}, {0, 1}, {1, 1}};
+    Mat<double> product = view * b;
+    assert(product.at(0, 0) == 4 && product.at(1, 1) == 11);
+    Mat<double> sum = view + view * 2.0;
+    assert(sum.at(1, 0) == 12);
+    Mat<double> transposed = view.t();
+    assert(transposed.at(2, 1) == 6);
+    assert(view == Mat<double>({{1, 2, 3}, {4, 5, 6}}));
+
+    /* Column-major buffers use a column stride */
+
+    double columnMajor[6] = {1, 4, 2, 5, 3, 6};
+    MatView<double> columns(columnMajor, 2, 3, 1, 2);
+    assert(!columns.isDense());
+    assert(columns == view);
+    assert((columns * b) == product);
+
+    double columnMajorLarge[40 * 40];
+    Mat<double> rowMajorLarge(40, 40);
+    index_t i, j;
+    for (i = 0; i < 40; ++i) {
+        for (j = 0; j < 40; ++j) {
+            columnMajorLarge[i + j * 40] = (i * 3 + j) % 7;
+            rowMajorLarge.set(i, j, (i * 3 + j) % 7);
+        }
+    }
+    MatView<double> columnsLarge(columnMajorLarge, 40, 40, 1, 40);
+    assert((columnsLarge * rowMajorLarge) == (rowMajorLarge * rowMajorLarge));
+    columnsLarge.block(0, 39, 0, 39).transposeInPlace();
+    assert(Mat<double>(columnsLarge) == rowMajorLarge.t());
+
+    /* Assignment writes into the buffer */
+
+    double out[4] = {0, 0, 0, 0};
+    MatView<double> destination(out, 2, 2);
+    destination = view * b;
+    assert(out[0] == 4 && out[3] == 11);
+    destination = destination + destination;
+    assert(out[1] == 2 * product.at(0, 1));
+    destination.set(1, 0, -1);
+    assert(out[2] == -1);
+
+    double columnOut[4] = {0, 0, 0, 0};
+    MatView<double> columnDestination(columnOut, 2, 2, 1, 2);
+    columnDestination = product + product;
+    assert(columnOut[1] == 2 * product.at(1, 0));
+    assert(columnOut[2] == 2 * product.at(0, 1));
+
+    /* Overlapping views of one buffer are detected */
+
+    double shared[5] = {1, 2, 3, 4, 5};
+    MatView<double> head(shared, 1, 4);
+    MatView<double> tail(shared + 1, 1, 4);
+    tail = head;
+    assert(shared[1] == 1 && shared[2] == 2 && shared[4] == 4);
+    double shifted[5] = {1, 2, 3, 4, 5};
+    MatView<double> front(shifted, 1, 4);
+    MatView<double> back(shifted + 1, 1, 4);
+    front = back + back;
+    assert(shifted[0] == 4 && shifted[3] == 10);
+    head = head * 2.0;
+    assert(shared[0] == 2 && shared[3] == 6);
+
+    /* Vector views with an element stride */
+
+    float interleaved[6] = {1, 10, 2, 20, 3, 30};
+    VecView<float> even(interleaved, 3, 2);
+    VecView<float> odd(interleaved + 1, 3, 2);
+    assert(even.at(2) == 3 && odd.at(2) == 30);
+    assert(near(dot(even, odd), 140));
+    Mat<float> rotation = {{0, -1, 0}, {1, 0, 0}, {0, 0, 1}};
+    even = rotation * odd;
+    assert(interleaved[0] == -20 && interleaved[2] == 10 && interleaved[4] == 30);
+    odd = odd + even;
+    assert(interleaved[1] == -10 && interleaved[5] == 60);
+    ColVec<float> owned = even;
+    assert(owned.at(1) == 10);
+
+    /* Writable blocks, rows and columns of owned matrices */
+
+    Mat<double> inertia(6, 6, fill::zeros);
+    Mat<double> rotational = {{2, 0, 1}, {0, 3, 0}, {1, 0, 4}};
+    Mat<double> skew = {{0, -3, 2}, {3, 0, -1}, {-2, 1, 0}};
+    inertia.block(0, 2, 0, 2) = rotational;
+    inertia.block(0, 2, 3, 5) = skew;
+    inertia.block(3, 5, 0, 2) = skew.t();
+    inertia.block(3, 5, 3, 5) = rotational * 2.0;
+    inertia.block(0, 2, 0, 2) += skew * skew.t();
+    inertia.block(3, 5, 3, 5) -= rotational;
+    inertia.block(0, 2, 3, 5) *= 2.0;
+    Mat<double> topLeft = rotational + skew * skew.t();
+    Mat<double> topRight = skew * 2.0;
+    Mat<double> assembled = {{topLeft, topRight}, {Mat<double>(skew.t()), rotational}};
+    assert(inertia == assembled);
+    assert(inertia.range(3, 5, 0, 2).isDense());
+    assert(inertia.range(3, 5, 0, 2) == skew.t());
+
+    Mat<double> cachedInertia = inertia;
+    double before = cachedInertia.trace();
+    cachedInertia.row(5) *= 3.0;
+    assert(near(cachedInertia.trace(), before + 2 * rotational.at(2, 2)));
+    cachedInertia.col(0) = cachedInertia.col(1);
+    assert(cachedInertia.at(4, 0) == cachedInertia.at(4, 1));
+    cachedInertia.getCol(2).set(1, -7);
+    assert(cachedInertia.at(1, 2) == -7);
+    cachedInertia.getRow(0).set(3, 9);
+    assert(cachedInertia.at(0, 3) == 9);
+
+    /* Rows and ranges write into the matrix they were taken from */
+
+    Mat<double> indexed = {{1, 2}, {3, 4}};
+    assert(near(indexed.det(), -2));
+    indexed[0].set(0, 0, 10);
+    assert((indexed.at(0, 0) == 10) && near(indexed.det(), 34));
+    indexed.range(1, 1, 0, 1).data()[1] = 5;
+    assert(near(indexed.det(), 44));
+    indexed.range(0, 1, 0, 1)[1].set(0, 0, 6);
+    assert(near(indexed.det(), 38));
+    indexed.range(0, 1, 0, 1).block(0, 0, 1, 1) = Mat<double>({{4}});
+    assert(near(indexed.det(), 26));
+    MatView<double> wholeIndexed = indexed.block(0, 1, 0, 1);
+    Mat<double>& viewOfIndexed = wholeIndexed;
+    viewOfIndexed.block(1, 1, 0, 0) = Mat<double>({{1}});
+    assert(near(indexed.det(), 46));
+
+    /* Output parameters write into blocks */
+
+    Mat<double> assembly(6, 6, fill::zeros);
+    MatView<double> corner = assembly.block(3, 5, 3, 5);
+    double cornerTrace = assembly.trace();
+    multiply(corner, rotational, skew);
+    assert(corner == rotational * skew);
+    assert(near(assembly.trace(), cornerTrace + (rotational * skew).trace()));
+    VecView<double> lastColumn = assembly.col(5);
+    gemv(lastColumn, inertia, ColVec<double>({1, 0, 0, 0, 0, 0}));
+    assert(assembly.at(4, 5) == inertia.at(4, 0));
+
+    /* Overlapping blocks of one matrix are copied before they are written */
+
+    Mat<double> shiftedRows = {{1, 2}, {3, 4}, {5, 6}};
+    shiftedRows.block(1, 2, 0, 1) = shiftedRows.block(0, 1, 0, 1);
+    assert(shiftedRows == Mat<double>({{1, 2}, {1, 2}, {3, 4}}));
+    Mat<double> square = {{1, 2}, {3, 4}};
+    square.block(0, 1, 0, 1) += square.t();
+    assert(square == Mat<double>({{2, 5}, {5, 8}}));
+
+    /* Blocks of strided views */
+
+    double columnBlock[9] = {1, 4, 7, 2, 5, 8, 3, 6, 9};
+    MatView<double> columnView(columnBlock, 3, 3, 1, 3);
+    columnView.block(1, 2, 1, 2) *= 10.0;
+    assert(columnBlock[4] == 50 && columnBlock[8] == 90 && columnBlock[7] == 60);
+    columnView.col(0) += columnView.col(2);
+    assert(columnBlock[0] == 4 && columnBlock[2] == 7 + 90);
+    
+    /* Error handling */
+
+    try {
+        destination = view;
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    try {
+        view.at(2, 0);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_OUT_OF_BOUNDS);
+    }
+
+    try {
+        even.at(3);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_OUT_OF_BOUNDS);
+    }
+
+    const Mat<double> constant = {{1, 2}, {3, 4}};
+    try {
+        constant.range(0, 0, 0, 1).set(0, 0, 10);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_READ_ONLY);
+    }
+    assert((constant.at(0, 0) == 1) && near(constant.det(), -2));
+
+    try {
+        inertia.block(4, 6, 0, 2);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_OUT_OF_BOUNDS);
+    }
+
+    try {
+        inertia.block(0, 2, 0, 2) += skew.range(0, 1, 0, 2);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    return 0;
+}
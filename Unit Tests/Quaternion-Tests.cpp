@@ -0,0 +1,229 @@
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <vector>
+#include "ORCAMath/ORCAMath.h"
+
+using namespace ORCA;
+
+static bool near(double a, double b) {
+    return std::abs(a - b) < 1e-12;
+}
+
+static double h0() {
+    return std::sqrt(0.5);
+}
+
+static bool near(Quaternion<double> a, Quaternion<double> b) {
+    return near(a.re(), b.re()) && near(a.i(), b.i()) && near(a.j(), b.j()) && near(a.k(), b.k());
+}
+
+int main(int argc, const char * argv[]) {
+
+    /* Rotation matrices */
+
+    Quaternion<double> q = Quaternion<double>(1, 2, -0.5, 0.75) / Quaternion<double>(1, 2, -0.5, 0.75).norm();
+    Mat<double, 3, 3> rotation = q.toRotationMatrix();
+    assert(near((rotation * rotation.t()).trace(), 3));
+    assert(near(rotation.det(), 1));
+    assert(near(Quaternion<double>::fromRotationMatrix(rotation), q));
+    assert(near(fromRotationMatrix(toRotationMatrix(q.conj())), q.conj()));
+    assert(near(fromRotationMatrix(toRotationMatrix(-q)), q));
+
+    /* A quaternion scaled by 3 describes the same rotation */
+
+    Mat<double, 3, 3> scaledRotation = (q * 3.0).toRotationMatrix();
+    index_t row, col;
+    for (row = 0; row < 3; ++row) {
+        for (col = 0; col < 3; ++col) {
+            assert(near(scaledRotation.at(row, col), rotation.at(row, col)));
+        }
+    }
+
+    /* 180 degree rotations take the non trace pivots */
+
+    assert(near(fromRotationMatrix(Mat<double, 3, 3>({{1,0,0},{0,-1,0},{0,0,-1}})), Quaternion<double>(0, 1, 0, 0)));
+    assert(near(fromRotationMatrix(Mat<double, 3, 3>({{-1,0,0},{0,1,0},{0,0,-1}})), Quaternion<double>(0, 0, 1, 0)));
+    assert(near(fromRotationMatrix(Mat<double, 3, 3>({{-1,0,0},{0,-1,0},{0,0,1}})), Quaternion<double>(0, 0, 0, 1)));
+
+    /* Direct rotation agrees with q * v * conj(q) and with the rotation matrix */
+
+    ColVec<double, 3> v = {0.3, -1.2, 2.5};
+    Quaternion<double> sandwich = q * Quaternion<double>(0, v.at(0), v.at(1), v.at(2)) * q.conj();
+    ColVec<double, 3> direct = q.rotate(v);
+    ColVec<double, 3> viaMatrix = rotation * v;
+    assert(near(direct.at(0), sandwich.i()) && near(direct.at(1), sandwich.j()) && near(direct.at(2), sandwich.k()));
+    assert(near(viaMatrix.at(0), direct.at(0)) && near(viaMatrix.at(1), direct.at(1)) && near(viaMatrix.at(2), direct.at(2)));
+
+    ColVec<double> dynamicV = {0.3, -1.2, 2.5};
+    ColVec<double> dynamicDirect = q.rotate(dynamicV);
+    assert(near(dynamicDirect.at(2), sandwich.k()));
+
+    Mat<double> cloud = {{0.3, 1, 0}, {-1.2, 0, 1}, {2.5, 0, 0}};
+    Mat<double> rotatedCloud = q.rotate(cloud);
+    assert(near(rotatedCloud.at(0,0), sandwich.i()) && near(rotatedCloud.at(2,0), sandwich.k()));
+    assert(near(rotatedCloud.at(0,1), rotation.at(0,0)) && near(rotatedCloud.at(1,2), rotation.at(1,1)));
+    Mat<double> rotatedTranspose = q.rotate(cloud.t().t());
+    assert(rotatedTranspose == rotatedCloud);
+
+    try {
+        q.rotate(Mat<double>(2, 4, fill::zeros));
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    /* Interpolation */
+
+    Quaternion<double> identity(1, 0, 0, 0);
+    Quaternion<double> quarterZ(h0(), 0, 0, h0());
+    Quaternion<double> halfway = slerp(identity, quarterZ, 0.5);
+    assert(near(halfway, Quaternion<double>(std::cos(M_PI / 8), 0, 0, std::sin(M_PI / 8))));
+    assert(near(slerp(identity, quarterZ, 0.0), identity) && near(slerp(identity, quarterZ, 1.0), quarterZ));
+    assert(near(slerp(identity, -quarterZ, 0.5), halfway));
+    assert(near(nlerp(identity, quarterZ, 0.5), halfway));
+    assert(near(nlerp(identity, quarterZ, 0.25).norm(), 1));
+
+    /* Nearly identical quaternions take the nlerp path */
+
+    Quaternion<double> tiny(std::cos(1e-5), std::sin(1e-5), 0, 0);
+    assert(near(slerp(identity, tiny, 0.5), Quaternion<double>(std::cos(0.5e-5), std::sin(0.5e-5), 0, 0)));
+
+    /* exp and log */
+
+    Quaternion<double> rotationLog = log(quarterZ);
+    assert(near(rotationLog, Quaternion<double>(0, 0, 0, M_PI / 4)));
+    assert(near(exp(rotationLog), quarterZ));
+    assert(near(exp(Quaternion<double>(0, 0, 0, 0)), identity));
+    assert(near(log(identity), Quaternion<double>(0, 0, 0, 0)));
+    Quaternion<double> general(0.3, -1.2, 0.4, 2.0);
+    assert(near(exp(log(general)), general));
+
+    /* Keyframe splines */
+
+    std::vector<double> times = {0.0, 1.0, 3.0};
+    std::vector<Quaternion<double>> keyframes = {identity, quarterZ, quarterZ * Quaternion<double>(h0(), h0(), 0, 0)};
+    QuaternionSpline<double> spline(times, keyframes);
+    assert((spline.segments() == 2) && (spline.startTime() == 0) && (spline.endTime() == 3));
+    assert(near(spline.at(0.5), halfway));
+    assert(near(spline.at(2.0), slerp(keyframes[1], keyframes[2], 0.5)));
+    assert(near(spline.at(-1.0), identity) && near(spline.at(10.0), keyframes[2]));
+
+    QuaternionBatch<double> samples = spline.sample(-0.25, 0.01, 400);
+    index_t sampleIndex;
+    for (sampleIndex = 0; sampleIndex < samples.size(); ++sampleIndex) {
+        assert(near(samples.at(sampleIndex), spline.at(-0.25 + sampleIndex * 0.01)));
+    }
+    QuaternionBatch<double> scattered = spline.sample(std::vector<double>({2.5, 0.1, 1.0}));
+    assert(near(scattered.at(0), spline.at(2.5)) && near(scattered.at(1), spline.at(0.1)) && near(scattered.at(2), quarterZ));
+
+    try {
+        QuaternionSpline<double> unordered({0.0, 0.0}, {identity, quarterZ});
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    /* Batches of quaternions, sized so the SIMD loop leaves a scalar remainder */
+
+    const index_t n = 37;
+    QuaternionBatch<double> a(n);
+    QuaternionBatch<double> b(n, Quaternion<double>(1, 0, 0, 0));
+    assert((a.size() == n) && (a.at(n - 1) == Quaternion<double>(0, 0, 0, 0)));
+    assert(b.at(3) == Quaternion<double>(1, 0, 0, 0));
+
+    index_t i;
+    for (i = 0; i < n; ++i) {
+        a.set(i, Quaternion<double>(1 + i, 0.5 * i, -0.25 * i, 2 - i));
+        b.set(i, Quaternion<double>(0.1 * i, 3 - i, 1, -0.5 * i));
+    }
+
+    /* The batch product matches the single quaternion product element by element */
+
+    QuaternionBatch<double> products = a * b;
+    for (i = 0; i < n; ++i) {
+        assert(near(products.at(i), a.at(i) * b.at(i)));
+    }
+
+    Quaternion<double> r(0.5, -1, 2, 0.25);
+    QuaternionBatch<double> right = a * r;
+    QuaternionBatch<double> left = r * a;
+    for (i = 0; i < n; ++i) {
+        assert(near(right.at(i), a.at(i) * r));
+        assert(near(left.at(i), r * a.at(i)));
+    }
+
+    QuaternionBatch<double> inPlace = a;
+    inPlace *= b;
+    for (i = 0; i < n; ++i) {
+        assert(near(inPlace.at(i), products.at(i)));
+    }
+
+    /* Conjugate and normalize */
+
+    QuaternionBatch<double> conjugates = a.conj();
+    assert(conjugates.at(5) == a.at(5).conj());
+
+    QuaternionBatch<double> units = a.normalized();
+    for (i = 0; i < n; ++i) {
+        assert(near(units.at(i).norm(), 1));
+    }
+
+    /* Rotating (1,0,0) by 90 degrees about z gives (0,1,0), about y gives (0,0,-1) */
+
+    const double h = std::sqrt(0.5);
+    QuaternionBatch<double> rotations(2);
+    rotations.set(0, Quaternion<double>(h, 0, 0, h));
+    rotations.set(1, Quaternion<double>(h, 0, h, 0));
+    Mat<double> vectors = {{1, 1}, {0, 0}, {0, 0}};
+    Mat<double> rotated = rotations.rotate(vectors);
+    assert(near(rotated.at(0,0), 0) && near(rotated.at(1,0), 1) && near(rotated.at(2,0), 0));
+    assert(near(rotated.at(0,1), 0) && near(rotated.at(1,1), 0) && near(rotated.at(2,1), -1));
+
+    /* Rotation agrees with q * v * conj(q) */
+
+    for (i = 0; i < n; ++i) {
+        double x = 1.0, y = -2.0 + i, z = 0.5;
+        double outX, outY, outZ;
+        QuaternionBatch<double> single(1, units.at(i));
+        single.rotate(&x, &y, &z, &outX, &outY, &outZ);
+        Quaternion<double> expected = units.at(i) * Quaternion<double>(0, x, y, z) * units.at(i).conj();
+        assert(near(outX, expected.i()) && near(outY, expected.j()) && near(outZ, expected.k()));
+    }
+
+    try {
+        QuaternionBatch<double> mismatched = a * QuaternionBatch<double>(n + 1);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    /* Float batches use the single precision kernel */
+
+    QuaternionBatch<float> f(n, Quaternion<float>(0, 1, 0, 0));
+    f *= f;
+    assert(f.at(n - 1) == Quaternion<float>(-1, 0, 0, 0));
+
+    /* Results assigned to batches created before an arena scope outlive it */
+
+    Arena workspace(1 << 16);
+    QuaternionBatch<double> assigned;
+    QuaternionBatch<double> resized(3);
+    {
+        arena::Scope scope(workspace);
+        assigned = a * b;
+        resized = a * b;
+    }
+    {
+        arena::Scope scope(workspace);
+        QuaternionBatch<double> scribble(4 * n);
+        assert(scribble.at(0) == Quaternion<double>(0, 0, 0, 0));
+    }
+    assert((assigned.size() == n) && (resized.size() == n));
+    for (i = 0; i < n; ++i) {
+        assert((assigned.at(i) == products.at(i)) && (resized.at(i) == products.at(i)));
+    }
+
+    return 0;
+}
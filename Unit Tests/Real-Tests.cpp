@@ -0,0 +1,79 @@
+#include <iostream>
+#include <cassert>
+#include <type_traits>
+#include "ORCAMath/ORCAMath.h"
+
+using namespace ORCA;
+
+typedef Real<double, Tolerance<1, 10>> Coarse;
+
+int main(int argc, const char * argv[]) {
+
+    /* Real has the layout of the type it wraps */
+
+    static_assert(std::is_trivially_copyable<Real<float>>::value, "Real<float> is trivially copyable");
+    static_assert(sizeof(Real<float>) == sizeof(float), "Real<float> has the size of float");
+    static_assert(std::is_same<_storage_t<Real<double>>, double>::value, "Real<double> is stored as double");
+
+    /* Operators are usable in constant expressions */
+
+    constexpr Real<double> two(2);
+    constexpr Real<double> sum = two + 1.5;
+    static_assert(sum.get() == 3.5, "constexpr addition");
+    static_assert((two * two - 1) / 3 == 1, "constexpr arithmetic");
+    static_assert(Real<double>(1.0000001) == 1, "equality within the default tolerance");
+
+    /* Comparisons */
+
+    Real<double> a(1.0);
+    Real<double> b(2.0);
+    assert((b > a) && !(a > b) && (2 > a) && !(a > 2));
+    assert((b >= a) && !(a >= b) && (a >= 1.0000001) && (1 >= a));
+    assert((a <= b) && !(b <= a) && (a <= 0.9999999));
+    assert((a != b) && !(a != 1.0000001) && (3 != b));
+    assert(abs(-b) == 2);
+    assert(sqrt(Real<double>(16)) == 4);
+
+    double raw = 1;
+    raw += b;
+    raw *= b;
+    assert(raw == 6);
+    a += 2;
+    a /= b;
+    assert(a == 1.5);
+
+    /* The tolerance is a compile time policy */
+
+    assert(Coarse(1.0) == Coarse(1.05));
+    assert(Coarse(1.0) != Coarse(1.2));
+    assert((Coarse(1.0) + 0.05) == Coarse(1.0));
+    assert(!(Real<double>(1.0) == Real<double>(1.05)));
+    static_assert(Coarse::tolerance() == 0.1, "policy tolerance");
+
+    /* Matrices of Real use the kernels of the wrapped type */
+
+    Mat<double> plain(40, 40);
+    index_t i, j;
+    for (i = 0; i < 40; ++i) {
+        for (j = 0; j < 40; ++j) {
+            plain.set(i, j, (i * 7 + j * 3) % 11 - 5.0);
+        }
+    }
+    Mat<Real<double>> wrapped(plain);
+    Mat<Real<double>> product = wrapped * wrapped;
+    Mat<double> expected = plain * plain;
+    const double* storage = reinterpret_cast<const double*>(product.data());
+    for (i = 0; i < 40; ++i) {
+        for (j = 0; j < 40; ++j) {
+            assert(storage[i * product.stride() + j] == expected.at(i, j));
+        }
+    }
+    assert((wrapped.t() * wrapped) == (plain.t() * plain));
+    assert((wrapped + wrapped) == (plain * 2.0));
+
+    Mat<Real<double>> small = {{1, 2}, {3, 4}};
+    assert((small * small) == Mat<double>({{7, 10}, {15, 22}}));
+    assert(small.det() == -2);
+
+    return 0;
+}
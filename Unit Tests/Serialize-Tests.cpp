@@ -0,0 +1,172 @@
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <cstdint>
+#include "ORCAMath/ORCAMath.h"
+
+using namespace ORCA;
+
+static const std::string path = "orca-serialize-test.orm";
+static const std::string logPath = "orca-serialize-log.orm";
+
+int main(int argc, const char * argv[]) {
+
+    Rng rng(2026);
+
+    /* Binary files give back exactly the same values */
+
+    Mat<double> random(7, 5, fill::rand, -1, 1, rng);
+    save(path, random);
+    assert(load<double>(path) == random);
+
+    Mat<double> tiny = {{0.1, 1.0 / 3.0}, {1e-300, -2.5e300}};
+    save(path, tiny);
+    assert(load<double>(path) == tiny);
+
+    Mat<float> floats(3, 4, fill::rand, rng);
+    save(path, floats);
+    assert(load<float>(path) == floats);
+
+    Mat<int> ints = {{1, -2, 3}, {4, 5, -6}};
+    save(path, ints);
+    assert(load<int>(path) == ints);
+
+    Mat<double, 3, 3> fixed(fill::eye);
+    save(path, fixed);
+    assert(load<double>(path) == Mat<double>({{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}));
+
+    /* Transposes and strided views are written by their elements */
+
+    save(path, random.t());
+    assert(load<double>(path) == Mat<double>(random.t()));
+
+    double columnMajor[6] = {1, 4, 2, 5, 3, 6};
+    save(path, MatView<double>(columnMajor, 2, 3, 1, 2));
+    assert(load<double>(path) == Mat<double>({{1, 2, 3}, {4, 5, 6}}));
+
+    /* Streaming a time series */
+
+    Mat<double> history(12, 6, fill::rand, -1, 1, rng);
+    {
+        MatWriter<double> writer(logPath, 1, 6);
+        index_t k;
+        for (k = 0; k < 8; ++k) {
+            writer.append(history.row(k));
+        }
+        assert(writer.count() == 8);
+        writer.flush();
+        writer.append(history.row(8).data());
+
+        /* Records after the last flush are not visible yet */
+
+        MappedMat<double> partial(logPath);
+        assert(partial.count() == 8);
+    }
+    {
+        MatWriter<double> writer(logPath);
+        assert((writer.count() == 9) && (writer.rows() == 1) && (writer.cols() == 6));
+        writer.append(history.row(9));
+        writer.append(history.row(10));
+        writer.append(history.row(11));
+    }
+
+    MappedMat<double> log(logPath);
+    assert((log.count() == 12) && (log.rows() == 1) && (log.cols() == 6));
+    index_t k;
+    for (k = 0; k < 12; ++k) {
+        assert(log[k] == history.row(k));
+        assert(reinterpret_cast<std::uintptr_t>(log.view(k).data()) % 64 == 0);
+    }
+    assert(log.series() == history);
+    assert(Mat<double>(log.series().t() * history) == Mat<double>(history.t() * history));
+
+    /* Mapped views read the file in place, writing to them leaves the file unchanged */
+
+    Mat<double> table(300, 200, fill::rand, -1, 1, rng);
+    save(path, table);
+    {
+        MappedMat<double> mapped(path);
+        MatView<double> view = mapped.view(0);
+        assert(view.isDense() && (view.stride() == 200));
+        assert(view == table);
+        assert(Mat<double>(view * table.t()) == Mat<double>(table * table.t()));
+        view.set(3, 4, 99);
+        assert(mapped.view(0).at(3, 4) == 99);
+
+        MappedMat<double> moved(std::move(mapped));
+        assert(view.at(3, 4) == 99);
+        assert(moved.count() == 1);
+    }
+    assert(load<double>(path) == table);
+
+    /* Errors */
+
+    try {
+        load<double>("orca-missing-file.orm");
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_FILE_ERROR);
+    }
+
+    try {
+        load<float>(path);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_FORMAT);
+    }
+
+    try {
+        load<double>(path, 1);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_OUT_OF_BOUNDS);
+    }
+
+    try {
+        log.view(12);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_OUT_OF_BOUNDS);
+    }
+
+    try {
+        MatWriter<double> writer(logPath);
+        writer.append(table);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    std::FILE* text = std::fopen(path.c_str(), "w");
+    std::fputs("1 2 3\n4 5 6\n", text);
+    std::fclose(text);
+
+    try {
+        MappedMat<double> mapped(path);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_FORMAT);
+    }
+
+    /* A file cut short is refused rather than read past its end */
+
+    save(logPath, history);
+    std::FILE* truncated = std::fopen(path.c_str(), "wb");
+    std::FILE* source = std::fopen(logPath.c_str(), "rb");
+    char bytes[256];
+    std::fwrite(bytes, 1, std::fread(bytes, 1, sizeof(bytes), source), truncated);
+    std::fclose(source);
+    std::fclose(truncated);
+
+    try {
+        load<double>(path);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_FORMAT);
+    }
+
+    std::remove(path.c_str());
+    std::remove(logPath.c_str());
+
+    return 0;
+}
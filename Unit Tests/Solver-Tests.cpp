@@ -0,0 +1,324 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include "ORCAMath/ORCAMath.h"
+
+using namespace ORCA;
+
+/**
+ * Returns true if every element of m1 is within tolerance of m2
+ */
+
+static bool near(Mat<double> m1, Mat<double> m2, double tolerance = 1e-10) {
+    if ((m1.rows() != m2.rows()) || (m1.cols() != m2.cols())) {
+        return false;
+    }
+    index_t i,j;
+    for (i = 0; i < m1.rows(); ++i) {
+        for (j = 0; j < m1.cols(); ++j) {
+            if (std::abs(m1.at(i, j) - m2.at(i, j)) > tolerance) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Returns the 5-point Laplacian of a side x side grid, plus convection along rows when nonsymmetric
+ */
+
+SparseMat<double> laplacian(index_t side, double convection = 0) {
+    std::vector<Triplet<double>> entries;
+    index_t i, j;
+    for (i = 0; i < side; ++i) {
+        for (j = 0; j < side; ++j) {
+            const index_t row = i * side + j;
+            entries.push_back({row, row, 4});
+            if (i > 0) entries.push_back({row, row - side, -1});
+            if (i + 1 < side) entries.push_back({row, row + side, -1});
+            if (j > 0) entries.push_back({row, row - 1, -1 - convection});
+            if (j + 1 < side) entries.push_back({row, row + 1, -1 + convection});
+        }
+    }
+    return SparseMat<double>(side * side, side * side, entries);
+}
+
+/**
+ * Returns a vector of n zeros
+ */
+
+ColVec<double> zeros(index_t n) {
+    ColVec<double> result(static_cast<int>(n));
+    index_t i;
+    for (i = 0; i < n; ++i) {
+        result.data()[i] = 0;
+    }
+    return result;
+}
+
+int main(int argc, const char * argv[]) {
+
+    /* LU factorization with partial pivoting */
+
+    Mat<double> a = {{0,2,1},{1,1,0},{3,0,1}};
+    LU<double> factors = a.lu();
+    assert(near(factors.P() * a, factors.L() * factors.U()));
+    assert(std::abs(factors.det() - (-5)) < 1e-12);
+    assert(std::abs(a.det() - (-5)) < 1e-12);
+
+    ColVec<double> b = {5,3,6};
+    ColVec<double> x = factors.solve(b);
+    assert(near(a * x, b));
+
+    Mat<double> rhs = {{1,0},{0,1},{2,3}};
+    assert(near(a * factors.solve(rhs), rhs));
+    assert(near(a * a.inv(), Mat<double>(3, 3, fill::eye)));
+
+    /* Small pivots are swapped out instead of only exact zeros */
+
+    Mat<double> tiny = {{1e-20,1},{1,1}};
+    ColVec<double> y = tiny.lu().solve(ColVec<double>({1,2}));
+    assert((std::abs(y.at(0) - 1) < 1e-12) && (std::abs(y.at(1) - 1) < 1e-12));
+
+    /* Singular matrices */
+
+    Mat<double> singular = {{1,2},{2,4}};
+    assert(singular.lu().isSingular());
+    assert(singular.det() == 0);
+    try {
+        singular.inv();
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_SINGULAR_MATRIX);
+    }
+
+    /* Cholesky and LDLt factorizations of a symmetric positive-definite matrix */
+
+    Mat<double> spd = {{4,2,0.4},{2,5,1},{0.4,1,3}};
+    Chol<double> cholesky = spd.chol();
+    assert(near(cholesky.L() * cholesky.L().t(), spd));
+    assert(near(spd * cholesky.solve(b), b));
+    assert(std::abs(cholesky.det() - spd.det()) < 1e-10);
+
+    LDLT<double> ldltFactors = spd.ldlt();
+    assert(near(spd * ldltFactors.solve(rhs), rhs));
+    assert(std::abs(ldltFactors.det() - spd.det()) < 1e-10);
+
+    /* Rank-1 update and downdate */
+
+    ColVec<double> u = {1,0.5,-1};
+    Mat<double> updated = spd + u * u.t();
+    cholesky.update(u);
+    assert(near(cholesky.L() * cholesky.L().t(), updated));
+    cholesky.downdate(u);
+    assert(near(cholesky.L() * cholesky.L().t(), spd));
+    ldltFactors.update(u);
+    assert(near(ldltFactors.inv(), updated.inv()));
+
+    /* Blocked factorization of a larger matrix */
+
+    index_t n = 150;
+    Mat<double> large(n, n);
+    index_t i,j;
+    for (i = 0; i < n; ++i) {
+        for (j = 0; j < n; ++j) {
+            large.set(i, j, (i == j) ? (n + 1.0) : (1.0 / (1 + i + j)));
+        }
+    }
+    Chol<double> largeFactors = large.chol();
+    assert(near(largeFactors.L() * largeFactors.L().t(), large, 1e-9));
+
+    LDLT<double> largeLdlt = large.ldlt();
+    Mat<double> scaledL = largeLdlt.L();
+    for (i = 0; i < n; ++i) {
+        for (j = 0; j < n; ++j) {
+            scaledL.set(i, j, scaledL.at(i, j) * largeLdlt.D().at(j));
+        }
+    }
+    assert(near(scaledL * largeLdlt.L().t(), large, 1e-9));
+    assert(largeLdlt.L().at(0, n - 1) == 0);
+
+    Mat<double> symmetricIndefinite = large;
+    symmetricIndefinite.set(n - 1, n - 1, -symmetricIndefinite.at(n - 1, n - 1));
+    Mat<double> inPlace = symmetricIndefinite;
+    ColVec<double> pivots(1);
+    ldltInPlace(inPlace, pivots);
+    assert((pivots.length() == n) && (pivots.at(n - 1) < 0));
+    LDLT<double> indefiniteFactors(symmetricIndefinite);
+    assert(near(inPlace, indefiniteFactors.L()) && near(pivots, indefiniteFactors.D()));
+    ColVec<double> ones(static_cast<int>(n));
+    for (i = 0; i < n; ++i) {
+        ones.set(i, 1);
+    }
+    assert(near(symmetricIndefinite * indefiniteFactors.solve(ones), ones, 1e-9));
+
+    Mat<float> largeFloat = large;
+    Chol<float> floatFactors = largeFloat.chol();
+    assert(near(Mat<double>(floatFactors.L() * floatFactors.L().t()), large, 1e-3));
+
+    Mat<double> indefinite = {{1,2},{2,1}};
+    try {
+        indefinite.chol();
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_NOT_POSITIVE_DEFINITE);
+    }
+    assert(std::abs(indefinite.ldlt().det() + 3) < 1e-12);
+
+    /* Iterative solvers on a sparse Poisson system */
+
+    Rng rng(2026);
+    const SparseMat<double> poisson = laplacian(20);
+    const index_t gridSize = poisson.rows();
+    ColVec<double> load(static_cast<int>(gridSize));
+    rng.uniform(load.data(), gridSize, -1.0, 1.0);
+    IterativeOptions<double> options;
+    options.tolerance = 1e-10;
+
+    ColVec<double> plain = zeros(gridSize);
+    IterativeResult<double> plainResult = cg(poisson, load, plain, options);
+    assert(plainResult.converged && (plainResult.residual <= 1e-10));
+    assert(near(poisson * plain, load, 1e-8));
+
+    ColVec<double> jacobi = zeros(gridSize);
+    assert(cg(poisson, load, jacobi, Jacobi<double>(poisson), options).converged);
+    assert(near(jacobi, plain, 1e-8));
+
+    IncompleteCholesky<double> ic(poisson);
+    assert(ic.nonZeros() == (poisson.nonZeros() + gridSize) / 2);
+    ColVec<double> preconditioned = zeros(gridSize);
+    IterativeResult<double> icResult = cg(poisson, load, preconditioned, ic, options);
+    assert(icResult.converged && (icResult.iterations < plainResult.iterations));
+    assert(near(preconditioned, plain, 1e-8));
+
+    /* Warm starts from the previous time step converge in a few iterations */
+
+    ColVec<double> nextLoad(load);
+    nextLoad.data()[7] += 1e-6;
+    ColVec<double> warm(plain);
+    IterativeResult<double> warmResult = cg(poisson, nextLoad, warm, ic, options);
+    assert(warmResult.converged && (warmResult.iterations < icResult.iterations / 2));
+
+    /* Matrix-free operators, writing into y or returning the product */
+
+    auto applyInPlace = [&](const ColVec<double>& in, ColVec<double>& out) {
+        poisson._multiply(in.data(), 1, 1, out.data(), 1);
+    };
+    auto applyReturning = [&](const ColVec<double>& in) {
+        return ColVec<double>(poisson * in);
+    };
+    ColVec<double> matrixFree = zeros(gridSize);
+    assert(cg(applyInPlace, load, matrixFree, ic, options).converged);
+    assert(near(matrixFree, plain, 1e-8));
+    matrixFree = zeros(gridSize);
+    assert(minres(applyReturning, load, matrixFree, options).converged);
+    assert(near(matrixFree, plain, 1e-8));
+
+    /* Dense matrices */
+
+    ColVec<double> denseLoad(static_cast<int>(n));
+    rng.uniform(denseLoad.data(), n, -1.0, 1.0);
+    ColVec<double> denseSolution = zeros(n);
+    assert(cg(large, denseLoad, denseSolution, Jacobi<double>(large), options).converged);
+    assert(near(denseSolution, largeFactors.solve(denseLoad), 1e-8));
+
+    /* Columns of matrices are strided views, solved through contiguous copies */
+
+    Mat<double> loads = {{1, 5}, {2, 3}, {3, -1}};
+    Mat<double> solutions(3, 3, fill::zeros);
+    VecView<double> cgColumn = solutions.col(0);
+    VecView<double> minresColumn = solutions.col(1);
+    VecView<double> gmresColumn = solutions.col(2);
+    const ColVec<double> exact = spd.chol().solve(ColVec<double>({5, 3, -1}));
+    assert(cg(spd, loads.col(1), cgColumn, options).converged);
+    assert(minres(spd, loads.col(1), minresColumn, Jacobi<double>(spd), options).converged);
+    assert(gmres(spd, loads.col(1), gmresColumn, options).converged);
+    assert(near(cgColumn, exact, 1e-8) && near(minresColumn, exact, 1e-8) && near(gmresColumn, exact, 1e-8));
+    assert(near(solutions.col(0), exact, 1e-8));
+
+    /* MINRES on a symmetric indefinite saddle point system */
+
+    Mat<double> saddle(5, 5, fill::zeros);
+    Mat<double> block = {{4,1,0},{1,3,1},{0,1,2}};
+    Mat<double> constraint = {{1,1,0},{0,1,-1}};
+    for (i = 0; i < 3; ++i) {
+        for (j = 0; j < 3; ++j) {
+            saddle.set(i, j, block.at(i, j));
+        }
+        for (j = 0; j < 2; ++j) {
+            saddle.set(3 + j, i, constraint.at(j, i));
+            saddle.set(i, 3 + j, constraint.at(j, i));
+        }
+    }
+    ColVec<double> saddleLoad = {1,2,3,4,5};
+    ColVec<double> saddleSolution = zeros(5);
+    IterativeResult<double> saddleResult = minres(saddle, saddleLoad, saddleSolution, options);
+    assert(saddleResult.converged);
+    assert(near(saddleSolution, saddle.lu().solve(saddleLoad), 1e-8));
+
+    try {
+        ColVec<double> attempt = zeros(5);
+        cg(saddle, saddleLoad, attempt, options);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_NOT_POSITIVE_DEFINITE);
+    }
+
+    ColVec<double> minresSolution = zeros(gridSize);
+    assert(minres(poisson, load, minresSolution, ic, options).converged);
+    assert(near(minresSolution, plain, 1e-8));
+
+    /* GMRES on a nonsymmetric convection-diffusion system, restarted */
+
+    const SparseMat<double> convection = laplacian(20, 0.4);
+    ColVec<double> gmresSolution = zeros(gridSize);
+    options.restart = 20;
+    IterativeResult<double> gmresResult = gmres(convection, load, gmresSolution, options);
+    assert(gmresResult.converged && (gmresResult.residual <= 1e-10));
+    assert(near(convection * gmresSolution, load, 1e-8));
+
+    ColVec<double> gmresJacobi = zeros(gridSize);
+    IterativeResult<double> gmresJacobiResult = gmres(convection, load, gmresJacobi, Jacobi<double>(convection), options);
+    assert(gmresJacobiResult.converged);
+    assert(near(gmresJacobi, gmresSolution, 1e-8));
+
+    ColVec<double> gmresDense = zeros(3);
+    assert(gmres(a, b, gmresDense, options).converged);
+    assert(near(gmresDense, x, 1e-8));
+
+    /* Stopping early, zero right hand sides and bad arguments */
+
+    IterativeOptions<double> few;
+    few.maxIterations = 3;
+    ColVec<double> unfinished = zeros(gridSize);
+    IterativeResult<double> unfinishedResult = cg(poisson, load, unfinished, few);
+    assert(!unfinishedResult.converged && (unfinishedResult.iterations == 3));
+
+    ColVec<double> nothing = zeros(gridSize);
+    nothing.data()[0] = 1;
+    assert(gmres(poisson, zeros(gridSize), nothing).converged);
+    assert(nothing.at(0) == 0);
+
+    try {
+        ColVec<double> wrong = zeros(3);
+        cg(poisson, load, wrong);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    try {
+        IncompleteCholesky<double> broken(saddle);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_NOT_POSITIVE_DEFINITE);
+    }
+
+    /* IC(0) of a tridiagonal matrix keeps every entry of the exact factor */
+
+    Mat<double> tridiagonal = {{4,1,0,0},{1,4,1,0},{0,1,4,1},{0,0,1,4}};
+    assert(near(IncompleteCholesky<double>(tridiagonal).L().dense(), tridiagonal.chol().L(), 1e-12));
+
+    return 0;
+}
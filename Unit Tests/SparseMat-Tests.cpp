@@ -0,0 +1,119 @@
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <vector>
+#include "ORCAMath/ORCAMath.h"
+
+using namespace ORCA;
+
+static bool near(double a, double b) {
+    return std::abs(a - b) < 1e-12;
+}
+
+static bool near(const Mat<double>& a, const Mat<double>& b) {
+    if ((a.rows() != b.rows()) || (a.cols() != b.cols())) {
+        return false;
+    }
+    index_t row, col;
+    for (row = 0; row < a.rows(); ++row) {
+        for (col = 0; col < a.cols(); ++col) {
+            if (!near(a.at(row, col), b.at(row, col))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(int argc, const char * argv[]) {
+
+    /* Construction from unordered triplets, duplicates are summed */
+
+    SparseMat<double> a(3, 4, {{2, 3, 5.0}, {0, 1, 1.0}, {1, 0, -2.0}, {0, 1, 2.0}, {2, 0, 4.0}});
+    assert(a.rows() == 3 && a.cols() == 4);
+    assert(a.nonZeros() == 4);
+    assert(a.at(0, 1) == 3.0);
+    assert(a.at(1, 0) == -2.0);
+    assert(a.at(2, 0) == 4.0 && a.at(2, 3) == 5.0);
+    assert(a.at(1, 1) == 0.0);
+    assert(a.rowStart()[3] == 4);
+
+    /* Dense round trip */
+
+    Mat<double> full = a.dense();
+    assert(full.at(2, 3) == 5.0 && full.at(1, 2) == 0.0);
+    SparseMat<double> back(full);
+    assert(back.nonZeros() == a.nonZeros());
+    assert(near(dense(back), full));
+    assert(near(a.t().dense(), Mat<double>(full.t())));
+
+    /* Sparse-dense products agree with dense products */
+
+    Mat<double> b = {{1, 2}, {3, 4}, {5, 6}, {7, 8}};
+    assert(near(a * b, full * b));
+    ColVec<double> x = {1, -1, 2, 0.5};
+    assert(near(a * x, full * x));
+    assert(near(a * Mat<double>(b.t()).t(), full * b));
+
+    /* Transposed products never form the transpose */
+
+    Mat<double> c = {{1, 0, 2}, {-1, 3, 1}};
+    assert(near(a.t() * c.t(), Mat<double>(full.t()) * c.t()));
+    ColVec<double> y = {2, -1, 0.5};
+    assert(near(a.t() * y, Mat<double>(full.t()) * y));
+    assert(near(c * a, c * full));
+
+    /* Large products split rows across threads */
+
+    const index_t n = 300;
+    std::vector<Triplet<double>> entries;
+    index_t i;
+    for (i = 0; i < n; ++i) {
+        entries.push_back({i, i, 2.0});
+        entries.push_back({i, (i * 7 + 3) % n, -1.0});
+    }
+    SparseMat<double> large(n, n, entries);
+    Mat<double> largeDense = large.dense();
+    Mat<double> block(n, 3);
+    for (i = 0; i < n; ++i) {
+        block.set(i, 0, 1.0);
+        block.set(i, 1, static_cast<double>(i));
+        block.set(i, 2, 1.0 / (i + 1));
+    }
+    assert(near(large * block, largeDense * block));
+    assert(near(large.t() * block, Mat<double>(largeDense.t()) * block));
+    assert(near(Mat<double>(block.t()) * large, Mat<double>(block.t()) * largeDense));
+
+    /* Error handling */
+
+    try {
+        SparseMat<double> outside(2, 2, {{2, 0, 1.0}});
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_OUT_OF_BOUNDS);
+    }
+
+    try {
+        a.at(3, 0);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_OUT_OF_BOUNDS);
+    }
+
+    try {
+        Mat<double> mismatched = a * c;
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    try {
+        ColVec<double> mismatched = a.t() * x;
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    return 0;
+}
@@ -0,0 +1,204 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <vector>
+#include "ORCAMath/ORCAMath.h"
+
+using namespace ORCA;
+
+template <index_t R, index_t C>
+static bool near(const Mat<double, R, C>& a, const Mat<double, R, C>& b) {
+    index_t i;
+    for (i = 0; i < R * C; ++i) {
+        if (std::abs(a.data()[i] - b.data()[i]) > 1e-12) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static ColVec<double, 3> randomVec(Rng& rng) {
+    ColVec<double, 3> result;
+    rng.uniform(result.data(), 3, -1.0, 1.0);
+    return result;
+}
+
+static Quaternion<double> randomOrientation(Rng& rng) {
+    double q[4];
+    rng.uniform(q, 4, -1.0, 1.0);
+    const double norm = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    return Quaternion<double>(q[0] / norm, q[1] / norm, q[2] / norm, q[3] / norm);
+}
+
+/* A serial chain of revolute joints about z, used to check the articulated-body algorithm
+ * against inverse dynamics */
+
+struct Chain {
+    std::vector<SpatialTransform<double>> tree;
+    std::vector<SpatialInertia<double>> bodies;
+};
+
+static const SpatialMotion<double> axis(0, 0, 1, 0, 0, 0);
+static const SpatialMotion<double> gravity(0, 0, 0, 0, 0, -9.81);
+
+static std::vector<double> inverseDynamics(const Chain& chain, const std::vector<double>& q,
+                                           const std::vector<double>& qd, const std::vector<double>& qdd) {
+    const size_t n = q.size();
+    std::vector<SpatialTransform<double>> up(n);
+    std::vector<SpatialForce<double>> forces(n);
+    std::vector<double> tau(n);
+    SpatialMotion<double> v, a = -gravity;
+    size_t i;
+    for (i = 0; i < n; ++i) {
+        up[i] = SpatialTransform<double>::rotZ(q[i]) * chain.tree[i];
+        const SpatialMotion<double> vJ = axis * qd[i];
+        v = up[i] * v + vJ;
+        a = up[i] * a + axis * qdd[i] + v.cross(vJ);
+        forces[i] = chain.bodies[i] * a + v.cross(chain.bodies[i] * v);
+    }
+    for (i = n; i-- > 0;) {
+        tau[i] = dot(axis, forces[i]);
+        if (i > 0) {
+            forces[i - 1] += up[i].applyInverse(forces[i]);
+        }
+    }
+    return tau;
+}
+
+static std::vector<double> forwardDynamics(const Chain& chain, const std::vector<double>& q,
+                                           const std::vector<double>& qd, const std::vector<double>& tau) {
+    const size_t n = q.size();
+    std::vector<SpatialTransform<double>> up(n);
+    std::vector<SpatialMotion<double>> bias(n);
+    std::vector<Mat<double, 6, 6>> articulated(n);
+    std::vector<SpatialForce<double>> biasForces(n);
+    std::vector<SpatialForce<double>> u(n);
+    std::vector<double> d(n), torque(n), qdd(n);
+    SpatialMotion<double> v;
+    size_t i;
+    for (i = 0; i < n; ++i) {
+        up[i] = SpatialTransform<double>::rotZ(q[i]) * chain.tree[i];
+        const SpatialMotion<double> vJ = axis * qd[i];
+        v = up[i] * v + vJ;
+        bias[i] = v.cross(vJ);
+        articulated[i] = chain.bodies[i].toMat();
+        biasForces[i] = v.cross(chain.bodies[i] * v);
+    }
+    for (i = n; i-- > 0;) {
+        u[i] = articulated[i] * axis;
+        d[i] = dot(axis, u[i]);
+        torque[i] = tau[i] - dot(axis, biasForces[i]);
+        if (i > 0) {
+            const Mat<double, 6, 6> projected = articulated[i] - (u[i].toVec() * u[i].toVec().t()) * (1 / d[i]);
+            const SpatialForce<double> pa = biasForces[i] + projected * bias[i] + u[i] * (torque[i] / d[i]);
+            articulated[i - 1] += up[i].applyInverse(projected);
+            biasForces[i - 1] += up[i].applyInverse(pa);
+        }
+    }
+    SpatialMotion<double> a = -gravity;
+    for (i = 0; i < n; ++i) {
+        a = up[i] * a + bias[i];
+        qdd[i] = (torque[i] - dot(u[i], a)) / d[i];
+        a += axis * qdd[i];
+    }
+    return qdd;
+}
+
+int main(int argc, const char * argv[]) {
+
+    Rng rng(2026);
+
+    const SpatialTransform<double> x(randomOrientation(rng), randomVec(rng));
+    const SpatialTransform<double> y(randomOrientation(rng), randomVec(rng));
+    const SpatialMotion<double> m(randomVec(rng), randomVec(rng));
+    const SpatialMotion<double> w(randomVec(rng), randomVec(rng));
+    const SpatialForce<double> f(randomVec(rng), randomVec(rng));
+
+    /* Construction and element access */
+
+    SpatialMotion<double> zero;
+    assert((zero.toVec() == ColVec<double, 6>(fill::zeros)));
+    SpatialForce<double> coordinates(1, 2, 3, 4, 5, 6);
+    assert((coordinates.at(0) == 1) && (coordinates.at(5) == 6) && (coordinates.linear().at(1) == 5));
+    coordinates.set(4, 7);
+    assert(SpatialForce<double>(coordinates.toVec()) == coordinates);
+    assert(coordinates.linear().at(1) == 7);
+    assert((2.0 * coordinates - coordinates) == coordinates);
+
+    try {
+        coordinates.at(6);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_OUT_OF_BOUNDS);
+    }
+
+    /* Transforms match their 6x6 matrices */
+
+    const Mat<double, 3, 3> rotation = randomOrientation(rng).toRotationMatrix();
+    assert(near(SpatialTransform<double>(fromRotationMatrix(rotation), ColVec<double, 3>(fill::zeros)).rotation(), rotation.t()));
+    assert(near(x.toForceMat(), x.toMat().inv().t()));
+    assert(near(x.apply(m).toVec(), x.toMat() * m.toVec()));
+    assert(near(x.apply(f).toVec(), x.toForceMat() * f.toVec()));
+    assert(near(x.applyInverse(m).toVec(), x.toMat().inv() * m.toVec()));
+    assert(near(x.applyInverse(f).toVec(), x.toMat().t() * f.toVec()));
+    assert(near(x.inverse().toMat(), x.toMat().inv()));
+    assert(near((x * y).toMat(), x.toMat() * y.toMat()));
+    assert(near((x * x.inverse()).toMat(), Mat<double, 6, 6>(fill::eye)));
+    assert(std::abs(dot(x * m, x * f) - dot(m, f)) < 1e-12);
+
+    const SpatialTransform<double> rotated = SpatialTransform<double>::rotX(0.3) * SpatialTransform<double>::fromTranslation(ColVec<double, 3>({1, 2, 3}));
+    assert(near(rotated.apply(SpatialMotion<double>(1, 0, 0, 0, 0, 0)).linear(), ColVec<double, 3>({0, 2 * std::sin(0.3) - 3 * std::cos(0.3), 3 * std::sin(0.3) + 2 * std::cos(0.3)})));
+    assert(near(SpatialTransform<double>::rotZ(0.7).rotation(), SpatialTransform<double>(Quaternion<double>(std::cos(0.35), 0, 0, std::sin(0.35)), ColVec<double, 3>(fill::zeros)).rotation()));
+
+    /* Cross products match their 6x6 matrices */
+
+    assert(near(m.cross(w).toVec(), m.crossMat() * w.toVec()));
+    assert(near(cross(m, f).toVec(), m.crossForceMat() * f.toVec()));
+    assert(near(m.crossForceMat(), -m.crossMat().t()));
+    assert(near(m.cross(m).toVec(), ColVec<double, 6>(fill::zeros)));
+
+    /* Inertias match their 6x6 matrices */
+
+    const Mat<double, 3, 3> central({{0.3, 0.01, -0.02}, {0.01, 0.25, 0.03}, {-0.02, 0.03, 0.2}});
+    const ColVec<double, 3> center({0.1, -0.2, 0.4});
+    const SpatialInertia<double> body(2.5, center, central);
+    const Mat<double, 3, 3> c = _spatialSkew(center);
+    const Mat<double, 3, 3> origin = central + c * c.t() * 2.5;
+    assert(near(body.inertia(), origin));
+    assert(near(body.centerOfMass(), center));
+    assert(near(body.toMat(), _spatialBlocks(origin, c * 2.5, c.t() * 2.5, Mat<double, 3, 3>(fill::eye) * 2.5)));
+    assert(near((body * m).toVec(), body.toMat() * m.toVec()));
+    assert(near(x.apply(body).toMat(), x.toForceMat() * body.toMat() * x.toMat().inv()));
+    assert(near(x.applyInverse(body).toMat(), x.toMat().t() * body.toMat() * x.toMat()));
+    assert(near((body + x.apply(body)).toMat(), body.toMat() + x.apply(body).toMat()));
+
+    const Mat<double, 6, 6> articulated = body.toMat() + x.apply(body).toMat();
+    assert(near(x.applyInverse(articulated), x.toMat().t() * articulated * x.toMat()));
+    assert(near(x.apply(articulated), x.toForceMat() * articulated * x.toMat().inv()));
+    assert(near((articulated * m).toVec(), articulated * m.toVec()));
+
+    /* Forward dynamics inverts inverse dynamics */
+
+    const size_t joints = 7;
+    Chain chain;
+    std::vector<double> q(joints), qd(joints), tau(joints);
+    size_t i;
+    for (i = 0; i < joints; ++i) {
+        chain.tree.push_back(SpatialTransform<double>(randomOrientation(rng), randomVec(rng)));
+        chain.bodies.push_back(SpatialInertia<double>(1 + i * 0.25, randomVec(rng) * 0.2, central));
+    }
+    rng.uniform(q.data(), joints, -3.0, 3.0);
+    rng.uniform(qd.data(), joints, -1.0, 1.0);
+    rng.uniform(tau.data(), joints, -5.0, 5.0);
+    std::vector<double> qdd = forwardDynamics(chain, q, qd, tau);
+    std::vector<double> recovered = inverseDynamics(chain, q, qd, qdd);
+    for (i = 0; i < joints; ++i) {
+        assert(std::abs(recovered[i] - tau[i]) < 1e-9);
+    }
+
+    /* Printing */
+
+    std::cout << m << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include "ORCAMath/ORCAMath.h"
+
+using namespace ORCA;
+
+static bool near(double a, double b) {
+    return std::abs(a - b) < 1e-9;
+}
+
+static bool near(const Mat<double>& a, const Mat<double>& b) {
+    if ((a.rows() != b.rows()) || (a.cols() != b.cols())) {
+        return false;
+    }
+    index_t row, col;
+    for (row = 0; row < a.rows(); ++row) {
+        for (col = 0; col < a.cols(); ++col) {
+            if (!near(a.at(row, col), b.at(row, col))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(int argc, const char * argv[]) {
+
+    const index_t n = 6;
+    Mat<double> b(n, 3);
+    Mat<double> left(2, n);
+    ColVec<double> x(static_cast<int>(n));
+    Mat<double> general(n, n);
+    index_t i, j;
+    for (i = 0; i < n; ++i) {
+        b.set(i, 0, 1.0 + i);
+        b.set(i, 1, -0.5 * i);
+        b.set(i, 2, 1.0 / (i + 1));
+        left.set(0, i, 2.0 - i);
+        left.set(1, i, 0.25 * i * i);
+        x.set(i, 3.0 - i);
+        for (j = 0; j < n; ++j) {
+            general.set(i, j, 1.0 / (i + j + 1) + ((i == j) ? 4.0 : 0.0) + 0.1 * (i - j));
+        }
+    }
+    Mat<double> eyeN(n, n, fill::eye);
+
+    /* Diagonal matrices */
+
+    DiagMat<double> d = {2, -1, 0.5, 4, 3, -2};
+    Mat<double> dDense = d.dense();
+    assert(d.at(2, 2) == 0.5 && d.at(2, 3) == 0.0);
+    assert(near(d * b, dDense * b));
+    assert(near(d * x, dDense * x));
+    assert(near(left * d, left * dDense));
+    assert(near((d * d.inv()).dense(), eyeN));
+    assert(near(det(d), dDense.det()));
+    assert(near(d.trace(), dDense.trace()));
+    assert(near(DiagMat<double>(general.diag()).at(3, 3), general.at(3, 3)));
+
+    /* Triangular matrices */
+
+    TriMat<double> upper(general, triangle::upper);
+    TriMat<double> lower(general, triangle::lower);
+    Mat<double> upperDense = upper.dense();
+    Mat<double> lowerDense = lower.dense();
+    assert(upper.at(4, 1) == 0.0 && upper.at(1, 4) == general.at(1, 4));
+    assert(lower.at(1, 4) == 0.0 && lower.at(4, 1) == general.at(4, 1));
+    assert(near(upper * b, upperDense * b));
+    assert(near(lower * x, lowerDense * x));
+    assert(near(left * upper, left * upperDense));
+    assert(near(left * lower, left * lowerDense));
+    assert(near(upper.t().dense(), Mat<double>(upperDense.t())));
+    assert(upper.t().isLower());
+    assert(near(det(upper), upperDense.det()));
+    assert(near(lower.det(), lowerDense.det()));
+    assert(near(upper.inv() * upperDense, eyeN));
+    assert(near(lower.inv() * lowerDense, eyeN));
+    assert(inv(lower).isLower());
+    assert(near(upperDense * upper.solve(b), b));
+    assert(near(lowerDense * lower.solve(x), x));
+
+    try {
+        upper.set(3, 1, 1.0);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_OUT_OF_BOUNDS);
+    }
+
+    try {
+        TriMat<double>(n, triangle::lower).inv();
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_SINGULAR_MATRIX);
+    }
+
+    /* Symmetric matrices */
+
+    Mat<double> symmetricDense = general + Mat<double>(general.t());
+    SymMat<double> s(symmetricDense);
+    assert(s.at(1, 4) == s.at(4, 1));
+    assert(near(s.dense(), symmetricDense));
+    assert(near(s * b, symmetricDense * b));
+    assert(near(s * x, symmetricDense * x));
+    assert(near(left * s, left * symmetricDense));
+    assert(near(det(s), symmetricDense.det()));
+    assert(near(s.inv() * symmetricDense, eyeN));
+    assert(near(symmetricDense * s.solve(x), x));
+    s.set(5, 0, 7.0);
+    assert(s.at(0, 5) == 7.0);
+
+    /* Banded matrices */
+
+    BandMat<double> band(general, 1, 2);
+    Mat<double> bandDense = band.dense();
+    assert(band.at(3, 2) == general.at(3, 2) && band.at(3, 1) == 0.0);
+    assert(band.at(2, 4) == general.at(2, 4) && band.at(2, 5) == 0.0);
+    assert(near(band * b, bandDense * b));
+    assert(near(band * x, bandDense * x));
+    assert(near(left * band, left * bandDense));
+    assert(near(det(band), bandDense.det()));
+    assert(near(bandDense * band.solve(b), b));
+    assert(near(inv(band) * bandDense, eyeN));
+
+    /* Row swaps are needed when the diagonal is small */
+
+    BandMat<double> pivoted(4, 1, 1);
+    pivoted.set(0, 0, 1e-3);
+    pivoted.set(0, 1, 1.0);
+    for (i = 1; i < 4; ++i) {
+        pivoted.set(i, i - 1, 2.0);
+        pivoted.set(i, i, 0.5);
+        if (i < 3) {
+            pivoted.set(i, i + 1, -1.0);
+        }
+    }
+    assert(near(pivoted.det(), pivoted.dense().det()));
+    ColVec<double> rhs = {1, 2, 3, 4};
+    assert(near(pivoted.dense() * pivoted.solve(rhs), rhs));
+
+    try {
+        BandMat<double> tooWide(3, 3, 0);
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    try {
+        Mat<double> mismatched = band * left;
+        assert(false);
+    } catch (ORCAExcept::ORCAException exception) {
+        assert(exception == ORCA_BAD_DIMENSIONS);
+    }
+
+    return 0;
+}